@@ -1,4 +1,4 @@
-QT += core gui xml
+QT += core gui network xml
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -69,7 +69,8 @@ win32: CONFIG(debug, debug|release): LIBS += \
 unix: LIBS += \
     -L/lib \
     -L/usr/lib \
-    -L/usr/local/lib
+    -L/usr/local/lib \
+    -lrt
 
 ################################################################################
 
@@ -77,11 +78,13 @@ HEADERS += \
     $$PWD/src/defs.h \
     $$PWD/src/Aircraft.h \
     $$PWD/src/AircraftData.h \
+    $$PWD/src/AircraftDataFields.h \
     $$PWD/src/DataFile.h
 
 SOURCES += \
     $$PWD/src/main.cpp \
     $$PWD/src/Aircraft.cpp \
+    $$PWD/src/AircraftDataFields.cpp \
     $$PWD/src/DataFile.cpp
 
 RESOURCES += \
@@ -89,6 +92,18 @@ RESOURCES += \
 
 ################################################################################
 
+include($$PWD/src/cache/cache.pri)
+include($$PWD/src/cli/cli.pri)
 include($$PWD/src/components/components.pri)
+include($$PWD/src/diff/diff.pri)
+include($$PWD/src/estimation/estimation.pri)
+include($$PWD/src/export/export.pri)
+include($$PWD/src/fleet/fleet.pri)
 include($$PWD/src/gui/gui.pri)
+include($$PWD/src/history/history.pri)
+include($$PWD/src/import/import.pri)
+include($$PWD/src/journal/journal.pri)
+include($$PWD/src/service/service.pri)
+include($$PWD/src/snapshot/snapshot.pri)
 include($$PWD/src/utils/utils.pri)
+include($$PWD/src/variants/variants.pri)
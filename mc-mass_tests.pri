@@ -2,15 +2,89 @@ HEADERS += \
     $$PWD/tests/ExampleData.h
 
 SOURCES += \
-    $$PWD/tests/ExampleData.cpp
+    $$PWD/tests/ExampleData.cpp \
+    $$PWD/tests/TestAircraftDataFields.cpp
 
 ################################################################################
 
 SOURCES += \
-    $$PWD/tests/components/TestAllElse.cpp
+    $$PWD/tests/cache/TestResultCache.cpp
 
 ################################################################################
 
 SOURCES += \
+    $$PWD/tests/components/TestAllElse.cpp \
+    $$PWD/tests/components/TestAssembly.cpp \
+    $$PWD/tests/components/TestComponent.cpp \
+    $$PWD/tests/components/TestEstimatedMass.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/diff/TestAircraftDiff.cpp \
+    $$PWD/tests/diff/TestAircraftMerge.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/estimation/TestEstimationEnsemble.cpp \
+    $$PWD/tests/estimation/TestEstimationKernel.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/export/TestArrowWriter.cpp \
+    $$PWD/tests/export/TestCsvWriter.cpp \
+    $$PWD/tests/export/TestJsonLinesWriter.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/fleet/TestFleetDatabase.cpp \
+    $$PWD/tests/fleet/TestFleetGenerator.cpp \
+    $$PWD/tests/fleet/TestFleetPipeline.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/history/TestTimeHistory.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/import/TestPointMassImporter.cpp \
+    $$PWD/tests/import/TestSimModelImporter.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/journal/TestEditJournal.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/service/TestFolderWatcher.cpp \
+    $$PWD/tests/service/TestMassService.cpp \
+    $$PWD/tests/service/TestSharedMemoryPublisher.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/snapshot/TestAircraftSnapshot.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/utils/TestBoundedQueue.cpp \
+    $$PWD/tests/utils/TestHashUtils.cpp \
+    $$PWD/tests/utils/TestInertiaTensor.cpp \
+    $$PWD/tests/utils/TestMassKernels.cpp \
     $$PWD/tests/utils/TestMatrix3x3.cpp \
+    $$PWD/tests/utils/TestPowerLaw.cpp \
+    $$PWD/tests/utils/TestThreadPool.cpp \
     $$PWD/tests/utils/TestVector3.cpp
+
+################################################################################
+
+SOURCES += \
+    $$PWD/tests/variants/TestVariantSet.cpp
@@ -1,5 +1,5 @@
 QT -= gui
-QT += xml
+QT += network xml
 
 TEMPLATE = app
 
@@ -45,11 +45,14 @@ win32: LIBS += \
 unix: LIBS += \
     -L/lib \
     -L/usr/lib \
-    -L/usr/local/lib
+    -L/usr/local/lib \
+    -lrt
 
 ################################################################################
 
 LIBS += \
+    -lmcutilMath \
+    -lmcutilMisc \
     -lgcov --coverage \
     -lgtest \
     -lgtest_main \
@@ -57,6 +60,31 @@ LIBS += \
 
 ################################################################################
 
+HEADERS += \
+    $$PWD/src/defs.h \
+    $$PWD/src/Aircraft.h \
+    $$PWD/src/AircraftData.h \
+    $$PWD/src/AircraftDataFields.h \
+    $$PWD/src/DataFile.h
+
+SOURCES += \
+    $$PWD/src/Aircraft.cpp \
+    $$PWD/src/AircraftDataFields.cpp \
+    $$PWD/src/DataFile.cpp
+
+################################################################################
+
+include($$PWD/src/cache/cache.pri)
 include($$PWD/src/components/components.pri)
+include($$PWD/src/diff/diff.pri)
+include($$PWD/src/estimation/estimation.pri)
+include($$PWD/src/export/export.pri)
+include($$PWD/src/fleet/fleet.pri)
+include($$PWD/src/history/history.pri)
+include($$PWD/src/import/import.pri)
+include($$PWD/src/journal/journal.pri)
+include($$PWD/src/service/service.pri)
+include($$PWD/src/snapshot/snapshot.pri)
 include($$PWD/src/utils/utils.pri)
+include($$PWD/src/variants/variants.pri)
 include($$PWD/mc-mass_tests.pri)
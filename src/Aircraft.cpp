@@ -19,22 +19,23 @@
 
 #include <Aircraft.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
+#include <unordered_map>
 
-#include <components/AllElse.h>
-#include <components/Engine.h>
-#include <components/Fuselage.h>
-#include <components/GearMain.h>
-#include <components/GearNose.h>
-#include <components/RotorDrive.h>
-#include <components/RotorHub.h>
-#include <components/RotorMain.h>
-#include <components/RotorTail.h>
-#include <components/TailHor.h>
-#include <components/TailVer.h>
-#include <components/Wing.h>
+#include <QDir>
+#include <QJsonArray>
 
+#include <AircraftDataFields.h>
+
+#include <components/ComponentFactory.h>
+
+#include <import/PointMassImporter.h>
+
+#include <utils/MassKernels.h>
+#include <utils/MassSums.h>
+#include <utils/ThreadPool.h>
 #include <utils/XmlUtils.h>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -44,7 +45,8 @@ namespace mc
 
 ////////////////////////////////////////////////////////////////////////////////
 
-Aircraft::Aircraft()
+Aircraft::Aircraft() :
+    _pointMassesVersion ( 0 )
 {
     reset();
 }
@@ -58,7 +60,7 @@ Aircraft::~Aircraft()
 
 ////////////////////////////////////////////////////////////////////////////////
 
-bool Aircraft::read( QDomElement *parentNode )
+bool Aircraft::read( QDomElement *parentNode, const QString &dirName )
 {
     if ( !parentNode->isNull() )
     {
@@ -74,6 +76,9 @@ bool Aircraft::read( QDomElement *parentNode )
             case AircraftData::Helicopter      : _data.type = AircraftData::Helicopter      ; break;
         }
 
+        // whole data is replaced
+        _data.touchAll();
+
         QDomElement dataNode = parentNode->firstChildElement( "data" );
         QDomElement componentsNode = parentNode->firstChildElement( "components" );
 
@@ -84,6 +89,22 @@ bool Aircraft::read( QDomElement *parentNode )
             if ( result ) result = readData( &dataNode );
             if ( result ) result = readComponents( &componentsNode );
 
+            QDomElement assembliesNode = parentNode->firstChildElement( "assemblies" );
+
+            if ( result && !assembliesNode.isNull() )
+            {
+                result = readAssemblies( &assembliesNode, &_assembly );
+            }
+
+            QDomElement pointMassesNode = parentNode->firstChildElement( "point_masses" );
+
+            if ( result && !pointMassesNode.isNull() )
+            {
+                // path is kept absolute, so it does not depend on the working directory
+                QString fileName = QDir( dirName ).absoluteFilePath( pointMassesNode.attributeNode( "file" ).value() );
+                result = importPointMasses( fileName.toLocal8Bit().data() );
+            }
+
             if ( result ) update();
 
             return result;
@@ -95,7 +116,7 @@ bool Aircraft::read( QDomElement *parentNode )
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void Aircraft::save( QDomDocument *doc, QDomElement *parentNode )
+void Aircraft::save( QDomDocument *doc, QDomElement *parentNode, const QString &dirName )
 {
     QDomAttr nodeType = doc->createAttribute( "type" );
     nodeType.setValue( QString::number( _data.type ) );
@@ -153,6 +174,34 @@ void Aircraft::save( QDomDocument *doc, QDomElement *parentNode )
     {
         (*it)->save( doc, &componentsNode );
     }
+
+    // assemblies, components not listed belong to the root assembly
+    if ( !_assembly.getAssemblies().empty() )
+    {
+        QDomElement assembliesNode = doc->createElement( "assemblies" );
+        parentNode->appendChild( assembliesNode );
+
+        std::unordered_map< const Component*, int > indices;
+
+        for ( int i = 0; i < static_cast< int >( _components.size() ); ++i )
+        {
+            indices[ _components[ i ] ] = i;
+        }
+
+        saveAssemblies( doc, &assembliesNode, &_assembly, indices );
+    }
+
+    // point masses are kept in their own file, path relative to the aircraft
+    // file lets both files be moved together
+    if ( _pointMassesFile.length() > 0 )
+    {
+        QDomElement pointMassesNode = doc->createElement( "point_masses" );
+        parentNode->appendChild( pointMassesNode );
+
+        QDomAttr nodeFile = doc->createAttribute( "file" );
+        nodeFile.setValue( QDir( dirName ).relativeFilePath( QString::fromLocal8Bit( _pointMassesFile.c_str() ) ) );
+        pointMassesNode.setAttributeNode( nodeFile );
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -263,26 +312,115 @@ void Aircraft::reset()
 
     _massTotal = 0.0;
 
+    _data.touchAll();
+
     deleteAllComponents();
+
+    _pointMasses.clear();
+    _pointMassesFile.clear();
+    _pointMassesVersion++;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 void Aircraft::update()
 {
-    double m = 0.0;
-    Vector3 s;
-    Matrix3x3 i;
+    // chunk size and threshold do not depend on number of threads, chunks
+    // sums are combined in order, so results are bitwise reproducible
+    const int chunkSize = 4096;
+    const int parallelThreshold = 16 * chunkSize;
 
-    for ( Components::iterator it = _components.begin(); it != _components.end(); ++it )
+    // components chunks first, then point masses chunks
+    const int componentsCount  = static_cast< int >( _components.size() );
+    const int pointsCount      = static_cast< int >( _pointMasses.getCount() );
+    const int componentsChunks = ( componentsCount + chunkSize - 1 ) / chunkSize;
+    const int pointsChunks     = ( pointsCount     + chunkSize - 1 ) / chunkSize;
+    const int chunks = componentsChunks + pointsChunks;
+
+    std::vector< MassSums > sums( chunks );
+
+    auto sumChunk = [ this, &sums, componentsCount, pointsCount, componentsChunks ]( int chunk )
+    {
+        if ( chunk < componentsChunks )
+        {
+            const int first = chunk * chunkSize;
+            const int last  = std::min( componentsCount, first + chunkSize );
+
+            // chunk is summed on a single thread, so buffer is reused
+            // instead of being allocated on every update
+            thread_local MassKernels::Cuboids cuboids;
+            cuboids.clear();
+
+            for ( int j = first; j < last; ++j )
+            {
+                const Component *c = _components[ j ];
+
+                cuboids.add( c->getMass(), c->getLength(), c->getWidth(), c->getHeight(),
+                             c->getPosition() );
+            }
+
+            MassKernels::sum( cuboids.getArrays(), 0, cuboids.getCount(), &sums[ chunk ] );
+        }
+        else
+        {
+            const int first = ( chunk - componentsChunks ) * chunkSize;
+            const int last  = std::min( pointsCount, first + chunkSize );
+
+            _pointMasses.addTo( &sums[ chunk ], first, last );
+        }
+    };
+
+    if ( componentsCount + pointsCount < parallelThreshold )
     {
-        m += (*it)->getMass();
-        s += (*it)->getMass() * (*it)->getPosition();
-        i += (*it)->getInertia();
+        for ( int chunk = 0; chunk < chunks; ++chunk ) sumChunk( chunk );
     }
+    else
+    {
+        ThreadPool::getInstance()->run( chunks, sumChunk );
+    }
+
+    MassSums total;
+
+    for ( int chunk = 0; chunk < componentsChunks; ++chunk )
+    {
+        total.add( sums[ chunk ] );
+    }
+
+    _pointMassesSums = MassSums();
+
+    for ( int chunk = componentsChunks; chunk < chunks; ++chunk )
+    {
+        _pointMassesSums.add( sums[ chunk ] );
+    }
+
+    total.add( _pointMassesSums );
+
+    double m = total.getMass();
 
-    _centerOfMass = ( m > 0.0 ) ? ( s / m ) : Vector3();
-    _inertiaMatrix = i;
+    _centerOfMass = ( m > 0.0 ) ? ( total.getFirstMoment() / m ) : Vector3();
+    _inertiaMatrix = total.getInertia().getMatrix();
+    _massTotal = m;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Aircraft::refresh()
+{
+    _assembly.update();
+
+    // root assembly origin is the reference point
+    MassSums total;
+
+    double m_a = _assembly.getMass();
+    Vector3 s_a = _assembly.getFirstMoment();
+
+    total.add( m_a, ( m_a > 0.0 ) ? ( s_a / m_a ) : Vector3(), _assembly.getInertia() );
+    total.add( _pointMassesSums );
+
+    double m = total.getMass();
+
+    _centerOfMass = ( m > 0.0 ) ? ( total.getFirstMoment() / m ) : Vector3();
+    _inertiaMatrix = total.getInertia().getMatrix();
     _massTotal = m;
 }
 
@@ -305,6 +443,22 @@ Component* Aircraft::getComponent( int index )
 void Aircraft::addComponent( Component *component )
 {
     _components.push_back( component );
+    _assembly.addComponent( component );
+    update();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Aircraft::addComponents( const Components &components )
+{
+    _components.reserve( _components.size() + components.size() );
+
+    for ( Components::const_iterator it = components.begin(); it != components.end(); ++it )
+    {
+        _components.push_back( *it );
+        _assembly.addComponent( *it );
+    }
+
     update();
 }
 
@@ -325,9 +479,89 @@ void Aircraft::delComponent( int index )
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void Aircraft::delComponents( const std::set< int > &indices )
+{
+    Components::iterator last = _components.begin();
+
+    for ( int i = 0; i < static_cast< int >( _components.size() ); ++i )
+    {
+        if ( indices.count( i ) > 0 )
+        {
+            DELPTR( _components[ i ] );
+        }
+        else
+        {
+            *last++ = _components[ i ];
+        }
+    }
+
+    _components.erase( last, _components.end() );
+
+    update();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool Aircraft::importPointMasses( const char *fileName )
+{
+    _pointMasses.clear();
+    _pointMassesFile.clear();
+
+    bool result = PointMassImporter::import( fileName, &_pointMasses );
+
+    if ( result )
+        _pointMassesFile = fileName;
+    else
+        _pointMasses.clear();
+
+    _pointMassesVersion++;
+
+    update();
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Aircraft::clearPointMasses()
+{
+    _pointMasses.clear();
+    _pointMassesFile.clear();
+    _pointMassesVersion++;
+
+    update();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Aircraft::setPointMasses( const PointMasses &points, const char *fileName )
+{
+    _pointMasses = points;
+    _pointMassesFile = fileName;
+    _pointMassesVersion++;
+
+    update();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void Aircraft::setData( const AircraftData &data )
 {
+    // versions of this aircraft data are kept, they must never decrease
+    uint64_t versions[ AircraftData::FieldsCount ];
+    std::copy( _data.versions, _data.versions + AircraftData::FieldsCount, versions );
+
+    for ( int i = 0; i < AircraftData::FieldsCount; ++i )
+    {
+        if ( AircraftDataFields::getValue( _data, i ) != AircraftDataFields::getValue( data, i ) )
+        {
+            versions[ i ]++;
+        }
+    }
+
     _data = data;
+
+    std::copy( versions, versions + AircraftData::FieldsCount, _data.versions );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -382,16 +616,66 @@ std::string Aircraft::toString() const
 
 ////////////////////////////////////////////////////////////////////////////////
 
+QJsonObject Aircraft::toJson() const
+{
+    QJsonObject result;
+
+    result[ "type"       ] = static_cast< int >( _data.type );
+    result[ "mass_empty" ] = _massTotal;
+
+    QJsonArray cm;
+    cm.append( _centerOfMass.x() );
+    cm.append( _centerOfMass.y() );
+    cm.append( _centerOfMass.z() );
+    result[ "center_of_mass" ] = cm;
+
+    QJsonArray inertia;
+    inertia.append( _inertiaMatrix.xx() );
+    inertia.append( _inertiaMatrix.xy() );
+    inertia.append( _inertiaMatrix.xz() );
+    inertia.append( _inertiaMatrix.yx() );
+    inertia.append( _inertiaMatrix.yy() );
+    inertia.append( _inertiaMatrix.yz() );
+    inertia.append( _inertiaMatrix.zx() );
+    inertia.append( _inertiaMatrix.zy() );
+    inertia.append( _inertiaMatrix.zz() );
+    result[ "inertia" ] = inertia;
+
+    result[ "point_masses" ] = static_cast< double >( _pointMasses.getCount() );
+
+    QJsonArray components;
+
+    for ( Components::const_iterator it = _components.begin(); it != _components.end(); ++it )
+    {
+        QJsonObject component;
+
+        component[ "type"     ] = (*it)->getXmlTagName();
+        component[ "name"     ] = (*it)->getName();
+        component[ "mass"     ] = (*it)->getMass();
+        component[ "mass_est" ] = (*it)->getEstimatedMass();
+
+        components.append( component );
+    }
+
+    result[ "components" ] = components;
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void Aircraft::deleteAllComponents()
 {
-    Components::iterator it = _components.begin();
+    // detaches all components at once
+    _assembly.clear();
 
-    while ( it != _components.end() )
+    for ( Components::iterator it = _components.begin(); it != _components.end(); ++it )
     {
         DELPTR( *it );
-        it = _components.erase( it );
     }
 
+    _components.clear();
+
     update();
 }
 
@@ -804,61 +1088,14 @@ bool Aircraft::readComponents( QDomElement *componentsNode )
 
     while ( !nodeComponent.isNull() )
     {
-        Component *temp = nullptr;
-
-        if      ( nodeComponent.tagName() == AllElse::xmlTagName )
-        {
-            temp = new AllElse( &_data );
-        }
-        else if ( nodeComponent.tagName() == Engine::xmlTagName )
-        {
-            temp = new Engine( &_data );
-        }
-        else if ( nodeComponent.tagName() == Fuselage::xmlTagName )
-        {
-            temp = new Fuselage( &_data );
-        }
-        else if ( nodeComponent.tagName() == GearMain::xmlTagName )
-        {
-            temp = new GearMain( &_data );
-        }
-        else if ( nodeComponent.tagName() == GearNose::xmlTagName )
-        {
-            temp = new GearNose( &_data );
-        }
-        else if ( nodeComponent.tagName() == RotorDrive::xmlTagName )
-        {
-            temp = new RotorDrive( &_data );
-        }
-        else if ( nodeComponent.tagName() == RotorHub::xmlTagName )
-        {
-            temp = new RotorHub( &_data );
-        }
-        else if ( nodeComponent.tagName() == RotorMain::xmlTagName )
-        {
-            temp = new RotorMain( &_data );
-        }
-        else if ( nodeComponent.tagName() == RotorTail::xmlTagName )
-        {
-            temp = new RotorTail( &_data );
-        }
-        else if ( nodeComponent.tagName() == TailHor::xmlTagName )
-        {
-            temp = new TailHor( &_data );
-        }
-        else if ( nodeComponent.tagName() == TailVer::xmlTagName )
-        {
-            temp = new TailVer( &_data );
-        }
-        else if ( nodeComponent.tagName() == Wing::xmlTagName )
-        {
-            temp = new Wing( &_data );
-        }
+        Component *temp = ComponentFactory::create( nodeComponent.tagName().toStdString().c_str(),
+                                                    &_data );
 
         if ( temp )
         {
             temp->read( &nodeComponent );
             _components.push_back( temp );
+            _assembly.addComponent( temp );
         }
 
         nodeComponent = nodeComponent.nextSiblingElement();
@@ -869,6 +1106,47 @@ bool Aircraft::readComponents( QDomElement *componentsNode )
 
 ////////////////////////////////////////////////////////////////////////////////
 
+bool Aircraft::readAssemblies( QDomElement *parentNode, Assembly *assembly )
+{
+    QDomElement nodeAssembly = parentNode->firstChildElement( "assembly" );
+
+    while ( !nodeAssembly.isNull() )
+    {
+        QDomElement nodeX = nodeAssembly.firstChildElement( "pos_x" );
+        QDomElement nodeY = nodeAssembly.firstChildElement( "pos_y" );
+        QDomElement nodeZ = nodeAssembly.firstChildElement( "pos_z" );
+
+        Vector3 origin( nodeX.text().toDouble(),
+                        nodeY.text().toDouble(),
+                        nodeZ.text().toDouble() );
+
+        std::string name = nodeAssembly.attributeNode( "name" ).value().toStdString();
+
+        Assembly *child = assembly->addAssembly( name.c_str(), origin );
+
+        QDomElement nodeComponent = nodeAssembly.firstChildElement( "component" );
+
+        while ( !nodeComponent.isNull() )
+        {
+            int index = nodeComponent.attributeNode( "index" ).value().toInt();
+
+            if ( index < 0 || index >= static_cast< int >( _components.size() ) ) return false;
+
+            child->addComponent( _components[ index ] );
+
+            nodeComponent = nodeComponent.nextSiblingElement( "component" );
+        }
+
+        if ( !readAssemblies( &nodeAssembly, child ) ) return false;
+
+        nodeAssembly = nodeAssembly.nextSiblingElement( "assembly" );
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void Aircraft::saveDataGeneral( QDomDocument *doc, QDomElement *parentNode )
 {
     XmlUtils::saveTextNode( doc, parentNode, "m_empty"     , _data.general.m_empty    );
@@ -1003,4 +1281,37 @@ void Aircraft::saveDataRotors( QDomDocument *doc, QDomElement *parentNode )
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void Aircraft::saveAssemblies( QDomDocument *doc, QDomElement *parentNode,
+                               const Assembly *assembly,
+                               const std::unordered_map< const Component*, int > &indices )
+{
+    for ( const Assembly *child : assembly->getAssemblies() )
+    {
+        QDomElement nodeAssembly = doc->createElement( "assembly" );
+        parentNode->appendChild( nodeAssembly );
+
+        QDomAttr nodeName = doc->createAttribute( "name" );
+        nodeName.setValue( child->getName() );
+        nodeAssembly.setAttributeNode( nodeName );
+
+        XmlUtils::saveTextNode( doc, &nodeAssembly, "pos_x", child->getOrigin().x() );
+        XmlUtils::saveTextNode( doc, &nodeAssembly, "pos_y", child->getOrigin().y() );
+        XmlUtils::saveTextNode( doc, &nodeAssembly, "pos_z", child->getOrigin().z() );
+
+        for ( const Component *component : child->getComponents() )
+        {
+            QDomElement nodeComponent = doc->createElement( "component" );
+            nodeAssembly.appendChild( nodeComponent );
+
+            QDomAttr nodeIndex = doc->createAttribute( "index" );
+            nodeIndex.setValue( QString::number( indices.at( component ) ) );
+            nodeComponent.setAttributeNode( nodeIndex );
+        }
+
+        saveAssemblies( doc, &nodeAssembly, child, indices );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 } // namespace mc
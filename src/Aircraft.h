@@ -21,10 +21,14 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QJsonObject>
 
 #include <mcutil/math/Matrix3x3.h>
 #include <mcutil/math/Vector3.h>
@@ -32,7 +36,11 @@
 #include <defs.h>
 #include <AircraftData.h>
 
+#include <components/Assembly.h>
 #include <components/Component.h>
+#include <components/PointMasses.h>
+
+#include <utils/MassSums.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -55,16 +63,20 @@ public:
     /**
      * @brief read
      * @param parentNode
+     * @param dirName aircraft file directory, relative point masses file
+     * path is resolved against it (current directory if empty)
      * @return returns true on success and false on failure
      */
-    bool read( QDomElement *parentNode );
+    bool read( QDomElement *parentNode, const QString &dirName = QString() );
 
     /**
      * Saves aircraft data.
      * @param doc
      * @param parentNode
+     * @param dirName aircraft file directory, point masses file path is
+     * saved relative to it (current directory if empty)
      */
-    void save( QDomDocument *doc, QDomElement *parentNode );
+    void save( QDomDocument *doc, QDomElement *parentNode, const QString &dirName = QString() );
 
     /**
      * @brief Resets aircraft data. Removes all components.
@@ -76,12 +88,58 @@ public:
      */
     void update();
 
+    /**
+     * @brief Updates output data re-aggregating only assemblies invalidated
+     * since the last update, e.g. after a single component was edited.
+     * Results equal those of update() up to rounding.
+     */
+    void refresh();
+
+    inline       Assembly* getAssembly()       { return &_assembly; }
+    inline const Assembly* getAssembly() const { return &_assembly; }
+
     inline const Components& getComponents() const { return _components; }
 
     Component* getComponent( int index );
     void addComponent( Component *component );
+
+    /**
+     * @brief Adds components to the root assembly and updates output data once.
+     * @param components components to be added
+     */
+    void addComponents( const Components &components );
     void delComponent( int index );
 
+    /**
+     * @brief Deletes components and updates output data once.
+     * @param indices indices of components to be deleted
+     */
+    void delComponents( const std::set< int > &indices );
+
+    inline const PointMasses& getPointMasses() const { return _pointMasses; }
+
+    inline const std::string& getPointMassesFile() const { return _pointMassesFile; }
+
+    /**
+     * @brief Imports CAD/FEM point masses, replaces previously imported ones.
+     * @param fileName point masses file name (CSV or binary)
+     * @return returns true on success and false on failure
+     */
+    bool importPointMasses( const char *fileName );
+
+    /** @brief Removes all point masses. */
+    void clearPointMasses();
+
+    /**
+     * @brief Sets point masses, replaces previous ones.
+     * @param points point masses
+     * @param fileName point masses file name
+     */
+    void setPointMasses( const PointMasses &points, const char *fileName );
+
+    /** @brief Returns number of point masses changes, it never decreases. */
+    inline uint64_t getPointMassesVersion() const { return _pointMassesVersion; }
+
     inline Vector3   getCenterOfMass  () const { return _centerOfMass;  }
     inline Matrix3x3 getInertiaMatrix () const { return _inertiaMatrix; }
     inline double    getMassTotal     () const { return _massTotal;     }
@@ -94,11 +152,23 @@ public:
     /** */
     std::string toString() const;
 
+    /**
+     * @brief Returns results (total mass, cg position, inertia and components
+     * masses) as JSON object.
+     */
+    QJsonObject toJson() const;
+
 private:
 
     AircraftData _data;         ///< aircraft data
 
     Components _components;     ///< mass components
+    Assembly _assembly;         ///< root assembly
+
+    PointMasses _pointMasses;       ///< CAD/FEM point masses
+    std::string _pointMassesFile;   ///< CAD/FEM point masses file name
+    uint64_t _pointMassesVersion;   ///< CAD/FEM point masses version
+    MassSums _pointMassesSums;      ///< CAD/FEM point masses sums
 
     Vector3   _centerOfMass;    ///< [m] center of mass position
     Matrix3x3 _inertiaMatrix;   ///< [kg*m^2] inertia
@@ -119,6 +189,7 @@ private:
     bool readDataRotors      ( QDomElement *parentNode );
 
     bool readComponents( QDomElement *componentsNode );
+    bool readAssemblies( QDomElement *parentNode, Assembly *assembly );
 
     void saveDataGeneral     ( QDomDocument *doc, QDomElement *parentNode );
     void saveDataFuselage    ( QDomDocument *doc, QDomElement *parentNode );
@@ -128,6 +199,10 @@ private:
     void saveDataLandingGear ( QDomDocument *doc, QDomElement *parentNode );
     void saveDataEngine      ( QDomDocument *doc, QDomElement *parentNode );
     void saveDataRotors      ( QDomDocument *doc, QDomElement *parentNode );
+
+    void saveAssemblies( QDomDocument *doc, QDomElement *parentNode,
+                         const Assembly *assembly,
+                         const std::unordered_map< const Component*, int > &indices );
 };
 
 } // namespace mc
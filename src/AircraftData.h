@@ -21,14 +21,25 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
+
+////////////////////////////////////////////////////////////////////////////////
+
 namespace mc
 {
 
 /**
  * @brief The AircraftData struct.
+ *
+ * Every field has its version, which has to be incremented with touch()
+ * whenever the field is changed, so cached values derived from the data can
+ * be recomputed only when any of the fields they depend on has changed.
+ * Fields are indexed as in AircraftDataFields.
  */
 struct AircraftData
 {
+    static constexpr int FieldsCount = 78;      ///< number of fields, see AircraftDataFields
+
     /**
      * @brief The aircraft type enum.
      */
@@ -207,6 +218,22 @@ struct AircraftData
     Engine         engine;          ///< engine data
     Rotors         rotors;          ///< helicopter rotors data
 
+    uint64_t versions[ FieldsCount ] = {};      ///< fields versions
+
+    /**
+     * @brief Marks field as changed.
+     * @param index field index
+     */
+    inline void touch( int index )
+    {
+        ++versions[ index ];
+    }
+
+    /** @brief Marks all fields as changed. */
+    inline void touchAll()
+    {
+        for ( int i = 0; i < FieldsCount; ++i ) ++versions[ i ];
+    }
 };
 
 } // namespace mc
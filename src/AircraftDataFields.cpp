@@ -0,0 +1,309 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <AircraftDataFields.h>
+
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////
+
+#define FIELD_DOUBLE( member ) \
+{ \
+    #member, offsetof( AircraftData, member ), AircraftDataFields::Double, 0, \
+    []( const AircraftData &d ) -> double { return d.member; }, \
+    []( AircraftData &d, double v ) { d.member = v; } \
+}
+
+#define FIELD_INT( member ) \
+{ \
+    #member, offsetof( AircraftData, member ), AircraftDataFields::Int, 0, \
+    []( const AircraftData &d ) -> double { return d.member; }, \
+    []( AircraftData &d, double v ) { d.member = static_cast< int >( v ); } \
+}
+
+#define FIELD_BOOL( member ) \
+{ \
+    #member, offsetof( AircraftData, member ), AircraftDataFields::Bool, 0, \
+    []( const AircraftData &d ) -> double { return d.member ? 1.0 : 0.0; }, \
+    []( AircraftData &d, double v ) { d.member = ( v != 0.0 ); } \
+}
+
+#define FIELD_ENUM( member, count ) \
+{ \
+    #member, offsetof( AircraftData, member ), AircraftDataFields::Enum, count, \
+    []( const AircraftData &d ) -> double { return static_cast< int >( d.member ); }, \
+    []( AircraftData &d, double v ) { d.member = static_cast< decltype( d.member ) >( static_cast< int >( v ) ); } \
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+static const AircraftDataFields::Field fields[] =
+{
+    FIELD_ENUM( type, AircraftData::Helicopter + 1 ),
+
+    // general
+    FIELD_DOUBLE ( general.m_empty    ),
+    FIELD_DOUBLE ( general.mtow       ),
+    FIELD_DOUBLE ( general.m_maxLand  ),
+    FIELD_DOUBLE ( general.nz_max     ),
+    FIELD_DOUBLE ( general.nz_maxLand ),
+    FIELD_DOUBLE ( general.v_stall    ),
+    FIELD_DOUBLE ( general.h_cruise   ),
+    FIELD_DOUBLE ( general.v_cruise   ),
+    FIELD_DOUBLE ( general.mach_max   ),
+    FIELD_BOOL   ( general.navy_ac    ),
+
+    // fuselage
+    FIELD_ENUM   ( fuselage.cargo_door, AircraftData::Fuselage::TwoSideAndAftDoor + 1 ),
+    FIELD_DOUBLE ( fuselage.l                    ),
+    FIELD_DOUBLE ( fuselage.h                    ),
+    FIELD_DOUBLE ( fuselage.w                    ),
+    FIELD_DOUBLE ( fuselage.l_n                  ),
+    FIELD_DOUBLE ( fuselage.wetted_area          ),
+    FIELD_DOUBLE ( fuselage.press_vol            ),
+    FIELD_BOOL   ( fuselage.landing_gear         ),
+    FIELD_BOOL   ( fuselage.cargo_ramp           ),
+    FIELD_BOOL   ( fuselage.wetted_area_override ),
+
+    // wing
+    FIELD_DOUBLE ( wing.area      ),
+    FIELD_DOUBLE ( wing.area_exp  ),
+    FIELD_DOUBLE ( wing.span      ),
+    FIELD_DOUBLE ( wing.sweep     ),
+    FIELD_DOUBLE ( wing.c_tip     ),
+    FIELD_DOUBLE ( wing.c_root    ),
+    FIELD_DOUBLE ( wing.ar        ),
+    FIELD_DOUBLE ( wing.tr        ),
+    FIELD_DOUBLE ( wing.t_c       ),
+    FIELD_DOUBLE ( wing.fuel      ),
+    FIELD_DOUBLE ( wing.ctrl_area ),
+    FIELD_BOOL   ( wing.delta     ),
+    FIELD_BOOL   ( wing.var_sweep ),
+
+    // horizontal tail
+    FIELD_DOUBLE ( hor_tail.area      ),
+    FIELD_DOUBLE ( hor_tail.span      ),
+    FIELD_DOUBLE ( hor_tail.sweep     ),
+    FIELD_DOUBLE ( hor_tail.c_tip     ),
+    FIELD_DOUBLE ( hor_tail.c_root    ),
+    FIELD_DOUBLE ( hor_tail.t_c       ),
+    FIELD_DOUBLE ( hor_tail.elev_area ),
+    FIELD_DOUBLE ( hor_tail.w_f       ),
+    FIELD_DOUBLE ( hor_tail.arm       ),
+    FIELD_DOUBLE ( hor_tail.ar        ),
+    FIELD_DOUBLE ( hor_tail.tr        ),
+    FIELD_BOOL   ( hor_tail.moving    ),
+    FIELD_BOOL   ( hor_tail.rolling   ),
+
+    // vertical tail
+    FIELD_DOUBLE ( ver_tail.area      ),
+    FIELD_DOUBLE ( ver_tail.height    ),
+    FIELD_DOUBLE ( ver_tail.sweep     ),
+    FIELD_DOUBLE ( ver_tail.c_tip     ),
+    FIELD_DOUBLE ( ver_tail.c_root    ),
+    FIELD_DOUBLE ( ver_tail.t_c       ),
+    FIELD_DOUBLE ( ver_tail.arm       ),
+    FIELD_DOUBLE ( ver_tail.rudd_area ),
+    FIELD_DOUBLE ( ver_tail.ar        ),
+    FIELD_DOUBLE ( ver_tail.tr        ),
+    FIELD_BOOL   ( ver_tail.t_tail    ),
+    FIELD_BOOL   ( ver_tail.rotor     ),
+
+    // landing gear
+    FIELD_DOUBLE ( landing_gear.main_l      ),
+    FIELD_DOUBLE ( landing_gear.nose_l      ),
+    FIELD_INT    ( landing_gear.main_wheels ),
+    FIELD_INT    ( landing_gear.main_struts ),
+    FIELD_INT    ( landing_gear.nose_wheels ),
+    FIELD_BOOL   ( landing_gear.fixed       ),
+    FIELD_BOOL   ( landing_gear.cross       ),
+    FIELD_BOOL   ( landing_gear.tripod      ),
+    FIELD_BOOL   ( landing_gear.main_kneel  ),
+    FIELD_BOOL   ( landing_gear.nose_kneel  ),
+
+    // engine
+    FIELD_DOUBLE ( engine.mass ),
+
+    // rotors
+    FIELD_DOUBLE ( rotors.main_r          ),
+    FIELD_DOUBLE ( rotors.main_cb         ),
+    FIELD_DOUBLE ( rotors.main_rpm        ),
+    FIELD_DOUBLE ( rotors.main_gear_ratio ),
+    FIELD_DOUBLE ( rotors.tail_r          ),
+    FIELD_DOUBLE ( rotors.mcp             ),
+    FIELD_DOUBLE ( rotors.main_tip_vel    ),
+    FIELD_INT    ( rotors.main_blades     )
+};
+
+static_assert( sizeof( fields ) / sizeof( fields[ 0 ] ) == AircraftData::FieldsCount,
+               "AircraftData::FieldsCount does not match the fields table" );
+
+////////////////////////////////////////////////////////////////////////////////
+
+int AircraftDataFields::getCount()
+{
+    return static_cast< int >( sizeof( fields ) / sizeof( fields[ 0 ] ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const AircraftDataFields::Field& AircraftDataFields::getField( int index )
+{
+    return fields[ index ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int AircraftDataFields::getIndex( const char *name )
+{
+    for ( int i = 0; i < getCount(); ++i )
+    {
+        if ( 0 == strcmp( fields[ i ].name, name ) )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int AircraftDataFields::getIndex( const AircraftData &data, const void *member )
+{
+    size_t offset = static_cast< const char* >( member ) - reinterpret_cast< const char* >( &data );
+
+    for ( int i = 0; i < getCount(); ++i )
+    {
+        if ( fields[ i ].offset == offset )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::vector< int > AircraftDataFields::getIndices( std::initializer_list< const char* > names )
+{
+    std::vector< int > indices;
+
+    for ( const char *name : names )
+    {
+        size_t length = strlen( name );
+
+        const size_t count = indices.size();
+
+        if ( length > 1 && name[ length - 1 ] == '*' )
+        {
+            // all fields of the section, prefix includes the dot
+            for ( int i = 0; i < getCount(); ++i )
+            {
+                if ( 0 == strncmp( fields[ i ].name, name, length - 1 ) )
+                {
+                    indices.push_back( i );
+                }
+            }
+        }
+        else
+        {
+            int index = getIndex( name );
+
+            if ( index >= 0 ) indices.push_back( index );
+        }
+
+        // unknown name is a programming error, dependencies would be
+        // silently incomplete and cached values would never be recomputed
+        if ( indices.size() == count )
+        {
+            fprintf( stderr, "Unknown aircraft data field: %s\n", name );
+            abort();
+        }
+    }
+
+    return indices;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void AircraftDataFields::touch( AircraftData *data, const void *member )
+{
+    int index = getIndex( *data, member );
+
+    if ( index >= 0 ) data->touch( index );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double AircraftDataFields::getValue( const AircraftData &data, int index )
+{
+    return fields[ index ].get( data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool AircraftDataFields::setValue( AircraftData &data, int index, double value )
+{
+    if ( index < 0 || index >= getCount() || !std::isfinite( value ) )
+    {
+        return false;
+    }
+
+    const Field &field = fields[ index ];
+
+    if ( field.kind != Double && value != floor( value ) )
+    {
+        return false;
+    }
+
+    if ( field.kind == Enum && ( value < 0.0 || value >= field.enumCount ) )
+    {
+        return false;
+    }
+
+    // integer fields are counts (wheels, struts, blades)
+    if ( field.kind == Int && ( value < 0.0 || value > INT_MAX ) )
+    {
+        return false;
+    }
+
+    if ( field.get( data ) != value )
+    {
+        field.set( data, value );
+        data.touch( index );
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
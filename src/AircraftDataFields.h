@@ -0,0 +1,141 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef AIRCRAFTDATAFIELDS_H_
+#define AIRCRAFTDATAFIELDS_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+#include <AircraftData.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The AircraftData fields table class.
+ *
+ * Provides access to all AircraftData fields by index or by name, where
+ * the name is the member path, e.g. "wing.area" or "general.mtow".
+ * Every field value is exchanged as double, which represents integers,
+ * booleans and enums exactly.
+ */
+class AircraftDataFields
+{
+public:
+
+    /**
+     * @brief The field kind enum.
+     */
+    enum Kind
+    {
+        Double = 0,                 ///< double field
+        Int,                        ///< integer field
+        Bool,                       ///< boolean field
+        Enum                        ///< enum field
+    };
+
+    typedef double (*Getter)( const AircraftData &data );
+    typedef void   (*Setter)( AircraftData &data, double value );
+
+    /**
+     * @brief The field descriptor struct.
+     */
+    struct Field
+    {
+        const char *name;           ///< field name (member path)
+        size_t offset;              ///< field offset within AircraftData
+        Kind kind;                  ///< field kind
+        int enumCount;              ///< number of enum values (enum fields only)
+        Getter get;                 ///< field getter
+        Setter set;                 ///< field setter
+    };
+
+    /**
+     * @brief Returns number of fields.
+     * @return number of fields
+     */
+    static int getCount();
+
+    /**
+     * @brief Returns field descriptor.
+     * @param index field index
+     * @return field descriptor
+     */
+    static const Field& getField( int index );
+
+    /**
+     * @brief Returns field index.
+     * @param name field name
+     * @return field index or -1 if there is no such field
+     */
+    static int getIndex( const char *name );
+
+    /**
+     * @brief Returns field index.
+     * @param data aircraft data
+     * @param member pointer to the field of the aircraft data
+     * @return field index or -1 if there is no such field
+     */
+    static int getIndex( const AircraftData &data, const void *member );
+
+    /**
+     * @brief Returns indices of fields given by names, name "section.*"
+     * stands for all fields of the section. Aborts if any of the names
+     * does not match any field.
+     * @param names fields names
+     * @return fields indices
+     */
+    static std::vector< int > getIndices( std::initializer_list< const char* > names );
+
+    /**
+     * @brief Marks field as changed.
+     * @param data aircraft data
+     * @param member pointer to the field of the aircraft data
+     */
+    static void touch( AircraftData *data, const void *member );
+
+    /**
+     * @brief Returns field value.
+     * @param data aircraft data
+     * @param index field index
+     * @return field value
+     */
+    static double getValue( const AircraftData &data, int index );
+
+    /**
+     * @brief Sets field value and marks the field as changed if value
+     * is different.
+     * @param data aircraft data
+     * @param index field index
+     * @param value field value
+     * @return returns true on success and false if value is not valid for the field
+     */
+    static bool setValue( AircraftData &data, int index, double value );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // AIRCRAFTDATAFIELDS_H_
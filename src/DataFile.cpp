@@ -78,26 +78,39 @@ bool DataFile::readFile( const char *fileName )
 
     if ( devFile.open( QFile::ReadOnly | QFile::Text ) )
     {
-        QDomDocument doc;
+        status = readData( devFile.readAll(), QFileInfo( fileName ).absolutePath() );
 
-        doc.setContent( &devFile, false );
+        devFile.close();
+    }
+
+    return status;
+}
 
-        QDomElement rootNode = doc.documentElement();
+////////////////////////////////////////////////////////////////////////////////
 
-        if ( rootNode.tagName() == "mscsim_mass" )
-        {
-            QDomElement nodeAircraft = rootNode.firstChildElement( "aircraft" );
+bool DataFile::readData( const QByteArray &content, const QString &dirName )
+{
+    bool status = false;
 
-            if ( !nodeAircraft.isNull() )
+    newEmpty();
+
+    QDomDocument doc;
+
+    doc.setContent( content, false );
+
+    QDomElement rootNode = doc.documentElement();
+
+    if ( rootNode.tagName() == "mscsim_mass" )
+    {
+        QDomElement nodeAircraft = rootNode.firstChildElement( "aircraft" );
+
+        if ( !nodeAircraft.isNull() )
+        {
+            if ( _aircraft.read( &nodeAircraft, dirName ) )
             {
-                if ( _aircraft.read( &nodeAircraft ) )
-                {
-                    status = true;
-                }
+                status = true;
             }
         }
-
-        devFile.close();
     }
 
     return status;
@@ -133,7 +146,7 @@ bool DataFile::saveFile( const char *fileName )
         QDomElement nodeAircraft = doc.createElement( "aircraft" );
         rootNode.appendChild( nodeAircraft );
 
-        _aircraft.save( &doc, &nodeAircraft );
+        _aircraft.save( &doc, &nodeAircraft, QFileInfo( fileTemp ).absolutePath() );
 
         out << doc.toString();
 
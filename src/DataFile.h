@@ -65,6 +65,16 @@ public:
     /** */
     bool readFile( const char *fileName );
 
+    /**
+     * @brief Reads aircraft from the file content already loaded to memory,
+     * so reading files and parsing them can be done by different threads.
+     * @param content aircraft file content
+     * @param dirName aircraft file directory, relative paths of the files
+     * referenced by the content are resolved against it
+     * @return returns true on success and false on failure
+     */
+    bool readData( const QByteArray &content, const QString &dirName = QString() );
+
     /** */
     bool saveFile( const char *fileName );
 
@@ -0,0 +1,390 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <cache/ResultCache.h>
+
+#include <fstream>
+#include <iterator>
+
+#include <defs.h>
+
+#include <AircraftDataFields.h>
+#include <DataFile.h>
+
+#include <utils/BinaryUtils.h>
+#include <utils/FileUtils.h>
+#include <utils/HashUtils.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+static const uint32_t magic   = 0x4352434D;   // "MCRC"
+static const uint32_t version = 1;
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t ResultCache::getKey( const Aircraft &aircraft )
+{
+    uint64_t key = HashUtils::hash( std::string( APP_VER ) );
+
+    for ( int i = 0; i < AircraftDataFields::getCount(); ++i )
+    {
+        key = HashUtils::hash( AircraftDataFields::getValue( *aircraft.getData(), i ), key );
+    }
+
+    key = HashUtils::hash( static_cast< uint32_t >( aircraft.getComponents().size() ), key );
+
+    for ( const Component *component : aircraft.getComponents() )
+    {
+        ComponentData data = component->getComponentData();
+
+        key = HashUtils::hash( data.type    , key );
+        key = HashUtils::hash( data.name    , key );
+        key = HashUtils::hash( data.r.x()   , key );
+        key = HashUtils::hash( data.r.y()   , key );
+        key = HashUtils::hash( data.r.z()   , key );
+        key = HashUtils::hash( data.m       , key );
+        key = HashUtils::hash( data.l       , key );
+        key = HashUtils::hash( data.w       , key );
+        key = HashUtils::hash( data.h       , key );
+    }
+
+    key = aircraft.getPointMasses().getHash( key );
+
+    return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ResultCache::Result ResultCache::getResult( const Aircraft &aircraft )
+{
+    Result result;
+
+    result.type          = static_cast< int >( aircraft.getData()->type );
+    result.massTotal     = aircraft.getMassTotal();
+    result.centerOfMass  = aircraft.getCenterOfMass();
+    result.inertiaMatrix = aircraft.getInertiaMatrix();
+
+    for ( const Component *component : aircraft.getComponents() )
+    {
+        ComponentResult componentResult;
+
+        componentResult.type    = component->getXmlTagName();
+        componentResult.name    = component->getName();
+        componentResult.mass    = component->getMass();
+        componentResult.massEst = component->getEstimatedMass();
+
+        result.components.push_back( componentResult );
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ResultCache::ResultCache() :
+    _hits     ( 0 ),
+    _misses   ( 0 ),
+    _modified ( false )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ResultCache::~ResultCache() {}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ResultCache::open( const char *fileName )
+{
+    clear();
+
+    _fileName = fileName;
+
+    std::ifstream fs( fileName, std::ios_base::in | std::ios_base::binary );
+
+    if ( !fs.is_open() )
+    {
+        // new cache
+        return true;
+    }
+
+    uint32_t magic_temp    = 0;
+    uint32_t version_temp  = 0;
+    uint32_t results_count = 0;
+    uint32_t aliases_count = 0;
+
+    bool result = true;
+
+    if ( result ) result = BinaryUtils::read( fs, &magic_temp   );
+    if ( result ) result = BinaryUtils::read( fs, &version_temp );
+
+    result = result && magic_temp == magic && version_temp == version;
+
+    if ( result ) result = BinaryUtils::read( fs, &results_count );
+
+    for ( uint32_t i = 0; i < results_count && result; ++i )
+    {
+        uint64_t key = 0;
+        uint32_t type = 0;
+        uint32_t components_count = 0;
+
+        Result entry;
+
+        if ( result ) result = BinaryUtils::read( fs, &key                 );
+        if ( result ) result = BinaryUtils::read( fs, &type                );
+        if ( result ) result = BinaryUtils::read( fs, &entry.massTotal     );
+        if ( result ) result = BinaryUtils::read( fs, &entry.centerOfMass  );
+        if ( result ) result = BinaryUtils::read( fs, &entry.inertiaMatrix );
+        if ( result ) result = BinaryUtils::read( fs, &components_count    );
+
+        entry.type = static_cast< int >( type );
+
+        for ( uint32_t j = 0; j < components_count && result; ++j )
+        {
+            ComponentResult component;
+
+            if ( result ) result = BinaryUtils::read( fs, &component.type    );
+            if ( result ) result = BinaryUtils::read( fs, &component.name    );
+            if ( result ) result = BinaryUtils::read( fs, &component.mass    );
+            if ( result ) result = BinaryUtils::read( fs, &component.massEst );
+
+            entry.components.push_back( component );
+        }
+
+        if ( result ) _results[ key ] = entry;
+    }
+
+    if ( result ) result = BinaryUtils::read( fs, &aliases_count );
+
+    for ( uint32_t i = 0; i < aliases_count && result; ++i )
+    {
+        uint64_t hash = 0;
+        uint64_t key  = 0;
+
+        if ( result ) result = BinaryUtils::read( fs, &hash );
+        if ( result ) result = BinaryUtils::read( fs, &key  );
+
+        if ( result ) _aliases[ hash ] = key;
+    }
+
+    fs.close();
+
+    if ( !result )
+    {
+        // stale or damaged cache is simply discarded
+        clear();
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ResultCache::save()
+{
+    if ( !_modified ) return true;
+
+    std::string fileTemp = _fileName + ".tmp";
+
+    std::ofstream fs( fileTemp.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+
+    if ( !fs.is_open() )
+    {
+        return false;
+    }
+
+    BinaryUtils::write( fs, magic );
+    BinaryUtils::write( fs, version );
+
+    BinaryUtils::write( fs, static_cast< uint32_t >( _results.size() ) );
+
+    for ( Results::const_iterator it = _results.begin(); it != _results.end(); ++it )
+    {
+        BinaryUtils::write( fs, it->first );
+        BinaryUtils::write( fs, static_cast< uint32_t >( it->second.type ) );
+        BinaryUtils::write( fs, it->second.massTotal     );
+        BinaryUtils::write( fs, it->second.centerOfMass  );
+        BinaryUtils::write( fs, it->second.inertiaMatrix );
+
+        BinaryUtils::write( fs, static_cast< uint32_t >( it->second.components.size() ) );
+
+        for ( const ComponentResult &component : it->second.components )
+        {
+            BinaryUtils::write( fs, component.type    );
+            BinaryUtils::write( fs, component.name    );
+            BinaryUtils::write( fs, component.mass    );
+            BinaryUtils::write( fs, component.massEst );
+        }
+    }
+
+    BinaryUtils::write( fs, static_cast< uint32_t >( _aliases.size() ) );
+
+    for ( Aliases::const_iterator it = _aliases.begin(); it != _aliases.end(); ++it )
+    {
+        BinaryUtils::write( fs, it->first  );
+        BinaryUtils::write( fs, it->second );
+    }
+
+    fs.flush();
+
+    bool result = fs.good();
+
+    fs.close();
+
+    if ( result )
+    {
+        // replace cache file only when it has been completely written
+        result = FileUtils::replace( fileTemp.c_str(), _fileName.c_str() );
+    }
+
+    if ( result )
+    {
+        _modified = false;
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ResultCache::clear()
+{
+    _results.clear();
+    _aliases.clear();
+
+    _hits   = 0;
+    _misses = 0;
+
+    _modified = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ResultCache::find( uint64_t key, Result *result ) const
+{
+    Results::const_iterator it = _results.find( key );
+
+    if ( it != _results.end() )
+    {
+        *result = it->second;
+        return true;
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ResultCache::insert( const Aircraft &aircraft )
+{
+    _results[ getKey( aircraft ) ] = getResult( aircraft );
+    _modified = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ResultCache::evaluate( Aircraft *aircraft, Result *result )
+{
+    uint64_t key = getKey( *aircraft );
+
+    if ( find( key, result ) )
+    {
+        _hits++;
+        return true;
+    }
+
+    _misses++;
+
+    aircraft->update();
+
+    *result = getResult( *aircraft );
+
+    _results[ key ] = *result;
+    _modified = true;
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ResultCache::readFile( const char *fileName, Result *result )
+{
+    std::ifstream fs( fileName, std::ios_base::in | std::ios_base::binary );
+
+    if ( !fs.is_open() )
+    {
+        return false;
+    }
+
+    std::string content( ( std::istreambuf_iterator< char >( fs ) ),
+                           std::istreambuf_iterator< char >() );
+
+    fs.close();
+
+    uint64_t hash = HashUtils::hash( content.data(), content.size() );
+
+    // content does not determine the result if it refers to the point masses
+    // file, which can change on its own, so such a file is always parsed
+    const bool external = content.find( "<point_masses" ) != std::string::npos;
+
+    Aliases::const_iterator it = _aliases.find( hash );
+
+    if ( !external && it != _aliases.end() && find( it->second, result ) )
+    {
+        _hits++;
+        return true;
+    }
+
+    DataFile dataFile;
+
+    if ( !dataFile.readFile( fileName ) )
+    {
+        return false;
+    }
+
+    // aircraft is already updated while reading components, the canonical
+    // key still lets the same configuration share a single entry
+    uint64_t key = getKey( *dataFile.getAircraft() );
+
+    if ( find( key, result ) )
+    {
+        _hits++;
+    }
+    else
+    {
+        _misses++;
+
+        *result = getResult( *dataFile.getAircraft() );
+        _results[ key ] = *result;
+    }
+
+    if ( !external ) _aliases[ hash ] = key;
+
+    _modified = true;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
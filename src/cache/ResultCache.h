@@ -0,0 +1,172 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef CACHE_RESULTCACHE_H_
+#define CACHE_RESULTCACHE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <mcutil/math/Matrix3x3.h>
+#include <mcutil/math/Vector3.h>
+
+#include <Aircraft.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The content-addressed persistent result cache class.
+ *
+ * Results are keyed by canonical hash of aircraft data and components, so
+ * the same configuration is evaluated once regardless of file it is stored
+ * in. Additionally hash of aircraft file content is mapped to the result key,
+ * so unchanged files are neither parsed nor evaluated again.
+ * Application version is a part of the key, cache is invalidated when
+ * estimation methods change.
+ */
+class ResultCache
+{
+public:
+
+    /**
+     * @brief The cached component result struct.
+     */
+    struct ComponentResult
+    {
+        std::string type;           ///< component XML tag name
+        std::string name;           ///< component name
+        double mass    = 0.0;       ///< [kg] component mass
+        double massEst = 0.0;       ///< [kg] component estimated mass
+    };
+
+    typedef std::vector< ComponentResult > ComponentResults;
+
+    /**
+     * @brief The cached aircraft result struct.
+     */
+    struct Result
+    {
+        int type = 0;               ///< aircraft type
+
+        double    massTotal = 0.0;  ///< [kg] total mass
+        Vector3   centerOfMass;     ///< [m] center of mass position
+        Matrix3x3 inertiaMatrix;    ///< [kg*m^2] inertia
+
+        ComponentResults components;    ///< components results
+    };
+
+    /**
+     * @brief Returns canonical hash of aircraft data and components.
+     * @param aircraft aircraft
+     * @return canonical hash
+     */
+    static uint64_t getKey( const Aircraft &aircraft );
+
+    /**
+     * @brief Returns result of already evaluated aircraft.
+     * @param aircraft aircraft
+     * @return aircraft result
+     */
+    static Result getResult( const Aircraft &aircraft );
+
+    /** @brief Constructor. */
+    ResultCache();
+
+    /** @brief Destructor. */
+    virtual ~ResultCache();
+
+    /**
+     * @brief Opens cache file. Cache is empty if the file does not exist.
+     * @param fileName cache file name
+     * @return returns true on success and false on failure
+     */
+    bool open( const char *fileName );
+
+    /**
+     * @brief Saves cache to the file it has been opened from if modified.
+     * @return returns true on success and false on failure
+     */
+    bool save();
+
+    /** @brief Removes all entries. */
+    void clear();
+
+    /**
+     * @brief Finds result of the given key.
+     * @param key canonical hash
+     * @param result output result
+     * @return returns true if result has been found
+     */
+    bool find( uint64_t key, Result *result ) const;
+
+    /**
+     * @brief Inserts result of already evaluated aircraft.
+     * @param aircraft aircraft
+     */
+    void insert( const Aircraft &aircraft );
+
+    /**
+     * @brief Updates aircraft unless its result is cached.
+     * @param aircraft aircraft
+     * @param result output result
+     * @return returns true if result has been taken from cache
+     */
+    bool evaluate( Aircraft *aircraft, Result *result );
+
+    /**
+     * @brief Evaluates aircraft file. File is not parsed if its content is
+     * known to the cache, unless it refers to the point masses file.
+     * @param fileName aircraft file name
+     * @param result output result
+     * @return returns true on success and false on failure
+     */
+    bool readFile( const char *fileName, Result *result );
+
+    inline int getCount() const { return static_cast< int >( _results.size() ); }
+
+    inline int getHits   () const { return _hits;   }
+    inline int getMisses () const { return _misses; }
+
+private:
+
+    typedef std::map< uint64_t, Result >   Results;
+    typedef std::map< uint64_t, uint64_t > Aliases;
+
+    std::string _fileName;      ///< cache file name
+
+    Results _results;           ///< results by canonical hash
+    Aliases _aliases;           ///< canonical hashes by file content hash
+
+    int _hits;                  ///< number of cache hits
+    int _misses;                ///< number of cache misses
+
+    bool _modified;             ///< specifies if cache has been modified since opened
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // CACHE_RESULTCACHE_H_
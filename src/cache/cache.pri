@@ -0,0 +1,5 @@
+HEADERS += \
+    $$PWD/ResultCache.h
+
+SOURCES += \
+    $$PWD/ResultCache.cpp
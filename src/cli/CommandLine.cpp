@@ -0,0 +1,755 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <cli/CommandLine.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+
+#include <defs.h>
+
+#include <DataFile.h>
+
+#include <cache/ResultCache.h>
+#include <diff/AircraftDiff.h>
+#include <diff/AircraftMerge.h>
+#include <estimation/EstimationEnsemble.h>
+#include <export/FleetExporter.h>
+#include <export/MassBalanceWriter.h>
+#include <fleet/FleetDatabase.h>
+#include <fleet/FleetGenerator.h>
+#include <fleet/FleetPipeline.h>
+#include <import/SimModelImporter.h>
+#include <service/FolderWatcher.h>
+#include <service/MassService.h>
+#include <variants/VariantSet.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+const char *CommandLine::_modes[] = { "--watch", "--export", "--serve", "--generate", "--ensemble", "--convert", "--jsbsim", "--import", "--variants", "--diff", "--merge", Q_NULLPTR };
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool CommandLine::isBatchMode( int argc, char *argv[] )
+{
+    for ( int i = 1; i < argc; i++ )
+    {
+        for ( int j = 0; _modes[ j ] != Q_NULLPTR; j++ )
+        {
+            size_t len = strlen( _modes[ j ] );
+
+            if ( strncmp( argv[ i ], _modes[ j ], len ) == 0
+              && ( argv[ i ][ len ] == '\0' || argv[ i ][ len ] == '=' ) )
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const char* CommandLine::getOption( int argc, char *argv[], const char *name )
+{
+    size_t len = strlen( name );
+
+    for ( int i = 1; i < argc; i++ )
+    {
+        if ( strncmp( argv[ i ], name, len ) == 0 )
+        {
+            if ( argv[ i ][ len ] == '=' ) return argv[ i ] + len + 1;
+            if ( argv[ i ][ len ] == '\0' && i + 1 < argc ) return argv[ i + 1 ];
+        }
+    }
+
+    return Q_NULLPTR;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::run( int argc, char *argv[] )
+{
+    QCoreApplication *app = new QCoreApplication( argc, argv );
+
+    app->setApplicationName    ( APP_NAME   );
+    app->setApplicationVersion ( APP_VER    );
+    app->setOrganizationDomain ( ORG_DOMAIN );
+    app->setOrganizationName   ( ORG_NAME   );
+
+    QCommandLineParser parser;
+
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    parser.addOption( QCommandLineOption( "watch"     , "Watches directory of aircraft files.", "directory" ) );
+    parser.addOption( QCommandLineOption( "export"    , "Exports aircraft data and results to the file.", "file" ) );
+    parser.addOption( QCommandLineOption( "serve"     , "Answers mass properties requests on the local socket.", "name" ) );
+    parser.addOption( QCommandLineOption( "output"    , "Writes results to the file.", "file" ) );
+    parser.addOption( QCommandLineOption( "socket"    , "Publishes results to the local socket.", "name" ) );
+    parser.addOption( QCommandLineOption( "database"  , "Uses fleet database.", "file" ) );
+    parser.addOption( QCommandLineOption( "cache"     , "Uses persistent result cache.", "file" ) );
+    parser.addOption( QCommandLineOption( "shm"       , "Publishes results to the shared memory segment.", "name" ) );
+    parser.addOption( QCommandLineOption( "delay"     , "Notifications collecting delay.", "ms", "200" ) );
+    parser.addOption( QCommandLineOption( "format"    , "Export format: csv, jsonl or arrow.", "format", "csv" ) );
+    parser.addOption( QCommandLineOption( "rows"      , "Exported rows: aircraft or components.", "rows", "aircraft" ) );
+    parser.addOption( QCommandLineOption( "generate"  , "Generates synthetic aircraft files to the directory.", "directory" ) );
+    parser.addOption( QCommandLineOption( "count"     , "Number of generated aircraft.", "count", "1" ) );
+    parser.addOption( QCommandLineOption( "components", "Number of components per generated aircraft.", "count", "0" ) );
+    parser.addOption( QCommandLineOption( "seed"      , "Generator random seed.", "seed", "1" ) );
+    parser.addOption( QCommandLineOption( "ensemble"  , "Writes masses estimated with all methods to the CSV file.", "file" ) );
+    parser.addOption( QCommandLineOption( "convert"   , "Converts aircraft files to the current format into the directory.", "directory" ) );
+    parser.addOption( QCommandLineOption( "jsbsim"    , "Writes JSBSim mass_balance files to the directory.", "directory" ) );
+    parser.addOption( QCommandLineOption( "pointmasses", "Writes components as JSBSim pointmasses." ) );
+    parser.addOption( QCommandLineOption( "import"    , "Imports JSBSim and YASim aircraft into the directory.", "directory" ) );
+    parser.addOption( QCommandLineOption( "type"      , "Imported aircraft type: 0 fighter, 1 cargo, 2 general aviation, 3 helicopter.", "type", "2" ) );
+    parser.addOption( QCommandLineOption( "variants"  , "Evaluates variants of the base aircraft file, writes results to the output CSV file.", "file" ) );
+    parser.addOption( QCommandLineOption( "diff"      , "Compares two aircraft files (exit status 0 if the same, 1 if different, 2 on error)." ) );
+    parser.addOption( QCommandLineOption( "merge"     , "Merges base, our and their aircraft files into the file.", "file" ) );
+
+    parser.addPositionalArgument( "paths", "Directories of aircraft files to be exported, estimated, converted or imported, aircraft files to be served, compared or merged or base aircraft file of variants.", "[paths...]" );
+
+    parser.process( *app );
+
+    int result = 0;
+
+    if ( parser.isSet( "export" ) )
+    {
+        result = runExport( parser );
+    }
+    else if ( parser.isSet( "serve" ) )
+    {
+        result = runServe( parser );
+    }
+    else if ( parser.isSet( "generate" ) )
+    {
+        result = runGenerate( parser );
+    }
+    else if ( parser.isSet( "ensemble" ) )
+    {
+        result = runEnsemble( parser );
+    }
+    else if ( parser.isSet( "convert" ) )
+    {
+        result = runConvert( parser );
+    }
+    else if ( parser.isSet( "jsbsim" ) )
+    {
+        result = runJsbSim( parser );
+    }
+    else if ( parser.isSet( "import" ) )
+    {
+        result = runImport( parser );
+    }
+    else if ( parser.isSet( "variants" ) )
+    {
+        result = runVariants( parser );
+    }
+    else if ( parser.isSet( "diff" ) )
+    {
+        result = runDiff( parser );
+    }
+    else if ( parser.isSet( "merge" ) )
+    {
+        result = runMerge( parser );
+    }
+    else
+    {
+        result = runWatch( parser );
+    }
+
+    DELPTR( app );
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runWatch( const QCommandLineParser &parser )
+{
+    int result = 0;
+
+    FleetDatabase *database = Q_NULLPTR;
+    ResultCache   *cache    = Q_NULLPTR;
+    FolderWatcher *watcher  = Q_NULLPTR;
+
+    if ( parser.isSet( "database" ) )
+    {
+        database = new FleetDatabase();
+
+        if ( !database->open( parser.value( "database" ).toLocal8Bit().data() ) )
+        {
+            std::cerr << "Cannot open database file." << std::endl;
+            result = 1;
+        }
+    }
+
+    if ( result == 0 && parser.isSet( "cache" ) )
+    {
+        cache = new ResultCache();
+
+        if ( !cache->open( parser.value( "cache" ).toLocal8Bit().data() ) )
+        {
+            std::cerr << "Cannot open cache file." << std::endl;
+            result = 1;
+        }
+    }
+
+    if ( result == 0 )
+    {
+        watcher = new FolderWatcher();
+
+        watcher->setDatabase( database );
+        watcher->setCache( cache );
+        watcher->setDelay( parser.value( "delay" ).toInt() );
+
+        if ( parser.isSet( "output" ) )
+        {
+            watcher->setOutputFile( parser.value( "output" ) );
+        }
+
+        if ( parser.isSet( "socket" ) && !watcher->setOutputSocket( parser.value( "socket" ) ) )
+        {
+            std::cerr << "Cannot listen on local socket." << std::endl;
+            result = 1;
+        }
+
+        QStringList dirs = parser.values( "watch" );
+
+        for ( QStringList::iterator it = dirs.begin(); it != dirs.end() && result == 0; ++it )
+        {
+            if ( !watcher->addDirectory( *it ) )
+            {
+                std::cerr << "Cannot watch directory: " << it->toLocal8Bit().data() << std::endl;
+                result = 1;
+            }
+        }
+    }
+
+    if ( result == 0 )
+    {
+        watcher->evaluateAll();
+        result = QCoreApplication::exec();
+    }
+
+    DELPTR( watcher );
+    DELPTR( cache );
+    DELPTR( database );
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runExport( const QCommandLineParser &parser )
+{
+    ExportWriter::Format format = ExportWriter::CSV;
+
+    if ( !ExportWriter::getFormat( parser.value( "format" ).toLocal8Bit().data(), &format ) )
+    {
+        std::cerr << "Unknown export format." << std::endl;
+        return 1;
+    }
+
+    ExportSchema::Rows rows = ExportSchema::AircraftRows;
+
+    if ( parser.value( "rows" ) == "components" )
+    {
+        rows = ExportSchema::ComponentRows;
+    }
+    else if ( parser.value( "rows" ) != "aircraft" )
+    {
+        std::cerr << "Unknown export rows." << std::endl;
+        return 1;
+    }
+
+    FleetExporter exporter( format, rows );
+
+    if ( !exporter.start( parser.value( "export" ).toLocal8Bit().data() ) )
+    {
+        std::cerr << "Cannot open export file." << std::endl;
+        return 1;
+    }
+
+    bool result = true;
+
+    if ( parser.isSet( "database" ) )
+    {
+        FleetDatabase database;
+
+        result = database.open( parser.value( "database" ).toLocal8Bit().data() )
+              && exporter.pushDatabase( database );
+    }
+
+    QStringList dirs = parser.positionalArguments();
+
+    for ( QStringList::iterator it = dirs.begin(); it != dirs.end() && result; ++it )
+    {
+        result = exporter.pushDirectory( it->toLocal8Bit().data() );
+    }
+
+    result = exporter.finish() && result;
+
+    if ( !result )
+    {
+        std::cerr << "Export failed." << std::endl;
+    }
+
+    return result ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runServe( const QCommandLineParser &parser )
+{
+    MassService service;
+
+    if ( parser.isSet( "shm" ) )
+    {
+        service.setSharedMemoryPrefix( parser.value( "shm" ) );
+    }
+
+    // aircraft files given as arguments are loaded as models named after files
+    QStringList files = parser.positionalArguments();
+
+    for ( QStringList::iterator it = files.begin(); it != files.end(); ++it )
+    {
+        if ( !service.load( QFileInfo( *it ).completeBaseName(), *it ) )
+        {
+            std::cerr << "Cannot read file: " << it->toLocal8Bit().data() << std::endl;
+            return 1;
+        }
+    }
+
+    if ( !service.listen( parser.value( "serve" ) ) )
+    {
+        std::cerr << "Cannot listen on local socket." << std::endl;
+        return 1;
+    }
+
+    return QCoreApplication::exec();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runGenerate( const QCommandLineParser &parser )
+{
+    FleetGenerator generator( parser.value( "seed" ).toULongLong() );
+
+    generator.setComponentsCount( parser.value( "components" ).toInt() );
+
+    if ( !generator.generateFiles( parser.value( "generate" ).toLocal8Bit().data(),
+                                   parser.value( "count" ).toInt() ) )
+    {
+        std::cerr << "Cannot write generated files." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runEnsemble( const QCommandLineParser &parser )
+{
+    // files are evaluated in batches, all components of the batch concurrently
+    static const int batchSize = 256;
+
+    EstimationEnsemble ensemble;
+
+    std::ofstream fs( parser.value( "ensemble" ).toLocal8Bit().data() );
+
+    if ( !fs.is_open() )
+    {
+        std::cerr << "Cannot open ensemble file." << std::endl;
+        return 1;
+    }
+
+    ensemble.writeCsvHeader( &fs );
+
+    std::vector< std::string > fileNames;
+    std::vector< std::unique_ptr< DataFile > > dataFiles;
+
+    auto flush = [ &ensemble, &fs, &fileNames, &dataFiles ]()
+    {
+        std::vector< const Aircraft* > fleet;
+
+        for ( const auto &dataFile : dataFiles ) fleet.push_back( dataFile->getAircraft() );
+
+        std::vector< EstimationEnsemble::Results > results;
+        ensemble.evaluate( fleet, &results );
+
+        for ( size_t i = 0; i < results.size(); ++i )
+        {
+            EstimationEnsemble::writeCsv( fileNames[ i ], results[ i ], &fs );
+        }
+
+        fileNames.clear();
+        dataFiles.clear();
+    };
+
+    QStringList dirs = parser.positionalArguments();
+
+    for ( QStringList::iterator dir = dirs.begin(); dir != dirs.end(); ++dir )
+    {
+        QDirIterator it( *dir, QStringList() << "*.xml", QDir::Files,
+                         QDirIterator::Subdirectories );
+
+        while ( it.hasNext() )
+        {
+            QString fileName = it.next();
+
+            std::unique_ptr< DataFile > dataFile( new DataFile() );
+
+            if ( dataFile->readFile( fileName.toLocal8Bit().data() ) )
+            {
+                fileNames.push_back( fileName.toStdString() );
+                dataFiles.push_back( std::move( dataFile ) );
+
+                if ( static_cast< int >( dataFiles.size() ) == batchSize ) flush();
+            }
+        }
+    }
+
+    flush();
+
+    if ( !fs.good() )
+    {
+        std::cerr << "Cannot write ensemble file." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runConvert( const QCommandLineParser &parser )
+{
+    auto writeFile = []( DataFile *dataFile, const QString &fileName )
+    {
+        return dataFile->saveFile( fileName.toLocal8Bit().data() );
+    };
+
+    return convertFiles( parser.positionalArguments(), parser.value( "convert" ), "", writeFile );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runJsbSim( const QCommandLineParser &parser )
+{
+    MassBalanceWriter writer( parser.isSet( "pointmasses" ) );
+
+    auto writeFile = [ &writer ]( DataFile *dataFile, const QString &fileName )
+    {
+        return writer.writeFile( *dataFile->getAircraft(), fileName.toLocal8Bit().data() );
+    };
+
+    return convertFiles( parser.positionalArguments(), parser.value( "jsbsim" ), "_mass_balance", writeFile );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runImport( const QCommandLineParser &parser )
+{
+    int type = parser.value( "type" ).toInt();
+
+    if ( type < AircraftData::FighterAttack || type > AircraftData::Helicopter )
+    {
+        std::cerr << "Invalid aircraft type." << std::endl;
+        return 1;
+    }
+
+    FleetDatabase *database = Q_NULLPTR;
+
+    if ( parser.isSet( "database" ) )
+    {
+        database = new FleetDatabase();
+
+        if ( !database->open( parser.value( "database" ).toLocal8Bit().data() ) )
+        {
+            std::cerr << "Cannot open database file." << std::endl;
+            DELPTR( database );
+            return 1;
+        }
+    }
+
+    SimModelImporter importer( static_cast< AircraftData::Type >( type ) );
+
+    auto parseFile = [ &importer ]( const QByteArray &content, const QString&, DataFile *dataFile )
+    {
+        return importer.read( content, dataFile->getAircraft() );
+    };
+
+    // imported aircraft are added to the database as written files
+    auto writeFile = [ database ]( DataFile *dataFile, const QString &fileName )
+    {
+        if ( !dataFile->saveFile( fileName.toLocal8Bit().data() ) ) return false;
+
+        if ( database ) database->insert( fileName.toLocal8Bit().data(), *dataFile->getAircraft() );
+
+        return true;
+    };
+
+    int result = convertFiles( parser.positionalArguments(), parser.value( "import" ), "",
+                               writeFile, parseFile );
+
+    if ( database && !database->save() )
+    {
+        std::cerr << "Cannot save database file." << std::endl;
+        result = 1;
+    }
+
+    DELPTR( database );
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runVariants( const QCommandLineParser &parser )
+{
+    QStringList paths = parser.positionalArguments();
+
+    if ( paths.size() != 1 || !parser.isSet( "output" ) )
+    {
+        std::cerr << "Base aircraft file and output file are required." << std::endl;
+        return 1;
+    }
+
+    DataFile dataFile;
+
+    if ( !dataFile.readFile( paths.at( 0 ).toLocal8Bit().data() ) )
+    {
+        std::cerr << "Cannot read base aircraft file." << std::endl;
+        return 1;
+    }
+
+    VariantSet variants;
+
+    if ( !variants.readFile( parser.value( "variants" ).toLocal8Bit().data() ) )
+    {
+        std::cerr << "Cannot read variants file." << std::endl;
+        return 1;
+    }
+
+    VariantSet::Results results = variants.evaluate( *dataFile.getAircraft() );
+
+    std::ofstream fs( parser.value( "output" ).toLocal8Bit().data() );
+
+    if ( !fs.is_open() )
+    {
+        std::cerr << "Cannot open output file." << std::endl;
+        return 1;
+    }
+
+    fs.precision( std::numeric_limits< double >::max_digits10 );
+
+    fs << "variant,valid,mass,cg_x,cg_y,cg_z,i_xx,i_yy,i_zz,i_xy,i_xz,i_yz,estimated_mass" << std::endl;
+
+    for ( const VariantSet::Result &r : results )
+    {
+        fs.put( '"' );
+        for ( char c : r.name )
+        {
+            if ( c == '"' ) fs.put( '"' );
+            fs.put( c );
+        }
+        fs.put( '"' );
+
+        // variants not matching the base aircraft are left empty
+        fs << ',' << ( r.valid ? 1 : 0 );
+
+        if ( r.valid )
+        {
+            double estimatedMass = 0.0;
+            for ( double mass : r.estimatedMasses ) estimatedMass += mass;
+
+            fs << ',' << r.massTotal
+               << ',' << r.centerOfMass.x()
+               << ',' << r.centerOfMass.y()
+               << ',' << r.centerOfMass.z()
+               << ',' << r.inertiaMatrix.xx()
+               << ',' << r.inertiaMatrix.yy()
+               << ',' << r.inertiaMatrix.zz()
+               << ',' << r.inertiaMatrix.xy()
+               << ',' << r.inertiaMatrix.xz()
+               << ',' << r.inertiaMatrix.yz()
+               << ',' << estimatedMass << '\n';
+        }
+        else
+        {
+            fs << ",,,,,,,,,,," << '\n';
+        }
+    }
+
+    if ( !fs.good() )
+    {
+        std::cerr << "Cannot write output file." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runDiff( const QCommandLineParser &parser )
+{
+    QStringList paths = parser.positionalArguments();
+
+    if ( paths.size() != 2 )
+    {
+        std::cerr << "Two aircraft files are required." << std::endl;
+        return 2;
+    }
+
+    AircraftDiff diff;
+
+    if ( !diff.compareFiles( paths.at( 0 ).toLocal8Bit().data(),
+                             paths.at( 1 ).toLocal8Bit().data() ) )
+    {
+        std::cerr << "Cannot read aircraft file." << std::endl;
+        return 2;
+    }
+
+    if ( parser.isSet( "output" ) )
+    {
+        std::ofstream fs( parser.value( "output" ).toLocal8Bit().data() );
+
+        fs << diff.toString();
+
+        if ( !fs.good() )
+        {
+            std::cerr << "Cannot write output file." << std::endl;
+            return 2;
+        }
+    }
+    else
+    {
+        std::cout << diff.toString();
+    }
+
+    // exit status as diff(1): 0 if files are the same, 1 if they differ
+    return diff.isEmpty() ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::runMerge( const QCommandLineParser &parser )
+{
+    QStringList paths = parser.positionalArguments();
+
+    if ( paths.size() != 3 )
+    {
+        std::cerr << "Base, our and their aircraft files are required." << std::endl;
+        return 1;
+    }
+
+    AircraftMerge::Conflicts conflicts;
+
+    if ( !AircraftMerge::mergeFiles( paths.at( 0 ).toLocal8Bit().data(),
+                                     paths.at( 1 ).toLocal8Bit().data(),
+                                     paths.at( 2 ).toLocal8Bit().data(),
+                                     parser.value( "merge" ).toLocal8Bit().data(),
+                                     &conflicts ) )
+    {
+        std::cerr << "Cannot merge aircraft files." << std::endl;
+        return 1;
+    }
+
+    // merged file is written anyway, conflicts are resolved in favour of our file
+    for ( const std::string &conflict : conflicts )
+    {
+        std::cerr << "Conflict: " << conflict << std::endl;
+    }
+
+    return conflicts.empty() ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CommandLine::convertFiles( const QStringList &dirs, const QString &outputPath,
+                               const QString &suffix, const FileWriter &writeFile,
+                               const FileParser &parseFile )
+{
+    QDir outputDir( outputPath );
+
+    int failedCount = 0;
+
+    for ( QStringList::const_iterator dir = dirs.begin(); dir != dirs.end(); ++dir )
+    {
+        QDir inputDir( *dir );
+
+        FleetPipeline pipeline;
+
+        if ( parseFile ) pipeline.setParser( parseFile );
+
+        // files are written in the directory order, keeping relative paths
+        auto write = [ &inputDir, &outputDir, &suffix, &writeFile, &failedCount ]( FleetPipeline::Item *item )
+        {
+            if ( !item->dataFile )
+            {
+                std::cerr << "Cannot read file: " << item->fileName << std::endl;
+                failedCount++;
+                return true;
+            }
+
+            QString fileName = QString::fromLocal8Bit( item->fileName.c_str() );
+            QFileInfo relative( inputDir.relativeFilePath( fileName ) );
+            QString outputFile = outputDir.filePath( relative.path() + "/"
+                                                   + relative.completeBaseName() + suffix + ".xml" );
+
+            if ( !QDir().mkpath( QFileInfo( outputFile ).path() )
+              || !writeFile( item->dataFile.get(), outputFile ) )
+            {
+                std::cerr << "Cannot write file: " << outputFile.toLocal8Bit().data() << std::endl;
+                return false;
+            }
+
+            return true;
+        };
+
+        if ( !pipeline.run( { dir->toLocal8Bit().data() }, write ) )
+        {
+            return 1;
+        }
+    }
+
+    return failedCount > 0 ? 1 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
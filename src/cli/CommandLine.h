@@ -0,0 +1,111 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef CLI_COMMANDLINE_H_
+#define CLI_COMMANDLINE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <functional>
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class QCommandLineParser;
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+class DataFile;
+
+/**
+ * @brief The command line (non-GUI) modes class.
+ */
+class CommandLine
+{
+public:
+
+    /**
+     * @brief Checks if command line arguments request non-GUI mode.
+     * @param argc arguments count
+     * @param argv arguments
+     * @return returns true if application should run without GUI
+     */
+    static bool isBatchMode( int argc, char *argv[] );
+
+    /**
+     * @brief Returns value of the option given either as "--name value" or
+     * as "--name=value".
+     * @param argc arguments count
+     * @param argv arguments
+     * @param name option name including leading dashes
+     * @return option value or null pointer if option is not given
+     */
+    static const char* getOption( int argc, char *argv[], const char *name );
+
+    /**
+     * @brief Runs application in non-GUI mode.
+     * @param argc arguments count
+     * @param argv arguments
+     * @return application exit code
+     */
+    static int run( int argc, char *argv[] );
+
+private:
+
+    /** Writes converted file, returns false on failure. */
+    typedef std::function< bool( DataFile*, const QString& ) > FileWriter;
+
+    /** Reads file content, returns false if file cannot be read. */
+    typedef std::function< bool( const QByteArray&, const QString&, DataFile* ) > FileParser;
+
+    static const char *_modes[];    ///< non-GUI mode options
+
+    static int runWatch( const QCommandLineParser &parser );
+    static int runExport( const QCommandLineParser &parser );
+    static int runServe( const QCommandLineParser &parser );
+    static int runGenerate( const QCommandLineParser &parser );
+    static int runEnsemble( const QCommandLineParser &parser );
+    static int runConvert( const QCommandLineParser &parser );
+    static int runJsbSim( const QCommandLineParser &parser );
+    static int runImport( const QCommandLineParser &parser );
+    static int runVariants( const QCommandLineParser &parser );
+    static int runDiff( const QCommandLineParser &parser );
+    static int runMerge( const QCommandLineParser &parser );
+
+    /**
+     * @brief Converts aircraft files found in the directories, output files
+     * keep relative paths and names with the suffix appended. Files which
+     * cannot be read or parsed are reported and the remaining ones are
+     * converted anyway, but the result is failure.
+     */
+    static int convertFiles( const QStringList &dirs, const QString &outputPath,
+                             const QString &suffix, const FileWriter &writeFile,
+                             const FileParser &parseFile = FileParser() );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // CLI_COMMANDLINE_H_
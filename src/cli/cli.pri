@@ -0,0 +1,5 @@
+HEADERS += \
+    $$PWD/CommandLine.h
+
+SOURCES += \
+    $$PWD/CommandLine.cpp
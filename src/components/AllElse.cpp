@@ -19,7 +19,9 @@
 
 #include <components/AllElse.h>
 
-#include <mcutil/misc/Units.h>
+#include <AircraftDataFields.h>
+
+#include <utils/Quantity.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -32,43 +34,79 @@ constexpr char AllElse::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double AllElse::estimateMass( const AircraftData &data )
 {
-    double w_dg = Units::kg2lb( data.general.mtow );
+    Mass w_dg( data.general.mtow );
 
-    double m = 0.0;
+    Mass m;
 
     // Rayner: Aircraft Design, p.568, table 15.2
-    if ( data.type == AircraftData::FighterAttack )
+    if constexpr ( TYPE == AircraftData::FighterAttack )
     {
-        m = Units::lb2kg( 0.17 * w_dg );
+        m = 0.17 * w_dg;
     }
 
     // Rayner: Aircraft Design, p.568, table 15.2
-    if ( data.type == AircraftData::CargoTransport )
+    if constexpr ( TYPE == AircraftData::CargoTransport )
     {
-        m = Units::lb2kg( 0.17 * w_dg );
+        m = 0.17 * w_dg;
     }
 
     // Rayner: Aircraft Design, p.568, table 15.2
-    if ( data.type == AircraftData::GeneralAviation )
+    if constexpr ( TYPE == AircraftData::GeneralAviation )
     {
-        m = Units::lb2kg( 0.1  * w_dg );
+        m = 0.1  * w_dg;
     }
 
     // engineering judgement
-    if ( data.type == AircraftData::Helicopter )
+    if constexpr ( TYPE == AircraftData::Helicopter )
+    {
+        m = 0.25 * w_dg;
+    }
+
+    return m.getSI();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template double AllElse::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double AllElse::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double AllElse::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double AllElse::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
+
+double AllElse::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
     {
-        m = Units::lb2kg( 0.25 * w_dg );
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
-    return m;
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const Component::Dependencies& AllElse::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "general.mtow"
+    });
+
+    return dependencies;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 AllElse::AllElse( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "All-else Empty" );
 }
@@ -43,6 +43,13 @@ public:
 
     static constexpr char xmlTagName[] { "all_else" };      ///< component XML tag name
 
+    /**
+     * @brief Returns indices of aircraft data fields the estimated mass
+     * depends on.
+     * @return aircraft data fields indices
+     */
+    static const Dependencies& getDependencies();
+
     /**
      * @brief Estimates component mass based on the aircraft parameters.
      * @param[in] data aircraft parameters
@@ -50,6 +57,16 @@ public:
      */
     static double estimateMass( const AircraftData &data );
 
+    /**
+     * @brief Estimates component mass of the aircraft of the given type.
+     * Aircraft data type is not checked.
+     * @tparam TYPE aircraft type
+     * @param[in] data aircraft parameters
+     * @return [kg] component statistical mass
+     */
+    template < AircraftData::Type TYPE >
+    static double estimateMass( const AircraftData &data );
+
     /**
      * @brief Constructor.
      * @param data aircraft data struct
@@ -57,10 +74,10 @@ public:
     AllElse( const AircraftData *data );
 
     /**
-     * @brief Returns component estimated mass.
+     * @brief Computes component estimated mass.
      * @return [kg] component estimated mass
      */
-    inline double getEstimatedMass() const override
+    inline double computeEstimatedMass() const override
     {
         return estimateMass( *_data );
     }
@@ -0,0 +1,224 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <components/Assembly.h>
+
+#include <algorithm>
+
+#include <defs.h>
+
+#include <components/Component.h>
+
+#include <utils/MassKernels.h>
+#include <utils/MassSums.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+Assembly::Assembly( const char *name, const Vector3 &origin, Assembly *parent ) :
+    _name ( name ),
+    _origin ( origin ),
+    _parent ( parent ),
+    _m ( 0.0 ),
+    _valid ( false )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+Assembly::~Assembly()
+{
+    clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+Assembly* Assembly::addAssembly( const char *name, const Vector3 &origin )
+{
+    Assembly *assembly = new Assembly( name, origin, this );
+    _assemblies.push_back( assembly );
+    invalidate();
+    return assembly;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Assembly::delAssembly( int index )
+{
+    if ( index < 0 || index >= static_cast< int >( _assemblies.size() ) ) return;
+
+    Assembly *assembly = _assemblies[ index ];
+
+    while ( !assembly->_assemblies.empty() )
+    {
+        assembly->delAssembly( 0 );
+    }
+
+    while ( !assembly->_components.empty() )
+    {
+        addComponent( assembly->_components.front() );
+    }
+
+    _assemblies.erase( _assemblies.begin() + index );
+    DELPTR( assembly );
+
+    invalidate();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Assembly::addComponent( Component *component )
+{
+    if ( component->getAssembly() )
+    {
+        component->getAssembly()->removeComponent( component );
+    }
+
+    _components.push_back( component );
+    component->setAssembly( this );
+
+    invalidate();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Assembly::removeComponent( Component *component )
+{
+    Components::iterator it = std::find( _components.begin(), _components.end(), component );
+
+    if ( it != _components.end() )
+    {
+        _components.erase( it );
+        component->setAssembly( nullptr );
+
+        invalidate();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Assembly::clear()
+{
+    for ( Components::iterator it = _components.begin(); it != _components.end(); ++it )
+    {
+        (*it)->setAssembly( nullptr );
+    }
+
+    _components.clear();
+
+    for ( Assemblies::iterator it = _assemblies.begin(); it != _assemblies.end(); ++it )
+    {
+        DELPTR( *it );
+    }
+
+    _assemblies.clear();
+
+    invalidate();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Assembly::invalidate()
+{
+    Assembly *assembly = this;
+
+    // ancestors of an outdated assembly are outdated already
+    while ( assembly && assembly->_valid )
+    {
+        assembly->_valid = false;
+        assembly = assembly->_parent;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Assembly::update()
+{
+    if ( _valid ) return;
+
+    MassSums sums;
+    MassKernels::Cuboids cuboids;
+
+    for ( Components::iterator it = _components.begin(); it != _components.end(); ++it )
+    {
+        const Component *c = *it;
+
+        // about the assembly origin
+        cuboids.add( c->getMass(), c->getLength(), c->getWidth(), c->getHeight(),
+                     c->getPosition() - _origin );
+    }
+
+    MassKernels::sum( cuboids.getArrays(), 0, cuboids.getCount(), &sums );
+
+    for ( Assemblies::iterator it = _assemblies.begin(); it != _assemblies.end(); ++it )
+    {
+        Assembly *a = *it;
+
+        a->update();
+
+        // parallel axis shift from the child origin to the assembly origin,
+        // child aggregates are not about its center of mass, hence s terms
+        const double  m = a->_m;
+        const Vector3 s = a->_s;
+        const Vector3 d = a->_origin - _origin;
+
+        const double sd2 = 2.0 * ( s * d );
+
+        InertiaTensor i = a->_i;
+
+        i += InertiaTensor( m * ( d.y() * d.y() + d.z() * d.z() ) + sd2 - 2.0 * s.x() * d.x(),
+                            m * ( d.x() * d.x() + d.z() * d.z() ) + sd2 - 2.0 * s.y() * d.y(),
+                            m * ( d.x() * d.x() + d.y() * d.y() ) + sd2 - 2.0 * s.z() * d.z(),
+                            -m * d.x() * d.y() - s.x() * d.y() - d.x() * s.y(),
+                            -m * d.x() * d.z() - s.x() * d.z() - d.x() * s.z(),
+                            -m * d.y() * d.z() - s.y() * d.z() - d.y() * s.z() );
+
+        sums.add( m, ( m > 0.0 ) ? ( s / m + d ) : d, i );
+    }
+
+    _m = sums.getMass();
+    _s = sums.getFirstMoment();
+    _i = sums.getInertia();
+
+    _valid = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Assembly::setName( const char *name )
+{
+    _name = name;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Assembly::setOrigin( const Vector3 &origin )
+{
+    _origin = origin;
+
+    // children aggregates are about their own origins, so they remain valid
+    invalidate();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
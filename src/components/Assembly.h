@@ -0,0 +1,157 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef COMPONENTS_ASSEMBLY_H_
+#define COMPONENTS_ASSEMBLY_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <mcutil/math/Vector3.h>
+
+#include <utils/InertiaTensor.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+class Component;
+
+/**
+ * @brief The components assembly class.
+ *
+ * Assemblies form a tree, e.g. "Wing group" -> "Left wing" -> parts. Each
+ * node caches its aggregate mass, first moment of mass and inertia about its
+ * own origin. Invalidating a node marks only the node and its ancestors,
+ * so update re-aggregates only those, other subtrees are taken from cache.
+ *
+ * Assembly does not own components. Components positions, as well as
+ * assemblies origins, are expressed in the aircraft reference frame.
+ */
+class Assembly
+{
+public:
+
+    typedef std::vector< Assembly*  > Assemblies;
+    typedef std::vector< Component* > Components;
+
+    /**
+     * @brief Constructor.
+     * @param name assembly name
+     * @param origin [m] assembly origin
+     * @param parent parent assembly
+     */
+    Assembly( const char *name = "", const Vector3 &origin = Vector3(),
+              Assembly *parent = nullptr );
+
+    /** @brief Destructor. Deletes child assemblies. */
+    virtual ~Assembly();
+
+    /**
+     * @brief Creates child assembly.
+     * @param name assembly name
+     * @param origin [m] assembly origin
+     * @return child assembly
+     */
+    Assembly* addAssembly( const char *name, const Vector3 &origin = Vector3() );
+
+    /**
+     * @brief Deletes child assembly, its components are moved to this one.
+     * @param index child assembly index
+     */
+    void delAssembly( int index );
+
+    /**
+     * @brief Adds component, component is removed from its previous assembly.
+     * @param component component
+     */
+    void addComponent( Component *component );
+
+    /**
+     * @brief Removes component.
+     * @param component component
+     */
+    void removeComponent( Component *component );
+
+    /** @brief Removes all components and deletes all child assemblies. */
+    void clear();
+
+    /**
+     * @brief Marks assembly and all its ancestors as outdated.
+     */
+    void invalidate();
+
+    /**
+     * @brief Re-aggregates outdated assemblies of the subtree.
+     */
+    void update();
+
+    inline const Assemblies& getAssemblies() const { return _assemblies; }
+    inline const Components& getComponents() const { return _components; }
+
+    inline Assembly* getParent() const { return _parent; }
+
+    inline const char* getName() const { return _name.c_str(); }
+
+    inline Vector3 getOrigin() const { return _origin; }
+
+    inline bool isValid() const { return _valid; }
+
+    /** @brief Returns [kg] aggregate mass. */
+    inline double getMass() const { return _m; }
+
+    /** @brief Returns [kg*m] aggregate first moment of mass about the origin. */
+    inline Vector3 getFirstMoment() const { return _s; }
+
+    /** @brief Returns [kg*m^2] aggregate inertia about the origin. */
+    inline InertiaTensor getInertia() const { return _i; }
+
+    void setName( const char *name );
+
+    /**
+     * @brief Sets origin.
+     * @param origin [m] assembly origin
+     */
+    void setOrigin( const Vector3 &origin );
+
+private:
+
+    std::string _name;          ///< assembly name
+
+    Vector3 _origin;            ///< [m] assembly origin
+
+    Assembly *_parent;          ///< parent assembly
+
+    Assemblies _assemblies;     ///< child assemblies
+    Components _components;     ///< components
+
+    double _m;                  ///< [kg] aggregate mass
+    Vector3 _s;                 ///< [kg*m] aggregate first moment of mass about the origin
+    InertiaTensor _i;           ///< [kg*m^2] aggregate inertia about the origin
+
+    bool _valid;                ///< specifies if aggregates are up to date
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // COMPONENTS_ASSEMBLY_H_
@@ -19,11 +19,10 @@
 
 #include <components/Component.h>
 
-#include <mcutil/physics/Physics.h>
+#include <components/Assembly.h>
 
 #include <DataFile.h>
 
-#include <utils/Cuboid.h>
 #include <utils/XmlUtils.h>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -33,19 +32,32 @@ namespace mc
 
 ////////////////////////////////////////////////////////////////////////////////
 
-Component::Component( const AircraftData *data ) :
+Component::Component( const AircraftData *data, const Dependencies *dependencies ) :
     _data ( data ),
+    _assembly ( nullptr ),
 
     _m ( 0.0 ),
     _l ( 0.0 ),
     _w ( 0.0 ),
-    _h ( 0.0 )
+    _h ( 0.0 ),
+
+    _dependencies ( dependencies ),
+
+    _estimatedMass ( 0.0 ),
+    _estimatedMassVersion ( UINT64_MAX )
 {
     _name = "";
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
+Component::~Component()
+{
+    if ( _assembly ) _assembly->removeComponent( this );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void Component::read( QDomElement *parentNode )
 {
     _name = parentNode->attributeNode( "name" ).value().toStdString();
@@ -69,6 +81,8 @@ void Component::read( QDomElement *parentNode )
     if ( !nodeL.isNull() ) _l = nodeL.text().toDouble();
     if ( !nodeW.isNull() ) _w = nodeW.text().toDouble();
     if ( !nodeH.isNull() ) _h = nodeH.text().toDouble();
+
+    if ( _assembly ) _assembly->invalidate();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -82,9 +96,39 @@ void Component::save( QDomDocument *doc, QDomElement *parentNode )
 
 ////////////////////////////////////////////////////////////////////////////////
 
+ComponentData Component::getComponentData() const
+{
+    ComponentData componentData;
+
+    componentData.type = getXmlTagName();
+    componentData.name = _name;
+
+    componentData.r = _r;
+    componentData.m = _m;
+    componentData.l = _l;
+    componentData.w = _w;
+    componentData.h = _h;
+
+    return componentData;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Component::setComponentData( const ComponentData &componentData )
+{
+    setName( componentData.name.c_str() );
+    setPosition( componentData.r );
+    setMass   ( componentData.m );
+    setLength ( componentData.l );
+    setWidth  ( componentData.w );
+    setHeight ( componentData.h );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 Matrix3x3 Component::getInertia() const
 {
-    return Physics::parallelAxisInertia( _m, Cuboid::getInertia( _m, _l, _w, _h ), _r );
+    return getInertiaTensor().getMatrix();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -99,6 +143,7 @@ void Component::setName( const char *name )
 void Component::setPosition( const Vector3 &r )
 {
     _r = r;
+    if ( _assembly ) _assembly->invalidate();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -106,6 +151,7 @@ void Component::setPosition( const Vector3 &r )
 void Component::setMass( double m )
 {
     _m = m;
+    if ( _assembly ) _assembly->invalidate();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -113,6 +159,7 @@ void Component::setMass( double m )
 void Component::setLength( double l )
 {
     _l = l;
+    if ( _assembly ) _assembly->invalidate();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -120,6 +167,7 @@ void Component::setLength( double l )
 void Component::setWidth( double w )
 {
     _w = w;
+    if ( _assembly ) _assembly->invalidate();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -127,6 +175,14 @@ void Component::setWidth( double w )
 void Component::setHeight( double h )
 {
     _h = h;
+    if ( _assembly ) _assembly->invalidate();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Component::setAssembly( Assembly *assembly )
+{
+    _assembly = assembly;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
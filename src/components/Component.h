@@ -21,7 +21,9 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include <QDomDocument>
 #include <QDomElement>
@@ -33,11 +35,17 @@
 
 #include <AircraftData.h>
 
+#include <components/ComponentData.h>
+
+#include <utils/InertiaTensor.h>
+
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace mc
 {
 
+class Assembly;
+
 /**
  * @brief The Component class.
  */
@@ -45,20 +53,45 @@ class Component
 {
 public:
 
+    typedef std::vector< int > Dependencies;    ///< aircraft data fields indices
+
     /**
      * @brief Constructor.
      * @param data aircraft data struct
+     * @param dependencies aircraft data fields the estimated mass depends on
      */
-    Component( const AircraftData *data );
+    Component( const AircraftData *data, const Dependencies *dependencies );
 
-    /** @brief Destructor. */
-    virtual ~Component() = default;
+    /** @brief Destructor. Removes component from its assembly. */
+    virtual ~Component();
+
+    /**
+     * @brief Computes component estimated mass.
+     * @return [kg] component estimated mass
+     */
+    virtual double computeEstimatedMass() const = 0;
 
     /**
-     * @brief Returns component estimated mass.
+     * @brief Returns component estimated mass. Value is cached and it is
+     * recomputed only after any of the aircraft data fields the estimated
+     * mass depends on has changed. Versions never decrease, so their sum
+     * changes whenever any of them does.
      * @return [kg] component estimated mass
      */
-    virtual double getEstimatedMass() const = 0;
+    inline double getEstimatedMass() const
+    {
+        uint64_t version = 0;
+
+        for ( int index : *_dependencies ) version += _data->versions[ index ];
+
+        if ( version != _estimatedMassVersion )
+        {
+            _estimatedMass = computeEstimatedMass();
+            _estimatedMassVersion = version;
+        }
+
+        return _estimatedMass;
+    }
 
     /**
      * @brief Reads component data.
@@ -79,6 +112,23 @@ public:
      */
     virtual const char* getXmlTagName() const = 0;
 
+    /**
+     * @brief Returns component parameters.
+     * @return component data
+     */
+    ComponentData getComponentData() const;
+
+    /**
+     * @brief Sets component parameters. Component type is not changed.
+     * @param componentData component data
+     */
+    void setComponentData( const ComponentData &componentData );
+
+    /** @brief Returns aircraft data fields the estimated mass depends on. */
+    inline const Dependencies& getEstimationDependencies() const { return *_dependencies; }
+
+    inline Assembly* getAssembly() const { return _assembly; }
+
     inline const char* getName() const { return _name.c_str(); }
 
     inline Vector3 getPosition() const { return _r; }
@@ -89,10 +139,20 @@ public:
     inline double getHeight () const { return _h; }
 
     /**
-     * @brief getInertia
-     * @return
+     * @brief Returns inertia about the reference point, component is
+     * a uniform cuboid, as in Aircraft::update().
+     * @return inertia matrix [kg*m^2]
+     */
+    Matrix3x3 getInertia() const;
+
+    /**
+     * @brief Returns inertia tensor about the reference point.
+     * @return inertia tensor [kg*m^2]
      */
-    virtual Matrix3x3 getInertia() const;
+    inline InertiaTensor getInertiaTensor() const
+    {
+        return InertiaTensor::getCuboid( _m, _l, _w, _h, _r );
+    }
 
     /**
      * @brief setName
@@ -111,10 +171,18 @@ public:
     void setWidth  ( double w );
     void setHeight ( double h );
 
+    /**
+     * @brief Sets assembly, should be called only by the assembly.
+     * @param assembly assembly the component belongs to
+     */
+    void setAssembly( Assembly *assembly );
+
 protected:
 
     const AircraftData *_data;  ///< aircraft data
 
+    Assembly *_assembly;        ///< assembly the component belongs to
+
     std::string _name;          ///< component name
 
     Vector3 _r;                 ///< [m] position
@@ -125,6 +193,11 @@ protected:
     double _w;                  ///< [m] width
     double _h;                  ///< [m] height
 
+    const Dependencies *_dependencies;      ///< aircraft data fields the estimated mass depends on
+
+    mutable double _estimatedMass;          ///< [kg] cached estimated mass
+    mutable uint64_t _estimatedMassVersion; ///< aircraft data version of the cached estimated mass
+
     virtual void saveParameters( QDomDocument *doc, QDomElement *node );
 };
 
@@ -0,0 +1,56 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef COMPONENTS_COMPONENTDATA_H_
+#define COMPONENTS_COMPONENTDATA_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+
+#include <mcutil/math/Vector3.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The component data struct.
+ *
+ * Plain copy of component parameters which does not depend on aircraft data.
+ */
+struct ComponentData
+{
+    std::string type;           ///< component XML tag name
+    std::string name;           ///< component name
+
+    Vector3 r;                  ///< [m] position
+
+    double m = 0.0;             ///< [kg] mass
+
+    double l = 0.0;             ///< [m] length
+    double w = 0.0;             ///< [m] width
+    double h = 0.0;             ///< [m] height
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // COMPONENTS_COMPONENTDATA_H_
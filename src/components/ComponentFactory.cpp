@@ -0,0 +1,115 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <components/ComponentFactory.h>
+
+#include <cstring>
+
+#include <components/AllElse.h>
+#include <components/Engine.h>
+#include <components/Fuselage.h>
+#include <components/GearMain.h>
+#include <components/GearNose.h>
+#include <components/RotorDrive.h>
+#include <components/RotorHub.h>
+#include <components/RotorMain.h>
+#include <components/RotorTail.h>
+#include <components/TailHor.h>
+#include <components/TailVer.h>
+#include <components/Wing.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+Component* ComponentFactory::create( const char *xmlTagName, const AircraftData *data )
+{
+    if      ( 0 == strcmp( xmlTagName, AllElse::xmlTagName ) )
+    {
+        return new AllElse( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, Engine::xmlTagName ) )
+    {
+        return new Engine( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, Fuselage::xmlTagName ) )
+    {
+        return new Fuselage( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, GearMain::xmlTagName ) )
+    {
+        return new GearMain( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, GearNose::xmlTagName ) )
+    {
+        return new GearNose( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, RotorDrive::xmlTagName ) )
+    {
+        return new RotorDrive( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, RotorHub::xmlTagName ) )
+    {
+        return new RotorHub( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, RotorMain::xmlTagName ) )
+    {
+        return new RotorMain( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, RotorTail::xmlTagName ) )
+    {
+        return new RotorTail( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, TailHor::xmlTagName ) )
+    {
+        return new TailHor( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, TailVer::xmlTagName ) )
+    {
+        return new TailVer( data );
+    }
+    else if ( 0 == strcmp( xmlTagName, Wing::xmlTagName ) )
+    {
+        return new Wing( data );
+    }
+
+    return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+Component* ComponentFactory::create( const ComponentData &componentData,
+                                     const AircraftData *data )
+{
+    Component *component = create( componentData.type.c_str(), data );
+
+    if ( component )
+    {
+        component->setComponentData( componentData );
+    }
+
+    return component;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
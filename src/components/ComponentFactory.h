@@ -0,0 +1,60 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef COMPONENTS_COMPONENTFACTORY_H_
+#define COMPONENTS_COMPONENTFACTORY_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <components/Component.h>
+#include <components/ComponentData.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The component factory class.
+ */
+class ComponentFactory
+{
+public:
+
+    /**
+     * @brief Creates component of the given type.
+     * @param xmlTagName component XML tag name
+     * @param data aircraft data struct
+     * @return new component or nullptr if type is not known
+     */
+    static Component* create( const char *xmlTagName, const AircraftData *data );
+
+    /**
+     * @brief Creates component and sets its parameters.
+     * @param componentData component data
+     * @param data aircraft data struct
+     * @return new component or nullptr if type is not known
+     */
+    static Component* create( const ComponentData &componentData, const AircraftData *data );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // COMPONENTS_COMPONENTFACTORY_H_
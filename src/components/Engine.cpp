@@ -19,7 +19,9 @@
 
 #include <components/Engine.h>
 
-#include <mcutil/misc/Units.h>
+#include <AircraftDataFields.h>
+
+#include <utils/Quantity.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -32,77 +34,85 @@ constexpr char Engine::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double Engine::estimateMass( const AircraftData &data )
 {
-    double w_en = Units::kg2lb( data.engine.mass );
+    Mass w_en( data.engine.mass );
 
-    double m1 = 0.0;
+    Mass m1;
     {
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
-            m1 = Units::lb2kg( 1.3 * w_en );
+            m1 = 1.3 * w_en;
         }
 
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            m1 = Units::lb2kg( 1.3 * w_en );
+            m1 = 1.3 * w_en;
         }
 
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m1 = Units::lb2kg( 1.4 * w_en );
+            m1 = 1.4 * w_en;
         }
 
         // engineering judgement (same as for CargoTransport)
-        if ( data.type == AircraftData::Helicopter )
+        if constexpr ( TYPE == AircraftData::Helicopter )
         {
-            m1 = Units::lb2kg( 1.3 * w_en );
+            m1 = 1.3 * w_en;
         }
     }
 
-    double m2 = 0.0;
-    {
-        double m2_lb = 0.0;
+    // no second method available for any type, same as m1
+    Mass m2 = m1;
 
-        //
-        if ( data.type == AircraftData::FighterAttack )
-        {
-            m2_lb = Units::kg2lb( m1 );
-        }
+    //std::cout << "Engine:  " << m1.getSI() << "  " << m2.getSI() << std::endl;
 
-        //
-        if ( data.type == AircraftData::CargoTransport )
-        {
-            m2_lb = Units::kg2lb( m1 );
-        }
+    return ( m1 + m2 ).getSI() / 2.0;
+}
 
-        //
-        if ( data.type == AircraftData::GeneralAviation )
-        {
-            m2_lb = Units::kg2lb( m1 );
-        }
+////////////////////////////////////////////////////////////////////////////////
 
-        //
-        if ( data.type == AircraftData::Helicopter )
-        {
-            m2_lb = Units::kg2lb( m1 );
-        }
+template double Engine::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double Engine::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double Engine::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double Engine::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
 
-        m2 = Units::lb2kg( m2_lb );
+////////////////////////////////////////////////////////////////////////////////
+
+double Engine::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
-    //std::cout << "Engine:  " << m1 << "  " << m2 << std::endl;
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const Component::Dependencies& Engine::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "engine.mass"
+    });
 
-    return ( m1 + m2 ) / 2.0;
+    return dependencies;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 Engine::Engine( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Engine" );
 }
@@ -19,9 +19,12 @@
 
 #include <components/Fuselage.h>
 
+#include <AircraftDataFields.h>
+
 #include <mcutil/misc/Units.h>
 
 #include <utils/Atmosphere.h>
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -34,51 +37,60 @@ constexpr char Fuselage::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double Fuselage::estimateMass( const AircraftData &data )
 {
-    double s_f = Units::sqm2sqft( data.fuselage.wetted_area );
+    Area s_f( data.fuselage.wetted_area );
 
     // Rayner: Aircraft Design, p.568, table 15.2
-    double m1 = 0.0;
+    Mass m1;
     {
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
-            m1 = Units::lb2kg( 4.8 * s_f );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 4.8, { 1.0 } );
+            m1 = table_15_2( s_f );
         }
 
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            m1 = Units::lb2kg( 5.0 * s_f );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 5.0, { 1.0 } );
+            m1 = table_15_2( s_f );
         }
 
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m1 = Units::lb2kg( 1.4 * s_f );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 1.4, { 1.0 } );
+            m1 = table_15_2( s_f );
         }
     }
 
-    double m2 = 0.0;
+    Mass m2;
     {
-        double m2_lb = 0.0;
-
-        double w_dg = Units::kg2lb( data.general.mtow );
-        double n_z  = 1.5 * data.general.nz_max;
-        double l_ft = Units::m2ft( data.fuselage.l );
-        double d_ft = Units::m2ft( data.fuselage.h );
-        double w_ft = Units::m2ft( data.fuselage.w );
+        Mass w_dg( data.general.mtow );
+        double n_z = 1.5 * data.general.nz_max;
+        Length l( data.fuselage.l );
+        Length d( data.fuselage.h );
+        Length w( data.fuselage.w );
 
         // Rayner: Aircraft Design, p.572, eq.15.4
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::One, Unit::Foot, Unit::Foot, Unit::Foot >
+                eq_15_4( 0.499, { 0.35, 0.25, 0.5, 0.849, 0.685 } );
+
             double k_dwf = data.wing.delta ? 0.774 : 1.0;
 
-            m2_lb = 0.499 * k_dwf * pow( w_dg, 0.35 ) * pow( n_z, 0.25 )
-                    * pow( l_ft, 0.5 ) * pow( d_ft, 0.849 ) * pow( w_ft, 0.685 );
+            m2 = k_dwf * eq_15_4( w_dg, n_z, l, d, w );
         }
 
         // Rayner: Aircraft Design, p.574, eq.15.28
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::Foot, Unit::SquareFoot, Unit::One, Unit::One >
+                eq_15_28( 0.328, { 0.5, 0.25, 0.302, 0.04, 0.1 } );
+
             double k_door = 1.0;
 
             switch ( data.fuselage.cargo_door )
@@ -92,65 +104,122 @@ double Fuselage::estimateMass( const AircraftData &data )
 
             double k_lg = data.fuselage.landing_gear ? 1.12 : 1.0;
 
-            double b_w = Units::m2ft( data.wing.span );
+            Length b_w( data.wing.span );
             double sweep_rad = Units::deg2rad( data.wing.sweep );
 
             double k_ws = 0.75
                     * ( (1.0 + 2.0 * data.wing.tr)/(1.0 + data.wing.tr) )
-                    * ( b_w * tan( sweep_rad ) / l_ft );
+                    * ( b_w * tan( sweep_rad ) / l );
 
-            m2_lb = 0.328 * k_door * k_lg * pow( w_dg * n_z, 0.5 )
-                            * pow( l_ft, 0.25 ) * pow( s_f, 0.302 ) * pow ( 1 + k_ws, 0.04 )
-                            * pow( l_ft / d_ft, 0.1 );
+            m2 = k_door * k_lg * eq_15_28( w_dg * n_z, l, s_f, 1.0 + k_ws, l / d );
         }
 
         // Rayner: Aircraft Design, p.576, eq.15.49
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            double l_t_ft = Units::m2ft( data.hor_tail.arm );
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::SquareFoot, Unit::Pound, Unit::Foot, Unit::One, Unit::PoundPerSquareFoot >
+                eq_15_49( 0.052, { 1.086, 0.177, -0.051, -0.072, 0.241 } );
+
+            // W_press = 11.9 + ( 8 * V_pr )^0.271
+            static constexpr PowerLaw< Unit::Pound, Unit::CubicFoot >
+                w_press_eq( ConstexprMath::pow( 8.0, 0.271 ), { 0.271 } );
+
+            Length l_t( data.hor_tail.arm );
 
-            double vol_press_cuft = Units::cum2cuft( data.fuselage.press_vol );
-            double w_press = 11.9 + pow( vol_press_cuft * 8.0, 0.271 );
+            Volume v_press( data.fuselage.press_vol );
+            Mass w_press = makeQuantity< Unit::Pound >( 11.9 ) + w_press_eq( v_press );
 
-            double v_mps = Units::kts2mps( data.general.v_cruise );
-            double h_m   = Units::ft2m( data.general.h_cruise );
-            double rho = Atmosphere::getDensity( h_m );
-            double q = 0.5 * rho * pow( v_mps, 2.0 );
-            double q_psf = Units::pa2psf( q );
+            Velocity v = makeQuantity< Unit::Knot >( data.general.v_cruise );
+            Length   h = makeQuantity< Unit::Foot >( data.general.h_cruise );
+            Density rho( Atmosphere::getDensity( h.getSI() ) );
+            Pressure q = 0.5 * rho * v * v;
 
-            m2_lb = 0.052 * pow( s_f, 1.086 ) * pow( n_z * w_dg, 0.177 )
-                            * pow( l_t_ft, -0.051 ) * pow ( l_ft / d_ft, -0.072 )
-                            * pow( q_psf, 0.241 ) + w_press;
+            m2 = eq_15_49( s_f, n_z * w_dg, l_t, l / d, q ) + w_press;
         }
 
         // NASA TP-2015-218751, p.232
-        if ( data.type == AircraftData::Helicopter )
+        if constexpr ( TYPE == AircraftData::Helicopter )
         {
+            // W_dg expressed in thousands of pounds
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::One, Unit::SquareFoot, Unit::Foot >
+                w_basic_eq( 5.896 * ConstexprMath::pow( 1000.0, -0.4908 ),
+                            { 0.4908, 0.1323, 0.2544, 0.61 } );
+
             double f_ramp = data.fuselage.cargo_ramp ? 1.3939 : 1.0;
 
-            double w_basic = 5.896 * f_ramp * pow( w_dg / 1000.0, 0.4908 )
-                    * pow( n_z, 0.1323 ) * pow( s_f, 0.2544 ) * pow( l_ft, 0.61 );
+            Mass w_basic = f_ramp * w_basic_eq( w_dg, n_z, s_f, l );
 
             double chi_basic = 1.0; // ?? technology factor
 
-            m2_lb = chi_basic * w_basic;
+            m2 = chi_basic * w_basic;
 
             // same as m2
-            m1 = Units::lb2kg( m2_lb );
+            m1 = m2;
         }
+    }
+
+    //std::cout << "Fuselage:  " << m1.getSI() << "  " << m2.getSI() << std::endl;
+
+    return ( m1 + m2 ).getSI() / 2.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template double Fuselage::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double Fuselage::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double Fuselage::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double Fuselage::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
 
-        m2 = Units::lb2kg( m2_lb );
+double Fuselage::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
-    //std::cout << "Fuselage:  " << m1 << "  " << m2 << std::endl;
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-    return ( m1 + m2 ) / 2.0;
+const Component::Dependencies& Fuselage::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "fuselage.cargo_door",
+        "fuselage.cargo_ramp",
+        "fuselage.h",
+        "fuselage.l",
+        "fuselage.landing_gear",
+        "fuselage.press_vol",
+        "fuselage.w",
+        "fuselage.wetted_area",
+        "general.h_cruise",
+        "general.mtow",
+        "general.nz_max",
+        "general.v_cruise",
+        "hor_tail.arm",
+        "wing.delta",
+        "wing.span",
+        "wing.sweep",
+        "wing.tr"
+    });
+
+    return dependencies;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 Fuselage::Fuselage( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Fuselage" );
 }
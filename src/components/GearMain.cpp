@@ -19,7 +19,9 @@
 
 #include <components/GearMain.h>
 
-#include <mcutil/misc/Units.h>
+#include <AircraftDataFields.h>
+
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -32,94 +34,151 @@ constexpr char GearMain::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double GearMain::estimateMass( const AircraftData &data )
 {
-    double w_dg = Units::kg2lb( data.general.mtow    );
-    double w_0  = Units::kg2lb( data.general.m_empty );
+    Mass w_dg( data.general.mtow    );
+    Mass w_0 ( data.general.m_empty );
 
-    double m1 = 0.0;
+    Mass m1;
     {
-        double reduce = data.landing_gear.fixed ? ( 0.014 * w_0 ) : 0.0;
+        Mass reduce = data.landing_gear.fixed ? ( 0.014 * w_0 ) : Mass();
 
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
             double coeff = data.general.navy_ac ? 0.045 : 0.033;
-            m1 = 0.85 * Units::lb2kg( coeff * w_dg - reduce );
+            m1 = 0.85 * ( coeff * w_dg - reduce );
         }
 
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            m1 = 0.85 * Units::lb2kg( 0.043 * w_dg - reduce );
+            m1 = 0.85 * ( 0.043 * w_dg - reduce );
         }
 
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m1 = 0.85 * Units::lb2kg( 0.057 * w_dg - reduce );
+            m1 = 0.85 * ( 0.057 * w_dg - reduce );
         }
 
         // NASA TP-2015-218751, p.233
-        if ( data.type == AircraftData::Helicopter )
+        if constexpr ( TYPE == AircraftData::Helicopter )
         {
-            m1 = Units::lb2kg( 0.0325 * w_dg );
+            m1 = 0.0325 * w_dg;
         }
     }
 
-    double m2 = 0.0;
+    Mass m2;
     {
-        double m2_lb = 0.0;
-
-        double w_l = Units::kg2lb( data.general.m_maxLand );
+        Mass w_l( data.general.m_maxLand );
         double n_l = 1.5 * data.general.nz_maxLand;
 
-        double l_m_in = Units::m2in( data.landing_gear.main_l );
+        Length l_m( data.landing_gear.main_l );
 
         // Rayner: Aircraft Design, p.572, eq.15.5
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
+            static constexpr PowerLaw< Unit::Pound, Unit::Pound, Unit::Inch >
+                eq_15_5( 1.0, { 0.25, 0.973 } );
+
             double k_cb  = data.landing_gear.cross  ? 2.25  : 1.0;
             double k_tpg = data.landing_gear.tripod ? 0.826 : 1.0;
 
-            m2_lb = k_cb * k_tpg * pow( w_l * n_l, 0.25 ) * pow( l_m_in, 0.973 );
+            m2 = k_cb * k_tpg * eq_15_5( w_l * n_l, l_m );
         }
 
         // Rayner: Aircraft Design, p.574, eq.15.29
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::One, Unit::Inch, Unit::One, Unit::One, Unit::Knot >
+                eq_15_29( 0.0106, { 0.888, 0.25, 0.4, 0.321, -0.5, 0.1 } );
+
             double k_mp = data.landing_gear.main_kneel ? 1.126 : 1.0;
 
-            m2_lb = 0.0106 * k_mp * pow( w_l, 0.888 ) * pow( n_l, 0.25 ) * pow( l_m_in, 0.4 )
-                    * pow( static_cast<double>(data.landing_gear.main_wheels), 0.321 )
-                    * pow( static_cast<double>(data.landing_gear.main_struts), -0.5 )
-                    * pow( data.general.v_stall, 0.1 );
+            m2 = k_mp * eq_15_29( w_l, n_l, l_m,
+                                  static_cast<double>(data.landing_gear.main_wheels),
+                                  static_cast<double>(data.landing_gear.main_struts),
+                                  makeQuantity< Unit::Knot >( data.general.v_stall ) );
         }
 
         // Rayner: Aircraft Design, p.576, eq.15.50
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m2_lb = 0.095 * pow( n_l * w_l, 0.768 ) * pow( l_m_in / 12.0, 0.409 );
+            static constexpr PowerLaw< Unit::Pound, Unit::Pound, Unit::Foot >
+                eq_15_50( 0.095, { 0.768, 0.409 } );
+
+            m2 = eq_15_50( n_l * w_l, l_m );
         }
 
         // NASA TP-2015-218751, p.233
-        if ( data.type == AircraftData::Helicopter )
+        if constexpr ( TYPE == AircraftData::Helicopter )
         {
-            m2_lb = 0.4013 * pow( w_dg, 0.6662 ) * pow ( n_l, 0.536 );
+            static constexpr PowerLaw< Unit::Pound, Unit::Pound, Unit::One >
+                w_lg_eq( 0.4013, { 0.6662, 0.536 } );
+
+            m2 = w_lg_eq( w_dg, n_l );
         }
+    }
+
+    //std::cout << "GearMain:  " << m1.getSI() << "  " << m2.getSI() << std::endl;
+
+    return ( m1 + m2 ).getSI() / 2.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-        m2 = Units::lb2kg( m2_lb );
+template double GearMain::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double GearMain::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double GearMain::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double GearMain::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
+
+double GearMain::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
-    //std::cout << "GearMain:  " << m1 << "  " << m2 << std::endl;
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-    return ( m1 + m2 ) / 2.0;
+const Component::Dependencies& GearMain::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "general.m_empty",
+        "general.m_maxLand",
+        "general.mtow",
+        "general.navy_ac",
+        "general.nz_maxLand",
+        "general.v_stall",
+        "landing_gear.cross",
+        "landing_gear.fixed",
+        "landing_gear.main_kneel",
+        "landing_gear.main_l",
+        "landing_gear.main_struts",
+        "landing_gear.main_wheels",
+        "landing_gear.tripod"
+    });
+
+    return dependencies;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 GearMain::GearMain( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Main Landing Gear" );
 }
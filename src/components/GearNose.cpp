@@ -19,7 +19,9 @@
 
 #include <components/GearNose.h>
 
-#include <mcutil/misc/Units.h>
+#include <AircraftDataFields.h>
+
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -32,79 +34,127 @@ constexpr char GearNose::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double GearNose::estimateMass( const AircraftData &data )
 {
-    double w_dg = Units::kg2lb( data.general.mtow );
-    double w_0  = Units::kg2lb( data.general.m_empty );
+    Mass w_dg( data.general.mtow );
+    Mass w_0 ( data.general.m_empty );
 
-    double m1 = 0.0;
+    Mass m1;
     {
-        double reduce = data.landing_gear.fixed ? ( 0.014 * w_0 ) : 0.0;
+        Mass reduce = data.landing_gear.fixed ? ( 0.014 * w_0 ) : Mass();
 
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
             double coeff = data.general.navy_ac ? 0.045 : 0.033;
-            m1 = 0.15 * Units::lb2kg( coeff * w_dg - reduce );
+            m1 = 0.15 * ( coeff * w_dg - reduce );
         }
 
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            m1 = 0.15 * Units::lb2kg( 0.043 * w_dg - reduce );
+            m1 = 0.15 * ( 0.043 * w_dg - reduce );
         }
 
         // Rayner: Aircraft Design, p.568, table 15.2
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m1 = 0.15 * Units::lb2kg( 0.057 * w_dg - reduce );
+            m1 = 0.15 * ( 0.057 * w_dg - reduce );
         }
     }
 
-    double m2 = 0.0;
+    Mass m2;
     {
-        double m2_lb = 0.0;
-
-        double w_l = Units::kg2lb( data.general.m_maxLand );
+        Mass w_l( data.general.m_maxLand );
         double n_l = 1.5 * data.general.nz_maxLand;
 
-        double l_n_in = Units::m2in( data.landing_gear.nose_l );
+        Length l_n( data.landing_gear.nose_l );
 
         // Rayner: Aircraft Design, p.572, eq.15.3
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
-            m2_lb = pow( w_l * n_l, 0.29 ) * pow( l_n_in, 0.5 )
-                  * pow( static_cast<double>(data.landing_gear.nose_wheels), 0.525 );
+            static constexpr PowerLaw< Unit::Pound, Unit::Pound, Unit::Inch, Unit::One >
+                eq_15_3( 1.0, { 0.29, 0.5, 0.525 } );
+
+            m2 = eq_15_3( w_l * n_l, l_n, static_cast<double>(data.landing_gear.nose_wheels) );
         }
 
         // Rayner: Aircraft Design, p.575, eq.15.27
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::One, Unit::Inch, Unit::One >
+                eq_15_27( 0.032, { 0.646, 0.2, 0.5, 0.45 } );
+
             double k_np = data.landing_gear.nose_kneel ? 1.15 : 1.0;
 
-            m2_lb = 0.032 * k_np * pow( w_l, 0.646 ) * pow( n_l, 0.2 ) * pow( l_n_in, 0.5 )
-                    * pow( static_cast<double>(data.landing_gear.nose_wheels), 0.45 );
+            m2 = k_np * eq_15_27( w_l, n_l, l_n, static_cast<double>(data.landing_gear.nose_wheels) );
         }
 
         // Rayner: Aircraft Design, p.576, eq.15.48
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m2_lb = 0.125 * pow( n_l * w_l, 0.566 ) * pow( l_n_in / 12.0, 0.845 )
-                    - ( data.landing_gear.fixed ? 0.014 * w_0 : 0.0 );
+            static constexpr PowerLaw< Unit::Pound, Unit::Pound, Unit::Foot >
+                eq_15_48( 0.125, { 0.566, 0.845 } );
+
+            m2 = eq_15_48( n_l * w_l, l_n )
+                    - ( data.landing_gear.fixed ? 0.014 * w_0 : Mass() );
         }
+    }
+
+    //std::cout << "GearNose:  " << m1.getSI() << "  " << m2.getSI() << std::endl;
+
+    return ( m1 + m2 ).getSI() / 2.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-        m2 = Units::lb2kg( m2_lb );
+template double GearNose::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double GearNose::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double GearNose::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double GearNose::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
+
+double GearNose::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
-    //std::cout << "GearNose:  " << m1 << "  " << m2 << std::endl;
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-    return ( m1 + m2 ) / 2.0;
+const Component::Dependencies& GearNose::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "general.m_empty",
+        "general.m_maxLand",
+        "general.mtow",
+        "general.navy_ac",
+        "general.nz_maxLand",
+        "landing_gear.fixed",
+        "landing_gear.nose_kneel",
+        "landing_gear.nose_l",
+        "landing_gear.nose_wheels"
+    });
+
+    return dependencies;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 GearNose::GearNose( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Nose Landing Gear" );
 }
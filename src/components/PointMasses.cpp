@@ -0,0 +1,178 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <components/PointMasses.h>
+
+#include <utils/HashUtils.h>
+#include <utils/MassKernels.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+template < typename T >
+static uint64_t hashArray( const std::vector< T > &values, uint64_t seed )
+{
+    return HashUtils::hash( values.data(), values.size() * sizeof( T ), seed );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void PointMasses::clear()
+{
+    _id.clear();
+
+    _m.clear();
+    _x.clear();
+    _y.clear();
+    _z.clear();
+
+    _i_xx.clear();
+    _i_yy.clear();
+    _i_zz.clear();
+    _i_xy.clear();
+    _i_xz.clear();
+    _i_yz.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void PointMasses::reserve( size_t count )
+{
+    _id.reserve( count );
+
+    _m.reserve( count );
+    _x.reserve( count );
+    _y.reserve( count );
+    _z.reserve( count );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void PointMasses::add( int64_t id, double m, const Vector3 &r )
+{
+    _id.push_back( id );
+
+    _m.push_back( m );
+    _x.push_back( r.x() );
+    _y.push_back( r.y() );
+    _z.push_back( r.z() );
+
+    if ( hasInertia() )
+    {
+        _i_xx.push_back( 0.0 );
+        _i_yy.push_back( 0.0 );
+        _i_zz.push_back( 0.0 );
+        _i_xy.push_back( 0.0 );
+        _i_xz.push_back( 0.0 );
+        _i_yz.push_back( 0.0 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void PointMasses::add( int64_t id, double m, const Vector3 &r, const InertiaTensor &i )
+{
+    if ( !hasInertia() )
+    {
+        // points added so far have no local inertia
+        _i_xx.resize( _m.size(), 0.0 );
+        _i_yy.resize( _m.size(), 0.0 );
+        _i_zz.resize( _m.size(), 0.0 );
+        _i_xy.resize( _m.size(), 0.0 );
+        _i_xz.resize( _m.size(), 0.0 );
+        _i_yz.resize( _m.size(), 0.0 );
+
+        _i_xx.reserve( _m.capacity() );
+        _i_yy.reserve( _m.capacity() );
+        _i_zz.reserve( _m.capacity() );
+        _i_xy.reserve( _m.capacity() );
+        _i_xz.reserve( _m.capacity() );
+        _i_yz.reserve( _m.capacity() );
+    }
+
+    _id.push_back( id );
+
+    _m.push_back( m );
+    _x.push_back( r.x() );
+    _y.push_back( r.y() );
+    _z.push_back( r.z() );
+
+    _i_xx.push_back( i.xx() );
+    _i_yy.push_back( i.yy() );
+    _i_zz.push_back( i.zz() );
+    _i_xy.push_back( i.xy() );
+    _i_xz.push_back( i.xz() );
+    _i_yz.push_back( i.yz() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void PointMasses::addTo( MassSums *sums, size_t first, size_t last ) const
+{
+    MassKernels::Arrays arrays;
+
+    arrays.m = _m.data();
+    arrays.x = _x.data();
+    arrays.y = _y.data();
+    arrays.z = _z.data();
+
+    if ( hasInertia() )
+    {
+        arrays.i_xx = _i_xx.data();
+        arrays.i_yy = _i_yy.data();
+        arrays.i_zz = _i_zz.data();
+        arrays.i_xy = _i_xy.data();
+        arrays.i_xz = _i_xz.data();
+        arrays.i_yz = _i_yz.data();
+    }
+
+    MassKernels::sum( arrays, first, last, sums );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t PointMasses::getHash( uint64_t seed ) const
+{
+    uint64_t count = getCount();
+    uint64_t hash = HashUtils::hash( &count, sizeof( count ), seed );
+
+    hash = hashArray( _id , hash );
+
+    hash = hashArray( _m , hash );
+    hash = hashArray( _x , hash );
+    hash = hashArray( _y , hash );
+    hash = hashArray( _z , hash );
+
+    hash = hashArray( _i_xx, hash );
+    hash = hashArray( _i_yy, hash );
+    hash = hashArray( _i_zz, hash );
+    hash = hashArray( _i_xy, hash );
+    hash = hashArray( _i_xz, hash );
+    hash = hashArray( _i_yz, hash );
+
+    return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,147 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef COMPONENTS_POINTMASSES_H_
+#define COMPONENTS_POINTMASSES_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+
+#include <mcutil/math/Vector3.h>
+
+#include <utils/InertiaTensor.h>
+#include <utils/MassSums.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The point (lumped) masses class.
+ *
+ * Stores large sets of point masses, as exported from CAD and FEM tools,
+ * in a structure of arrays instead of one component object per point.
+ * Local inertia arrays are allocated only when at least one point has
+ * its own inertia.
+ */
+class PointMasses
+{
+public:
+
+    /** @brief Removes all points. */
+    void clear();
+
+    /**
+     * @brief Reserves space for given number of points.
+     * @param count number of points
+     */
+    void reserve( size_t count );
+
+    /**
+     * @brief Adds point mass.
+     * @param id point id
+     * @param m [kg] mass
+     * @param r [m] position
+     */
+    void add( int64_t id, double m, const Vector3 &r );
+
+    /**
+     * @brief Adds point mass with local inertia.
+     * @param id point id
+     * @param m [kg] mass
+     * @param r [m] position
+     * @param i [kg*m^2] inertia tensor about the point
+     */
+    void add( int64_t id, double m, const Vector3 &r, const InertiaTensor &i );
+
+    /**
+     * @brief Adds point mass to the sums.
+     * @param sums mass sums
+     * @param index point index
+     */
+    inline void addTo( MassSums *sums, size_t index ) const
+    {
+        Vector3 r = getPosition( index );
+        InertiaTensor i = InertiaTensor::getCuboid( _m[ index ], 0.0, 0.0, 0.0, r );
+
+        if ( hasInertia() ) i += getInertia( index );
+
+        sums->add( _m[ index ], r, i );
+    }
+
+    /**
+     * @brief Adds point masses of the given range to the sums.
+     * @param sums mass sums
+     * @param first index of the first point
+     * @param last index past the last point
+     */
+    void addTo( MassSums *sums, size_t first, size_t last ) const;
+
+    /**
+     * @brief Returns hash of all points data.
+     * @param seed hash seed
+     * @return hash value
+     */
+    uint64_t getHash( uint64_t seed ) const;
+
+    inline size_t getCount() const { return _m.size(); }
+
+    inline bool hasInertia() const { return !_i_xx.empty(); }
+
+    inline int64_t getId   ( size_t index ) const { return _id [ index ]; }
+    inline double  getMass ( size_t index ) const { return _m  [ index ]; }
+
+    inline Vector3 getPosition( size_t index ) const
+    {
+        return Vector3( _x[ index ], _y[ index ], _z[ index ] );
+    }
+
+    /** @brief Returns [kg*m^2] local inertia about the point. */
+    inline InertiaTensor getInertia( size_t index ) const
+    {
+        if ( !hasInertia() ) return InertiaTensor();
+
+        return InertiaTensor( _i_xx[ index ], _i_yy[ index ], _i_zz[ index ],
+                              _i_xy[ index ], _i_xz[ index ], _i_yz[ index ] );
+    }
+
+private:
+
+    std::vector< int64_t > _id;     ///< points ids
+
+    std::vector< double > _m;       ///< [kg] masses
+    std::vector< double > _x;       ///< [m] positions x-coordinates
+    std::vector< double > _y;       ///< [m] positions y-coordinates
+    std::vector< double > _z;       ///< [m] positions z-coordinates
+
+    std::vector< double > _i_xx;    ///< [kg*m^2] local inertia xx elements
+    std::vector< double > _i_yy;    ///< [kg*m^2] local inertia yy elements
+    std::vector< double > _i_zz;    ///< [kg*m^2] local inertia zz elements
+    std::vector< double > _i_xy;    ///< [kg*m^2] local inertia xy elements
+    std::vector< double > _i_xz;    ///< [kg*m^2] local inertia xz elements
+    std::vector< double > _i_yz;    ///< [kg*m^2] local inertia yz elements
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // COMPONENTS_POINTMASSES_H_
@@ -19,7 +19,9 @@
 
 #include <components/RotorDrive.h>
 
-#include <mcutil/misc/Units.h>
+#include <AircraftDataFields.h>
+
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -32,21 +34,28 @@ constexpr char RotorDrive::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double RotorDrive::estimateMass( const AircraftData &data )
 {
     // NASA TP-2015-218751, p.236
-    if ( data.type == AircraftData::Helicopter )
+    if constexpr ( TYPE == AircraftData::Helicopter )
     {
+        static constexpr PowerLaw< Unit::Pound,
+                Unit::One, Unit::Horsepower, Unit::Rpm, Unit::Rpm >
+            w_dt_eq( 95.7634, { 0.38553, 0.78137, 0.09899, -0.80686 } );
+
         double n_rotor = 1.0; // number of rotors
 
         double chi = 1.0; // ?? technology factor
 
-        double engine_rpm = data.rotors.main_gear_ratio * data.rotors.main_rpm;
+        AngularVelocity rotor_rpm  = makeQuantity< Unit::Rpm >( data.rotors.main_rpm );
+        AngularVelocity engine_rpm = data.rotors.main_gear_ratio * rotor_rpm;
+
+        Power mcp = makeQuantity< Unit::Horsepower >( data.rotors.mcp );
 
-        double m_lb = chi * 95.7634 * pow( n_rotor, 0.38553 ) * pow( data.rotors.mcp, 0.78137 )
-                * pow( engine_rpm, 0.09899 ) / pow( data.rotors.main_rpm, 0.80686 );
+        Mass m = chi * w_dt_eq( n_rotor, mcp, engine_rpm, rotor_rpm );
 
-        return Units::lb2kg( m_lb );
+        return m.getSI();
     }
 
     return 0.0;
@@ -54,8 +63,45 @@ double RotorDrive::estimateMass( const AircraftData &data )
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template double RotorDrive::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double RotorDrive::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double RotorDrive::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double RotorDrive::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
+
+double RotorDrive::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
+    }
+
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const Component::Dependencies& RotorDrive::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "rotors.main_gear_ratio",
+        "rotors.main_rpm",
+        "rotors.mcp"
+    });
+
+    return dependencies;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 RotorDrive::RotorDrive( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Rotor Drive" );
 }
@@ -19,7 +19,9 @@
 
 #include <components/RotorHub.h>
 
-#include <mcutil/misc/Units.h>
+#include <AircraftDataFields.h>
+
+#include <utils/PowerLaw.h>
 
 #include <components/RotorMain.h>
 
@@ -34,29 +36,35 @@ constexpr char RotorHub::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double RotorHub::estimateMass( const AircraftData &data )
 {
     // NASA TP-2015-218751, p.228
-    if ( data.type == AircraftData::Helicopter )
+    if constexpr ( TYPE == AircraftData::Helicopter )
     {
+        // blade mass is taken in kilograms, as it always was, since estimates
+        // and data files are calibrated against it
+        static constexpr PowerLaw< Unit::Pound,
+                Unit::One, Unit::Foot, Unit::FootPerSecond, Unit::One, Unit::Kilogram >
+            w_hub_eq( 0.003722, { 0.2807, 1.5377, 0.429, 2.1414, 0.5505 } );
+
         double n_rotor = 1.0; // number of rotors
 
-        double r_ft = Units::m2ft( data.rotors.main_r );
+        Length r( data.rotors.main_r );
 
-        double v_tip_fps = Units::mps2fps( data.rotors.main_tip_vel );
+        Velocity v_tip( data.rotors.main_tip_vel );
 
         double mu_h = 1.0; // ?? flap natural frequency
 
         double chi_h = 1.0; // ?? technology factor
 
-        double w_b = RotorMain::estimateMass( data );
+        Mass w_b( RotorMain::estimateMass< TYPE >( data ) );
 
-        double m_lb = chi_h * 0.003722 * n_rotor
-                * pow( static_cast<double>(data.rotors.main_blades), 0.2807 )
-                * pow( r_ft, 1.5377 ) * pow( v_tip_fps, 0.429 ) * pow( mu_h, 2.1414 )
-                * pow( w_b / n_rotor, 0.5505 );
+        Mass m = chi_h * n_rotor
+                * w_hub_eq( static_cast<double>(data.rotors.main_blades),
+                            r, v_tip, mu_h, w_b / n_rotor );
 
-        return Units::lb2kg( m_lb );
+        return m.getSI();
     }
 
     return 0.0;
@@ -64,8 +72,46 @@ double RotorHub::estimateMass( const AircraftData &data )
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template double RotorHub::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double RotorHub::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double RotorHub::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double RotorHub::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
+
+double RotorHub::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
+    }
+
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const Component::Dependencies& RotorHub::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "rotors.main_blades",
+        "rotors.main_cb",
+        "rotors.main_r",
+        "rotors.main_tip_vel"
+    });
+
+    return dependencies;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 RotorHub::RotorHub( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Main Rotor Hub" );
 }
@@ -19,7 +19,9 @@
 
 #include <components/RotorMain.h>
 
-#include <mcutil/misc/Units.h>
+#include <AircraftDataFields.h>
+
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -32,27 +34,32 @@ constexpr char RotorMain::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double RotorMain::estimateMass( const AircraftData &data )
 {
     // NASA TP-2015-218751, p.228
-    if ( data.type == AircraftData::Helicopter )
+    if constexpr ( TYPE == AircraftData::Helicopter )
     {
+        static constexpr PowerLaw< Unit::Pound,
+                Unit::One, Unit::Foot, Unit::Foot, Unit::FootPerSecond, Unit::One >
+            w_blade_eq( 0.02606, { 0.6592, 1.3371, 0.9959, 0.6682, 2.5279 } );
+
         double n_rotor = 1.0; // number of rotors
 
-        double r_ft = Units::m2ft( data.rotors.main_r  );
-        double c_ft = Units::m2ft( data.rotors.main_cb );
+        Length r( data.rotors.main_r  );
+        Length c( data.rotors.main_cb );
 
-        double v_tip_fps = Units::mps2fps( data.rotors.main_tip_vel );
+        Velocity v_tip( data.rotors.main_tip_vel );
 
         double mu_b = 1.0; // ?? flap natural frequency
 
         double chi_b = 1.0; // ?? technology factor
 
-        double m_lb = chi_b * 0.02606 * n_rotor * pow( static_cast<double>(data.rotors.main_blades), 0.6592 )
-                * pow( r_ft, 1.3371 ) * pow( c_ft, 0.9959 )
-                * pow( v_tip_fps, 0.6682 ) * pow( mu_b, 2.5279 );
+        Mass m = chi_b * n_rotor
+                * w_blade_eq( static_cast<double>(data.rotors.main_blades),
+                              r, c, v_tip, mu_b );
 
-        return Units::lb2kg( m_lb );
+        return m.getSI();
     }
 
     return 0.0;
@@ -60,8 +67,46 @@ double RotorMain::estimateMass( const AircraftData &data )
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template double RotorMain::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double RotorMain::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double RotorMain::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double RotorMain::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
+
+double RotorMain::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
+    }
+
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const Component::Dependencies& RotorMain::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "rotors.main_blades",
+        "rotors.main_cb",
+        "rotors.main_r",
+        "rotors.main_tip_vel"
+    });
+
+    return dependencies;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 RotorMain::RotorMain( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Main Rotor" );
 }
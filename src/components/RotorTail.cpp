@@ -19,7 +19,9 @@
 
 #include <components/RotorTail.h>
 
-#include <mcutil/misc/Units.h>
+#include <AircraftDataFields.h>
+
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -32,22 +34,49 @@ constexpr char RotorTail::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double RotorTail::estimateMass( const AircraftData &data )
 {
     // NASA TP-2015-218751, p.230
-    if ( data.type == AircraftData::Helicopter )
+    if constexpr ( TYPE == AircraftData::Helicopter )
     {
+        static constexpr PowerLaw< Unit::Pound, Unit::Foot, Unit::HorsepowerSecond >
+            w_tr_eq( 1.3778, { 0.0897, 0.8951 } );
+
         double chi_tr = 1.0; // ?? technology factor
 
-        double r_mr_ft = Units::m2ft( data.rotors.main_r );
-        double r_tr_ft = Units::m2ft( data.rotors.tail_r );
+        Length r_mr( data.rotors.main_r );
+        Length r_tr( data.rotors.tail_r );
+
+        Velocity v_tip( data.rotors.main_tip_vel );
+
+        Power mcp = makeQuantity< Unit::Horsepower >( data.rotors.mcp );
+
+        Mass m = chi_tr * w_tr_eq( r_tr, mcp * r_mr / v_tip );
+
+        return m.getSI();
+    }
+
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-        double v_tip_fps = Units::mps2fps( data.rotors.main_tip_vel );
+template double RotorTail::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double RotorTail::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double RotorTail::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double RotorTail::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
 
-        double m_lb = chi_tr * 1.3778 * pow( r_tr_ft, 0.0897 )
-                * pow( data.rotors.mcp * r_mr_ft / v_tip_fps, 0.8951 );
+////////////////////////////////////////////////////////////////////////////////
 
-        return Units::lb2kg( m_lb );
+double RotorTail::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
     return 0.0;
@@ -55,8 +84,24 @@ double RotorTail::estimateMass( const AircraftData &data )
 
 ////////////////////////////////////////////////////////////////////////////////
 
+const Component::Dependencies& RotorTail::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "rotors.main_r",
+        "rotors.main_tip_vel",
+        "rotors.mcp",
+        "rotors.tail_r"
+    });
+
+    return dependencies;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 RotorTail::RotorTail( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Tail Rotor" );
 }
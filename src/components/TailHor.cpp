@@ -19,9 +19,12 @@
 
 #include <components/TailHor.h>
 
+#include <AircraftDataFields.h>
+
 #include <mcutil/misc/Units.h>
 
 #include <utils/Atmosphere.h>
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -34,103 +37,159 @@ constexpr char TailHor::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double TailHor::estimateMass( const AircraftData &data )
 {
-    double s_ht = Units::sqm2sqft( data.hor_tail.area );
+    Area s_ht( data.hor_tail.area );
 
     // Rayner: Aircraft Design, p.568, table 15.2
-    double m1 = 0.0;
+    Mass m1;
     {
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
-            m1 = Units::lb2kg( 4.0 * s_ht );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 4.0, { 1.0 } );
+            m1 = table_15_2( s_ht );
         }
 
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            m1 = Units::lb2kg( 5.5 * s_ht );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 5.5, { 1.0 } );
+            m1 = table_15_2( s_ht );
         }
 
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m1 = Units::lb2kg( 2.0 * s_ht );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 2.0, { 1.0 } );
+            m1 = table_15_2( s_ht );
         }
     }
 
-    double m2 = 0.0;
+    Mass m2;
     {
-        double m2_lb = 0.0;
-
-        double w_dg  = Units::kg2lb( data.general.mtow );
-        double n_z   = 1.5 * data.general.nz_max;
+        Mass w_dg( data.general.mtow );
+        double n_z = 1.5 * data.general.nz_max;
 
-        double f_w_ft = Units::m2ft( data.hor_tail.w_f );
-        double b_h_ft = Units::m2ft( data.hor_tail.span );
+        Length f_w( data.hor_tail.w_f );
+        Length b_h( data.hor_tail.span );
 
         double sweep_rad = Units::deg2rad( data.hor_tail.sweep );
 
         // Rayner: Aircraft Design, p.572, eq.15.2
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
-            m2_lb = 3.316 * pow( 1 + f_w_ft / b_h_ft, -2.0 )
-                    * pow( w_dg * n_z / 1000.0, 0.26 )
-                    * pow( s_ht, 0.806 );
+            // W_dg * N_z expressed in thousands of pounds
+            static constexpr PowerLaw< Unit::Pound, Unit::One, Unit::Pound, Unit::SquareFoot >
+                eq_15_2( 3.316 * ConstexprMath::pow( 1000.0, -0.26 ), { -2.0, 0.26, 0.806 } );
+
+            m2 = eq_15_2( 1.0 + f_w / b_h, w_dg * n_z, s_ht );
         }
 
         // Rayner: Aircraft Design, p.574, eq.15.26
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::One, Unit::Pound, Unit::One, Unit::SquareFoot, Unit::Foot,
+                    Unit::Foot, Unit::One, Unit::One, Unit::One >
+                eq_15_26( 0.0379, { -0.25, 0.639, 0.1, 0.75, -1.0, 0.704, -1.0, 0.166, 0.1 } );
+
             double k_uht = data.hor_tail.moving ? 1.143 : 1.0;
 
-            double l_t_ft = Units::m2ft( data.hor_tail.arm );
-            double k_y = 0.3 * l_t_ft;
+            Length l_t( data.hor_tail.arm );
+            Length k_y = 0.3 * l_t;
 
-            double s_e = Units::sqm2sqft( data.hor_tail.elev_area );
+            Area s_e( data.hor_tail.elev_area );
 
-            m2_lb = 0.0379 * k_uht * pow( 1.0 + f_w_ft / b_h_ft, -0.25 )
-                    * pow( w_dg, 0.639 ) * pow( n_z, 0.1 ) * pow( s_ht, 0.75 )
-                    * pow( l_t_ft, -1.0 ) * pow( k_y, 0.704 )
-                    * pow( cos( sweep_rad ), -1.0 ) * pow( data.hor_tail.ar, 0.166 )
-                    * pow( 1.0 + s_e / s_ht, 0.1 );
+            m2 = k_uht * eq_15_26( 1.0 + f_w / b_h, w_dg, n_z, s_ht, l_t, k_y,
+                                   cos( sweep_rad ), data.hor_tail.ar, 1.0 + s_e / s_ht );
         }
 
         // Rayner: Aircraft Design, p.576, eq.15.47
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            double v_mps = Units::kts2mps( data.general.v_cruise );
-            double h_m   = Units::ft2m( data.general.h_cruise );
-            double rho = Atmosphere::getDensity( h_m );
-            double q = 0.5 * rho * pow( v_mps, 2.0 );
-            double q_psf = Units::pa2psf( q );
-
-            m2_lb = 0.016 * pow( n_z * w_dg, 0.414 ) * pow( q_psf, 0.006 )
-                    * pow( data.hor_tail.tr, 0.04 )
-                    * pow( 100.0 * data.hor_tail.t_c / cos( sweep_rad ), -0.3 )
-                    * pow( n_z * w_dg, 0.49 );
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::PoundPerSquareFoot, Unit::One, Unit::One, Unit::Pound >
+                eq_15_47( 0.016, { 0.414, 0.006, 0.04, -0.3, 0.49 } );
+
+            Velocity v = makeQuantity< Unit::Knot >( data.general.v_cruise );
+            Length   h = makeQuantity< Unit::Foot >( data.general.h_cruise );
+            Density rho( Atmosphere::getDensity( h.getSI() ) );
+            Pressure q = 0.5 * rho * v * v;
+
+            m2 = eq_15_47( n_z * w_dg, q, data.hor_tail.tr,
+                           100.0 * data.hor_tail.t_c / cos( sweep_rad ), n_z * w_dg );
         }
 
         // NASA TP-2015-218751, p.230
-        if ( data.type == AircraftData::Helicopter )
+        if constexpr ( TYPE == AircraftData::Helicopter )
         {
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot, Unit::One >
+                w_ht_eq( 0.7176, { 1.1881, 0.3173 } );
+
             double chi_ht = 1.0; // ?? technology factor
 
-            m2_lb = chi_ht * 0.7176 * pow( s_ht, 1.1881 ) * pow( data.hor_tail.ar, 0.3173 );
+            m2 = chi_ht * w_ht_eq( s_ht, data.hor_tail.ar );
 
-            m1 = Units::lb2kg( m2_lb ); // same as m2
+            m1 = m2; // same as m2
         }
+    }
+
+    //std::cout << "TailHor:  " << m1.getSI() << "  " << m2.getSI() << std::endl;
+
+    return ( m1 + m2 ).getSI() / 2.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template double TailHor::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double TailHor::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double TailHor::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double TailHor::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
 
-        m2 = Units::lb2kg( m2_lb );
+double TailHor::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
-    //std::cout << "TailHor:  " << m1 << "  " << m2 << std::endl;
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-    return ( m1 + m2 ) / 2.0;
+const Component::Dependencies& TailHor::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "general.h_cruise",
+        "general.mtow",
+        "general.nz_max",
+        "general.v_cruise",
+        "hor_tail.ar",
+        "hor_tail.area",
+        "hor_tail.arm",
+        "hor_tail.elev_area",
+        "hor_tail.moving",
+        "hor_tail.span",
+        "hor_tail.sweep",
+        "hor_tail.t_c",
+        "hor_tail.tr",
+        "hor_tail.w_f"
+    });
+
+    return dependencies;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 TailHor::TailHor( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Horizontal Tail" );
 }
@@ -19,9 +19,12 @@
 
 #include <components/TailVer.h>
 
+#include <AircraftDataFields.h>
+
 #include <mcutil/misc/Units.h>
 
 #include <utils/Atmosphere.h>
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -34,110 +37,173 @@ constexpr char TailVer::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double TailVer::estimateMass( const AircraftData &data )
 {
-    double s_vt = Units::sqm2sqft( data.ver_tail.area );
+    Area s_vt( data.ver_tail.area );
 
     // Rayner: Aircraft Design, p.568, table 15.2
-    double m1 = 0.0;
+    Mass m1;
     {
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
-            m1 = Units::lb2kg( 5.3 * s_vt );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 5.3, { 1.0 } );
+            m1 = table_15_2( s_vt );
         }
 
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            m1 = Units::lb2kg( 5.5 * s_vt );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 5.5, { 1.0 } );
+            m1 = table_15_2( s_vt );
         }
 
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m1 = Units::lb2kg( 2.0 * s_vt );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 2.0, { 1.0 } );
+            m1 = table_15_2( s_vt );
         }
     }
 
-    double m2 = 0.0;
+    Mass m2;
     {
-        double m2_lb = 0.0;
-
-        double w_dg  = Units::kg2lb( data.general.mtow );
-        double n_z   = 1.5 * data.general.nz_max;
+        Mass w_dg( data.general.mtow );
+        double n_z = 1.5 * data.general.nz_max;
 
-        double l_t_ft = Units::m2ft( data.ver_tail.arm );
+        Length l_t( data.ver_tail.arm );
 
         double ht_hv = data.ver_tail.t_tail ? 1.0 : 0.0;
 
         double sweep_rad = Units::deg2rad( data.ver_tail.sweep );
 
         // Rayner: Aircraft Design, p.572, eq.15.3
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
-            double s_r = Units::sqm2sqft( data.ver_tail.rudd_area );
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::One, Unit::Pound, Unit::SquareFoot, Unit::One, Unit::Foot,
+                    Unit::One, Unit::One, Unit::One, Unit::One >
+                eq_15_3( 0.452, { 0.5, 0.488, 0.718, 0.341, -1.0, 0.348, 0.223, 0.25, -0.323 } );
+
+            Area s_r( data.ver_tail.rudd_area );
 
             double k_rht = data.hor_tail.rolling ? 1.047 : 1.0;
 
-            m2_lb = 0.452 * k_rht * pow( 1.0 + ht_hv, 0.5 ) * pow( w_dg * n_z, 0.488 )
-                    * pow( s_vt, 0.718 ) * pow( data.general.mach_max, 0.341 ) * pow( l_t_ft, -1.0 )
-                    * pow( 1.0 + s_r / s_vt, 0.348 ) * pow( data.ver_tail.ar, 0.223 )
-                    * pow( 1.0 + data.ver_tail.tr, 0.25 ) * pow( cos( sweep_rad ), -0.323 );
+            m2 = k_rht * eq_15_3( 1.0 + ht_hv, w_dg * n_z, s_vt, data.general.mach_max, l_t,
+                                  1.0 + s_r / s_vt, data.ver_tail.ar, 1.0 + data.ver_tail.tr,
+                                  cos( sweep_rad ) );
         }
 
         // Rayner: Aircraft Design, p.574, eq.15.27
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            double k_z = l_t_ft;
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::One, Unit::Pound, Unit::One, Unit::Foot, Unit::SquareFoot,
+                    Unit::Foot, Unit::One, Unit::One, Unit::One >
+                eq_15_27( 0.0026, { 0.225, 0.556, 0.536, -0.5, 0.5, 0.875, -1.0, 0.35, -0.5 } );
 
-            m2_lb = 0.0026 * pow( 1.0 + ht_hv, 0.225 ) * pow( w_dg, 0.556 )
-                    * pow( n_z, 0.536 ) * pow( l_t_ft, -0.5 ) * pow( s_vt, 0.5 )
-                    * pow( k_z, 0.875 ) * pow( cos( sweep_rad ), -1.0 )
-                    * pow( data.ver_tail.ar, 0.35 ) * pow( data.ver_tail.t_c, -0.5 );
+            Length k_z = l_t;
+
+            m2 = eq_15_27( 1.0 + ht_hv, w_dg, n_z, l_t, s_vt, k_z,
+                           cos( sweep_rad ), data.ver_tail.ar, data.ver_tail.t_c );
         }
 
         // Rayner: Aircraft Design, p.576, eq.15.48
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            double v_mps = Units::kts2mps( data.general.v_cruise );
-            double h_m   = Units::ft2m( data.general.h_cruise );
-            double rho = Atmosphere::getDensity( h_m );
-            double q = 0.5 * rho * pow( v_mps, 2.0 );
-            double q_psf = Units::pa2psf( q );
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::PoundPerSquareFoot, Unit::SquareFoot,
+                    Unit::One, Unit::One, Unit::One >
+                eq_15_48( 0.073, { 0.376, 0.122, 0.873, -0.49, 0.357, 0.039 } );
+
+            Velocity v = makeQuantity< Unit::Knot >( data.general.v_cruise );
+            Length   h = makeQuantity< Unit::Foot >( data.general.h_cruise );
+            Density rho( Atmosphere::getDensity( h.getSI() ) );
+            Pressure q = 0.5 * rho * v * v;
 
             double lambda_vt = data.ver_tail.tr;
 
             if ( lambda_vt < 0.2 ) lambda_vt = 0.2;
 
-            m2_lb = 0.073 * ( 1.0 + 0.2 * ht_hv ) * pow( n_z * w_dg, 0.376 )
-                    * pow( q_psf, 0.122 ) * pow( s_vt, 0.873 )
-                    * pow( 100.0 * data.ver_tail.t_c / cos( sweep_rad ), -0.49 )
-                    * pow( data.ver_tail.ar / pow( cos( sweep_rad ), 2.0 ), 0.357 )
-                    * pow( lambda_vt, 0.039 );
+            double cos_sweep = cos( sweep_rad );
+
+            m2 = ( 1.0 + 0.2 * ht_hv )
+                    * eq_15_48( n_z * w_dg, q, s_vt, 100.0 * data.ver_tail.t_c / cos_sweep,
+                                data.ver_tail.ar / ( cos_sweep * cos_sweep ), lambda_vt );
         }
 
         // NASA TP-2015-218751, p.230
-        if ( data.type == AircraftData::Helicopter )
+        if constexpr ( TYPE == AircraftData::Helicopter )
         {
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot, Unit::One >
+                w_vt_eq( 1.046, { 0.9441, 0.5332 } );
+
             double f_tr = data.ver_tail.rotor ? 1.6311 : 1.0;
 
             double chi_vt = 1.0; // ?? technology factor
 
-            m2_lb = chi_vt * 1.046 * f_tr * pow( s_vt, 0.9441 ) * pow( data.ver_tail.ar, 0.5332 );
+            m2 = chi_vt * f_tr * w_vt_eq( s_vt, data.ver_tail.ar );
 
-            m1 = Units::lb2kg( m2_lb ); // same as m2
+            m1 = m2; // same as m2
         }
+    }
+
+    //std::cout << "TailVer:  " << m1.getSI() << "  " << m2.getSI() << std::endl;
+
+    return ( m1 + m2 ).getSI() / 2.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template double TailVer::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double TailVer::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double TailVer::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double TailVer::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
 
-        m2 = Units::lb2kg( m2_lb );
+double TailVer::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
-    //std::cout << "TailVer:  " << m1 << "  " << m2 << std::endl;
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-    return ( m1 + m2 ) / 2.0;
+const Component::Dependencies& TailVer::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "general.h_cruise",
+        "general.mach_max",
+        "general.mtow",
+        "general.nz_max",
+        "general.v_cruise",
+        "hor_tail.rolling",
+        "ver_tail.ar",
+        "ver_tail.area",
+        "ver_tail.arm",
+        "ver_tail.rotor",
+        "ver_tail.rudd_area",
+        "ver_tail.sweep",
+        "ver_tail.t_c",
+        "ver_tail.t_tail",
+        "ver_tail.tr"
+    });
+
+    return dependencies;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 TailVer::TailVer( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Vertical Tail" );
 }
@@ -19,9 +19,12 @@
 
 #include <components/Wing.h>
 
+#include <AircraftDataFields.h>
+
 #include <mcutil/misc/Units.h>
 
 #include <utils/Atmosphere.h>
+#include <utils/PowerLaw.h>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -34,91 +37,151 @@ constexpr char Wing::xmlTagName[];
 
 ////////////////////////////////////////////////////////////////////////////////
 
+template < AircraftData::Type TYPE >
 double Wing::estimateMass( const AircraftData &data )
 {
-    double s_w = Units::sqm2sqft( data.wing.area_exp );
+    Area s_w( data.wing.area_exp );
 
     // Rayner: Aircraft Design, p.568, table 15.2
-    double m1 = 0.0;
+    Mass m1;
     {
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
-            m1 = Units::lb2kg( 9.0 * s_w );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 9.0, { 1.0 } );
+            m1 = table_15_2( s_w );
         }
 
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            m1 = Units::lb2kg( 10.0 * s_w );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 10.0, { 1.0 } );
+            m1 = table_15_2( s_w );
         }
 
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            m1 = Units::lb2kg( 2.5 * s_w );
+            static constexpr PowerLaw< Unit::Pound, Unit::SquareFoot > table_15_2( 2.5, { 1.0 } );
+            m1 = table_15_2( s_w );
         }
     }
 
-    double m2 = 0.0;
+    Mass m2;
     {
-        double m2_lb = 0.0;
-
-        double w_dg  = Units::kg2lb( data.general.mtow );
-        double n_z   = 1.5 * data.general.nz_max;
+        Mass w_dg( data.general.mtow );
+        double n_z = 1.5 * data.general.nz_max;
 
+        // control surfaces area enters eq.15.1 and eq.15.25 as kg2lb() of
+        // the area in square meters, as it always did, since estimates and
+        // data files are calibrated against it
         double s_csw = Units::kg2lb( data.wing.ctrl_area );
 
         double sweep_rad = Units::deg2rad( data.wing.sweep );
 
         // Rayner: Aircraft Design, p.572, eq.15.1
-        if ( data.type == AircraftData::FighterAttack )
+        if constexpr ( TYPE == AircraftData::FighterAttack )
         {
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::SquareFoot, Unit::One, Unit::One,
+                    Unit::One, Unit::One, Unit::One >
+                eq_15_1( 0.0103, { 0.5, 0.622, 0.785, -0.4, 0.05, -1.0, 0.04 } );
+
             double k_vs  = data.wing.var_sweep ? 1.19  : 1.0;
             double k_dw  = data.wing.delta     ? 0.768 : 1.0;
 
-            m2_lb = 0.0103 * k_dw * k_vs * pow( w_dg * n_z, 0.5 )
-                    * pow( s_w, 0.622 ) * pow( data.wing.ar, 0.785 ) * pow( data.wing.t_c, -0.4 )
-                    * pow( 1.0 + data.wing.tr, 0.05 ) * pow( cos( sweep_rad ), -1.0 )
-                    * pow( s_csw, 0.04 );
+            m2 = k_dw * k_vs * eq_15_1( w_dg * n_z, s_w, data.wing.ar, data.wing.t_c,
+                                        1.0 + data.wing.tr, cos( sweep_rad ), s_csw );
         }
 
         // Rayner: Aircraft Design, p.574, eq.15.25
-        if ( data.type == AircraftData::CargoTransport )
+        if constexpr ( TYPE == AircraftData::CargoTransport )
         {
-            m2_lb = 0.0051 * pow( w_dg * n_z, 0.557 )
-                    * pow( s_w, 0.649 ) * pow( data.wing.ar, 0.5 ) * pow( data.wing.t_c, -0.4 )
-                    * pow( 1.0 + data.wing.tr, 0.1 ) * pow( cos( sweep_rad ), -1.0 )
-                    * pow( s_csw, 0.1 );
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::Pound, Unit::SquareFoot, Unit::One, Unit::One,
+                    Unit::One, Unit::One, Unit::One >
+                eq_15_25( 0.0051, { 0.557, 0.649, 0.5, -0.4, 0.1, -1.0, 0.1 } );
+
+            m2 = eq_15_25( w_dg * n_z, s_w, data.wing.ar, data.wing.t_c,
+                           1.0 + data.wing.tr, cos( sweep_rad ), s_csw );
         }
 
         // Rayner: Aircraft Design, p.575, eq.15.46
-        if ( data.type == AircraftData::GeneralAviation )
+        if constexpr ( TYPE == AircraftData::GeneralAviation )
         {
-            double w_fw  = Units::kg2lb( data.wing.fuel );
-
-            double v_mps = Units::kts2mps( data.general.v_cruise );
-            double h_m   = Units::ft2m( data.general.h_cruise );
-            double rho = Atmosphere::getDensity( h_m );
-            double q = 0.5 * rho * pow( v_mps, 2.0 );
-            double q_psf = Units::pa2psf( q );
-
-            m2_lb = 0.036 * pow( s_w, 0.758 ) * pow( w_fw, 0.0035 )
-                    * pow( data.wing.ar / pow( cos( sweep_rad ), 2.0 ), 0.6 )
-                    * pow( q_psf, 0.006 ) * pow( data.wing.tr, 0.04 )
-                    * pow( 100 * data.wing.t_c / cos( sweep_rad ), -0.3 )
-                    * pow( w_dg * n_z, 0.49 );
+            static constexpr PowerLaw< Unit::Pound,
+                    Unit::SquareFoot, Unit::Pound, Unit::One, Unit::PoundPerSquareFoot,
+                    Unit::One, Unit::One, Unit::Pound >
+                eq_15_46( 0.036, { 0.758, 0.0035, 0.6, 0.006, 0.04, -0.3, 0.49 } );
+
+            Mass w_fw( data.wing.fuel );
+
+            Velocity v = makeQuantity< Unit::Knot >( data.general.v_cruise );
+            Length   h = makeQuantity< Unit::Foot >( data.general.h_cruise );
+            Density rho( Atmosphere::getDensity( h.getSI() ) );
+            Pressure q = 0.5 * rho * v * v;
+
+            double cos_sweep = cos( sweep_rad );
+
+            m2 = eq_15_46( s_w, w_fw, data.wing.ar / ( cos_sweep * cos_sweep ),
+                           q, data.wing.tr, 100.0 * data.wing.t_c / cos_sweep,
+                           w_dg * n_z );
         }
+    }
+
+    //std::cout << "Wing:  " << m1.getSI() << "  " << m2.getSI() << std::endl;
 
-        m2 = Units::lb2kg( m2_lb );
+    return ( m1 + m2 ).getSI() / 2.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template double Wing::estimateMass< AircraftData::FighterAttack   >( const AircraftData &data );
+template double Wing::estimateMass< AircraftData::CargoTransport  >( const AircraftData &data );
+template double Wing::estimateMass< AircraftData::GeneralAviation >( const AircraftData &data );
+template double Wing::estimateMass< AircraftData::Helicopter      >( const AircraftData &data );
+
+////////////////////////////////////////////////////////////////////////////////
+
+double Wing::estimateMass( const AircraftData &data )
+{
+    switch ( data.type )
+    {
+        case AircraftData::FighterAttack:   return estimateMass< AircraftData::FighterAttack   >( data );
+        case AircraftData::CargoTransport:  return estimateMass< AircraftData::CargoTransport  >( data );
+        case AircraftData::GeneralAviation: return estimateMass< AircraftData::GeneralAviation >( data );
+        case AircraftData::Helicopter:      return estimateMass< AircraftData::Helicopter      >( data );
     }
 
-    //std::cout << "Wing:  " << m1 << "  " << m2 << std::endl;
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-    return ( m1 + m2 ) / 2.0;
+const Component::Dependencies& Wing::getDependencies()
+{
+    static const Dependencies dependencies = AircraftDataFields::getIndices(
+    {
+        "type",
+        "general.h_cruise",
+        "general.mtow",
+        "general.nz_max",
+        "general.v_cruise",
+        "wing.ar",
+        "wing.area_exp",
+        "wing.ctrl_area",
+        "wing.delta",
+        "wing.fuel",
+        "wing.sweep",
+        "wing.t_c",
+        "wing.tr",
+        "wing.var_sweep"
+    });
+
+    return dependencies;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 Wing::Wing( const AircraftData *data ) :
-    Component( data )
+    Component( data, &getDependencies() )
 {
     setName( "Wing" );
 }
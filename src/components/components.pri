@@ -1,10 +1,14 @@
 HEADERS += \
     $$PWD/AllElse.h \
+    $$PWD/Assembly.h \
     $$PWD/Component.h \
+    $$PWD/ComponentData.h \
+    $$PWD/ComponentFactory.h \
     $$PWD/Engine.h \
     $$PWD/Fuselage.h \
     $$PWD/GearMain.h \
     $$PWD/GearNose.h \
+    $$PWD/PointMasses.h \
     $$PWD/RotorDrive.h \
     $$PWD/RotorHub.h \
     $$PWD/RotorMain.h \
@@ -15,11 +19,14 @@ HEADERS += \
 
 SOURCES += \
     $$PWD/AllElse.cpp \
+    $$PWD/Assembly.cpp \
     $$PWD/Component.cpp \
+    $$PWD/ComponentFactory.cpp \
     $$PWD/Engine.cpp \
     $$PWD/Fuselage.cpp \
     $$PWD/GearMain.cpp \
     $$PWD/GearNose.cpp \
+    $$PWD/PointMasses.cpp \
     $$PWD/RotorDrive.cpp \
     $$PWD/RotorHub.cpp \
     $$PWD/RotorMain.cpp \
@@ -0,0 +1,385 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <diff/AircraftDiff.h>
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+#include <AircraftDataFields.h>
+#include <DataFile.h>
+
+#include <utils/HashUtils.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** The component matching key, refers to the component strings. */
+struct Key
+{
+    const char *type;       ///< component XML tag name
+    const char *name;       ///< component name
+
+    explicit Key( const Component *component ) :
+        type ( component->getXmlTagName() ),
+        name ( component->getName() )
+    {}
+
+    inline bool operator== ( const Key &key ) const
+    {
+        return strcmp( type, key.type ) == 0 && strcmp( name, key.name ) == 0;
+    }
+};
+
+/** The component matching key hash. */
+struct KeyHash
+{
+    inline size_t operator() ( const Key &key ) const
+    {
+        return HashUtils::hash( key.name, strlen( key.name ),
+                                HashUtils::hash( key.type, strlen( key.type ) ) );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Checks if matched components parameters are the same. */
+static bool isSame( const Component *c1, const Component *c2 )
+{
+    return c1->getMass()   == c2->getMass()
+        && c1->getLength() == c2->getLength()
+        && c1->getWidth()  == c2->getWidth()
+        && c1->getHeight() == c2->getHeight()
+        && c1->getPosition().x() == c2->getPosition().x()
+        && c1->getPosition().y() == c2->getPosition().y()
+        && c1->getPosition().z() == c2->getPosition().z();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Adds component contribution to the mass characteristics delta. */
+static void addContribution( AircraftDiff::ComponentDelta *delta,
+                             const ComponentData &data, double sign )
+{
+    const double m = sign * data.m;
+
+    delta->mass        += m;
+    delta->firstMoment += data.r * m;
+    delta->inertia     += InertiaTensor::getCuboid( m, data.l, data.w, data.h, data.r );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Prints component parameters. */
+static void printComponent( std::stringstream *ss, const char *prefix,
+                            const ComponentData &data )
+{
+    *ss << prefix
+        << "mass [kg]: " << std::setprecision( 3 ) << data.m
+        << "  position [m]: " << data.r.x() << " " << data.r.y() << " " << data.r.z()
+        << "  size [m]: " << data.l << " " << data.w << " " << data.h
+        << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::vector< int > AircraftDiff::match( const Aircraft::Components &oldComponents,
+                                        const Aircraft::Components &newComponents )
+{
+    const int oldCount = static_cast< int >( oldComponents.size() );
+    const int newCount = static_cast< int >( newComponents.size() );
+
+    std::vector< int > result( oldCount, -1 );
+
+    // common prefix and suffix, usually most of the components, are matched by position
+    int prefix = 0;
+    int suffix = 0;
+
+    while ( prefix < oldCount && prefix < newCount
+         && Key( oldComponents[ prefix ] ) == Key( newComponents[ prefix ] ) )
+    {
+        result[ prefix ] = prefix;
+        ++prefix;
+    }
+
+    while ( prefix + suffix < oldCount && prefix + suffix < newCount
+         && Key( oldComponents[ oldCount - 1 - suffix ] ) == Key( newComponents[ newCount - 1 - suffix ] ) )
+    {
+        result[ oldCount - 1 - suffix ] = newCount - 1 - suffix;
+        ++suffix;
+    }
+
+    // remaining new components of the same key are chained in order of occurrence
+    std::unordered_map< Key, int, KeyHash > heads;
+    heads.reserve( newCount - prefix - suffix );
+
+    std::vector< int > next( newCount, -1 );
+
+    for ( int i = newCount - 1 - suffix; i >= prefix; --i )
+    {
+        std::pair< std::unordered_map< Key, int, KeyHash >::iterator, bool > it
+                = heads.emplace( Key( newComponents[ i ] ), i );
+
+        if ( !it.second )
+        {
+            next[ i ] = it.first->second;
+            it.first->second = i;
+        }
+    }
+
+    for ( int i = prefix; i < oldCount - suffix; ++i )
+    {
+        std::unordered_map< Key, int, KeyHash >::iterator it = heads.find( Key( oldComponents[ i ] ) );
+
+        if ( it != heads.end() && it->second >= 0 )
+        {
+            result[ i ] = it->second;
+            it->second = next[ it->second ];
+        }
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool AircraftDiff::isSame( const ComponentData &c1, const ComponentData &c2 )
+{
+    return c1.type == c2.type
+        && c1.name == c2.name
+        && c1.m == c2.m
+        && c1.l == c2.l
+        && c1.w == c2.w
+        && c1.h == c2.h
+        && c1.r.x() == c2.r.x()
+        && c1.r.y() == c2.r.y()
+        && c1.r.z() == c2.r.z();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+AircraftDiff::AircraftDiff() :
+    _pointMassesChanged ( false ),
+    _oldMassTotal ( 0.0 ),
+    _newMassTotal ( 0.0 )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void AircraftDiff::compare( const Aircraft &oldAircraft, const Aircraft &newAircraft )
+{
+    _fields.clear();
+    _components.clear();
+
+    // aircraft data
+    for ( int i = 0; i < AircraftDataFields::getCount(); ++i )
+    {
+        FieldDelta delta;
+
+        delta.index    = i;
+        delta.oldValue = AircraftDataFields::getValue( *oldAircraft.getData(), i );
+        delta.newValue = AircraftDataFields::getValue( *newAircraft.getData(), i );
+
+        if ( delta.oldValue != delta.newValue ) _fields.push_back( delta );
+    }
+
+    // components, removed and modified in the old order, then added in the new order
+    const Aircraft::Components &oldComponents = oldAircraft.getComponents();
+    const Aircraft::Components &newComponents = newAircraft.getComponents();
+
+    std::vector< int > matches = match( oldComponents, newComponents );
+    std::vector< bool > matched( newComponents.size(), false );
+
+    for ( int i = 0; i < static_cast< int >( oldComponents.size() ); ++i )
+    {
+        const int j = matches[ i ];
+
+        if ( j >= 0 )
+        {
+            matched[ j ] = true;
+
+            if ( mc::isSame( oldComponents[ i ], newComponents[ j ] ) ) continue;
+        }
+
+        ComponentDelta delta;
+
+        delta.oldIndex = i;
+        delta.newIndex = j;
+        delta.oldData  = oldComponents[ i ]->getComponentData();
+
+        if ( j < 0 )
+        {
+            delta.change = Removed;
+        }
+        else
+        {
+            delta.change  = Modified;
+            delta.newData = newComponents[ j ]->getComponentData();
+
+            addContribution( &delta, delta.newData, 1.0 );
+        }
+
+        addContribution( &delta, delta.oldData, -1.0 );
+
+        _components.push_back( delta );
+    }
+
+    for ( int i = 0; i < static_cast< int >( newComponents.size() ); ++i )
+    {
+        if ( matched[ i ] ) continue;
+
+        ComponentDelta delta;
+
+        delta.change   = Added;
+        delta.newIndex = i;
+        delta.newData  = newComponents[ i ]->getComponentData();
+
+        addContribution( &delta, delta.newData, 1.0 );
+
+        _components.push_back( delta );
+    }
+
+    // point masses
+    const PointMasses &oldPoints = oldAircraft.getPointMasses();
+    const PointMasses &newPoints = newAircraft.getPointMasses();
+
+    _pointMassesChanged = oldPoints.getCount() != newPoints.getCount()
+                       || oldPoints.getHash( 0 ) != newPoints.getHash( 0 );
+
+    // results
+    _oldMassTotal     = oldAircraft.getMassTotal();
+    _newMassTotal     = newAircraft.getMassTotal();
+    _oldCenterOfMass  = oldAircraft.getCenterOfMass();
+    _newCenterOfMass  = newAircraft.getCenterOfMass();
+    _oldInertiaMatrix = oldAircraft.getInertiaMatrix();
+    _newInertiaMatrix = newAircraft.getInertiaMatrix();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool AircraftDiff::compareFiles( const char *oldFileName, const char *newFileName )
+{
+    DataFile oldFile;
+    DataFile newFile;
+
+    if ( !oldFile.readFile( oldFileName ) ) return false;
+    if ( !newFile.readFile( newFileName ) ) return false;
+
+    compare( *oldFile.getAircraft(), *newFile.getAircraft() );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool AircraftDiff::isEmpty() const
+{
+    return _fields.empty() && _components.empty() && !_pointMassesChanged;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::string AircraftDiff::toString() const
+{
+    std::stringstream ss;
+
+    ss.setf( std::ios_base::showpoint );
+    ss.setf( std::ios_base::fixed );
+
+    for ( const FieldDelta &field : _fields )
+    {
+        ss << "field " << AircraftDataFields::getField( field.index ).name << ": ";
+        ss << std::setprecision( 6 ) << field.oldValue << " -> " << field.newValue;
+        ss << std::endl;
+    }
+
+    for ( const ComponentDelta &component : _components )
+    {
+        const ComponentData &data = ( component.change == Added ) ? component.newData
+                                                                  : component.oldData;
+
+        switch ( component.change )
+        {
+            case Added:    ss << "component added: ";    break;
+            case Removed:  ss << "component removed: ";  break;
+            case Modified: ss << "component modified: "; break;
+        }
+
+        ss << data.type << " \"" << data.name << "\"";
+        ss << std::endl;
+
+        if ( component.change != Added   ) printComponent( &ss, "  - ", component.oldData );
+        if ( component.change != Removed ) printComponent( &ss, "  + ", component.newData );
+    }
+
+    if ( _pointMassesChanged ) ss << "point masses changed" << std::endl;
+
+    ss << "mass [kg]: ";
+    ss << std::setprecision( 1 ) << _oldMassTotal << " -> " << _newMassTotal;
+    ss << " (" << std::showpos << ( _newMassTotal - _oldMassTotal ) << std::noshowpos << ")";
+    ss << std::endl;
+
+    const Vector3 dr = _newCenterOfMass - _oldCenterOfMass;
+
+    ss << "center of mass delta [m]: ";
+    ss << std::setfill(' ') << std::setw( 8 ) << std::setprecision( 3 ) << dr.x();
+    ss << " ";
+    ss << std::setfill(' ') << std::setw( 8 ) << std::setprecision( 3 ) << dr.y();
+    ss << " ";
+    ss << std::setfill(' ') << std::setw( 8 ) << std::setprecision( 3 ) << dr.z();
+    ss << std::endl;
+
+    const Matrix3x3 di = _newInertiaMatrix - _oldInertiaMatrix;
+
+    ss << "inertia delta [kg*m^2]:";
+    ss << std::endl;
+
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.xx();
+    ss << " ";
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.xy();
+    ss << " ";
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.xz();
+    ss << std::endl;
+
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.yx();
+    ss << " ";
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.yy();
+    ss << " ";
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.yz();
+    ss << std::endl;
+
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.zx();
+    ss << " ";
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.zy();
+    ss << " ";
+    ss << std::setfill(' ') << std::setw( 12 ) << std::setprecision( 1 ) << di.zz();
+    ss << std::endl;
+
+    return ss.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,168 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef DIFF_AIRCRAFTDIFF_H_
+#define DIFF_AIRCRAFTDIFF_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <mcutil/math/Matrix3x3.h>
+#include <mcutil/math/Vector3.h>
+
+#include <Aircraft.h>
+
+#include <components/ComponentData.h>
+
+#include <utils/InertiaTensor.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The aircraft structural difference class.
+ *
+ * Compares two aircraft field by field and component by component.
+ * Components are matched by XML tag name and name, components of the same
+ * tag and name are matched in order of occurrence, so changing component
+ * type or name is reported as removal and addition. Assemblies are not
+ * compared, as components positions are in the aircraft axes anyway.
+ * Comparison is exact, as values read from the same file text are equal.
+ */
+class AircraftDiff
+{
+public:
+
+    /**
+     * @brief The component change enum.
+     */
+    enum Change
+    {
+        Added = 0,                  ///< component added
+        Removed,                    ///< component removed
+        Modified                    ///< component parameters modified
+    };
+
+    /**
+     * @brief The aircraft data field difference struct.
+     */
+    struct FieldDelta
+    {
+        int index = -1;             ///< field index, see AircraftDataFields
+        double oldValue = 0.0;      ///< old value
+        double newValue = 0.0;      ///< new value
+    };
+
+    /**
+     * @brief The component difference struct.
+     */
+    struct ComponentDelta
+    {
+        Change change = Modified;   ///< change
+
+        int oldIndex = -1;          ///< old component index, -1 if added
+        int newIndex = -1;          ///< new component index, -1 if removed
+
+        ComponentData oldData;      ///< old component parameters
+        ComponentData newData;      ///< new component parameters
+
+        double mass = 0.0;          ///< [kg] mass delta
+        Vector3 firstMoment;        ///< [kg*m] first moment of mass delta
+        InertiaTensor inertia;      ///< [kg*m^2] inertia about the reference point delta
+    };
+
+    typedef std::vector< FieldDelta     > FieldDeltas;
+    typedef std::vector< ComponentDelta > ComponentDeltas;
+
+    /**
+     * @brief Matches components by XML tag name and name.
+     * @param oldComponents old components
+     * @param newComponents new components
+     * @return index of matching new component for every old component, -1 if there is none
+     */
+    static std::vector< int > match( const Aircraft::Components &oldComponents,
+                                     const Aircraft::Components &newComponents );
+
+    /**
+     * @brief Checks if components parameters are the same.
+     * @param c1 first component parameters
+     * @param c2 second component parameters
+     * @return true if parameters are the same
+     */
+    static bool isSame( const ComponentData &c1, const ComponentData &c2 );
+
+    /** @brief Constructor. */
+    AircraftDiff();
+
+    /**
+     * @brief Compares aircraft.
+     * @param oldAircraft old aircraft
+     * @param newAircraft new aircraft
+     */
+    void compare( const Aircraft &oldAircraft, const Aircraft &newAircraft );
+
+    /**
+     * @brief Compares aircraft files.
+     * @param oldFileName old aircraft file name
+     * @param newFileName new aircraft file name
+     * @return returns true on success and false if any of files cannot be read
+     */
+    bool compareFiles( const char *oldFileName, const char *newFileName );
+
+    /** @brief Returns true if aircraft are the same. */
+    bool isEmpty() const;
+
+    inline const FieldDeltas&     getFields     () const { return _fields;     }
+    inline const ComponentDeltas& getComponents () const { return _components; }
+
+    inline bool isPointMassesChanged() const { return _pointMassesChanged; }
+
+    inline double    getOldMassTotal     () const { return _oldMassTotal;     }
+    inline double    getNewMassTotal     () const { return _newMassTotal;     }
+    inline Vector3   getOldCenterOfMass  () const { return _oldCenterOfMass;  }
+    inline Vector3   getNewCenterOfMass  () const { return _newCenterOfMass;  }
+    inline Matrix3x3 getOldInertiaMatrix () const { return _oldInertiaMatrix; }
+    inline Matrix3x3 getNewInertiaMatrix () const { return _newInertiaMatrix; }
+
+    /** @brief Returns differences as human readable text. */
+    std::string toString() const;
+
+private:
+
+    FieldDeltas     _fields;        ///< aircraft data fields differences
+    ComponentDeltas _components;    ///< components differences
+
+    bool _pointMassesChanged;       ///< specifies if CAD/FEM point masses differ
+
+    double    _oldMassTotal;        ///< [kg] old total mass
+    double    _newMassTotal;        ///< [kg] new total mass
+    Vector3   _oldCenterOfMass;     ///< [m] old center of mass position
+    Vector3   _newCenterOfMass;     ///< [m] new center of mass position
+    Matrix3x3 _oldInertiaMatrix;    ///< [kg*m^2] old inertia
+    Matrix3x3 _newInertiaMatrix;    ///< [kg*m^2] new inertia
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // DIFF_AIRCRAFTDIFF_H_
@@ -0,0 +1,225 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <diff/AircraftMerge.h>
+
+#include <set>
+
+#include <AircraftDataFields.h>
+#include <DataFile.h>
+
+#include <components/ComponentFactory.h>
+
+#include <diff/AircraftDiff.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Checks if point masses are the same. */
+static bool isSame( const PointMasses &p1, const PointMasses &p2 )
+{
+    return p1.getCount() == p2.getCount() && p1.getHash( 0 ) == p2.getHash( 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool AircraftMerge::merge( const Aircraft &base, const Aircraft &theirs, Aircraft *ours,
+                           Conflicts *conflicts )
+{
+    bool result = true;
+
+    auto addConflict = [ &result, conflicts ]( const std::string &description )
+    {
+        result = false;
+        if ( conflicts ) conflicts->push_back( description );
+    };
+
+    auto getDescription = []( const ComponentData &data )
+    {
+        return data.type + " \"" + data.name + "\"";
+    };
+
+    // aircraft data
+    AircraftData data = *ours->getData();
+
+    for ( int i = 0; i < AircraftDataFields::getCount(); ++i )
+    {
+        const double valueBase   = AircraftDataFields::getValue( *base.getData(), i );
+        const double valueOurs   = AircraftDataFields::getValue( data, i );
+        const double valueTheirs = AircraftDataFields::getValue( *theirs.getData(), i );
+
+        if ( valueTheirs == valueBase || valueTheirs == valueOurs ) continue;
+
+        if ( valueOurs == valueBase )
+        {
+            AircraftDataFields::setValue( data, i, valueTheirs );
+        }
+        else
+        {
+            addConflict( std::string( "field " ) + AircraftDataFields::getField( i ).name
+                         + " modified on both sides" );
+        }
+    }
+
+    ours->setData( data );
+
+    // components of the base
+    const Aircraft::Components &componentsBase   = base.getComponents();
+    const Aircraft::Components &componentsOurs   = ours->getComponents();
+    const Aircraft::Components &componentsTheirs = theirs.getComponents();
+
+    std::vector< int > matchesOurs   = AircraftDiff::match( componentsBase, componentsOurs   );
+    std::vector< int > matchesTheirs = AircraftDiff::match( componentsBase, componentsTheirs );
+
+    std::vector< bool > matchedOurs   ( componentsOurs.size()   , false );
+    std::vector< bool > matchedTheirs ( componentsTheirs.size() , false );
+
+    std::set< int > removed;
+
+    for ( size_t i = 0; i < componentsBase.size(); ++i )
+    {
+        const int o = matchesOurs   [ i ];
+        const int t = matchesTheirs [ i ];
+
+        if ( o >= 0 ) matchedOurs   [ o ] = true;
+        if ( t >= 0 ) matchedTheirs [ t ] = true;
+
+        const ComponentData dataBase = componentsBase[ i ]->getComponentData();
+
+        const bool changedOurs = o >= 0
+                && !AircraftDiff::isSame( dataBase, componentsOurs[ o ]->getComponentData() );
+
+        if ( t < 0 )
+        {
+            if ( o < 0 ) continue;
+
+            if ( changedOurs )
+            {
+                addConflict( "component " + getDescription( dataBase )
+                             + " removed by theirs and modified by ours" );
+            }
+            else
+            {
+                removed.insert( o );
+            }
+
+            continue;
+        }
+
+        const ComponentData dataTheirs = componentsTheirs[ t ]->getComponentData();
+
+        if ( AircraftDiff::isSame( dataBase, dataTheirs ) ) continue;
+
+        if ( o < 0 )
+        {
+            addConflict( "component " + getDescription( dataBase )
+                         + " modified by theirs and removed by ours" );
+        }
+        else if ( !changedOurs )
+        {
+            componentsOurs[ o ]->setComponentData( dataTheirs );
+        }
+        else if ( !AircraftDiff::isSame( componentsOurs[ o ]->getComponentData(), dataTheirs ) )
+        {
+            addConflict( "component " + getDescription( dataBase )
+                         + " modified on both sides" );
+        }
+    }
+
+    // components added on both sides
+    Aircraft::Components addedOurs;
+    Aircraft::Components addedTheirs;
+
+    for ( size_t i = 0; i < componentsOurs.size(); ++i )
+    {
+        if ( !matchedOurs[ i ] ) addedOurs.push_back( componentsOurs[ i ] );
+    }
+
+    for ( size_t i = 0; i < componentsTheirs.size(); ++i )
+    {
+        if ( !matchedTheirs[ i ] ) addedTheirs.push_back( componentsTheirs[ i ] );
+    }
+
+    std::vector< int > matchesAdded = AircraftDiff::match( addedTheirs, addedOurs );
+
+    Aircraft::Components added;
+
+    for ( size_t i = 0; i < addedTheirs.size(); ++i )
+    {
+        const ComponentData dataTheirs = addedTheirs[ i ]->getComponentData();
+
+        if ( matchesAdded[ i ] < 0 )
+        {
+            added.push_back( ComponentFactory::create( dataTheirs, ours->getData() ) );
+        }
+        else if ( !AircraftDiff::isSame( dataTheirs, addedOurs[ matchesAdded[ i ] ]->getComponentData() ) )
+        {
+            addConflict( "component " + getDescription( dataTheirs )
+                         + " added on both sides" );
+        }
+    }
+
+    ours->delComponents( removed );
+    ours->addComponents( added );
+
+    // point masses
+    if ( !isSame( theirs.getPointMasses(), base.getPointMasses() )
+      && !isSame( theirs.getPointMasses(), ours->getPointMasses() ) )
+    {
+        if ( isSame( ours->getPointMasses(), base.getPointMasses() ) )
+        {
+            ours->setPointMasses( theirs.getPointMasses(), theirs.getPointMassesFile().c_str() );
+        }
+        else
+        {
+            addConflict( "point masses modified on both sides" );
+        }
+    }
+
+    ours->update();
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool AircraftMerge::mergeFiles( const char *baseFileName, const char *oursFileName,
+                                const char *theirsFileName, const char *outputFileName,
+                                Conflicts *conflicts )
+{
+    DataFile baseFile;
+    DataFile oursFile;
+    DataFile theirsFile;
+
+    if ( !baseFile   .readFile( baseFileName   ) ) return false;
+    if ( !oursFile   .readFile( oursFileName   ) ) return false;
+    if ( !theirsFile .readFile( theirsFileName ) ) return false;
+
+    merge( *baseFile.getAircraft(), *theirsFile.getAircraft(), oursFile.getAircraft(), conflicts );
+
+    return oursFile.saveFile( outputFileName );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
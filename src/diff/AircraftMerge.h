@@ -0,0 +1,79 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef DIFF_AIRCRAFTMERGE_H_
+#define DIFF_AIRCRAFTMERGE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <Aircraft.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The aircraft three-way merge class.
+ *
+ * Merges changes made in "their" aircraft since the common base into "our"
+ * aircraft, which is edited in place, so its assemblies are preserved.
+ * Components are matched as by AircraftDiff. Aircraft data fields, components
+ * and point masses changed on both sides differently are conflicts, which
+ * are resolved in favour of our side and reported.
+ */
+class AircraftMerge
+{
+public:
+
+    typedef std::vector< std::string > Conflicts;
+
+    /**
+     * @brief Merges their changes into our aircraft.
+     * @param base common base aircraft
+     * @param theirs their aircraft
+     * @param ours our aircraft, merge result
+     * @param conflicts output conflicts descriptions, may be null
+     * @return returns true if there were no conflicts
+     */
+    static bool merge( const Aircraft &base, const Aircraft &theirs, Aircraft *ours,
+                       Conflicts *conflicts = nullptr );
+
+    /**
+     * @brief Merges aircraft files.
+     * @param baseFileName common base aircraft file name
+     * @param oursFileName our aircraft file name
+     * @param theirsFileName their aircraft file name
+     * @param outputFileName merged aircraft file name
+     * @param conflicts output conflicts descriptions, may be null
+     * @return returns true on success and false if any of files cannot be
+     * read or written, conflicts are not failures
+     */
+    static bool mergeFiles( const char *baseFileName, const char *oursFileName,
+                            const char *theirsFileName, const char *outputFileName,
+                            Conflicts *conflicts = nullptr );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // DIFF_AIRCRAFTMERGE_H_
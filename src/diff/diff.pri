@@ -0,0 +1,7 @@
+HEADERS += \
+    $$PWD/AircraftDiff.h \
+    $$PWD/AircraftMerge.h
+
+SOURCES += \
+    $$PWD/AircraftDiff.cpp \
+    $$PWD/AircraftMerge.cpp
@@ -0,0 +1,281 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <estimation/EstimationEnsemble.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include <defs.h>
+
+#include <estimation/RaymerMethod.h>
+#include <estimation/TorenbeekMethod.h>
+#include <estimation/UsafMethod.h>
+
+#include <utils/ThreadPool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+EstimationEnsemble::EstimationEnsemble()
+{
+    addMethod( new RaymerMethod()    );
+    addMethod( new TorenbeekMethod() );
+    addMethod( new UsafMethod()      );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+EstimationEnsemble::~EstimationEnsemble()
+{
+    for ( EstimationMethod *method : _methods )
+    {
+        DELPTR( method );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationEnsemble::addMethod( EstimationMethod *method )
+{
+    _methods.push_back( method );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationEnsemble::evaluate( const Aircraft &aircraft, Results *results ) const
+{
+    std::vector< Results > fleetResults;
+
+    evaluate( std::vector< const Aircraft* >( 1, &aircraft ), &fleetResults );
+
+    results->swap( fleetResults[ 0 ] );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationEnsemble::evaluate( const std::vector< const Aircraft* > &fleet,
+                                   std::vector< Results > *results ) const
+{
+    static const int parallelThreshold = 256;
+
+    const int methodsCount = static_cast< int >( _methods.size() );
+
+    // every task estimates mass of the components of single type of single
+    // aircraft with all methods
+    struct Task
+    {
+        const AircraftData *data;
+        Result estimate;
+    };
+
+    std::vector< Task > tasks;
+    std::vector< std::vector< int > > componentsTasks( fleet.size() );
+
+    results->clear();
+    results->resize( fleet.size() );
+
+    for ( size_t i = 0; i < fleet.size(); ++i )
+    {
+        const Aircraft::Components &components = fleet[ i ]->getComponents();
+
+        // aircraft tasks indices by component type
+        std::map< std::string, int > aircraftTasks;
+
+        ( *results )[ i ].resize( components.size() );
+
+        for ( size_t j = 0; j < components.size(); ++j )
+        {
+            Result &result = ( *results )[ i ][ j ];
+
+            result.name = components[ j ]->getName();
+            result.type = components[ j ]->getXmlTagName();
+
+            std::map< std::string, int >::iterator it = aircraftTasks.find( result.type );
+
+            if ( it == aircraftTasks.end() )
+            {
+                it = aircraftTasks.insert( std::make_pair( result.type,
+                                                           static_cast< int >( tasks.size() ) ) ).first;
+
+                Task task;
+                task.data = fleet[ i ]->getData();
+                task.estimate.type = result.type;
+
+                tasks.push_back( task );
+            }
+
+            componentsTasks[ i ].push_back( it->second );
+        }
+    }
+
+    auto estimate = [ this, &tasks, methodsCount ]( int index )
+    {
+        Task &task = tasks[ index ];
+
+        task.estimate.masses.assign( methodsCount, std::numeric_limits< double >::quiet_NaN() );
+
+        for ( int k = 0; k < methodsCount; ++k )
+        {
+            double mass = 0.0;
+
+            if ( _methods[ k ]->estimateMass( task.estimate.type.c_str(), *task.data, &mass ) )
+            {
+                task.estimate.masses[ k ] = mass;
+            }
+        }
+
+        computeStatistics( &task.estimate );
+    };
+
+    const int count = static_cast< int >( tasks.size() );
+
+    if ( count * methodsCount < parallelThreshold )
+    {
+        for ( int i = 0; i < count; ++i ) estimate( i );
+    }
+    else
+    {
+        ThreadPool::getInstance()->run( count, estimate );
+    }
+
+    for ( size_t i = 0; i < fleet.size(); ++i )
+    {
+        for ( size_t j = 0; j < componentsTasks[ i ].size(); ++j )
+        {
+            const Result &estimate = tasks[ componentsTasks[ i ][ j ] ].estimate;
+
+            Result &result = ( *results )[ i ][ j ];
+
+            result.masses = estimate.masses;
+            result.count  = estimate.count;
+            result.mean   = estimate.mean;
+            result.min    = estimate.min;
+            result.max    = estimate.max;
+            result.stdDev = estimate.stdDev;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationEnsemble::writeCsvHeader( std::ostream *os ) const
+{
+    *os << "file,component,type";
+
+    for ( const EstimationMethod *method : _methods ) *os << ',' << method->getName();
+
+    *os << ",count,mean,min,max,std_dev\n";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationEnsemble::writeCsv( const std::string &fileName, const Results &results,
+                                   std::ostream *os )
+{
+    os->precision( std::numeric_limits< double >::max_digits10 );
+
+    for ( const Result &result : results )
+    {
+        writeText( fileName, os );
+        *os << ',';
+        writeText( result.name, os );
+        *os << ',' << result.type;
+
+        for ( double mass : result.masses )
+        {
+            *os << ',';
+            if ( !std::isnan( mass ) ) *os << mass;
+        }
+
+        *os << ',' << result.count
+            << ',' << result.mean
+            << ',' << result.min
+            << ',' << result.max
+            << ',' << result.stdDev << '\n';
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationEnsemble::computeStatistics( Result *result ) const
+{
+    result->count  = 0;
+    result->mean   = 0.0;
+    result->min    = 0.0;
+    result->max    = 0.0;
+    result->stdDev = 0.0;
+
+    for ( double mass : result->masses )
+    {
+        if ( std::isnan( mass ) ) continue;
+
+        if ( result->count == 0 )
+        {
+            result->min = mass;
+            result->max = mass;
+        }
+
+        result->min = std::min( result->min, mass );
+        result->max = std::max( result->max, mass );
+
+        result->mean += mass;
+        result->count++;
+    }
+
+    if ( result->count > 0 )
+    {
+        result->mean /= result->count;
+
+        for ( double mass : result->masses )
+        {
+            if ( !std::isnan( mass ) )
+            {
+                result->stdDev += ( mass - result->mean ) * ( mass - result->mean );
+            }
+        }
+
+        result->stdDev = sqrt( result->stdDev / result->count );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationEnsemble::writeText( const std::string &text, std::ostream *os )
+{
+    os->put( '"' );
+
+    for ( char c : text )
+    {
+        if ( c == '"' ) os->put( '"' );
+        os->put( c );
+    }
+
+    os->put( '"' );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,128 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef ESTIMATION_ESTIMATIONENSEMBLE_H_
+#define ESTIMATION_ESTIMATIONENSEMBLE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <Aircraft.h>
+
+#include <estimation/EstimationMethod.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The ensemble of mass estimation methods class.
+ *
+ * Evaluates all methods for every component side by side and reports spread
+ * of estimated masses. Estimates depend only on the aircraft data and the
+ * component type, so they are computed once for every component type of
+ * every aircraft and shared by the components of that type. Estimates of all
+ * aircraft are computed concurrently, results do not depend on the number
+ * of threads.
+ */
+class EstimationEnsemble
+{
+public:
+
+    /** @brief Component ensemble result. */
+    struct Result
+    {
+        std::string name;               ///< component name
+        std::string type;               ///< component XML tag name
+
+        std::vector< double > masses;   ///< [kg] masses estimated by methods, NaN if method does not cover component
+
+        int count;                      ///< number of methods covering component
+
+        double mean;                    ///< [kg] mean of estimated masses
+        double min;                     ///< [kg] minimum estimated mass
+        double max;                     ///< [kg] maximum estimated mass
+        double stdDev;                  ///< [kg] standard deviation of estimated masses
+    };
+
+    typedef std::vector< Result > Results;
+    typedef std::vector< EstimationMethod* > Methods;
+
+    /** @brief Constructor. Adds all available methods. */
+    EstimationEnsemble();
+
+    /** @brief Destructor. */
+    virtual ~EstimationEnsemble();
+
+    /**
+     * @brief Adds method, ensemble takes ownership of the method.
+     * @param method estimation method
+     */
+    void addMethod( EstimationMethod *method );
+
+    /**
+     * @brief Evaluates all methods for every aircraft component.
+     * @param aircraft aircraft
+     * @param results components results
+     */
+    void evaluate( const Aircraft &aircraft, Results *results ) const;
+
+    /**
+     * @brief Evaluates all methods for every component of every aircraft.
+     * @param fleet aircraft
+     * @param results components results for every aircraft
+     */
+    void evaluate( const std::vector< const Aircraft* > &fleet,
+                   std::vector< Results > *results ) const;
+
+    /**
+     * @brief Writes CSV header, there is a column for every method.
+     * @param os output stream
+     */
+    void writeCsvHeader( std::ostream *os ) const;
+
+    /**
+     * @brief Writes CSV row for every aircraft component. Masses estimated
+     * by methods not covering the component are left empty.
+     * @param fileName aircraft file name
+     * @param results aircraft components results
+     * @param os output stream
+     */
+    static void writeCsv( const std::string &fileName, const Results &results,
+                          std::ostream *os );
+
+    inline const Methods& getMethods() const { return _methods; }
+
+private:
+
+    Methods _methods;   ///< estimation methods
+
+    void computeStatistics( Result *result ) const;
+
+    static void writeText( const std::string &text, std::ostream *os );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // ESTIMATION_ESTIMATIONENSEMBLE_H_
@@ -0,0 +1,238 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <estimation/EstimationKernel.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <components/AllElse.h>
+#include <components/Engine.h>
+#include <components/Fuselage.h>
+#include <components/GearMain.h>
+#include <components/GearNose.h>
+#include <components/RotorDrive.h>
+#include <components/RotorHub.h>
+#include <components/RotorMain.h>
+#include <components/RotorTail.h>
+#include <components/TailHor.h>
+#include <components/TailVer.h>
+#include <components/Wing.h>
+
+#include <utils/ThreadPool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+template < AircraftData::Type TYPE >
+void EstimationKernel::estimate( const AircraftData &data, Masses *masses )
+{
+    Masses &m = *masses;
+
+    m[ FuselageGroup ] = Fuselage ::estimateMass< TYPE >( data );
+    m[ TailHorGroup  ] = TailHor  ::estimateMass< TYPE >( data );
+    m[ TailVerGroup  ] = TailVer  ::estimateMass< TYPE >( data );
+    m[ GearMainGroup ] = GearMain ::estimateMass< TYPE >( data );
+    m[ EngineGroup   ] = Engine   ::estimateMass< TYPE >( data );
+    m[ AllElseGroup  ] = AllElse  ::estimateMass< TYPE >( data );
+
+    if constexpr ( TYPE == AircraftData::Helicopter )
+    {
+        m[ WingGroup       ] = 0.0;
+        m[ GearNoseGroup   ] = 0.0;
+        m[ RotorDriveGroup ] = RotorDrive ::estimateMass< TYPE >( data );
+        m[ RotorHubGroup   ] = RotorHub   ::estimateMass< TYPE >( data );
+        m[ RotorMainGroup  ] = RotorMain  ::estimateMass< TYPE >( data );
+        m[ RotorTailGroup  ] = RotorTail  ::estimateMass< TYPE >( data );
+    }
+    else
+    {
+        m[ WingGroup       ] = Wing     ::estimateMass< TYPE >( data );
+        m[ GearNoseGroup   ] = GearNose ::estimateMass< TYPE >( data );
+        m[ RotorDriveGroup ] = 0.0;
+        m[ RotorHubGroup   ] = 0.0;
+        m[ RotorMainGroup  ] = 0.0;
+        m[ RotorTailGroup  ] = 0.0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template void EstimationKernel::estimate< AircraftData::FighterAttack   >( const AircraftData &data, Masses *masses );
+template void EstimationKernel::estimate< AircraftData::CargoTransport  >( const AircraftData &data, Masses *masses );
+template void EstimationKernel::estimate< AircraftData::GeneralAviation >( const AircraftData &data, Masses *masses );
+template void EstimationKernel::estimate< AircraftData::Helicopter      >( const AircraftData &data, Masses *masses );
+
+////////////////////////////////////////////////////////////////////////////////
+
+EstimationKernel::Kernel EstimationKernel::getKernel( AircraftData::Type type )
+{
+    switch ( type )
+    {
+        case AircraftData::FighterAttack:   return &estimateBatch< AircraftData::FighterAttack   >;
+        case AircraftData::CargoTransport:  return &estimateBatch< AircraftData::CargoTransport  >;
+        case AircraftData::GeneralAviation: return &estimateBatch< AircraftData::GeneralAviation >;
+        case AircraftData::Helicopter:      return &estimateBatch< AircraftData::Helicopter      >;
+    }
+
+    return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationKernel::estimate( const AircraftData &data, Masses *masses )
+{
+    Kernel kernel = getKernel( data.type );
+
+    if ( kernel )
+    {
+        const AircraftData *fleet = &data;
+        const int index = 0;
+
+        kernel( &fleet, &index, 1, masses );
+    }
+    else
+    {
+        masses->fill( 0.0 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EstimationKernel::estimate( const std::vector< const AircraftData* > &fleet,
+                                 std::vector< Masses > *masses )
+{
+    static const int chunkSize = 1024;
+
+    static const AircraftData::Type types[] =
+    {
+        AircraftData::FighterAttack,
+        AircraftData::CargoTransport,
+        AircraftData::GeneralAviation,
+        AircraftData::Helicopter
+    };
+
+    const int count = static_cast< int >( fleet.size() );
+
+    masses->assign( count, Masses() );
+
+    // indices of aircraft grouped by type, every chunk holds single type only
+    std::vector< int > indices;
+    std::vector< int > chunksFirst;
+    std::vector< int > chunksCount;
+    std::vector< Kernel > chunksKernel;
+
+    indices.reserve( count );
+
+    for ( AircraftData::Type type : types )
+    {
+        const int first = static_cast< int >( indices.size() );
+
+        for ( int i = 0; i < count; ++i )
+        {
+            if ( fleet[ i ]->type == type ) indices.push_back( i );
+        }
+
+        const int last = static_cast< int >( indices.size() );
+
+        for ( int i = first; i < last; i += chunkSize )
+        {
+            chunksFirst.push_back( i );
+            chunksCount.push_back( std::min( chunkSize, last - i ) );
+            chunksKernel.push_back( getKernel( type ) );
+        }
+    }
+
+    const int chunks = static_cast< int >( chunksKernel.size() );
+
+    auto estimateChunk = [ &fleet, &indices, &chunksFirst, &chunksCount, &chunksKernel, masses ]( int chunk )
+    {
+        chunksKernel[ chunk ]( fleet.data(), indices.data() + chunksFirst[ chunk ],
+                               chunksCount[ chunk ], masses->data() );
+    };
+
+    if ( chunks < 2 )
+    {
+        for ( int chunk = 0; chunk < chunks; ++chunk ) estimateChunk( chunk );
+    }
+    else
+    {
+        ThreadPool::getInstance()->run( chunks, estimateChunk );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+const char* EstimationKernel::getXmlTagName( Group group )
+{
+    switch ( group )
+    {
+        case FuselageGroup:   return Fuselage   ::xmlTagName;
+        case WingGroup:       return Wing       ::xmlTagName;
+        case TailHorGroup:    return TailHor    ::xmlTagName;
+        case TailVerGroup:    return TailVer    ::xmlTagName;
+        case GearMainGroup:   return GearMain   ::xmlTagName;
+        case GearNoseGroup:   return GearNose   ::xmlTagName;
+        case EngineGroup:     return Engine     ::xmlTagName;
+        case RotorDriveGroup: return RotorDrive ::xmlTagName;
+        case RotorHubGroup:   return RotorHub   ::xmlTagName;
+        case RotorMainGroup:  return RotorMain  ::xmlTagName;
+        case RotorTailGroup:  return RotorTail  ::xmlTagName;
+        case AllElseGroup:    return AllElse    ::xmlTagName;
+        case GroupsCount:     break;
+    }
+
+    return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+EstimationKernel::Group EstimationKernel::getGroup( const char *xmlTagName )
+{
+    for ( int i = 0; i < GroupsCount; ++i )
+    {
+        const Group group = static_cast< Group >( i );
+
+        if ( strcmp( getXmlTagName( group ), xmlTagName ) == 0 ) return group;
+    }
+
+    return GroupsCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template < AircraftData::Type TYPE >
+void EstimationKernel::estimateBatch( const AircraftData *const *fleet, const int *indices, int count,
+                                      Masses *masses )
+{
+    for ( int i = 0; i < count; ++i )
+    {
+        const int index = indices[ i ];
+
+        estimate< TYPE >( *fleet[ index ], &masses[ index ] );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
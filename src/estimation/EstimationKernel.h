@@ -0,0 +1,132 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef ESTIMATION_ESTIMATIONKERNEL_H_
+#define ESTIMATION_ESTIMATIONKERNEL_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <vector>
+
+#include <AircraftData.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The whole aircraft mass estimation kernels class.
+ *
+ * Kernel estimates masses of all components groups of the aircraft with
+ * formulas specialized for the aircraft type at compile time. Kernel is
+ * selected once per aircraft and batch evaluation groups fleet by aircraft
+ * type, so inner loops run over aircraft of single type without checking it.
+ */
+class EstimationKernel
+{
+public:
+
+    /** @brief Components groups. */
+    enum Group
+    {
+        FuselageGroup = 0,          ///< fuselage
+        WingGroup,                  ///< wing
+        TailHorGroup,               ///< horizontal tail
+        TailVerGroup,               ///< vertical tail
+        GearMainGroup,              ///< main landing gear
+        GearNoseGroup,              ///< nose landing gear
+        EngineGroup,                ///< engine
+        RotorDriveGroup,            ///< rotor drive
+        RotorHubGroup,              ///< main rotor hub
+        RotorMainGroup,             ///< main rotor blades
+        RotorTailGroup,             ///< tail rotor
+        AllElseGroup,               ///< all else
+
+        GroupsCount                 ///< number of groups
+    };
+
+    typedef std::array< double, GroupsCount > Masses;   ///< [kg] groups estimated masses
+
+    /**
+     * @brief Batch kernel estimates masses of the aircraft given by indices.
+     * All of the aircraft have to be of the kernel type.
+     */
+    typedef void (*Kernel)( const AircraftData *const *fleet, const int *indices, int count,
+                            Masses *masses );
+
+    /**
+     * @brief Estimates masses of all components groups of the aircraft of the
+     * given type. Aircraft data type is not checked.
+     * @tparam TYPE aircraft type
+     * @param data aircraft parameters
+     * @param masses [kg] groups estimated masses
+     */
+    template < AircraftData::Type TYPE >
+    static void estimate( const AircraftData &data, Masses *masses );
+
+    /**
+     * @brief Returns batch kernel of the given aircraft type.
+     * @param type aircraft type
+     * @return batch kernel or nullptr if type is not known
+     */
+    static Kernel getKernel( AircraftData::Type type );
+
+    /**
+     * @brief Estimates masses of all components groups of the aircraft.
+     * @param data aircraft parameters
+     * @param masses [kg] groups estimated masses
+     */
+    static void estimate( const AircraftData &data, Masses *masses );
+
+    /**
+     * @brief Estimates masses of all components groups of every aircraft.
+     * Results do not depend on the number of threads.
+     * @param fleet aircraft parameters
+     * @param masses [kg] groups estimated masses of every aircraft
+     */
+    static void estimate( const std::vector< const AircraftData* > &fleet,
+                          std::vector< Masses > *masses );
+
+    /**
+     * @brief Returns XML tag name of the components of the group.
+     * @param group components group
+     * @return components XML tag name
+     */
+    static const char* getXmlTagName( Group group );
+
+    /**
+     * @brief Returns components group of the components of the XML tag name.
+     * @param xmlTagName components XML tag name
+     * @return components group or GroupsCount if there is no such group
+     */
+    static Group getGroup( const char *xmlTagName );
+
+private:
+
+    template < AircraftData::Type TYPE >
+    static void estimateBatch( const AircraftData *const *fleet, const int *indices, int count,
+                               Masses *masses );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // ESTIMATION_ESTIMATIONKERNEL_H_
@@ -0,0 +1,71 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <estimation/EstimationMethod.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <mcutil/misc/Units.h>
+
+#include <utils/Atmosphere.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool EstimationMethod::isGiven( std::initializer_list< double > values )
+{
+    for ( double value : values )
+    {
+        if ( !( value > 0.0 ) ) return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double EstimationMethod::getCruiseEAS( const AircraftData &data )
+{
+    double h_m = Units::ft2m( data.general.h_cruise );
+    double sigma = Atmosphere::getDensity( h_m ) / Atmosphere::_std_sl_rho;
+
+    return data.general.v_cruise * sqrt( sigma );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double EstimationMethod::getMaxEAS( const AircraftData &data )
+{
+    Atmosphere atmosphere;
+    atmosphere.update( Units::ft2m( data.general.h_cruise ) );
+
+    double sigma = atmosphere.getDensity() / Atmosphere::_std_sl_rho;
+    double v_max = Units::mps2kts( data.general.mach_max * atmosphere.getSpeedOfSound() );
+
+    return std::max( v_max * sqrt( sigma ), getCruiseEAS( data ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
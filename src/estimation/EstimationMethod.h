@@ -0,0 +1,96 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef ESTIMATION_ESTIMATIONMETHOD_H_
+#define ESTIMATION_ESTIMATIONMETHOD_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <initializer_list>
+
+#include <AircraftData.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The mass estimation method interface.
+ *
+ * Method estimates masses of components given by their XML tag names.
+ * Methods do not have to cover every component nor every aircraft type.
+ * Method does not cover component also if any of the parameters it requires
+ * is not given, as data files contain only parameters required by default
+ * method for the aircraft type.
+ */
+class EstimationMethod
+{
+public:
+
+    /** @brief Destructor. */
+    virtual ~EstimationMethod() = default;
+
+    /**
+     * @brief Returns method name.
+     * @return method name
+     */
+    virtual const char* getName() const = 0;
+
+    /**
+     * @brief Estimates component mass.
+     * @param xmlTagName component XML tag name
+     * @param data aircraft parameters
+     * @param mass [kg] estimated mass
+     * @return true if method covers component and aircraft type, false otherwise
+     */
+    virtual bool estimateMass( const char *xmlTagName, const AircraftData &data,
+                               double *mass ) const = 0;
+
+protected:
+
+    typedef bool (*Estimate)( const AircraftData &data, double *mass );
+
+    /**
+     * @brief Checks if all the required parameters are given.
+     * @param values parameters values
+     * @return true if all values are positive, false otherwise
+     */
+    static bool isGiven( std::initializer_list< double > values );
+
+    /**
+     * @brief Returns cruise equivalent airspeed.
+     * @param data aircraft parameters
+     * @return [kts] cruise equivalent airspeed
+     */
+    static double getCruiseEAS( const AircraftData &data );
+
+    /**
+     * @brief Returns maximum level equivalent airspeed approximated by the
+     * maximum design Mach number at cruise altitude (cruise speed if higher).
+     * @param data aircraft parameters
+     * @return [kts] maximum level equivalent airspeed
+     */
+    static double getMaxEAS( const AircraftData &data );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // ESTIMATION_ESTIMATIONMETHOD_H_
@@ -0,0 +1,79 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <estimation/RaymerMethod.h>
+
+#include <cstring>
+
+#include <components/AllElse.h>
+#include <components/Engine.h>
+#include <components/Fuselage.h>
+#include <components/GearMain.h>
+#include <components/GearNose.h>
+#include <components/RotorDrive.h>
+#include <components/RotorHub.h>
+#include <components/RotorMain.h>
+#include <components/RotorTail.h>
+#include <components/TailHor.h>
+#include <components/TailVer.h>
+#include <components/Wing.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool RaymerMethod::estimateMass( const char *xmlTagName, const AircraftData &data,
+                                 double *mass ) const
+{
+    typedef double (*Estimate)( const AircraftData & );
+
+    static const struct { const char *tag; Estimate estimate; } estimates[] =
+    {
+        { AllElse    ::xmlTagName, &AllElse    ::estimateMass },
+        { Engine     ::xmlTagName, &Engine     ::estimateMass },
+        { Fuselage   ::xmlTagName, &Fuselage   ::estimateMass },
+        { GearMain   ::xmlTagName, &GearMain   ::estimateMass },
+        { GearNose   ::xmlTagName, &GearNose   ::estimateMass },
+        { RotorDrive ::xmlTagName, &RotorDrive ::estimateMass },
+        { RotorHub   ::xmlTagName, &RotorHub   ::estimateMass },
+        { RotorMain  ::xmlTagName, &RotorMain  ::estimateMass },
+        { RotorTail  ::xmlTagName, &RotorTail  ::estimateMass },
+        { TailHor    ::xmlTagName, &TailHor    ::estimateMass },
+        { TailVer    ::xmlTagName, &TailVer    ::estimateMass },
+        { Wing       ::xmlTagName, &Wing       ::estimateMass }
+    };
+
+    for ( const auto &e : estimates )
+    {
+        if ( 0 == strcmp( xmlTagName, e.tag ) )
+        {
+            *mass = e.estimate( data );
+            return true;
+        }
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,63 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef ESTIMATION_RAYMERMETHOD_H_
+#define ESTIMATION_RAYMERMETHOD_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <estimation/EstimationMethod.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The default mass estimation method.
+ *
+ * Uses components own estimation formulas, for fixed wing aircraft these are
+ * averages of Raymer approximate and statistical group weights.
+ *
+ * <h3>Refernces:</h3>
+ * <ul>
+ *   <li>Raymer D. P.: Aircraft Design: A Conceptual Approach, AIAA, 2018, p.567-583</li>
+ * </ul>
+ */
+class RaymerMethod : public EstimationMethod
+{
+public:
+
+    inline const char* getName() const override { return "raymer"; }
+
+    /**
+     * @brief Estimates component mass.
+     * @param xmlTagName component XML tag name
+     * @param data aircraft parameters
+     * @param mass [kg] estimated mass
+     * @return true if method covers component, false otherwise
+     */
+    bool estimateMass( const char *xmlTagName, const AircraftData &data,
+                       double *mass ) const override;
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // ESTIMATION_RAYMERMETHOD_H_
@@ -0,0 +1,276 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <estimation/TorenbeekMethod.h>
+
+#include <cmath>
+#include <cstring>
+
+#include <mcutil/misc/Units.h>
+
+#include <components/Fuselage.h>
+#include <components/GearMain.h>
+#include <components/GearNose.h>
+#include <components/TailHor.h>
+#include <components/TailVer.h>
+#include <components/Wing.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::estimateMass( const char *xmlTagName, const AircraftData &data,
+                                    double *mass ) const
+{
+    // method covers subsonic civil aircraft only
+    if ( data.type != AircraftData::CargoTransport
+      && data.type != AircraftData::GeneralAviation )
+    {
+        return false;
+    }
+
+    static const struct { const char *tag; Estimate estimate; } estimates[] =
+    {
+        { Fuselage ::xmlTagName, &TorenbeekMethod::estimateFuselage },
+        { GearMain ::xmlTagName, &TorenbeekMethod::estimateGearMain },
+        { GearNose ::xmlTagName, &TorenbeekMethod::estimateGearNose },
+        { TailHor  ::xmlTagName, &TorenbeekMethod::estimateTailHor  },
+        { TailVer  ::xmlTagName, &TorenbeekMethod::estimateTailVer  },
+        { Wing     ::xmlTagName, &TorenbeekMethod::estimateWing     }
+    };
+
+    for ( const auto &e : estimates )
+    {
+        if ( 0 == strcmp( xmlTagName, e.tag ) )
+        {
+            return e.estimate( data, mass );
+        }
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::estimateFuselage( const AircraftData &data, double *mass )
+{
+    if ( !isGiven( { data.general.v_cruise, data.hor_tail.arm,
+                     data.fuselage.w, data.fuselage.h, data.fuselage.wetted_area } ) )
+    {
+        return false;
+    }
+
+    double v_d   = getDiveEAS( data );
+    double l_t   = Units::m2ft( data.hor_tail.arm );
+    double b_f   = Units::m2ft( data.fuselage.w );
+    double h_f   = Units::m2ft( data.fuselage.h );
+    double s_g   = Units::sqm2sqft( data.fuselage.wetted_area );
+
+    // Torenbeek: Synthesis of Subsonic Airplane Design, p.283
+    double k_f = 1.0;
+    if ( data.fuselage.press_vol > 0.0 ) k_f += 0.08;
+    if ( data.fuselage.landing_gear    ) k_f += 0.07;
+    if ( data.fuselage.cargo_door != AircraftData::Fuselage::NoCargoDoor ) k_f += 0.10;
+
+    // Torenbeek: Synthesis of Subsonic Airplane Design, p.283, eq.8-15
+    double m_lb = 0.021 * k_f * sqrt( v_d * l_t / ( b_f + h_f ) ) * pow( s_g, 1.2 );
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::estimateGearMain( const AircraftData &data, double *mass )
+{
+    double w_to = Units::kg2lb( data.general.mtow );
+
+    // high wing aircraft usually have fuselage mounted main gear
+    double k_uc = data.fuselage.landing_gear ? 1.08 : 1.0;
+
+    // Torenbeek: Synthesis of Subsonic Airplane Design, p.283, table 8-6
+    double m_lb = 0.0;
+
+    if ( data.landing_gear.fixed )
+    {
+        m_lb = k_uc * ( 20.0 + 0.10 * pow( w_to, 0.75 ) + 0.019 * w_to );
+    }
+    else
+    {
+        m_lb = k_uc * ( 40.0 + 0.16 * pow( w_to, 0.75 ) + 0.019 * w_to
+                        + 1.5e-5 * pow( w_to, 1.5 ) );
+    }
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::estimateGearNose( const AircraftData &data, double *mass )
+{
+    double w_to = Units::kg2lb( data.general.mtow );
+
+    // high wing aircraft usually have fuselage mounted main gear
+    double k_uc = data.fuselage.landing_gear ? 1.08 : 1.0;
+
+    // Torenbeek: Synthesis of Subsonic Airplane Design, p.283, table 8-6
+    double m_lb = 0.0;
+
+    if ( data.landing_gear.fixed )
+    {
+        m_lb = k_uc * ( 25.0 + 0.0024 * w_to );
+    }
+    else
+    {
+        m_lb = k_uc * ( 20.0 + 0.10 * pow( w_to, 0.75 ) + 2.0e-6 * pow( w_to, 1.5 ) );
+    }
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::estimateTailHor( const AircraftData &data, double *mass )
+{
+    double k_h = data.hor_tail.moving ? 1.1 : 1.0;
+
+    return getTailMass( data, data.hor_tail.area, data.hor_tail.sweep, k_h, mass );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::estimateTailVer( const AircraftData &data, double *mass )
+{
+    // horizontal tail is mounted at the vertical tail tip
+    double k_v = 1.0;
+    if ( data.ver_tail.t_tail && data.ver_tail.area > 0.0 )
+    {
+        k_v = 1.0 + 0.15 * data.hor_tail.area / data.ver_tail.area;
+    }
+
+    return getTailMass( data, data.ver_tail.area, data.ver_tail.sweep, k_v, mass );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::estimateWing( const AircraftData &data, double *mass )
+{
+    if ( !isGiven( { data.general.mtow - data.wing.fuel, data.general.nz_max,
+                     data.wing.span, data.wing.area, data.wing.ar,
+                     data.wing.t_c, data.wing.c_root } ) )
+    {
+        return false;
+    }
+
+    double w_mzf = Units::kg2lb( data.general.mtow - data.wing.fuel );
+    double n_ult = 1.5 * data.general.nz_max;
+
+    double b   = Units::m2ft( data.wing.span );
+    double s_w = Units::sqm2sqft( data.wing.area );
+    double t_r = Units::m2ft( data.wing.t_c * data.wing.c_root );
+
+    // half chord sweep
+    double tan_sweep = tan( Units::deg2rad( data.wing.sweep ) )
+            - ( 1.0 - data.wing.tr ) / ( data.wing.ar * ( 1.0 + data.wing.tr ) );
+    double cos_sweep = cos( atan( tan_sweep ) );
+
+    // Torenbeek: Synthesis of Subsonic Airplane Design, p.280, eq.8-12
+    double m_lb = 0.0017 * w_mzf * pow( b / cos_sweep, 0.75 )
+            * ( 1.0 + sqrt( 6.3 * cos_sweep / b ) ) * pow( n_ult, 0.55 )
+            * pow( b * s_w / ( t_r * w_mzf * cos_sweep ), 0.3 );
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double TorenbeekMethod::getDiveEAS( const AircraftData &data )
+{
+    // design dive speed approximation
+    return 1.25 * getCruiseEAS( data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::getTailMass( const AircraftData &data, double area, double sweep, double k,
+                                   double *mass )
+{
+    if ( !isGiven( { area } ) )
+    {
+        return false;
+    }
+
+    double s_t = Units::sqm2sqft( area );
+
+    double m_lb = 0.0;
+
+    if ( isLight( data ) )
+    {
+        if ( !isGiven( { data.general.nz_max } ) )
+        {
+            return false;
+        }
+
+        // Torenbeek: Synthesis of Subsonic Airplane Design, p.282, eq.8-14
+        // whole empennage mass is distributed proportionally to surfaces areas
+        double n_ult = 1.5 * data.general.nz_max;
+        double s_tail = Units::sqm2sqft( data.hor_tail.area + data.ver_tail.area );
+
+        m_lb = 0.04 * pow( n_ult * s_tail * s_tail, 0.75 ) * s_t / s_tail;
+    }
+    else
+    {
+        if ( !isGiven( { data.general.v_cruise } ) )
+        {
+            return false;
+        }
+
+        // Torenbeek: Synthesis of Subsonic Airplane Design, p.282, eq.8-16
+        double v_d = getDiveEAS( data );
+        double cos_sweep = cos( Units::deg2rad( sweep ) );
+
+        m_lb = k * s_t * ( 3.81 * pow( s_t, 0.2 ) * v_d / ( 1000.0 * sqrt( cos_sweep ) ) - 0.287 );
+    }
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool TorenbeekMethod::isLight( const AircraftData &data )
+{
+    // light aircraft, maximum take-off weight up to 12500 lb
+    return data.general.mtow <= Units::lb2kg( 12500.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,178 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <estimation/UsafMethod.h>
+
+#include <cmath>
+#include <cstring>
+
+#include <mcutil/misc/Units.h>
+
+#include <components/Fuselage.h>
+#include <components/TailHor.h>
+#include <components/TailVer.h>
+#include <components/Wing.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool UsafMethod::estimateMass( const char *xmlTagName, const AircraftData &data,
+                               double *mass ) const
+{
+    // method covers military aircraft only
+    if ( data.type != AircraftData::FighterAttack
+      && data.type != AircraftData::CargoTransport )
+    {
+        return false;
+    }
+
+    static const struct { const char *tag; Estimate estimate; } estimates[] =
+    {
+        { Fuselage ::xmlTagName, &UsafMethod::estimateFuselage },
+        { TailHor  ::xmlTagName, &UsafMethod::estimateTailHor  },
+        { TailVer  ::xmlTagName, &UsafMethod::estimateTailVer  },
+        { Wing     ::xmlTagName, &UsafMethod::estimateWing     }
+    };
+
+    for ( const auto &e : estimates )
+    {
+        if ( 0 == strcmp( xmlTagName, e.tag ) )
+        {
+            return e.estimate( data, mass );
+        }
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool UsafMethod::estimateFuselage( const AircraftData &data, double *mass )
+{
+    if ( !isGiven( { data.general.nz_max, getMaxEAS( data ),
+                     data.fuselage.l, data.fuselage.w, data.fuselage.h } ) )
+    {
+        return false;
+    }
+
+    double w_to = Units::kg2lb( data.general.mtow );
+    double n_z  = 1.5 * data.general.nz_max;
+    double v_e  = getMaxEAS( data );
+
+    double l = Units::m2ft( data.fuselage.l );
+    double w = Units::m2ft( data.fuselage.w );
+    double d = Units::m2ft( data.fuselage.h );
+
+    // Nicolai: Fundamentals of Aircraft Design, p.20-7
+    double m_lb = 200.0 * pow( pow( w_to * n_z / 1.0e5, 0.286 ) * pow( l / 10.0, 0.857 )
+                               * ( ( w + d ) / 10.0 ) * pow( v_e / 100.0, 0.338 ), 1.1 );
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool UsafMethod::estimateTailHor( const AircraftData &data, double *mass )
+{
+    if ( !isGiven( { data.general.nz_max, data.hor_tail.area, data.hor_tail.arm,
+                     data.hor_tail.span, data.hor_tail.t_c, data.hor_tail.c_root } ) )
+    {
+        return false;
+    }
+
+    double w_to = Units::kg2lb( data.general.mtow );
+    double n_z  = 1.5 * data.general.nz_max;
+
+    double s_ht = Units::sqm2sqft( data.hor_tail.area );
+    double l_t  = Units::m2ft( data.hor_tail.arm );
+    double b_ht = Units::m2ft( data.hor_tail.span );
+    double t_hr = Units::m2ft( data.hor_tail.t_c * data.hor_tail.c_root );
+
+    // Nicolai: Fundamentals of Aircraft Design, p.20-6
+    double m_lb = 127.0 * pow( pow( w_to * n_z / 1.0e5, 0.87 ) * pow( s_ht / 100.0, 1.2 )
+                               * pow( l_t / 10.0, 0.483 ) * pow( b_ht / t_hr, 0.5 ), 0.458 );
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool UsafMethod::estimateTailVer( const AircraftData &data, double *mass )
+{
+    if ( !isGiven( { data.general.nz_max, data.ver_tail.area, data.ver_tail.height,
+                     data.ver_tail.t_c, data.ver_tail.c_root } ) )
+    {
+        return false;
+    }
+
+    double w_to = Units::kg2lb( data.general.mtow );
+    double n_z  = 1.5 * data.general.nz_max;
+
+    double s_vt = Units::sqm2sqft( data.ver_tail.area );
+    double b_vt = Units::m2ft( data.ver_tail.height );
+    double t_vr = Units::m2ft( data.ver_tail.t_c * data.ver_tail.c_root );
+
+    // Nicolai: Fundamentals of Aircraft Design, p.20-6
+    double m_lb = 98.5 * pow( pow( w_to * n_z / 1.0e5, 0.87 ) * pow( s_vt / 100.0, 1.2 )
+                              * pow( b_vt / t_vr, 0.5 ), 0.458 );
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool UsafMethod::estimateWing( const AircraftData &data, double *mass )
+{
+    if ( !isGiven( { data.general.nz_max, data.wing.area, data.wing.ar, data.wing.t_c } ) )
+    {
+        return false;
+    }
+
+    double w_to = Units::kg2lb( data.general.mtow );
+    double n_z  = 1.5 * data.general.nz_max;
+    double v_e  = getMaxEAS( data );
+
+    double s_w = Units::sqm2sqft( data.wing.area );
+    double cos_sweep = cos( Units::deg2rad( data.wing.sweep ) );
+
+    // Nicolai: Fundamentals of Aircraft Design, p.20-5
+    double m_lb = 96.948 * pow( pow( w_to * n_z / 1.0e5, 0.65 )
+                                * pow( data.wing.ar / ( cos_sweep * cos_sweep ), 0.57 )
+                                * pow( s_w / 100.0, 0.61 )
+                                * pow( ( 1.0 + data.wing.tr ) / ( 2.0 * data.wing.t_c ), 0.36 )
+                                * pow( 1.0 + v_e / 500.0, 0.5 ), 0.993 );
+
+    *mass = Units::lb2kg( m_lb );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,70 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef ESTIMATION_USAFMETHOD_H_
+#define ESTIMATION_USAFMETHOD_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <estimation/EstimationMethod.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The USAF statistical mass estimation method.
+ *
+ * Covers airframe structure (wing, tails and fuselage) of fighter/attack
+ * and cargo/transport aircraft.
+ *
+ * <h3>Refernces:</h3>
+ * <ul>
+ *   <li>Nicolai L. M.: Fundamentals of Aircraft Design, 1975, p.20-5 - 20-9</li>
+ * </ul>
+ */
+class UsafMethod : public EstimationMethod
+{
+public:
+
+    inline const char* getName() const override { return "usaf"; }
+
+    /**
+     * @brief Estimates component mass.
+     * @param xmlTagName component XML tag name
+     * @param data aircraft parameters
+     * @param mass [kg] estimated mass
+     * @return true if method covers component and aircraft type, false otherwise
+     */
+    bool estimateMass( const char *xmlTagName, const AircraftData &data,
+                       double *mass ) const override;
+
+private:
+
+    static bool estimateFuselage ( const AircraftData &data, double *mass );
+    static bool estimateTailHor  ( const AircraftData &data, double *mass );
+    static bool estimateTailVer  ( const AircraftData &data, double *mass );
+    static bool estimateWing     ( const AircraftData &data, double *mass );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // ESTIMATION_USAFMETHOD_H_
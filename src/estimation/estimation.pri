@@ -0,0 +1,15 @@
+HEADERS += \
+    $$PWD/EstimationEnsemble.h \
+    $$PWD/EstimationKernel.h \
+    $$PWD/EstimationMethod.h \
+    $$PWD/RaymerMethod.h \
+    $$PWD/TorenbeekMethod.h \
+    $$PWD/UsafMethod.h
+
+SOURCES += \
+    $$PWD/EstimationEnsemble.cpp \
+    $$PWD/EstimationKernel.cpp \
+    $$PWD/EstimationMethod.cpp \
+    $$PWD/RaymerMethod.cpp \
+    $$PWD/TorenbeekMethod.cpp \
+    $$PWD/UsafMethod.cpp
@@ -0,0 +1,318 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <export/ArrowWriter.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Arrow format constants (Schema.fbs and Message.fbs)
+static const int16_t  metadataVersionV5   = 4;
+static const uint8_t  headerSchema        = 1;
+static const uint8_t  headerRecordBatch   = 3;
+static const uint8_t  typeInt             = 2;
+static const uint8_t  typeFloatingPoint   = 3;
+static const uint8_t  typeUtf8            = 5;
+static const uint8_t  typeBool            = 6;
+static const int16_t  precisionDouble     = 2;
+static const uint32_t continuation        = 0xFFFFFFFF;
+
+static const size_t bufferAlignment = 8;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t getPaddedSize( size_t size )
+{
+    return ( size + bufferAlignment - 1 ) / bufferAlignment * bufferAlignment;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ArrowWriter::ArrowWriter( const ExportSchema *schema, int batchSize ) :
+    ExportWriter( schema ),
+
+    _batchSize ( batchSize > 0 ? batchSize : 1 ),
+    _rows ( 0 )
+{
+    _columns.resize( _schema->getColumns().size() );
+    clearColumns();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArrowWriter::write( const ExportSchema::Row &row )
+{
+    const ExportSchema::Columns &columns = _schema->getColumns();
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        ColumnData &data = _columns[ i ];
+
+        switch ( columns[ i ].type )
+        {
+            case ExportSchema::Float64:
+            {
+                const uint8_t *bytes = reinterpret_cast< const uint8_t* >( &row[ i ].number );
+                data.values.insert( data.values.end(), bytes, bytes + sizeof(double) );
+                break;
+            }
+
+            case ExportSchema::Int32:
+            {
+                int32_t value = static_cast< int32_t >( row[ i ].number );
+                const uint8_t *bytes = reinterpret_cast< const uint8_t* >( &value );
+                data.values.insert( data.values.end(), bytes, bytes + sizeof(int32_t) );
+                break;
+            }
+
+            case ExportSchema::Boolean:
+            {
+                // bit-packed, least significant bit first
+                if ( _rows % 8 == 0 ) data.values.push_back( 0 );
+                if ( row[ i ].number != 0.0 ) data.values.back() |= 1 << ( _rows % 8 );
+                break;
+            }
+
+            case ExportSchema::Utf8:
+            {
+                data.values.insert( data.values.end(), row[ i ].text.begin(), row[ i ].text.end() );
+                data.offsets.push_back( static_cast< int32_t >( data.values.size() ) );
+                break;
+            }
+        }
+    }
+
+    _rows++;
+
+    if ( _rows >= _batchSize )
+    {
+        return writeBatch();
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArrowWriter::writeHeader()
+{
+    FlatBufferBuilder builder;
+
+    std::vector< FlatBufferBuilder::Offset > fields;
+
+    for ( const ExportSchema::Column &column : _schema->getColumns() )
+    {
+        FlatBufferBuilder::Offset name = builder.createString( column.name );
+        FlatBufferBuilder::Offset children = builder.createOffsetVector( std::vector< FlatBufferBuilder::Offset >() );
+
+        uint8_t typeType = typeFloatingPoint;
+
+        builder.startTable();
+
+        switch ( column.type )
+        {
+            case ExportSchema::Float64:
+                builder.addField< int16_t >( 0, precisionDouble );
+                typeType = typeFloatingPoint;
+                break;
+
+            case ExportSchema::Int32:
+                builder.addField< int32_t >( 0, 32 );
+                builder.addField< uint8_t >( 1, 1 );
+                typeType = typeInt;
+                break;
+
+            case ExportSchema::Boolean:
+                typeType = typeBool;
+                break;
+
+            case ExportSchema::Utf8:
+                typeType = typeUtf8;
+                break;
+        }
+
+        FlatBufferBuilder::Offset type = builder.endTable();
+
+        builder.startTable();
+        builder.addOffset( 0, name );
+        builder.addField< uint8_t >( 1, 0 );
+        builder.addField< uint8_t >( 2, typeType );
+        builder.addOffset( 3, type );
+        builder.addOffset( 5, children );
+        fields.push_back( builder.endTable() );
+    }
+
+    FlatBufferBuilder::Offset fieldsVector = builder.createOffsetVector( fields );
+
+    builder.startTable();
+    builder.addField< int16_t >( 0, 0 );    // little-endian
+    builder.addOffset( 1, fieldsVector );
+    FlatBufferBuilder::Offset schema = builder.endTable();
+
+    builder.startTable();
+    builder.addField< int64_t >( 3, 0 );
+    builder.addOffset( 2, schema );
+    builder.addField< int16_t >( 0, metadataVersionV5 );
+    builder.addField< uint8_t >( 1, headerSchema );
+    builder.finish( builder.endTable() );
+
+    writeMessage( builder );
+
+    return _fs.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArrowWriter::writeFooter()
+{
+    bool result = true;
+
+    if ( _rows > 0 )
+    {
+        result = writeBatch();
+    }
+
+    // end-of-stream marker
+    const int32_t zero = 0;
+    _fs.write( reinterpret_cast< const char* >( &continuation ), sizeof(continuation) );
+    _fs.write( reinterpret_cast< const char* >( &zero ), sizeof(zero) );
+
+    return result && _fs.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArrowWriter::writeBatch()
+{
+    const ExportSchema::Columns &columns = _schema->getColumns();
+
+    std::vector< FieldNode > nodes;
+    std::vector< Buffer > buffers;
+
+    int64_t bodyLength = 0;
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        nodes.push_back( { _rows, 0 } );
+
+        // no validity bitmap, all values are valid
+        buffers.push_back( { bodyLength, 0 } );
+
+        if ( columns[ i ].type == ExportSchema::Utf8 )
+        {
+            int64_t length = static_cast< int64_t >( _columns[ i ].offsets.size() * sizeof(int32_t) );
+            buffers.push_back( { bodyLength, length } );
+            bodyLength += getPaddedSize( length );
+        }
+
+        int64_t length = static_cast< int64_t >( _columns[ i ].values.size() );
+        buffers.push_back( { bodyLength, length } );
+        bodyLength += getPaddedSize( length );
+    }
+
+    FlatBufferBuilder builder;
+
+    FlatBufferBuilder::Offset nodesVector = builder.createStructVector( nodes.data(), nodes.size(),
+                                                                        sizeof(FieldNode), sizeof(int64_t) );
+    FlatBufferBuilder::Offset buffersVector = builder.createStructVector( buffers.data(), buffers.size(),
+                                                                          sizeof(Buffer), sizeof(int64_t) );
+
+    builder.startTable();
+    builder.addField< int64_t >( 0, _rows );
+    builder.addOffset( 1, nodesVector );
+    builder.addOffset( 2, buffersVector );
+    FlatBufferBuilder::Offset recordBatch = builder.endTable();
+
+    builder.startTable();
+    builder.addField< int64_t >( 3, bodyLength );
+    builder.addOffset( 2, recordBatch );
+    builder.addField< int16_t >( 0, metadataVersionV5 );
+    builder.addField< uint8_t >( 1, headerRecordBatch );
+    builder.finish( builder.endTable() );
+
+    writeMessage( builder );
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        if ( columns[ i ].type == ExportSchema::Utf8 )
+        {
+            size_t length = _columns[ i ].offsets.size() * sizeof(int32_t);
+            _fs.write( reinterpret_cast< const char* >( _columns[ i ].offsets.data() ), length );
+            writePadding( getPaddedSize( length ) - length );
+        }
+
+        size_t length = _columns[ i ].values.size();
+        _fs.write( reinterpret_cast< const char* >( _columns[ i ].values.data() ), length );
+        writePadding( getPaddedSize( length ) - length );
+    }
+
+    clearColumns();
+
+    return _fs.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ArrowWriter::writeMessage( const FlatBufferBuilder &builder )
+{
+    // continuation marker and metadata length, body starts 8-byte aligned
+    int32_t length = static_cast< int32_t >( getPaddedSize( builder.getSize() ) );
+
+    _fs.write( reinterpret_cast< const char* >( &continuation ), sizeof(continuation) );
+    _fs.write( reinterpret_cast< const char* >( &length ), sizeof(length) );
+    _fs.write( reinterpret_cast< const char* >( builder.getData() ), builder.getSize() );
+
+    writePadding( length - builder.getSize() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ArrowWriter::writePadding( size_t size )
+{
+    static const char zeros[ bufferAlignment ] = { 0 };
+    _fs.write( zeros, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ArrowWriter::clearColumns()
+{
+    const ExportSchema::Columns &columns = _schema->getColumns();
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        _columns[ i ].values.clear();
+        _columns[ i ].offsets.clear();
+
+        if ( columns[ i ].type == ExportSchema::Utf8 )
+        {
+            _columns[ i ].offsets.push_back( 0 );
+        }
+    }
+
+    _rows = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,107 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef EXPORT_ARROWWRITER_H_
+#define EXPORT_ARROWWRITER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+
+#include <export/ExportWriter.h>
+#include <export/FlatBufferBuilder.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The Apache Arrow IPC stream export writer class.
+ *
+ * Rows are collected column-wise and written as record batches of limited
+ * size, so memory usage does not depend on number of exported rows.
+ * All columns are non-nullable.
+ */
+class ArrowWriter : public ExportWriter
+{
+public:
+
+    /**
+     * @brief Constructor.
+     * @param schema export schema (not owned)
+     * @param batchSize maximum number of rows in a record batch
+     */
+    explicit ArrowWriter( const ExportSchema *schema, int batchSize = 8192 );
+
+    bool write( const ExportSchema::Row &row ) override;
+
+protected:
+
+    bool writeHeader() override;
+    bool writeFooter() override;
+
+private:
+
+    /**
+     * @brief The column buffers struct.
+     */
+    struct ColumnData
+    {
+        std::vector< uint8_t > values;      ///< values buffer
+        std::vector< int32_t > offsets;     ///< string offsets buffer
+    };
+
+    /**
+     * @brief The buffer descriptor struct (Arrow Buffer struct layout).
+     */
+    struct Buffer
+    {
+        int64_t offset;                     ///< offset within message body
+        int64_t length;                     ///< buffer length
+    };
+
+    /**
+     * @brief The field node struct (Arrow FieldNode struct layout).
+     */
+    struct FieldNode
+    {
+        int64_t length;                     ///< number of values
+        int64_t nullCount;                  ///< number of null values
+    };
+
+    std::vector< ColumnData > _columns;     ///< current batch columns
+
+    const int _batchSize;                   ///< maximum number of rows in a record batch
+    int _rows;                              ///< number of rows in current batch
+
+    bool writeBatch();
+
+    void writeMessage( const FlatBufferBuilder &builder );
+
+    void writePadding( size_t size );
+
+    void clearColumns();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // EXPORT_ARROWWRITER_H_
@@ -0,0 +1,99 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <export/CsvWriter.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+CsvWriter::CsvWriter( const ExportSchema *schema ) :
+    ExportWriter( schema )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool CsvWriter::write( const ExportSchema::Row &row )
+{
+    const ExportSchema::Columns &columns = _schema->getColumns();
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        if ( i > 0 ) _fs.put( ',' );
+
+        if ( columns[ i ].type == ExportSchema::Utf8 )
+        {
+            writeText( row[ i ].text );
+        }
+        else
+        {
+            writeNumber( row[ i ].number, columns[ i ].type );
+        }
+    }
+
+    _fs.put( '\n' );
+
+    return _fs.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool CsvWriter::writeHeader()
+{
+    const ExportSchema::Columns &columns = _schema->getColumns();
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        if ( i > 0 ) _fs.put( ',' );
+
+        writeText( columns[ i ].name );
+    }
+
+    _fs.put( '\n' );
+
+    return _fs.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void CsvWriter::writeText( const std::string &text )
+{
+    if ( text.find_first_of( ",\"\r\n" ) == std::string::npos )
+    {
+        _fs << text;
+        return;
+    }
+
+    _fs.put( '"' );
+
+    for ( char c : text )
+    {
+        if ( c == '"' ) _fs.put( '"' );
+        _fs.put( c );
+    }
+
+    _fs.put( '"' );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,56 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef EXPORT_CSVWRITER_H_
+#define EXPORT_CSVWRITER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <export/ExportWriter.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The CSV export writer class (RFC 4180, header row included).
+ */
+class CsvWriter : public ExportWriter
+{
+public:
+
+    /** @brief Constructor. */
+    explicit CsvWriter( const ExportSchema *schema );
+
+    bool write( const ExportSchema::Row &row ) override;
+
+protected:
+
+    bool writeHeader() override;
+
+private:
+
+    void writeText( const std::string &text );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // EXPORT_CSVWRITER_H_
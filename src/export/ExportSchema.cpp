@@ -0,0 +1,163 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <export/ExportSchema.h>
+
+#include <defs.h>
+
+#include <AircraftDataFields.h>
+
+#include <components/ComponentFactory.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+ExportSchema::ExportSchema( Rows rows ) :
+    _rows ( rows )
+{
+    _columns.push_back( { "file", Utf8 } );
+
+    if ( _rows == AircraftRows )
+    {
+        for ( int i = 0; i < AircraftDataFields::getCount(); ++i )
+        {
+            const AircraftDataFields::Field &field = AircraftDataFields::getField( i );
+
+            Type type = Float64;
+
+            switch ( field.kind )
+            {
+                case AircraftDataFields::Double: type = Float64; break;
+                case AircraftDataFields::Int:    type = Int32;   break;
+                case AircraftDataFields::Bool:   type = Boolean; break;
+                case AircraftDataFields::Enum:   type = Int32;   break;
+            }
+
+            _columns.push_back( { field.name, type } );
+        }
+
+        _columns.push_back( { "mass_empty" , Float64 } );
+        _columns.push_back( { "cm_x"       , Float64 } );
+        _columns.push_back( { "cm_y"       , Float64 } );
+        _columns.push_back( { "cm_z"       , Float64 } );
+        _columns.push_back( { "i_xx"       , Float64 } );
+        _columns.push_back( { "i_yy"       , Float64 } );
+        _columns.push_back( { "i_zz"       , Float64 } );
+        _columns.push_back( { "i_xy"       , Float64 } );
+        _columns.push_back( { "i_xz"       , Float64 } );
+        _columns.push_back( { "i_yz"       , Float64 } );
+    }
+    else
+    {
+        _columns.push_back( { "type"     , Utf8    } );
+        _columns.push_back( { "name"     , Utf8    } );
+        _columns.push_back( { "x"        , Float64 } );
+        _columns.push_back( { "y"        , Float64 } );
+        _columns.push_back( { "z"        , Float64 } );
+        _columns.push_back( { "mass"     , Float64 } );
+        _columns.push_back( { "length"   , Float64 } );
+        _columns.push_back( { "width"    , Float64 } );
+        _columns.push_back( { "height"   , Float64 } );
+        _columns.push_back( { "mass_est" , Float64 } );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int ExportSchema::getRowsCount( const FleetRecord &record ) const
+{
+    if ( _rows == AircraftRows )
+    {
+        return 1;
+    }
+
+    return static_cast< int >( record.components.size() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ExportSchema::getRow( const FleetRecord &record, int index, Row *row ) const
+{
+    row->resize( _columns.size() );
+
+    Row::iterator it = row->begin();
+
+    (it++)->text = record.fileName;
+
+    if ( _rows == AircraftRows )
+    {
+        for ( int i = 0; i < AircraftDataFields::getCount(); ++i )
+        {
+            (it++)->number = AircraftDataFields::getValue( record.data, i );
+        }
+
+        (it++)->number = record.massTotal;
+        (it++)->number = record.centerOfMass.x();
+        (it++)->number = record.centerOfMass.y();
+        (it++)->number = record.centerOfMass.z();
+        (it++)->number = record.inertiaMatrix.xx();
+        (it++)->number = record.inertiaMatrix.yy();
+        (it++)->number = record.inertiaMatrix.zz();
+        (it++)->number = record.inertiaMatrix.xy();
+        (it++)->number = record.inertiaMatrix.xz();
+        (it++)->number = record.inertiaMatrix.yz();
+    }
+    else
+    {
+        const ComponentData &data = record.components[ index ];
+
+        double massEst = 0.0;
+
+        if ( index < static_cast< int >( record.estimatedMasses.size() ) )
+        {
+            // already evaluated by the producer
+            massEst = record.estimatedMasses[ index ];
+        }
+        else
+        {
+            Component *component = ComponentFactory::create( data, &record.data );
+
+            if ( component )
+            {
+                massEst = component->getEstimatedMass();
+            }
+
+            DELPTR( component );
+        }
+
+        (it++)->text   = data.type;
+        (it++)->text   = data.name;
+        (it++)->number = data.r.x();
+        (it++)->number = data.r.y();
+        (it++)->number = data.r.z();
+        (it++)->number = data.m;
+        (it++)->number = data.l;
+        (it++)->number = data.w;
+        (it++)->number = data.h;
+        (it++)->number = massEst;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
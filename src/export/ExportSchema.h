@@ -0,0 +1,123 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef EXPORT_EXPORTSCHEMA_H_
+#define EXPORT_EXPORTSCHEMA_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <fleet/FleetRecord.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The export schema class.
+ *
+ * Defines columns of exported table and flattens fleet records into rows.
+ * There is either one row per aircraft (all aircraft data fields followed
+ * by results) or one row per component.
+ */
+class ExportSchema
+{
+public:
+
+    /**
+     * @brief The rows kind enum.
+     */
+    enum Rows
+    {
+        AircraftRows = 0,           ///< one row per aircraft
+        ComponentRows               ///< one row per component
+    };
+
+    /**
+     * @brief The column type enum.
+     */
+    enum Type
+    {
+        Float64 = 0,                ///< 64-bit floating point
+        Int32,                      ///< 32-bit signed integer
+        Boolean,                    ///< boolean
+        Utf8                        ///< UTF-8 string
+    };
+
+    /**
+     * @brief The column struct.
+     */
+    struct Column
+    {
+        std::string name;           ///< column name
+        Type type;                  ///< column type
+    };
+
+    /**
+     * @brief The cell value struct. Numeric value is used by all but string
+     * columns.
+     */
+    struct Value
+    {
+        double number = 0.0;        ///< numeric value
+        std::string text;           ///< string value
+    };
+
+    typedef std::vector< Column > Columns;
+    typedef std::vector< Value >  Row;
+
+    /**
+     * @brief Constructor.
+     * @param rows rows kind
+     */
+    explicit ExportSchema( Rows rows );
+
+    /**
+     * @brief Returns number of rows of the given record.
+     * @param record fleet record
+     * @return number of rows
+     */
+    int getRowsCount( const FleetRecord &record ) const;
+
+    /**
+     * @brief Flattens record into row.
+     * @param record fleet record
+     * @param index row index within the record
+     * @param row output row, resized to the number of columns
+     */
+    void getRow( const FleetRecord &record, int index, Row *row ) const;
+
+    inline const Columns& getColumns() const { return _columns; }
+
+    inline Rows getRows() const { return _rows; }
+
+private:
+
+    const Rows _rows;           ///< rows kind
+
+    Columns _columns;           ///< columns
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // EXPORT_EXPORTSCHEMA_H_
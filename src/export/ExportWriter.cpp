@@ -0,0 +1,137 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <export/ExportWriter.h>
+
+#include <cstring>
+#include <locale>
+
+#include <export/ArrowWriter.h>
+#include <export/CsvWriter.h>
+#include <export/JsonLinesWriter.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+ExportWriter* ExportWriter::create( Format format, const ExportSchema *schema )
+{
+    switch ( format )
+    {
+        case CSV:       return new CsvWriter( schema );
+        case JSONLines: return new JsonLinesWriter( schema );
+        case ArrowIPC:  return new ArrowWriter( schema );
+    }
+
+    return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ExportWriter::getFormat( const char *name, Format *format )
+{
+    if      ( 0 == strcmp( name, "csv"   ) ) *format = CSV;
+    else if ( 0 == strcmp( name, "jsonl" ) ) *format = JSONLines;
+    else if ( 0 == strcmp( name, "arrow" ) ) *format = ArrowIPC;
+    else
+        return false;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ExportWriter::ExportWriter( const ExportSchema *schema ) :
+    _schema ( schema )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ExportWriter::~ExportWriter()
+{
+    if ( _fs.is_open() ) _fs.close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ExportWriter::open( const char *fileName )
+{
+    _fs.open( fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+
+    if ( !_fs.is_open() )
+    {
+        return false;
+    }
+
+    // numbers are written the same regardless of user locale
+    _fs.imbue( std::locale::classic() );
+    _fs.precision( 17 );
+
+    return writeHeader();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ExportWriter::close()
+{
+    bool result = writeFooter();
+
+    _fs.flush();
+
+    result = result && _fs.good();
+
+    _fs.close();
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ExportWriter::writeNumber( double value, ExportSchema::Type type )
+{
+    if ( type == ExportSchema::Float64 )
+    {
+        _fs << value;
+    }
+    else
+    {
+        _fs << static_cast< long long >( value );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ExportWriter::writeHeader()
+{
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ExportWriter::writeFooter()
+{
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
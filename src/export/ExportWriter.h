@@ -0,0 +1,116 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef EXPORT_EXPORTWRITER_H_
+#define EXPORT_EXPORTWRITER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+
+#include <export/ExportSchema.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The export writer base class.
+ */
+class ExportWriter
+{
+public:
+
+    /**
+     * @brief The export format enum.
+     */
+    enum Format
+    {
+        CSV = 0,                    ///< comma separated values
+        JSONLines,                  ///< one JSON object per line
+        ArrowIPC                    ///< Apache Arrow IPC stream
+    };
+
+    /**
+     * @brief Creates writer.
+     * @param format export format
+     * @param schema export schema (not owned)
+     * @return writer (has to be deleted by caller)
+     */
+    static ExportWriter* create( Format format, const ExportSchema *schema );
+
+    /**
+     * @brief Returns format of the given name ("csv", "jsonl" or "arrow").
+     * @param name format name
+     * @param format output format
+     * @return returns true on success and false on failure
+     */
+    static bool getFormat( const char *name, Format *format );
+
+    /**
+     * @brief Constructor.
+     * @param schema export schema (not owned)
+     */
+    explicit ExportWriter( const ExportSchema *schema );
+
+    /** @brief Destructor. */
+    virtual ~ExportWriter();
+
+    /**
+     * @brief Opens output file and writes header.
+     * @param fileName output file name
+     * @return returns true on success and false on failure
+     */
+    virtual bool open( const char *fileName );
+
+    /**
+     * @brief Writes single row.
+     * @param row row
+     * @return returns true on success and false on failure
+     */
+    virtual bool write( const ExportSchema::Row &row ) = 0;
+
+    /**
+     * @brief Writes footer and closes output file.
+     * @return returns true on success and false on failure
+     */
+    virtual bool close();
+
+protected:
+
+    const ExportSchema *_schema;    ///< export schema
+
+    std::ofstream _fs;              ///< output file stream
+
+    /**
+     * @brief Writes numeric value, integers and booleans without fraction.
+     * @param value numeric value
+     * @param type column type
+     */
+    void writeNumber( double value, ExportSchema::Type type );
+
+    virtual bool writeHeader();
+    virtual bool writeFooter();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // EXPORT_EXPORTWRITER_H_
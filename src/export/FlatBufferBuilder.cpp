@@ -0,0 +1,177 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <export/FlatBufferBuilder.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+FlatBufferBuilder::FlatBufferBuilder() :
+    _tableStart ( 0 ),
+    _minAlign ( 1 )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FlatBufferBuilder::Offset FlatBufferBuilder::createString( const std::string &str )
+{
+    align( sizeof(uint32_t), str.size() + 1 );
+
+    const char terminator = '\0';
+    push( &terminator, 1 );
+    push( str.data(), str.size() );
+
+    uint32_t length = static_cast< uint32_t >( str.size() );
+    push( &length, sizeof(length) );
+
+    return size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FlatBufferBuilder::Offset FlatBufferBuilder::createStructVector( const void *data, size_t count,
+                                                                 size_t size, size_t align )
+{
+    // both length prefix and elements have to be aligned
+    this->align( align > sizeof(uint32_t) ? align : sizeof(uint32_t), count * size );
+
+    push( data, count * size );
+
+    uint32_t length = static_cast< uint32_t >( count );
+    push( &length, sizeof(length) );
+
+    return this->size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FlatBufferBuilder::Offset FlatBufferBuilder::createOffsetVector( const std::vector< Offset > &offsets )
+{
+    align( sizeof(uint32_t), offsets.size() * sizeof(uint32_t) );
+
+    for ( std::vector< Offset >::const_reverse_iterator it = offsets.rbegin(); it != offsets.rend(); ++it )
+    {
+        pushOffset( *it );
+    }
+
+    uint32_t length = static_cast< uint32_t >( offsets.size() );
+    push( &length, sizeof(length) );
+
+    return size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FlatBufferBuilder::startTable()
+{
+    _fields.clear();
+    _tableStart = size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FlatBufferBuilder::addOffset( uint16_t id, Offset offset )
+{
+    align( sizeof(uint32_t) );
+    pushOffset( offset );
+    _fields.push_back( { id, size() } );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FlatBufferBuilder::Offset FlatBufferBuilder::endTable()
+{
+    // vtable offset placeholder
+    align( sizeof(int32_t) );
+    int32_t vtableOffset = 0;
+    push( &vtableOffset, sizeof(vtableOffset) );
+
+    Offset table = size();
+
+    uint16_t fieldsCount = 0;
+
+    for ( const FieldLoc &field : _fields )
+    {
+        if ( field.id + 1 > fieldsCount ) fieldsCount = field.id + 1;
+    }
+
+    std::vector< uint16_t > vtable( fieldsCount + 2, 0 );
+
+    vtable[ 0 ] = static_cast< uint16_t >( ( fieldsCount + 2 ) * sizeof(uint16_t) );
+    vtable[ 1 ] = static_cast< uint16_t >( table - _tableStart );
+
+    for ( const FieldLoc &field : _fields )
+    {
+        vtable[ field.id + 2 ] = static_cast< uint16_t >( table - field.offset );
+    }
+
+    push( vtable.data(), vtable.size() * sizeof(uint16_t) );
+
+    // vtable precedes table
+    vtableOffset = static_cast< int32_t >( size() - table );
+    memcpy( &_buffer[ _buffer.size() - table ], &vtableOffset, sizeof(vtableOffset) );
+
+    _fields.clear();
+
+    return table;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FlatBufferBuilder::finish( Offset root )
+{
+    align( _minAlign > sizeof(uint32_t) ? _minAlign : sizeof(uint32_t), sizeof(uint32_t) );
+    pushOffset( root );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FlatBufferBuilder::align( size_t alignment, size_t additional )
+{
+    if ( alignment > _minAlign ) _minAlign = alignment;
+
+    size_t padding = ( alignment - ( ( _buffer.size() + additional ) % alignment ) ) % alignment;
+
+    _buffer.insert( _buffer.begin(), padding, 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FlatBufferBuilder::push( const void *data, size_t size )
+{
+    const uint8_t *bytes = static_cast< const uint8_t* >( data );
+    _buffer.insert( _buffer.begin(), bytes, bytes + size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FlatBufferBuilder::pushOffset( Offset offset )
+{
+    // offsets are relative to the location they are stored at
+    uint32_t value = size() + sizeof(uint32_t) - offset;
+    push( &value, sizeof(value) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
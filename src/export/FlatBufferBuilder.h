@@ -0,0 +1,145 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef EXPORT_FLATBUFFERBUILDER_H_
+#define EXPORT_FLATBUFFERBUILDER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief Minimal FlatBuffers builder, sufficient for Arrow IPC metadata.
+ *
+ * As in the reference implementation buffer is built back to front, so
+ * children (strings, vectors, tables) have to be created before tables
+ * referencing them. Objects are identified by their offsets from the end
+ * of the buffer. Scalars are stored in the host byte order, which has to
+ * be little-endian.
+ */
+class FlatBufferBuilder
+{
+public:
+
+    typedef uint32_t Offset;
+
+    /** @brief Constructor. */
+    FlatBufferBuilder();
+
+    /**
+     * @brief Creates string.
+     * @param str string
+     * @return string offset
+     */
+    Offset createString( const std::string &str );
+
+    /**
+     * @brief Creates vector of structs.
+     * @param data structs data
+     * @param count number of structs
+     * @param size single struct size
+     * @param align struct alignment
+     * @return vector offset
+     */
+    Offset createStructVector( const void *data, size_t count, size_t size, size_t align );
+
+    /**
+     * @brief Creates vector of offsets (tables or strings).
+     * @param offsets offsets
+     * @return vector offset
+     */
+    Offset createOffsetVector( const std::vector< Offset > &offsets );
+
+    /** @brief Starts table. */
+    void startTable();
+
+    /**
+     * @brief Adds scalar table field.
+     * @param id field id
+     * @param value field value
+     */
+    template < typename T >
+    void addField( uint16_t id, T value )
+    {
+        align( sizeof(T) );
+        push( &value, sizeof(T) );
+        _fields.push_back( { id, size() } );
+    }
+
+    /**
+     * @brief Adds offset table field.
+     * @param id field id
+     * @param offset referenced object offset
+     */
+    void addOffset( uint16_t id, Offset offset );
+
+    /**
+     * @brief Ends table.
+     * @return table offset
+     */
+    Offset endTable();
+
+    /**
+     * @brief Finishes buffer.
+     * @param root root table offset
+     */
+    void finish( Offset root );
+
+    inline const uint8_t* getData() const { return _buffer.data(); }
+    inline size_t getSize() const { return _buffer.size(); }
+
+private:
+
+    /**
+     * @brief The table field location struct.
+     */
+    struct FieldLoc
+    {
+        uint16_t id;                ///< field id
+        Offset offset;              ///< field offset
+    };
+
+    std::vector< uint8_t > _buffer;     ///< buffer
+    std::vector< FieldLoc > _fields;    ///< current table fields
+
+    Offset _tableStart;                 ///< current table start
+    size_t _minAlign;                   ///< largest alignment used
+
+    inline Offset size() const { return static_cast< Offset >( _buffer.size() ); }
+
+    void align( size_t alignment, size_t additional = 0 );
+
+    void push( const void *data, size_t size );
+
+    void pushOffset( Offset offset );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // EXPORT_FLATBUFFERBUILDER_H_
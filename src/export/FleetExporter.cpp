@@ -0,0 +1,143 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <export/FleetExporter.h>
+
+#include <defs.h>
+
+#include <fleet/FleetPipeline.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetExporter::FleetExporter( ExportWriter::Format format, ExportSchema::Rows rows,
+                              size_t queueSize ) :
+    _schema ( rows ),
+    _writer ( nullptr ),
+    _queue  ( queueSize ),
+    _failed ( false )
+{
+    _writer = ExportWriter::create( format, &_schema );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetExporter::~FleetExporter()
+{
+    finish();
+    DELPTR( _writer );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetExporter::start( const char *fileName )
+{
+    if ( _thread.joinable() || !_writer->open( fileName ) )
+    {
+        return false;
+    }
+
+    _failed = false;
+    _thread = std::thread( &FleetExporter::run, this );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetExporter::push( FleetRecord record )
+{
+    return _thread.joinable() && _queue.push( std::move( record ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetExporter::pushDatabase( const FleetDatabase &database )
+{
+    for ( const FleetRecord &record : database.getRecords() )
+    {
+        if ( !push( record ) ) return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetExporter::pushDirectory( const char *path )
+{
+    FleetPipeline pipeline;
+
+    return pipeline.run( { path }, [ this ]( FleetPipeline::Item *item )
+    {
+        // files which cannot be read are skipped
+        return !item->dataFile || push( std::move( item->record ) );
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetExporter::finish()
+{
+    if ( !_thread.joinable() )
+    {
+        return false;
+    }
+
+    _queue.close();
+    _thread.join();
+
+    bool result = _writer->close();
+
+    return result && !_failed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetExporter::run()
+{
+    FleetRecord record;
+    ExportSchema::Row row;
+
+    while ( _queue.pop( &record ) )
+    {
+        int count = _schema.getRowsCount( record );
+
+        for ( int i = 0; i < count; ++i )
+        {
+            _schema.getRow( record, i, &row );
+
+            if ( !_writer->write( row ) )
+            {
+                // producer is released as well
+                _failed = true;
+                _queue.close();
+                return;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,119 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef EXPORT_FLEETEXPORTER_H_
+#define EXPORT_FLEETEXPORTER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <thread>
+
+#include <export/ExportSchema.h>
+#include <export/ExportWriter.h>
+
+#include <fleet/FleetDatabase.h>
+#include <fleet/FleetRecord.h>
+
+#include <utils/BoundedQueue.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The streaming fleet exporter class.
+ *
+ * Records are passed through a bounded queue to a dedicated writer thread,
+ * which flattens them into rows and writes them out. Producer (reading and
+ * evaluating aircraft files) is blocked whenever the writer falls behind,
+ * so memory usage does not depend on number of exported aircraft.
+ */
+class FleetExporter
+{
+public:
+
+    /**
+     * @brief Constructor.
+     * @param format export format
+     * @param rows rows kind
+     * @param queueSize maximum number of records waiting for writer
+     */
+    FleetExporter( ExportWriter::Format format, ExportSchema::Rows rows,
+                   size_t queueSize = 64 );
+
+    /** @brief Destructor. */
+    virtual ~FleetExporter();
+
+    /**
+     * @brief Opens output file and starts writer thread. Exporter can be
+     * started only once.
+     * @param fileName output file name
+     * @return returns true on success and false on failure
+     */
+    bool start( const char *fileName );
+
+    /**
+     * @brief Pushes record to be exported, waits while the queue is full.
+     * @param record fleet record
+     * @return returns false if exporter is not running or writing failed
+     */
+    bool push( FleetRecord record );
+
+    /**
+     * @brief Pushes all database records.
+     * @param database fleet database
+     * @return returns true on success and false on failure
+     */
+    bool pushDatabase( const FleetDatabase &database );
+
+    /**
+     * @brief Reads and pushes all aircraft files found in the directory and
+     * its subdirectories. Files are read, parsed and evaluated by the
+     * pipeline stages concurrently and pushed in the directory order.
+     * Files which cannot be read are skipped.
+     * @param path directory path
+     * @return returns true on success and false on failure
+     */
+    bool pushDirectory( const char *path );
+
+    /**
+     * @brief Waits for all pushed records to be written and closes output file.
+     * @return returns true on success and false on failure
+     */
+    bool finish();
+
+private:
+
+    ExportSchema _schema;                   ///< export schema
+    ExportWriter *_writer;                  ///< export writer
+
+    BoundedQueue< FleetRecord > _queue;     ///< records waiting for writer
+
+    std::thread _thread;                    ///< writer thread
+    std::atomic< bool > _failed;            ///< specifies if writing failed
+
+    void run();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // EXPORT_FLEETEXPORTER_H_
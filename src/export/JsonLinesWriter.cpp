@@ -0,0 +1,115 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <export/JsonLinesWriter.h>
+
+#include <cmath>
+#include <cstdio>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+JsonLinesWriter::JsonLinesWriter( const ExportSchema *schema ) :
+    ExportWriter( schema )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool JsonLinesWriter::write( const ExportSchema::Row &row )
+{
+    const ExportSchema::Columns &columns = _schema->getColumns();
+
+    _fs.put( '{' );
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        if ( i > 0 ) _fs.put( ',' );
+
+        writeText( columns[ i ].name );
+        _fs.put( ':' );
+
+        switch ( columns[ i ].type )
+        {
+            case ExportSchema::Utf8:
+                writeText( row[ i ].text );
+                break;
+
+            case ExportSchema::Boolean:
+                _fs << ( row[ i ].number != 0.0 ? "true" : "false" );
+                break;
+
+            default:
+                // JSON has no representation of NaN and infinity
+                if ( std::isfinite( row[ i ].number ) )
+                    writeNumber( row[ i ].number, columns[ i ].type );
+                else
+                    _fs << "null";
+                break;
+        }
+    }
+
+    _fs.put( '}' );
+    _fs.put( '\n' );
+
+    return _fs.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void JsonLinesWriter::writeText( const std::string &text )
+{
+    _fs.put( '"' );
+
+    for ( char c : text )
+    {
+        switch ( c )
+        {
+            case '"':  _fs << "\\\""; break;
+            case '\\': _fs << "\\\\"; break;
+            case '\b': _fs << "\\b";  break;
+            case '\f': _fs << "\\f";  break;
+            case '\n': _fs << "\\n";  break;
+            case '\r': _fs << "\\r";  break;
+            case '\t': _fs << "\\t";  break;
+
+            default:
+                if ( static_cast< unsigned char >( c ) < 0x20 )
+                {
+                    char buffer[ 8 ];
+                    snprintf( buffer, sizeof(buffer), "\\u%04x", static_cast< unsigned int >( c ) );
+                    _fs << buffer;
+                }
+                else
+                {
+                    _fs.put( c );
+                }
+                break;
+        }
+    }
+
+    _fs.put( '"' );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,183 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <export/MassBalanceWriter.h>
+
+#include <fstream>
+
+#include <mcutil/misc/Units.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr double MassBalanceWriter::slugFt2;
+
+////////////////////////////////////////////////////////////////////////////////
+
+MassBalanceWriter::MassBalanceWriter( bool pointMasses ) :
+    _pointMasses ( pointMasses )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool MassBalanceWriter::write( const Aircraft &aircraft, std::ostream *os ) const
+{
+    const Matrix3x3 matrix = aircraft.getInertiaMatrix();
+
+    // totals about the reference point
+    double        m = aircraft.getMassTotal();
+    Vector3       s = aircraft.getCenterOfMass() * m;
+    InertiaTensor i( matrix.xx(), matrix.yy(), matrix.zz(),
+                     matrix.xy(), matrix.xz(), matrix.yz() );
+
+    if ( _pointMasses )
+    {
+        // components are written separately, the rest stays as empty weight
+        for ( const Component *component : aircraft.getComponents() )
+        {
+            m -= component->getMass();
+            s -= component->getPosition() * component->getMass();
+            i += component->getInertiaTensor() * -1.0;
+        }
+
+        // tolerance for rounding errors when there is nothing else
+        if ( m <= 1.0e-9 * aircraft.getMassTotal() )
+        {
+            m = 0.0;
+            s = Vector3();
+            i = InertiaTensor();
+        }
+    }
+
+    Vector3 r_cm = ( m > 0.0 ) ? ( s / m ) : aircraft.getCenterOfMass();
+
+    // about the center of mass
+    i += InertiaTensor::getCuboid( m, 0.0, 0.0, 0.0, r_cm ) * -1.0;
+
+    os->setf( std::ios_base::fixed, std::ios_base::floatfield );
+    os->precision( 4 );
+
+    *os << "<?xml version=\"1.0\"?>\n";
+    *os << "<mass_balance>\n";
+
+    writeInertia( i, "  ", os );
+
+    *os << "  <emptywt unit=\"LBS\"> " << Units::kg2lb( m ) << " </emptywt>\n";
+
+    writeLocation( r_cm, "CG", "  ", os );
+
+    if ( _pointMasses )
+    {
+        for ( const Component *component : aircraft.getComponents() )
+        {
+            InertiaTensor i_c = InertiaTensor::getCuboid( component->getMass(),
+                                                          component->getLength(),
+                                                          component->getWidth(),
+                                                          component->getHeight(),
+                                                          Vector3() );
+
+            *os << "  <pointmass name=\"";
+            writeText( component->getName(), os );
+            *os << "\">\n";
+
+            writeInertia( i_c, "    ", os );
+
+            *os << "    <weight unit=\"LBS\"> " << Units::kg2lb( component->getMass() ) << " </weight>\n";
+
+            writeLocation( component->getPosition(), "POINTMASS", "    ", os );
+
+            *os << "  </pointmass>\n";
+        }
+    }
+
+    *os << "</mass_balance>\n";
+
+    return os->good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool MassBalanceWriter::writeFile( const Aircraft &aircraft, const char *fileName ) const
+{
+    std::ofstream fs( fileName, std::ios_base::out | std::ios_base::trunc );
+
+    if ( fs.is_open() )
+    {
+        bool result = write( aircraft, &fs );
+
+        fs.close();
+
+        return result && !fs.fail();
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassBalanceWriter::writeInertia( const InertiaTensor &i, const char *indent, std::ostream *os )
+{
+    // JSBSim products of inertia are negated tensor elements,
+    // subtracting from zero avoids writing negative zeros
+    *os << indent << "<ixx unit=\"SLUG*FT2\"> " << i.xx() / slugFt2 << " </ixx>\n";
+    *os << indent << "<iyy unit=\"SLUG*FT2\"> " << i.yy() / slugFt2 << " </iyy>\n";
+    *os << indent << "<izz unit=\"SLUG*FT2\"> " << i.zz() / slugFt2 << " </izz>\n";
+    *os << indent << "<ixy unit=\"SLUG*FT2\"> " << 0.0 - i.xy() / slugFt2 << " </ixy>\n";
+    *os << indent << "<ixz unit=\"SLUG*FT2\"> " << 0.0 - i.xz() / slugFt2 << " </ixz>\n";
+    *os << indent << "<iyz unit=\"SLUG*FT2\"> " << 0.0 - i.yz() / slugFt2 << " </iyz>\n";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassBalanceWriter::writeLocation( const Vector3 &r, const char *name, const char *indent,
+                                       std::ostream *os )
+{
+    // body axes (x forward, z down) to structural frame (x aft, z up)
+    *os << indent << "<location name=\"" << name << "\" unit=\"IN\">\n";
+    *os << indent << "  <x> " << 0.0 - Units::m2in( r.x() ) << " </x>\n";
+    *os << indent << "  <y> " <<       Units::m2in( r.y() ) << " </y>\n";
+    *os << indent << "  <z> " << 0.0 - Units::m2in( r.z() ) << " </z>\n";
+    *os << indent << "</location>\n";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassBalanceWriter::writeText( const std::string &text, std::ostream *os )
+{
+    for ( char c : text )
+    {
+        switch ( c )
+        {
+            case '&'  : *os << "&amp;";  break;
+            case '<'  : *os << "&lt;";   break;
+            case '>'  : *os << "&gt;";   break;
+            case '"'  : *os << "&quot;"; break;
+            case '\'' : *os << "&apos;"; break;
+            default   : os->put( c );    break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,95 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef EXPORT_MASSBALANCEWRITER_H_
+#define EXPORT_MASSBALANCEWRITER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <ostream>
+#include <string>
+
+#include <mcutil/math/Vector3.h>
+
+#include <Aircraft.h>
+
+#include <utils/InertiaTensor.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The JSBSim/FlightGear mass_balance writer class.
+ *
+ * Writes <mass_balance> element straight to the stream, without building
+ * the XML document, so it can be used for thousands of files.
+ *
+ * Locations are given in the JSBSim structural frame (x-axis aft, y-axis
+ * right, z-axis up, inches) with the origin at the aircraft reference point.
+ * Inertia is given about the center of mass in the body axes, products of
+ * inertia follow JSBSim convention, i.e. ixy = sum( m*x*y ), which is
+ * negated tensor element.
+ *
+ * Optionally each component is written as a pointmass with its cuboid
+ * inertia. Empty weight covers then only the rest of the aircraft (CAD/FEM
+ * point masses), so the totals computed by JSBSim are the same.
+ */
+class MassBalanceWriter
+{
+public:
+
+    static constexpr double slugFt2 = 1.3558179483314004;   ///< [kg*m^2] one slug*ft^2
+
+    /**
+     * @brief Constructor.
+     * @param pointMasses specifies if components are written as pointmasses
+     */
+    explicit MassBalanceWriter( bool pointMasses = false );
+
+    /**
+     * @brief Writes mass_balance element.
+     * @param aircraft aircraft (updated)
+     * @param os output stream
+     * @return returns true on success and false on failure
+     */
+    bool write( const Aircraft &aircraft, std::ostream *os ) const;
+
+    /**
+     * @brief Writes mass_balance file.
+     * @param aircraft aircraft (updated)
+     * @param fileName output file name
+     * @return returns true on success and false on failure
+     */
+    bool writeFile( const Aircraft &aircraft, const char *fileName ) const;
+
+private:
+
+    bool _pointMasses;      ///< specifies if components are written as pointmasses
+
+    static void writeInertia( const InertiaTensor &i, const char *indent, std::ostream *os );
+    static void writeLocation( const Vector3 &r, const char *name, const char *indent, std::ostream *os );
+    static void writeText( const std::string &text, std::ostream *os );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // EXPORT_MASSBALANCEWRITER_H_
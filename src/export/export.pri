@@ -0,0 +1,19 @@
+HEADERS += \
+    $$PWD/ArrowWriter.h \
+    $$PWD/CsvWriter.h \
+    $$PWD/ExportSchema.h \
+    $$PWD/ExportWriter.h \
+    $$PWD/FlatBufferBuilder.h \
+    $$PWD/FleetExporter.h \
+    $$PWD/JsonLinesWriter.h \
+    $$PWD/MassBalanceWriter.h
+
+SOURCES += \
+    $$PWD/ArrowWriter.cpp \
+    $$PWD/CsvWriter.cpp \
+    $$PWD/ExportSchema.cpp \
+    $$PWD/ExportWriter.cpp \
+    $$PWD/FlatBufferBuilder.cpp \
+    $$PWD/FleetExporter.cpp \
+    $$PWD/JsonLinesWriter.cpp \
+    $$PWD/MassBalanceWriter.cpp
@@ -0,0 +1,550 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <fleet/FleetDatabase.h>
+
+#include <algorithm>
+#include <fstream>
+
+#include <QDirIterator>
+#include <QFileInfo>
+
+#include <AircraftDataFields.h>
+#include <DataFile.h>
+
+#include <components/ComponentFactory.h>
+
+#include <import/PointMassImporter.h>
+
+#include <utils/BinaryUtils.h>
+#include <utils/FileUtils.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr int FleetDatabase::_typesCount;
+
+static const uint32_t magic   = 0x4446434D;   // "MCFD"
+static const uint32_t version = 2;
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetRecord FleetDatabase::createRecord( const char *fileName, const Aircraft &aircraft )
+{
+    FleetRecord record;
+
+    record.fileName = getAbsolutePath( fileName );
+    record.modified = getModificationTime( record.fileName );
+
+    record.data = *aircraft.getData();
+
+    for ( const Component *component : aircraft.getComponents() )
+    {
+        record.components.push_back( component->getComponentData() );
+    }
+
+    record.pointMasses     = aircraft.getPointMasses();
+    record.pointMassesFile = aircraft.getPointMassesFile();
+
+    record.massTotal     = aircraft.getMassTotal();
+    record.centerOfMass  = aircraft.getCenterOfMass();
+    record.inertiaMatrix = aircraft.getInertiaMatrix();
+
+    return record;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetDatabase::FleetDatabase() :
+    _indexValid ( false )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetDatabase::~FleetDatabase() {}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetDatabase::open( const char *fileName )
+{
+    clear();
+
+    _fileName = fileName;
+
+    std::ifstream fs( fileName, std::ios_base::in | std::ios_base::binary );
+
+    if ( !fs.is_open() )
+    {
+        // new database
+        return true;
+    }
+
+    uint32_t magic_temp   = 0;
+    uint32_t version_temp = 0;
+    uint32_t fields_count = 0;
+    uint32_t records_count = 0;
+
+    bool result = true;
+
+    if ( result ) result = BinaryUtils::read( fs, &magic_temp    );
+    if ( result ) result = BinaryUtils::read( fs, &version_temp  );
+    if ( result ) result = BinaryUtils::read( fs, &fields_count  );
+    if ( result ) result = BinaryUtils::read( fs, &records_count );
+
+    result = result
+          && magic_temp   == magic
+          && version_temp == version
+          && fields_count == static_cast< uint32_t >( AircraftDataFields::getCount() );
+
+    for ( uint32_t i = 0; i < records_count && result; ++i )
+    {
+        FleetRecord record;
+
+        if ( result ) result = BinaryUtils::read( fs, &record.fileName );
+        if ( result ) result = BinaryUtils::read( fs, &record.modified );
+
+        for ( uint32_t j = 0; j < fields_count && result; ++j )
+        {
+            double value = 0.0;
+            result = BinaryUtils::read( fs, &value )
+                  && AircraftDataFields::setValue( record.data, j, value );
+        }
+
+        uint32_t components_count = 0;
+
+        if ( result ) result = BinaryUtils::read( fs, &components_count );
+
+        for ( uint32_t j = 0; j < components_count && result; ++j )
+        {
+            ComponentData component;
+
+            if ( result ) result = BinaryUtils::read( fs, &component.type );
+            if ( result ) result = BinaryUtils::read( fs, &component.name );
+            if ( result ) result = BinaryUtils::read( fs, &component.r    );
+            if ( result ) result = BinaryUtils::read( fs, &component.m    );
+            if ( result ) result = BinaryUtils::read( fs, &component.l    );
+            if ( result ) result = BinaryUtils::read( fs, &component.w    );
+            if ( result ) result = BinaryUtils::read( fs, &component.h    );
+
+            record.components.push_back( component );
+        }
+
+        if ( result ) result = BinaryUtils::read( fs, &record.pointMassesFile );
+        if ( result ) result = PointMassImporter::readBinary( fs, &record.pointMasses );
+
+        if ( result ) result = BinaryUtils::read( fs, &record.massTotal     );
+        if ( result ) result = BinaryUtils::read( fs, &record.centerOfMass  );
+        if ( result ) result = BinaryUtils::read( fs, &record.inertiaMatrix );
+
+        if ( result ) _records.push_back( record );
+    }
+
+    fs.close();
+
+    if ( !result )
+    {
+        clear();
+    }
+
+    updateFileNames();
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetDatabase::save()
+{
+    return saveAs( _fileName.c_str() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetDatabase::saveAs( const char *fileName )
+{
+    std::string fileTemp = std::string( fileName ) + ".tmp";
+
+    std::ofstream fs( fileTemp.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+
+    if ( !fs.is_open() )
+    {
+        return false;
+    }
+
+    BinaryUtils::write( fs, magic );
+    BinaryUtils::write( fs, version );
+    BinaryUtils::write( fs, static_cast< uint32_t >( AircraftDataFields::getCount() ) );
+    BinaryUtils::write( fs, static_cast< uint32_t >( _records.size() ) );
+
+    for ( Records::const_iterator it = _records.begin(); it != _records.end(); ++it )
+    {
+        BinaryUtils::write( fs, it->fileName );
+        BinaryUtils::write( fs, it->modified );
+
+        for ( int i = 0; i < AircraftDataFields::getCount(); ++i )
+        {
+            BinaryUtils::write( fs, AircraftDataFields::getValue( it->data, i ) );
+        }
+
+        BinaryUtils::write( fs, static_cast< uint32_t >( it->components.size() ) );
+
+        for ( const ComponentData &component : it->components )
+        {
+            BinaryUtils::write( fs, component.type );
+            BinaryUtils::write( fs, component.name );
+            BinaryUtils::write( fs, component.r    );
+            BinaryUtils::write( fs, component.m    );
+            BinaryUtils::write( fs, component.l    );
+            BinaryUtils::write( fs, component.w    );
+            BinaryUtils::write( fs, component.h    );
+        }
+
+        BinaryUtils::write( fs, it->pointMassesFile );
+        PointMassImporter::writeBinary( fs, it->pointMasses );
+
+        BinaryUtils::write( fs, it->massTotal     );
+        BinaryUtils::write( fs, it->centerOfMass  );
+        BinaryUtils::write( fs, it->inertiaMatrix );
+    }
+
+    fs.flush();
+
+    bool result = fs.good();
+
+    fs.close();
+
+    if ( result )
+    {
+        // replace database file only when it has been completely written
+        result = FileUtils::replace( fileTemp.c_str(), fileName );
+    }
+
+    if ( result )
+    {
+        _fileName = fileName;
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetDatabase::clear()
+{
+    _records.clear();
+    _fileNames.clear();
+    _indexValid = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int FleetDatabase::ingestFile( const char *fileName )
+{
+    std::string path = getAbsolutePath( fileName );
+    int64_t modified = getModificationTime( path );
+
+    int index = find( path.c_str() );
+
+    if ( index >= 0 && _records[ index ].modified == modified )
+    {
+        // not modified since ingested
+        return index;
+    }
+
+    DataFile dataFile;
+
+    if ( dataFile.readFile( path.c_str() ) )
+    {
+        index = insert( path.c_str(), *dataFile.getAircraft() );
+        _records[ index ].modified = modified;
+
+        return index;
+    }
+
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int FleetDatabase::ingestDirectory( const char *path )
+{
+    int count = 0;
+
+    QDirIterator it( path, QStringList() << "*.xml", QDir::Files,
+                     QDirIterator::Subdirectories );
+
+    while ( it.hasNext() )
+    {
+        if ( ingestFile( it.next().toLocal8Bit().constData() ) >= 0 )
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int FleetDatabase::insert( const char *fileName, const Aircraft &aircraft )
+{
+    FleetRecord record = createRecord( fileName, aircraft );
+
+    int index = find( record.fileName.c_str() );
+
+    if ( index < 0 )
+    {
+        index = getCount();
+        _records.push_back( record );
+        _fileNames[ record.fileName ] = index;
+    }
+    else
+    {
+        _records[ index ] = record;
+    }
+
+    _indexValid = false;
+
+    return index;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetDatabase::remove( const char *fileName )
+{
+    int index = find( getAbsolutePath( fileName ).c_str() );
+
+    if ( index >= 0 )
+    {
+        _records.erase( _records.begin() + index );
+        updateFileNames();
+        _indexValid = false;
+
+        return true;
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetDatabase::Indices FleetDatabase::query( Key key, double min, double max ) const
+{
+    updateIndexes();
+    return query( _index[ key ], min, max );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetDatabase::Indices FleetDatabase::query( AircraftData::Type type, Key key,
+                                             double min, double max ) const
+{
+    updateIndexes();
+    return query( _indexType[ type ][ key ], min, max );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetDatabase::Indices FleetDatabase::query( AircraftData::Type type ) const
+{
+    updateIndexes();
+
+    Indices result;
+
+    const Index &index = _indexType[ type ][ MTOW ];
+
+    result.reserve( index.size() );
+
+    for ( Index::const_iterator it = index.begin(); it != index.end(); ++it )
+    {
+        result.push_back( it->second );
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int FleetDatabase::find( const char *fileName ) const
+{
+    FileNames::const_iterator it = _fileNames.find( fileName );
+
+    if ( it != _fileNames.end() )
+    {
+        return it->second;
+    }
+
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetDatabase::getAircraft( int index, Aircraft *aircraft ) const
+{
+    if ( index < 0 || index >= getCount() )
+    {
+        return false;
+    }
+
+    const FleetRecord &record = _records[ index ];
+
+    aircraft->reset();
+    aircraft->setData( record.data );
+
+    Aircraft::Components components;
+    components.reserve( record.components.size() );
+
+    for ( const ComponentData &componentData : record.components )
+    {
+        Component *component = ComponentFactory::create( componentData, aircraft->getData() );
+
+        if ( component )
+        {
+            components.push_back( component );
+        }
+    }
+
+    if ( record.pointMasses.getCount() > 0 )
+    {
+        aircraft->setPointMasses( record.pointMasses, record.pointMassesFile.c_str() );
+    }
+
+    aircraft->addComponents( components );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double FleetDatabase::getKeyValue( const FleetRecord &record, Key key )
+{
+    switch ( key )
+    {
+        case MTOW          : return record.data.general.mtow;
+        case MassEmpty     : return record.massTotal;
+        case CenterOfMassX : return record.centerOfMass.x();
+        case KeysCount     : break;
+    }
+
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetDatabase::Indices FleetDatabase::query( const Index &index, double min, double max )
+{
+    Indices result;
+
+    Index::const_iterator first = std::lower_bound( index.begin(), index.end(),
+                                                    std::make_pair( min, -1 ) );
+
+    for ( Index::const_iterator it = first; it != index.end() && it->first <= max; ++it )
+    {
+        result.push_back( it->second );
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::string FleetDatabase::getAbsolutePath( const char *fileName )
+{
+    return QFileInfo( fileName ).absoluteFilePath().toLocal8Bit().constData();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int64_t FleetDatabase::getModificationTime( const std::string &fileName )
+{
+    QFileInfo fileInfo( fileName.c_str() );
+
+    if ( fileInfo.exists() )
+    {
+        return fileInfo.lastModified().toMSecsSinceEpoch();
+    }
+
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetDatabase::updateFileNames()
+{
+    _fileNames.clear();
+
+    for ( int i = 0; i < getCount(); ++i )
+    {
+        _fileNames[ _records[ i ].fileName ] = i;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetDatabase::updateIndexes() const
+{
+    if ( _indexValid )
+    {
+        return;
+    }
+
+    for ( int k = 0; k < KeysCount; ++k )
+    {
+        _index[ k ].clear();
+        _index[ k ].reserve( _records.size() );
+
+        for ( int t = 0; t < _typesCount; ++t )
+        {
+            _indexType[ t ][ k ].clear();
+        }
+    }
+
+    for ( int i = 0; i < getCount(); ++i )
+    {
+        const FleetRecord &record = _records[ i ];
+
+        for ( int k = 0; k < KeysCount; ++k )
+        {
+            std::pair< double, int > entry( getKeyValue( record, static_cast< Key >( k ) ), i );
+
+            _index[ k ].push_back( entry );
+            _indexType[ record.data.type ][ k ].push_back( entry );
+        }
+    }
+
+    for ( int k = 0; k < KeysCount; ++k )
+    {
+        std::sort( _index[ k ].begin(), _index[ k ].end() );
+
+        for ( int t = 0; t < _typesCount; ++t )
+        {
+            std::sort( _indexType[ t ][ k ].begin(), _indexType[ t ][ k ].end() );
+        }
+    }
+
+    _indexValid = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,211 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef FLEET_FLEETDATABASE_H_
+#define FLEET_FLEETDATABASE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Aircraft.h>
+
+#include <fleet/FleetRecord.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The fleet database class.
+ *
+ * Embedded store of aircraft ingested from data files. Records are kept
+ * in memory and persisted to a single binary file. Secondary indexes are
+ * sorted (value, record) arrays, one per key for all aircraft and one per
+ * key for every aircraft type, so range queries are binary searches.
+ * Indexes are rebuilt lazily after the records have been modified.
+ */
+class FleetDatabase
+{
+public:
+
+    /**
+     * @brief The index key enum.
+     */
+    enum Key
+    {
+        MTOW = 0,                   ///< maximum take-off mass
+        MassEmpty,                  ///< computed empty mass
+        CenterOfMassX,              ///< computed center of mass x-coordinate
+        KeysCount                   ///< number of keys
+    };
+
+    typedef std::vector< FleetRecord > Records;
+    typedef std::vector< int > Indices;
+
+    /**
+     * @brief Creates record of already evaluated aircraft.
+     * @param fileName aircraft file name
+     * @param aircraft aircraft
+     * @return fleet record
+     */
+    static FleetRecord createRecord( const char *fileName, const Aircraft &aircraft );
+
+    /** @brief Constructor. */
+    FleetDatabase();
+
+    /** @brief Destructor. */
+    virtual ~FleetDatabase();
+
+    /**
+     * @brief Opens database file. Database is empty if the file does not exist.
+     * @param fileName database file name
+     * @return returns true on success and false on failure
+     */
+    bool open( const char *fileName );
+
+    /**
+     * @brief Saves database to the file it has been opened from.
+     * @return returns true on success and false on failure
+     */
+    bool save();
+
+    /**
+     * @brief Saves database to the file.
+     * @param fileName database file name
+     * @return returns true on success and false on failure
+     */
+    bool saveAs( const char *fileName );
+
+    /** @brief Removes all records. */
+    void clear();
+
+    /**
+     * @brief Ingests aircraft file. File is not parsed again if it has not
+     * been modified since it was ingested.
+     * @param fileName aircraft file name
+     * @return record index or -1 on failure
+     */
+    int ingestFile( const char *fileName );
+
+    /**
+     * @brief Ingests all aircraft files found in the directory and its
+     * subdirectories.
+     * @param path directory path
+     * @return number of ingested aircraft files
+     */
+    int ingestDirectory( const char *path );
+
+    /**
+     * @brief Inserts or replaces record of the given aircraft.
+     * @param fileName aircraft file name
+     * @param aircraft aircraft
+     * @return record index
+     */
+    int insert( const char *fileName, const Aircraft &aircraft );
+
+    /**
+     * @brief Removes aircraft file record.
+     * @param fileName aircraft file name
+     * @return returns true if record has been removed
+     */
+    bool remove( const char *fileName );
+
+    /**
+     * @brief Returns indices of records which key value is within range.
+     * @param key index key
+     * @param min minimum value (inclusive)
+     * @param max maximum value (inclusive)
+     * @return records indices sorted by key value
+     */
+    Indices query( Key key, double min, double max ) const;
+
+    /**
+     * @brief Returns indices of records of the given aircraft type which
+     * key value is within range.
+     * @param type aircraft type
+     * @param key index key
+     * @param min minimum value (inclusive)
+     * @param max maximum value (inclusive)
+     * @return records indices sorted by key value
+     */
+    Indices query( AircraftData::Type type, Key key, double min, double max ) const;
+
+    /**
+     * @brief Returns indices of all records of the given aircraft type.
+     * @param type aircraft type
+     * @return records indices
+     */
+    Indices query( AircraftData::Type type ) const;
+
+    /**
+     * @brief Returns record index.
+     * @param fileName aircraft file name
+     * @return record index or -1 if there is no such record
+     */
+    int find( const char *fileName ) const;
+
+    /**
+     * @brief Restores aircraft from the record.
+     * @param index record index
+     * @param aircraft aircraft to be restored
+     * @return returns true on success and false on failure
+     */
+    bool getAircraft( int index, Aircraft *aircraft ) const;
+
+    inline const FleetRecord& getRecord( int index ) const { return _records[ index ]; }
+    inline const Records& getRecords() const { return _records; }
+
+    inline int getCount() const { return static_cast< int >( _records.size() ); }
+
+private:
+
+    typedef std::vector< std::pair< double, int > > Index;
+    typedef std::map< std::string, int > FileNames;
+
+    static constexpr int _typesCount { AircraftData::Helicopter + 1 };  ///< number of aircraft types
+
+    std::string _fileName;      ///< database file name
+
+    Records _records;           ///< records
+    FileNames _fileNames;       ///< records indices by file name
+
+    mutable Index _index[ KeysCount ];                      ///< all aircraft indexes
+    mutable Index _indexType[ _typesCount ][ KeysCount ];   ///< aircraft type indexes
+    mutable bool _indexValid;                               ///< specifies if indexes are up to date
+
+    static double getKeyValue( const FleetRecord &record, Key key );
+
+    static Indices query( const Index &index, double min, double max );
+
+    static std::string getAbsolutePath( const char *fileName );
+    static int64_t getModificationTime( const std::string &fileName );
+
+    void updateFileNames();
+    void updateIndexes() const;
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // FLEET_FLEETDATABASE_H_
@@ -0,0 +1,515 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <fleet/FleetGenerator.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <QDir>
+
+#include <AircraftDataFields.h>
+#include <DataFile.h>
+
+#include <components/ComponentFactory.h>
+
+#include <utils/ThreadPool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct BaselineField
+{
+    const char *name;           ///< field name
+    double value;               ///< field value
+};
+
+struct BaselineComponent
+{
+    const char *type;           ///< component XML tag name
+    const char *name;           ///< component name
+    double m;                   ///< [kg] mass
+    double x, y, z;             ///< [m] position
+    double l, w, h;             ///< [m] dimensions
+};
+
+struct Baseline
+{
+    AircraftData::Type type;                ///< aircraft type
+    double sigma;                           ///< scale factor log standard deviation
+    const BaselineField *fields;            ///< non-zero fields, null terminated
+    const BaselineComponent *components;    ///< components, null terminated
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// F-16C
+static const BaselineField fieldsF16C[] =
+{
+    { "general.m_empty", 8910.0 }, { "general.mtow", 21772.0 }, { "general.m_maxLand", 21772.0 },
+    { "general.nz_max", 9.0 }, { "general.nz_maxLand", 9.0 }, { "general.mach_max", 2.1 },
+    { "fuselage.l", 14.0 }, { "fuselage.h", 1.65 }, { "fuselage.w", 2.08 }, { "fuselage.l_n", 5.0 },
+    { "fuselage.wetted_area", 72.92 },
+    { "wing.area", 27.87 }, { "wing.area_exp", 18.14 }, { "wing.span", 9.14 }, { "wing.sweep", 30.9 },
+    { "wing.c_tip", 1.15 }, { "wing.c_root", 3.89 }, { "wing.ar", 2.997 }, { "wing.tr", 0.296 },
+    { "wing.t_c", 0.04 }, { "wing.ctrl_area", 6.24 },
+    { "hor_tail.area", 5.92 }, { "hor_tail.span", 5.58 }, { "hor_tail.w_f", 2.08 }, { "hor_tail.ar", 5.26 },
+    { "hor_tail.rolling", 1.0 },
+    { "ver_tail.area", 5.09 }, { "ver_tail.height", 1.3 }, { "ver_tail.sweep", 44.2 },
+    { "ver_tail.c_tip", 1.21 }, { "ver_tail.c_root", 2.81 }, { "ver_tail.arm", 4.4 },
+    { "ver_tail.rudd_area", 1.31 }, { "ver_tail.ar", 0.332 }, { "ver_tail.tr", 0.431 },
+    { "landing_gear.main_l", 1.4 }, { "landing_gear.nose_l", 1.0 }, { "landing_gear.nose_wheels", 1.0 },
+    { "landing_gear.tripod", 1.0 },
+    { "engine.mass", 1681.0 },
+    { "rotors.main_gear_ratio", 1.0 },
+    { nullptr, 0.0 }
+};
+
+static const BaselineComponent componentsF16C[] =
+{
+    { "fuselage"  , "Fuselage"          , 1854.0,  0.0 , 0.0,  0.0 , 14.0 , 2.08, 1.65 },
+    { "wing"      , "Wing"              ,  961.0, -0.5 , 0.0,  0.0 ,  3.45, 9.14, 0.3  },
+    { "tail_hor"  , "Horizontal Tail"   ,  119.0, -4.85, 0.0,  0.0 ,  1.75, 5.58, 0.3  },
+    { "tail_ver"  , "Vertical Tail"     ,  186.0, -4.62, 0.0, -2.02,  4.09, 0.3 , 2.54 },
+    { "gear_main" , "Main Landing Gear" ,  568.0, -0.89, 0.0,  1.14,  0.0 , 0.0 , 0.0  },
+    { "gear_nose" , "Nose Landing Gear" ,  123.0,  3.08, 0.0,  1.39,  0.0 , 0.0 , 0.0  },
+    { "engine"    , "Engine"            , 2185.0, -2.2 , 0.0,  0.0 ,  4.85, 1.19, 1.19 },
+    { "all_else"  , "All-else Empty"    , 2914.0,  1.0 , 0.0,  0.0 ,  8.0 , 3.0 , 1.0  },
+    { nullptr, nullptr, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }
+};
+
+// C-130
+static const BaselineField fieldsC130[] =
+{
+    { "general.m_empty", 34686.0 }, { "general.mtow", 70310.0 }, { "general.m_maxLand", 59000.0 },
+    { "general.nz_max", 4.4 }, { "general.nz_maxLand", 4.4 }, { "general.v_stall", 100.0 },
+    { "fuselage.l", 30.3 }, { "fuselage.h", 4.0 }, { "fuselage.w", 4.4 }, { "fuselage.l_n", 4.3 },
+    { "fuselage.wetted_area", 299.0 }, { "fuselage.landing_gear", 1.0 },
+    { "fuselage.wetted_area_override", 1.0 },
+    { "wing.area", 162.12 }, { "wing.area_exp", 140.8 }, { "wing.span", 40.41 },
+    { "wing.c_tip", 2.58 }, { "wing.c_root", 4.93 }, { "wing.ar", 10.073 }, { "wing.tr", 0.523 },
+    { "wing.t_c", 0.18 }, { "wing.ctrl_area", 46.12 },
+    { "hor_tail.area", 35.4 }, { "hor_tail.span", 15.86 }, { "hor_tail.sweep", 8.6 },
+    { "hor_tail.elev_area", 29.9 }, { "hor_tail.w_f", 2.92 }, { "hor_tail.arm", 13.04 },
+    { "hor_tail.ar", 7.106 },
+    { "ver_tail.area", 20.9 }, { "ver_tail.height", 6.9 }, { "ver_tail.sweep", 19.5 },
+    { "ver_tail.t_c", 0.16 }, { "ver_tail.arm", 12.62 }, { "ver_tail.ar", 2.278 },
+    { "landing_gear.main_l", 1.5 }, { "landing_gear.nose_l", 1.5 }, { "landing_gear.main_wheels", 4.0 },
+    { "landing_gear.main_struts", 4.0 }, { "landing_gear.nose_wheels", 2.0 },
+    { "engine.mass", 828.0 },
+    { "rotors.main_gear_ratio", 1.0 },
+    { nullptr, 0.0 }
+};
+
+static const BaselineComponent componentsC130[] =
+{
+    { "fuselage"  , "Fuselage"          ,  7385.0,   0.0 ,   0.0 ,  0.0 , 30.3 ,  4.33, 4.0 },
+    { "wing"      , "Wing"              ,  6552.0,   0.0 ,   0.0 , -2.16,  4.16, 40.41, 1.0 },
+    { "tail_hor"  , "Horizontal Tail"   ,   849.0, -13.4 ,   0.0 , -2.07,  3.04, 15.86, 0.3 },
+    { "tail_ver"  , "Vertical Tail"     ,   548.0, -12.62,   0.0 , -5.09,  4.25,  0.3 , 6.9 },
+    { "gear_main" , "Main Landing Gear" ,  2132.0,   0.0 ,   0.0 ,  0.0 ,  0.0 ,  0.0 , 0.0 },
+    { "gear_nose" , "Nose Landing Gear" ,   934.0,   0.0 ,   0.0 ,  0.0 ,  0.0 ,  0.0 , 0.0 },
+    { "engine"    , "Engine 1"          ,  1150.0,   2.0 , -10.2 , -1.96,  3.7 ,  0.7 , 1.0 },
+    { "engine"    , "Engine 2"          ,  1150.0,   2.0 ,  -5.15, -1.73,  3.7 ,  0.7 , 1.0 },
+    { "engine"    , "Engine 3"          ,  1150.0,   2.0 ,   5.15, -1.73,  3.7 ,  0.7 , 1.0 },
+    { "engine"    , "Engine 4"          ,  1150.0,   2.0 ,  10.2 , -1.96,  3.7 ,  0.7 , 1.0 },
+    { "all_else"  , "All-else Empty"    , 11686.0,   0.0 ,   0.0 ,  0.0 , 15.0 ,  6.0 , 4.0 },
+    { nullptr, nullptr, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }
+};
+
+// Cessna 172
+static const BaselineField fieldsC172[] =
+{
+    { "general.m_empty", 754.0 }, { "general.mtow", 1157.0 }, { "general.m_maxLand", 1157.0 },
+    { "general.nz_max", 4.4 }, { "general.nz_maxLand", 4.4 }, { "general.h_cruise", 3000.0 },
+    { "general.v_cruise", 124.0 },
+    { "fuselage.l", 7.22 }, { "fuselage.h", 1.4 }, { "fuselage.w", 1.1 }, { "fuselage.l_n", 2.0 },
+    { "fuselage.wetted_area", 26.43 },
+    { "wing.area", 16.17 }, { "wing.area_exp", 15.9 }, { "wing.span", 11.0 },
+    { "wing.c_tip", 1.13 }, { "wing.c_root", 1.7 }, { "wing.ar", 7.483 }, { "wing.tr", 0.665 },
+    { "wing.t_c", 0.12 }, { "wing.fuel", 165.0 }, { "wing.ctrl_area", 16.17 },
+    { "hor_tail.area", 2.0 }, { "hor_tail.c_tip", 0.82 }, { "hor_tail.c_root", 1.3 },
+    { "hor_tail.t_c", 0.12 }, { "hor_tail.arm", 4.79 }, { "hor_tail.tr", 0.631 },
+    { "ver_tail.area", 1.04 }, { "ver_tail.height", 1.77 }, { "ver_tail.sweep", 33.6 },
+    { "ver_tail.c_tip", 0.7 }, { "ver_tail.c_root", 1.42 }, { "ver_tail.t_c", 0.09 },
+    { "ver_tail.ar", 3.012 }, { "ver_tail.tr", 0.493 },
+    { "landing_gear.main_l", 0.7 }, { "landing_gear.nose_l", 0.6 }, { "landing_gear.fixed", 1.0 },
+    { "engine.mass", 126.0 },
+    { "rotors.main_gear_ratio", 1.0 },
+    { nullptr, 0.0 }
+};
+
+static const BaselineComponent componentsC172[] =
+{
+    { "fuselage"  , "Fuselage"          , 153.0, -1.15, 0.0,  0.0 , 6.8, 1.1 , 1.4 },
+    { "wing"      , "Wing"              , 174.0,  0.0 , 0.0, -0.73, 1.7, 11.0, 0.2 },
+    { "tail_hor"  , "Horizontal Tail"   ,  21.0, -4.79, 0.0, -0.28, 1.1, 3.6 , 0.1 },
+    { "tail_ver"  , "Vertical Tail"     ,   9.0, -4.79, 0.0, -0.4 , 1.0, 0.1 , 1.7 },
+    { "gear_main" , "Main Landing Gear" ,  77.0,  1.0 , 0.0,  1.0 , 0.0, 0.0 , 0.0 },
+    { "gear_nose" , "Nose Landing Gear" ,  11.0, -0.5 , 0.0,  1.0 , 0.0, 0.0 , 0.0 },
+    { "engine"    , "Engine"            , 176.0,  1.3 , 0.0,  0.0 , 1.0, 1.0 , 0.8 },
+    { "all_else"  , "All-else Empty"    , 133.0, -1.0 , 0.0,  0.0 , 0.0, 0.0 , 0.0 },
+    { nullptr, nullptr, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }
+};
+
+// UH-60
+static const BaselineField fieldsUH60[] =
+{
+    { "general.m_empty", 5118.0 }, { "general.mtow", 11113.0 },
+    { "general.nz_max", 4.4 }, { "general.nz_maxLand", 4.4 },
+    { "fuselage.l", 15.26 }, { "fuselage.h", 2.38 }, { "fuselage.w", 2.36 }, { "fuselage.l_n", 2.0 },
+    { "fuselage.wetted_area", 114.91 },
+    { "hor_tail.area", 4.18 }, { "hor_tail.span", 4.36 }, { "hor_tail.ar", 4.548 },
+    { "ver_tail.area", 3.0 }, { "ver_tail.height", 2.17 }, { "ver_tail.ar", 1.57 }, { "ver_tail.rotor", 1.0 },
+    { "engine.mass", 207.0 },
+    { "rotors.main_r", 8.18 }, { "rotors.main_cb", 0.53 }, { "rotors.main_rpm", 258.0 },
+    { "rotors.main_gear_ratio", 80.0 }, { "rotors.tail_r", 1.675 }, { "rotors.mcp", 2215.0 },
+    { "rotors.main_tip_vel", 221.0 }, { "rotors.main_blades", 4.0 },
+    { nullptr, 0.0 }
+};
+
+static const BaselineComponent componentsUH60[] =
+{
+    { "fuselage"    , "Fuselage"          , 1099.0,  0.0 ,  0.0,  0.0 , 15.26, 2.36, 2.0  },
+    { "tail_hor"    , "Horizontal Tail"   ,   48.0, -9.12,  0.0,  0.18,  1.1 , 4.36, 0.2  },
+    { "tail_ver"    , "Vertical Tail"     ,   26.0, -8.98,  0.0, -0.55,  2.9 , 0.4 , 2.17 },
+    { "gear_main"   , "Main Landing Gear" ,  391.0,  1.3 ,  0.0,  1.3 ,  2.5 , 3.0 , 0.7  },
+    { "engine"      , "Engine 1"          ,  270.0, -0.55, -0.9, -0.66,  1.17, 0.4 , 0.4  },
+    { "engine"      , "Engine 2"          ,  270.0, -0.55,  0.9, -0.66,  1.17, 0.4 , 0.4  },
+    { "rotor_drive" , "Rotor Drive"       ,  541.0,  0.0 ,  0.0, -0.8 ,  1.0 , 1.0 , 1.2  },
+    { "rotor_hub"   , "Main Rotor Hub"    ,  164.0,  0.0 ,  0.0, -1.62,  1.5 , 1.5 , 0.4  },
+    { "rotor_main"  , "Main Rotor"        ,  339.0,  0.0 ,  0.0, -1.62,  0.0 , 0.0 , 0.0  },
+    { "rotor_tail"  , "Tail Rotor"        ,   38.0, -9.92,  0.0, -1.87,  3.35, 1.0 , 3.35 },
+    { "all_else"    , "All-else Empty"    , 1932.0,  0.0 ,  0.0,  0.3 ,  5.0 , 1.0 , 1.7  },
+    { nullptr, nullptr, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }
+};
+
+// AW101
+static const BaselineField fieldsAW101[] =
+{
+    { "general.m_empty", 10500.0 }, { "general.mtow", 14600.0 },
+    { "general.nz_max", 4.4 }, { "general.nz_maxLand", 4.4 },
+    { "fuselage.l", 19.3 }, { "fuselage.h", 3.84 }, { "fuselage.w", 4.34 }, { "fuselage.l_n", 3.25 },
+    { "fuselage.wetted_area", 245.79 }, { "fuselage.cargo_ramp", 1.0 },
+    { "hor_tail.area", 2.73 }, { "hor_tail.span", 2.66 }, { "hor_tail.ar", 2.592 },
+    { "ver_tail.area", 4.24 }, { "ver_tail.height", 2.57 }, { "ver_tail.ar", 1.558 }, { "ver_tail.rotor", 1.0 },
+    { "engine.mass", 220.0 },
+    { "rotors.main_r", 9.3 }, { "rotors.main_cb", 0.47 }, { "rotors.main_rpm", 210.0 },
+    { "rotors.main_gear_ratio", 97.0 }, { "rotors.tail_r", 2.0 }, { "rotors.mcp", 6000.0 },
+    { "rotors.main_tip_vel", 204.52 }, { "rotors.main_blades", 5.0 },
+    { nullptr, 0.0 }
+};
+
+static const BaselineComponent componentsAW101[] =
+{
+    { "fuselage"    , "Fuselage"          , 2452.0,   0.7,  0.0, -0.8 , 19.3, 4.34, 3.84 },
+    { "gear_main"   , "Main Landing Gear" ,  489.0,   0.0,  0.0,  0.0 ,  7.6, 4.1 , 0.8  },
+    { "tail_hor"    , "Horizontal Tail"   ,   24.0,   0.0,  0.0,  0.0 ,  0.0, 0.0 , 0.0  },
+    { "tail_ver"    , "Vertical Tail"     ,   36.0,   0.0,  0.0,  0.0 ,  0.0, 0.0 , 0.0  },
+    { "engine"      , "Engine 1"          ,  286.0,   0.0, -1.0, -2.3 ,  1.2, 0.7 , 0.7  },
+    { "engine"      , "Engine 2"          ,  286.0,   0.0,  0.0, -2.7 ,  1.2, 0.7 , 0.7  },
+    { "engine"      , "Engine 3"          ,  286.0,   0.0,  1.0, -2.3 ,  1.2, 0.7 , 0.7  },
+    { "rotor_drive" , "Rotor Drive"       , 1389.0,   0.0,  0.0, -2.4 ,  0.0, 0.0 , 0.0  },
+    { "rotor_hub"   , "Main Rotor Hub"    ,  222.0,   0.0,  0.0, -3.58,  1.5, 1.5 , 0.2  },
+    { "rotor_main"  , "Main Rotor"        ,  393.0,   0.0,  0.0, -3.58,  0.0, 0.0 , 0.0  },
+    { "rotor_tail"  , "Tail Rotor"        ,  112.0, -11.5,  0.0, -3.34,  0.0, 0.0 , 0.0  },
+    { "all_else"    , "All-else Empty"    , 4525.0,   0.0,  0.0, -0.5 ,  0.0, 0.0 , 0.0  },
+    { nullptr, nullptr, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }
+};
+
+static const Baseline baselines[] =
+{
+    { AircraftData::FighterAttack   , 0.10, fieldsF16C  , componentsF16C  },
+    { AircraftData::CargoTransport  , 0.20, fieldsC130  , componentsC130  },
+    { AircraftData::GeneralAviation , 0.15, fieldsC172  , componentsC172  },
+    { AircraftData::Helicopter      , 0.15, fieldsUH60  , componentsUH60  },
+    { AircraftData::Helicopter      , 0.15, fieldsAW101 , componentsAW101 }
+};
+
+static const int baselinesCount = sizeof( baselines ) / sizeof( Baseline );
+
+// fields scaled with the square and the cube of the scale factor,
+// other double fields, except lengths, are only perturbed
+static const char *areaFields[] =
+{
+    "fuselage.wetted_area", "wing.area", "wing.area_exp", "wing.ctrl_area",
+    "hor_tail.area", "hor_tail.elev_area", "ver_tail.area", "ver_tail.rudd_area",
+    nullptr
+};
+
+static const char *massFields[] =
+{
+    "general.m_empty", "general.mtow", "general.m_maxLand", "fuselage.press_vol",
+    "wing.fuel", "engine.mass", "rotors.mcp",
+    nullptr
+};
+
+static const char *lengthFields[] =
+{
+    "fuselage.l", "fuselage.h", "fuselage.w", "fuselage.l_n",
+    "wing.span", "wing.c_tip", "wing.c_root",
+    "hor_tail.span", "hor_tail.c_tip", "hor_tail.c_root", "hor_tail.w_f", "hor_tail.arm",
+    "ver_tail.height", "ver_tail.c_tip", "ver_tail.c_root", "ver_tail.arm",
+    "landing_gear.main_l", "landing_gear.nose_l",
+    "rotors.main_r", "rotors.main_cb", "rotors.tail_r",
+    nullptr
+};
+
+static const double detailsMassFraction = 0.5;  ///< all-else mass fraction taken by details
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief SplitMix64 random numbers generator, portable unlike standard
+ * library distributions.
+ */
+class SplitMix64
+{
+public:
+
+    SplitMix64( uint64_t seed ) : _state ( seed ) {}
+
+    inline uint64_t next()
+    {
+        uint64_t z = ( _state += 0x9e3779b97f4a7c15ULL );
+        z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+        z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+        return z ^ ( z >> 31 );
+    }
+
+    /** @brief Returns uniformly distributed number from [0,1). */
+    inline double getUniform()
+    {
+        return static_cast< double >( next() >> 11 ) * ( 1.0 / 9007199254740992.0 );
+    }
+
+    /** @brief Returns normally distributed number (Box-Muller). */
+    inline double getNormal()
+    {
+        double u = 1.0 - getUniform();
+        double v = getUniform();
+        return sqrt( -2.0 * log( u ) ) * cos( 2.0 * M_PI * v );
+    }
+
+    /** @brief Returns log-normally distributed factor of median 1. */
+    inline double getFactor( double sigma )
+    {
+        return exp( sigma * getNormal() );
+    }
+
+private:
+
+    uint64_t _state;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool contains( const char *names[], const char *name )
+{
+    for ( int i = 0; names[ i ] != nullptr; ++i )
+    {
+        if ( strcmp( names[ i ], name ) == 0 ) return true;
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetGenerator::FleetGenerator( uint64_t seed ) :
+    _seed ( seed ),
+    _componentsCount ( 0 )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+AircraftData::Type FleetGenerator::getType( int index )
+{
+    return static_cast< AircraftData::Type >( index % ( AircraftData::Helicopter + 1 ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetGenerator::generate( int index, Aircraft *aircraft ) const
+{
+    generate( index, getType( index ), aircraft );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetGenerator::generate( int index, AircraftData::Type type, Aircraft *aircraft ) const
+{
+    SplitMix64 random( _seed * 0x2545f4914f6cdd1dULL + static_cast< uint64_t >( index ) );
+
+    // baseline of the type
+    int candidates[ baselinesCount ];
+    int candidatesCount = 0;
+
+    for ( int i = 0; i < baselinesCount; ++i )
+    {
+        if ( baselines[ i ].type == type ) candidates[ candidatesCount++ ] = i;
+    }
+
+    const Baseline &baseline = baselines[ candidates[ random.next() % candidatesCount ] ];
+
+    const double k_l = random.getFactor( baseline.sigma );
+    const double k_m = k_l * k_l * k_l * random.getFactor( 0.05 );
+
+    // data
+    aircraft->reset();
+
+    AircraftData data = *aircraft->getData();
+    data.type = type;
+
+    for ( const BaselineField *f = baseline.fields; f->name != nullptr; ++f )
+    {
+        int i = AircraftDataFields::getIndex( f->name );
+        double value = f->value;
+
+        if ( AircraftDataFields::getField( i ).kind == AircraftDataFields::Double )
+        {
+            if ( contains( massFields, f->name ) )
+                value *= k_m;
+            else if ( contains( areaFields, f->name ) )
+                value *= k_l * k_l * random.getFactor( 0.03 );
+            else if ( contains( lengthFields, f->name ) )
+                value *= k_l * random.getFactor( 0.03 );
+            else
+                value *= random.getFactor( 0.05 );
+        }
+
+        AircraftDataFields::setValue( data, i, value );
+    }
+
+    aircraft->setData( data );
+
+    // components
+    const int baselineCount = [ &baseline ]()
+    {
+        int count = 0;
+        while ( baseline.components[ count ].type != nullptr ) count++;
+        return count;
+    }();
+
+    const int detailsCount = std::max( 0, _componentsCount - baselineCount );
+
+    Aircraft::Components components;
+    components.reserve( baselineCount + detailsCount );
+
+    ComponentData fuselage;
+    double detailsMass = 0.0;
+
+    for ( const BaselineComponent *c = baseline.components; c->type != nullptr; ++c )
+    {
+        ComponentData cd;
+
+        cd.type = c->type;
+        cd.name = c->name;
+        cd.r    = Vector3( c->x, c->y, c->z ) * k_l;
+        cd.m    = c->m * k_m * random.getFactor( 0.05 );
+        cd.l    = c->l * k_l;
+        cd.w    = c->w * k_l;
+        cd.h    = c->h * k_l;
+
+        if ( detailsCount > 0 && cd.type == "all_else" )
+        {
+            detailsMass = detailsMassFraction * cd.m;
+            cd.m -= detailsMass;
+        }
+
+        if ( cd.type == "fuselage" ) fuselage = cd;
+
+        components.push_back( ComponentFactory::create( cd, aircraft->getData() ) );
+    }
+
+    // details are spread over the fuselage volume
+    if ( detailsCount > 0 )
+    {
+        std::vector< double > weights( detailsCount );
+        double weightsSum = 0.0;
+
+        for ( int i = 0; i < detailsCount; ++i )
+        {
+            weights[ i ] = -log( 1.0 - random.getUniform() );
+            weightsSum += weights[ i ];
+        }
+
+        const double size = fuselage.l / cbrt( static_cast< double >( detailsCount ) );
+
+        char name[ 32 ];
+
+        for ( int i = 0; i < detailsCount; ++i )
+        {
+            ComponentData cd;
+
+            snprintf( name, sizeof( name ), "Detail %d", i + 1 );
+
+            cd.type = "all_else";
+            cd.name = name;
+            cd.r    = fuselage.r + Vector3( ( random.getUniform() - 0.5 ) * fuselage.l,
+                                            ( random.getUniform() - 0.5 ) * fuselage.w,
+                                            ( random.getUniform() - 0.5 ) * fuselage.h );
+            cd.m    = detailsMass * weights[ i ] / weightsSum;
+            cd.l    = size;
+            cd.w    = size;
+            cd.h    = size;
+
+            components.push_back( ComponentFactory::create( cd, aircraft->getData() ) );
+        }
+    }
+
+    aircraft->addComponents( components );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetGenerator::generateFiles( const char *dirName, int count ) const
+{
+    if ( !QDir().mkpath( dirName ) ) return false;
+
+    std::atomic< bool > result( true );
+
+    ThreadPool::getInstance()->run( count, [ this, dirName, &result ]( int index )
+    {
+        char fileName[ 32 ];
+        snprintf( fileName, sizeof( fileName ), "aircraft_%07d.xml", index + 1 );
+
+        std::string path = std::string( dirName ) + "/" + fileName;
+
+        DataFile dataFile;
+        generate( index, dataFile.getAircraft() );
+
+        if ( !dataFile.saveFile( path.c_str() ) ) result = false;
+    });
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,107 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef FLEET_FLEETGENERATOR_H_
+#define FLEET_FLEETGENERATOR_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+
+#include <Aircraft.h>
+#include <AircraftData.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The synthetic aircraft and fleet generator class.
+ *
+ * Generates valid aircraft for load, update and export scaling tests.
+ * Every aircraft is a randomly scaled variant of one of the baseline
+ * aircraft of its type (data files shipped with application): lengths scale
+ * with the factor, areas with its square and masses with its cube, other
+ * parameters are slightly perturbed. Baseline components are followed by
+ * detail components, which take a part of the all-else mass and are spread
+ * over the fuselage volume.
+ *
+ * Aircraft depends only on the seed and its index, so fleets can be
+ * generated in parallel and are reproducible on every platform.
+ */
+class FleetGenerator
+{
+public:
+
+    /**
+     * @brief Constructor.
+     * @param seed random seed
+     */
+    explicit FleetGenerator( uint64_t seed = 1 );
+
+    /**
+     * @brief Returns aircraft type of the fleet member, types are mixed
+     * in equal proportions.
+     * @param index aircraft index
+     * @return aircraft type
+     */
+    static AircraftData::Type getType( int index );
+
+    /**
+     * @brief Generates aircraft of type given by getType().
+     * @param index aircraft index
+     * @param aircraft output aircraft
+     */
+    void generate( int index, Aircraft *aircraft ) const;
+
+    /**
+     * @brief Generates aircraft.
+     * @param index aircraft index
+     * @param type aircraft type
+     * @param aircraft output aircraft
+     */
+    void generate( int index, AircraftData::Type type, Aircraft *aircraft ) const;
+
+    /**
+     * @brief Generates fleet of aircraft files named aircraft_0000001.xml etc.
+     * Files are written in parallel.
+     * @param dirName output directory name
+     * @param count number of aircraft
+     * @return true on success false on failure
+     */
+    bool generateFiles( const char *dirName, int count ) const;
+
+    /**
+     * @brief Sets number of components per aircraft, when smaller than
+     * number of baseline components only baseline components are generated.
+     * @param count number of components
+     */
+    inline void setComponentsCount( int count ) { _componentsCount = count; }
+
+private:
+
+    uint64_t _seed;             ///< random seed
+    int _componentsCount;       ///< number of components per aircraft
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // FLEET_FLEETGENERATOR_H_
@@ -0,0 +1,292 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <fleet/FleetPipeline.h>
+
+#include <algorithm>
+
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#include <defs.h>
+
+#include <estimation/EstimationKernel.h>
+
+#include <fleet/FleetDatabase.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetPipeline::FleetPipeline( int workers, size_t window ) :
+    _workers ( workers > 0 ? workers : std::max( 1, static_cast< int >( std::thread::hardware_concurrency() ) ) ),
+    _window  ( window > 0 ? window : 1 ),
+    _parser  ( []( const QByteArray &content, const QString &dirName, DataFile *dataFile )
+               {
+                   return dataFile->readData( content, dirName );
+               } ),
+    _slots        ( nullptr ),
+    _parseQueue   ( nullptr ),
+    _computeQueue ( nullptr ),
+    _parseActive   ( 0 ),
+    _computeActive ( 0 ),
+    _computeFinished ( false ),
+    _stopped ( false )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FleetPipeline::~FleetPipeline() {}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetPipeline::setParser( const Parser &parser )
+{
+    _parser = parser;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetPipeline::run( const std::vector< std::string > &paths, const Sink &sink )
+{
+    _slots        = new BoundedQueue< int  >( _window );
+    _parseQueue   = new BoundedQueue< Item >( _window );
+    _computeQueue = new BoundedQueue< Item >( _window );
+
+    _done.clear();
+
+    _parseActive     = _workers;
+    _computeActive   = _workers;
+    _computeFinished = false;
+    _stopped         = false;
+
+    std::vector< std::thread > threads;
+
+    threads.emplace_back( &FleetPipeline::read, this, std::cref( paths ) );
+
+    for ( int i = 0; i < _workers; ++i )
+    {
+        threads.emplace_back( &FleetPipeline::parse, this );
+        threads.emplace_back( &FleetPipeline::compute, this );
+    }
+
+    // writer runs on the calling thread
+    write( sink );
+
+    for ( std::thread &thread : threads ) thread.join();
+
+    DELPTR( _computeQueue );
+    DELPTR( _parseQueue );
+    DELPTR( _slots );
+
+    _done.clear();
+
+    return !_stopped;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetPipeline::read( const std::vector< std::string > &paths )
+{
+    size_t index = 0;
+
+    for ( const std::string &path : paths )
+    {
+        QString qpath = QString::fromLocal8Bit( path.c_str() );
+
+        if ( QFileInfo( qpath ).isDir() )
+        {
+            QDirIterator it( qpath, QStringList() << "*.xml", QDir::Files,
+                             QDirIterator::Subdirectories );
+
+            while ( it.hasNext() )
+            {
+                if ( !readFile( it.next().toLocal8Bit().data(), index++ ) ) return;
+            }
+        }
+        else
+        {
+            if ( !readFile( path, index++ ) ) return;
+        }
+    }
+
+    _parseQueue->close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FleetPipeline::readFile( const std::string &fileName, size_t index )
+{
+    // waits while the writer is window size behind
+    if ( !_slots->push( 0 ) ) return false;
+
+    Item item;
+
+    item.index    = index;
+    item.fileName = fileName;
+
+    QFile file( QString::fromLocal8Bit( fileName.c_str() ) );
+
+    if ( file.open( QFile::ReadOnly | QFile::Text ) )
+    {
+        item.content = file.readAll();
+        file.close();
+    }
+
+    return _parseQueue->push( std::move( item ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetPipeline::parse()
+{
+    Item item;
+
+    while ( _parseQueue->pop( &item ) )
+    {
+        item.dataFile.reset( new DataFile() );
+
+        QString dirName = QFileInfo( QString::fromLocal8Bit( item.fileName.c_str() ) ).absolutePath();
+
+        if ( item.content.isEmpty() || !_parser( item.content, dirName, item.dataFile.get() ) )
+        {
+            item.dataFile.reset();
+        }
+
+        item.content.clear();
+
+        if ( !_computeQueue->push( std::move( item ) ) ) break;
+    }
+
+    // last parse worker closes the next stage
+    if ( --_parseActive == 0 )
+    {
+        _computeQueue->close();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetPipeline::compute()
+{
+    Item item;
+
+    while ( _computeQueue->pop( &item ) )
+    {
+        if ( item.dataFile )
+        {
+            const Aircraft *aircraft = item.dataFile->getAircraft();
+
+            item.record = FleetDatabase::createRecord( item.fileName.c_str(), *aircraft );
+
+            // components of the same group share estimate, so all groups are
+            // estimated once per aircraft instead of once per component
+            EstimationKernel::Masses masses;
+            EstimationKernel::estimate( *aircraft->getData(), &masses );
+
+            item.record.estimatedMasses.reserve( aircraft->getComponents().size() );
+
+            for ( const Component *component : aircraft->getComponents() )
+            {
+                EstimationKernel::Group group = EstimationKernel::getGroup( component->getXmlTagName() );
+
+                item.record.estimatedMasses.push_back( group < EstimationKernel::GroupsCount
+                                                       ? masses[ group ]
+                                                       : component->getEstimatedMass() );
+            }
+        }
+
+        std::lock_guard< std::mutex > lock( _doneMutex );
+
+        _done[ item.index ] = std::move( item );
+        _doneCond.notify_all();
+    }
+
+    // last compute worker tells the writer that no more files will come
+    if ( --_computeActive == 0 )
+    {
+        std::lock_guard< std::mutex > lock( _doneMutex );
+
+        _computeFinished = true;
+        _doneCond.notify_all();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetPipeline::write( const Sink &sink )
+{
+    size_t next = 0;
+
+    while ( true )
+    {
+        Item item;
+
+        {
+            std::unique_lock< std::mutex > lock( _doneMutex );
+
+            _doneCond.wait( lock, [ this, next ]()
+            {
+                return _stopped || _computeFinished || _done.count( next ) > 0;
+            });
+
+            std::map< size_t, Item >::iterator it = _done.find( next );
+
+            // every read file passes all the stages, so once compute workers
+            // exited the next missing file means there are no more files
+            if ( _stopped || it == _done.end() ) return;
+
+            item = std::move( it->second );
+            _done.erase( it );
+        }
+
+        if ( !sink( &item ) )
+        {
+            stop();
+            return;
+        }
+
+        int slot = 0;
+        _slots->pop( &slot );
+
+        ++next;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FleetPipeline::stop()
+{
+    _stopped = true;
+
+    _slots->close();
+    _parseQueue->close();
+    _computeQueue->close();
+
+    std::lock_guard< std::mutex > lock( _doneMutex );
+    _doneCond.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,150 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef FLEET_FLEETPIPELINE_H_
+#define FLEET_FLEETPIPELINE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <QByteArray>
+
+#include <DataFile.h>
+
+#include <fleet/FleetRecord.h>
+
+#include <utils/BoundedQueue.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The aircraft files processing pipeline class.
+ *
+ * Files are processed by stages running concurrently and connected with
+ * bounded queues:
+ * - reader thread reads files content,
+ * - parse workers parse content into aircraft,
+ * - compute workers estimate components masses and create fleet records,
+ * - writer (calling) thread passes results to the sink in the input order.
+ *
+ * Number of files in flight is limited by the window size: reader waits
+ * while the writer is that many files behind, so memory usage does not
+ * depend on number of files and the reorder buffer stays bounded even if
+ * some files take much longer than others.
+ */
+class FleetPipeline
+{
+public:
+
+    /** @brief The processed file struct. */
+    struct Item
+    {
+        size_t index = 0;                       ///< file input order index
+        std::string fileName;                   ///< file path
+        QByteArray content;                     ///< file content, released once parsed
+        std::unique_ptr< DataFile > dataFile;   ///< parsed file, null if file cannot be read
+        FleetRecord record;                     ///< evaluated record, valid if file has been read
+    };
+
+    /**
+     * @brief Sink called on the writer thread in the input order, also for
+     * files which cannot be read. Returning false stops the pipeline.
+     */
+    typedef std::function< bool( Item* ) > Sink;
+
+    /**
+     * @brief Parser reading file content into the data file, called
+     * concurrently on the parse workers. Arguments are the file content, the
+     * file directory, which relative paths in the content are resolved
+     * against, and the output data file. Returns false if file cannot be read.
+     */
+    typedef std::function< bool( const QByteArray&, const QString&, DataFile* ) > Parser;
+
+    /**
+     * @brief Constructor.
+     * @param workers number of threads of each worker pool, 0 means one per hardware thread
+     * @param window maximum number of files in flight
+     */
+    explicit FleetPipeline( int workers = 0, size_t window = 256 );
+
+    /** @brief Destructor. */
+    virtual ~FleetPipeline();
+
+    /**
+     * @brief Sets parser of files content, mc-mass files are read by default.
+     * @param parser files parser
+     */
+    void setParser( const Parser &parser );
+
+    /**
+     * @brief Processes files and waits until all are done. Directories are
+     * searched for aircraft files recursively.
+     * @param paths aircraft files and directories paths
+     * @param sink results sink
+     * @return returns false if processing has been stopped by the sink
+     */
+    bool run( const std::vector< std::string > &paths, const Sink &sink );
+
+private:
+
+    const int    _workers;                  ///< number of threads of each worker pool
+    const size_t _window;                   ///< maximum number of files in flight
+
+    Parser _parser;                         ///< files parser
+
+    BoundedQueue< int >  *_slots;           ///< files in flight, reader waits while full
+    BoundedQueue< Item > *_parseQueue;      ///< files waiting for parsing
+    BoundedQueue< Item > *_computeQueue;    ///< files waiting for computing
+
+    std::map< size_t, Item > _done;         ///< reorder buffer, files waiting for writer
+    std::mutex _doneMutex;                  ///< reorder buffer mutex
+    std::condition_variable _doneCond;      ///< signaled when file is done or pipeline stops
+
+    std::atomic< int > _parseActive;        ///< number of running parse workers
+    std::atomic< int > _computeActive;      ///< number of running compute workers
+
+    bool _computeFinished;                  ///< specifies if all compute workers exited
+    std::atomic< bool > _stopped;           ///< specifies if pipeline has been stopped
+
+    void read( const std::vector< std::string > &paths );
+    bool readFile( const std::string &fileName, size_t index );
+
+    void parse();
+    void compute();
+    void write( const Sink &sink );
+
+    void stop();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // FLEET_FLEETPIPELINE_H_
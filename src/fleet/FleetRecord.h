@@ -0,0 +1,71 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef FLEET_FLEETRECORD_H_
+#define FLEET_FLEETRECORD_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <mcutil/math/Matrix3x3.h>
+#include <mcutil/math/Vector3.h>
+
+#include <AircraftData.h>
+
+#include <components/ComponentData.h>
+#include <components/PointMasses.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The fleet record struct.
+ *
+ * Single aircraft stored in the fleet database: aircraft data, components,
+ * point masses and computed mass characteristics.
+ */
+struct FleetRecord
+{
+    typedef std::vector< ComponentData > Components;
+
+    std::string fileName;       ///< aircraft file absolute path
+    int64_t modified = 0;       ///< [ms] aircraft file modification time (since epoch)
+
+    AircraftData data;          ///< aircraft data
+    Components components;      ///< mass components
+
+    PointMasses pointMasses;        ///< point masses
+    std::string pointMassesFile;    ///< point masses file name
+
+    std::vector< double > estimatedMasses;  ///< [kg] components estimated masses, empty if not evaluated
+
+    double    massTotal = 0.0;  ///< [kg] total mass
+    Vector3   centerOfMass;     ///< [m] center of mass position
+    Matrix3x3 inertiaMatrix;    ///< [kg*m^2] inertia
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // FLEET_FLEETRECORD_H_
@@ -0,0 +1,10 @@
+HEADERS += \
+    $$PWD/FleetDatabase.h \
+    $$PWD/FleetGenerator.h \
+    $$PWD/FleetPipeline.h \
+    $$PWD/FleetRecord.h
+
+SOURCES += \
+    $$PWD/FleetDatabase.cpp \
+    $$PWD/FleetGenerator.cpp \
+    $$PWD/FleetPipeline.cpp
@@ -23,11 +23,16 @@
 #include <cmath>
 
 #include <QCloseEvent>
+#include <QCoreApplication>
+#include <QDir>
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QStandardPaths>
 
 #include <gui/DialogEdit.h>
 
+#include <AircraftDataFields.h>
+
 #include <components/AllElse.h>
 #include <components/Engine.h>
 #include <components/Fuselage.h>
@@ -65,6 +70,9 @@ MainWindow::MainWindow( QWidget *parent ) :
     settingsRead();
 
     _saved = true;
+
+    recoverJournal();
+
     updateTitleBar();
 }
 
@@ -82,9 +90,28 @@ MainWindow::~MainWindow()
 
 ////////////////////////////////////////////////////////////////////////////////
 
+bool MainWindow::setSharedMemory( const char *name )
+{
+    bool result = _publisher.open( name );
+
+    _publisher.publish( *_dataFile.getAircraft() );
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void MainWindow::closeEvent( QCloseEvent *event )
 {
-    askIfSave();
+    bool resolved = askIfSave();
+
+    _journal.close();
+
+    // journal is kept for recovery unless changes were saved or discarded
+    if ( resolved )
+    {
+        EditJournal::remove( getJournalFile().toLocal8Bit().data() );
+    }
 
     /////////////////////////////////
     QMainWindow::closeEvent( event );
@@ -93,7 +120,7 @@ void MainWindow::closeEvent( QCloseEvent *event )
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void MainWindow::askIfSave()
+bool MainWindow::askIfSave()
 {
     if ( !_saved )
     {
@@ -106,9 +133,101 @@ void MainWindow::askIfSave()
 
         if ( result == QMessageBox::Save )
         {
+            // saving might fail or be cancelled in the file dialog
             saveFile();
+            return _saved;
         }
+
+        return result == QMessageBox::Discard;
     }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+QString MainWindow::getJournalFile() const
+{
+    QString dir = QStandardPaths::writableLocation( QStandardPaths::AppLocalDataLocation );
+
+    QDir().mkpath( dir );
+
+    // every running instance keeps its own journal
+    return QDir( dir ).filePath( QString( "autosave.%1.journal" ).arg( QCoreApplication::applicationPid() ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MainWindow::recoverJournal()
+{
+    QDir dir( QStandardPaths::writableLocation( QStandardPaths::AppLocalDataLocation ) );
+
+    // only journals of instances which are no longer running are offered,
+    // snapshot might be left in its temporary file only
+    QStringList journals;
+    QStringList snapshots = dir.entryList( QStringList() << "autosave.*.journal.snapshot*", QDir::Files );
+
+    for ( const QString &snapshot : snapshots )
+    {
+        QString fileName = dir.filePath( snapshot.left( snapshot.lastIndexOf( ".snapshot" ) ) );
+
+        if ( !journals.contains( fileName ) && EditJournal::isOrphaned( fileName.toLocal8Bit().data() ) )
+        {
+            journals.push_back( fileName );
+        }
+    }
+
+    QString recoveredJournal;
+
+    for ( const QString &fileName : journals )
+    {
+        QString title = windowTitle();
+        QString text = tr( "Application has not been closed properly. Recover unsaved changes?" );
+
+        QMessageBox::StandardButton result = QMessageBox::question( this, title, text,
+                                                                    QMessageBox::Yes | QMessageBox::No,
+                                                                    QMessageBox::Yes );
+
+        if ( result == QMessageBox::Yes )
+        {
+            std::string aircraftFile;
+
+            if ( EditJournal::recover( fileName.toLocal8Bit().data(),
+                                       _dataFile.getAircraft(), &aircraftFile ) )
+            {
+                _currentFile = QString::fromStdString( aircraftFile );
+
+                updateGUI();
+                _saved = false;
+
+                recoveredJournal = fileName;
+                break;
+            }
+            else
+            {
+                QMessageBox::warning( this, tr( APP_TITLE ),
+                                     tr( "Cannot recover unsaved changes." ) );
+            }
+        }
+
+        EditJournal::remove( fileName.toLocal8Bit().data() );
+    }
+
+    restartJournal();
+
+    // recovered journal is removed once recovered state is in the new one
+    if ( !recoveredJournal.isEmpty() && _journal.wait() )
+    {
+        EditJournal::remove( recoveredJournal.toLocal8Bit().data() );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MainWindow::restartJournal()
+{
+    _journal.open( getJournalFile().toLocal8Bit().data(), *_dataFile.getAircraft(),
+                   _currentFile.toLocal8Bit().data() );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -123,6 +242,8 @@ void MainWindow::newFile()
 
     updateGUI();
     updateTitleBar();
+
+    restartJournal();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +345,8 @@ void MainWindow::readFile( QString fileName )
     updateGUI();
     _saved = true;
     updateTitleBar();
+
+    restartJournal();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -233,6 +356,8 @@ void MainWindow::saveFile( QString fileName )
     if ( _dataFile.saveFile( fileName.toStdString().c_str() ) )
     {
         _saved = true;
+
+        restartJournal();
     }
     else
     {
@@ -361,6 +486,7 @@ void MainWindow::addComponent()
     if ( component )
     {
         _dataFile.getAircraft()->addComponent( component );
+        _journal.componentAdded( *_dataFile.getAircraft() );
         _saved = false;
     }
 
@@ -380,7 +506,9 @@ void MainWindow::editComponent()
     {
         DialogEdit::edit( this, component );
 
-        _dataFile.getAircraft()->update();
+        _dataFile.getAircraft()->refresh();
+
+        _journal.componentChanged( *_dataFile.getAircraft(), index );
 
         _saved = false;
 
@@ -1024,6 +1152,8 @@ void MainWindow::updateGUI()
     _ui->spinBox_I_YZ->setValue( inertiaMatrix.yz() );
 
     _ui->textResults->setText( ac->toString().c_str() );
+
+    _publisher.publish( *ac );
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1176,6 +1306,16 @@ void MainWindow::updateRotorTipVel()
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void MainWindow::touchData( const void *member )
+{
+    AircraftDataFields::touch( _dataFile.getAircraftData(), member );
+
+    _journal.dataChanged( *_dataFile.getAircraft(),
+                          AircraftDataFields::getIndex( *_dataFile.getAircraftData(), member ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void MainWindow::updateRecentFiles( QString file )
 {
     for ( unsigned int i = 0; i < _recentFilesActions.size(); i++ )
@@ -1331,6 +1471,7 @@ void MainWindow::on_pushButtonDel_clicked()
     if ( currentRow >=0 && currentRow < (int)components.size() )
     {
         _dataFile.getAircraft()->delComponent( currentRow );
+        _journal.componentRemoved( *_dataFile.getAircraft(), currentRow );
         _saved = false;
     }
 
@@ -1362,6 +1503,7 @@ void MainWindow::on_comboBoxAircraftType_currentIndexChanged( int index )
     setAircraftType( type );
 
     _dataFile.getAircraftData()->type = type;
+    touchData( &_dataFile.getAircraftData()->type );
 
     _saved = false;
     updateTitleBar();
@@ -1372,6 +1514,7 @@ void MainWindow::on_comboBoxAircraftType_currentIndexChanged( int index )
 void MainWindow::on_spinBoxMassEmpty_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->general.m_empty = arg1;
+    touchData( &_dataFile.getAircraftData()->general.m_empty );
     _saved = false;
     updateTitleBar();
 }
@@ -1381,6 +1524,7 @@ void MainWindow::on_spinBoxMassEmpty_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMTOW_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->general.mtow =  arg1;
+    touchData( &_dataFile.getAircraftData()->general.mtow );
     _saved = false;
     updateTitleBar();
 }
@@ -1390,6 +1534,7 @@ void MainWindow::on_spinBoxMTOW_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMassMaxLand_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->general.m_maxLand = arg1;
+    touchData( &_dataFile.getAircraftData()->general.m_maxLand );
     _saved = false;
     updateTitleBar();
 }
@@ -1399,6 +1544,7 @@ void MainWindow::on_spinBoxMassMaxLand_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMaxNz_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->general.nz_max = arg1;
+    touchData( &_dataFile.getAircraftData()->general.nz_max );
     _saved = false;
     updateTitleBar();
 }
@@ -1408,6 +1554,7 @@ void MainWindow::on_spinBoxMaxNz_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMaxNzLand_valueChanged(double arg1)
 {
     _dataFile.getAircraftData()->general.nz_maxLand = arg1;
+    touchData( &_dataFile.getAircraftData()->general.nz_maxLand );
     _saved = false;
     updateTitleBar();
 }
@@ -1417,6 +1564,7 @@ void MainWindow::on_spinBoxMaxNzLand_valueChanged(double arg1)
 void MainWindow::on_spinBoxStallV_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->general.v_stall = arg1;
+    touchData( &_dataFile.getAircraftData()->general.v_stall );
     _saved = false;
     updateTitleBar();
 }
@@ -1426,6 +1574,7 @@ void MainWindow::on_spinBoxStallV_valueChanged( double arg1 )
 void MainWindow::on_spinBoxCruiseV_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->general.v_cruise = arg1;
+    touchData( &_dataFile.getAircraftData()->general.v_cruise );
     _saved = false;
     updateTitleBar();
 }
@@ -1435,6 +1584,7 @@ void MainWindow::on_spinBoxCruiseV_valueChanged( double arg1 )
 void MainWindow::on_spinBoxCruiseH_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->general.h_cruise = arg1;
+    touchData( &_dataFile.getAircraftData()->general.h_cruise );
     _saved = false;
     updateTitleBar();
 }
@@ -1444,6 +1594,7 @@ void MainWindow::on_spinBoxCruiseH_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMachMax_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->general.mach_max = arg1;
+    touchData( &_dataFile.getAircraftData()->general.mach_max );
     _saved = false;
     updateTitleBar();
 }
@@ -1453,6 +1604,7 @@ void MainWindow::on_spinBoxMachMax_valueChanged( double arg1 )
 void MainWindow::on_checkBoxNavyAircraft_toggled( bool checked )
 {
     _dataFile.getAircraftData()->general.navy_ac = checked;
+    touchData( &_dataFile.getAircraftData()->general.navy_ac );
     _saved = false;
     updateTitleBar();
 }
@@ -1473,6 +1625,7 @@ void MainWindow::on_comboBoxCargoDoor_currentIndexChanged( int index )
     }
 
     _dataFile.getAircraftData()->fuselage.cargo_door = door;
+    touchData( &_dataFile.getAircraftData()->fuselage.cargo_door );
 
     _saved = false;
     updateTitleBar();
@@ -1483,6 +1636,7 @@ void MainWindow::on_comboBoxCargoDoor_currentIndexChanged( int index )
 void MainWindow::on_spinBoxFuseLength_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->fuselage.l = arg1;
+    touchData( &_dataFile.getAircraftData()->fuselage.l );
     _saved = false;
     updateTitleBar();
     updateWettedArea();
@@ -1493,6 +1647,7 @@ void MainWindow::on_spinBoxFuseLength_valueChanged( double arg1 )
 void MainWindow::on_spinBoxFuseHeight_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->fuselage.h = arg1;
+    touchData( &_dataFile.getAircraftData()->fuselage.h );
     _saved = false;
     updateTitleBar();
     updateWettedArea();
@@ -1503,6 +1658,7 @@ void MainWindow::on_spinBoxFuseHeight_valueChanged( double arg1 )
 void MainWindow::on_spinBoxFuseWidth_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->fuselage.w = arg1;
+    touchData( &_dataFile.getAircraftData()->fuselage.w );
     _saved = false;
     updateTitleBar();
     updateWettedArea();
@@ -1513,6 +1669,7 @@ void MainWindow::on_spinBoxFuseWidth_valueChanged( double arg1 )
 void MainWindow::on_spinBoxNoseLength_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->fuselage.l_n = arg1;
+    touchData( &_dataFile.getAircraftData()->fuselage.l_n );
     _saved = false;
     updateTitleBar();
     updateWettedArea();
@@ -1523,6 +1680,7 @@ void MainWindow::on_spinBoxNoseLength_valueChanged( double arg1 )
 void MainWindow::on_spinBoxPressVol_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->fuselage.press_vol = arg1;
+    touchData( &_dataFile.getAircraftData()->fuselage.press_vol );
     _saved = false;
     updateTitleBar();
 }
@@ -1542,6 +1700,7 @@ void MainWindow::on_spinBoxWettedAreaEstimated_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWettedAreaReal_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->fuselage.wetted_area = arg1;
+    touchData( &_dataFile.getAircraftData()->fuselage.wetted_area );
     _saved = false;
     updateTitleBar();
 }
@@ -1551,6 +1710,7 @@ void MainWindow::on_spinBoxWettedAreaReal_valueChanged( double arg1 )
 void MainWindow::on_checkBoxFuselageLG_toggled( bool checked )
 {
     _dataFile.getAircraftData()->fuselage.landing_gear = checked;
+    touchData( &_dataFile.getAircraftData()->fuselage.landing_gear );
     _saved = false;
     updateTitleBar();
 }
@@ -1560,6 +1720,7 @@ void MainWindow::on_checkBoxFuselageLG_toggled( bool checked )
 void MainWindow::on_checkBoxCargoRamp_toggled( bool checked )
 {
     _dataFile.getAircraftData()->fuselage.cargo_ramp = checked;
+    touchData( &_dataFile.getAircraftData()->fuselage.cargo_ramp );
     _saved = false;
     updateTitleBar();
 }
@@ -1569,6 +1730,7 @@ void MainWindow::on_checkBoxCargoRamp_toggled( bool checked )
 void MainWindow::on_checkBoxWettedAreaOverride_toggled( bool checked )
 {
     _dataFile.getAircraftData()->fuselage.wetted_area_override = checked;
+    touchData( &_dataFile.getAircraftData()->fuselage.wetted_area_override );
     _saved = false;
     updateTitleBar();
 
@@ -1586,6 +1748,7 @@ void MainWindow::on_checkBoxWettedAreaOverride_toggled( bool checked )
 void MainWindow::on_spinBoxWingArea_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.area = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.area );
     _saved = false;
     updateTitleBar();
     updateWingAR();
@@ -1596,6 +1759,7 @@ void MainWindow::on_spinBoxWingArea_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingAreaExp_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.area_exp = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.area_exp );
     _saved = false;
     updateTitleBar();
 }
@@ -1605,6 +1769,7 @@ void MainWindow::on_spinBoxWingAreaExp_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingSpan_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.span = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.span );
     _saved = false;
     updateTitleBar();
     updateWingAR();
@@ -1615,6 +1780,7 @@ void MainWindow::on_spinBoxWingSpan_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingSweep_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.sweep = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.sweep );
     _saved = false;
     updateTitleBar();
 }
@@ -1624,6 +1790,7 @@ void MainWindow::on_spinBoxWingSweep_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingCRoot_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.c_root = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.c_root );
     _saved = false;
     updateTitleBar();
     updateWingTR();
@@ -1634,6 +1801,7 @@ void MainWindow::on_spinBoxWingCRoot_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingCTip_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.c_tip = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.c_tip );
     _saved = false;
     updateTitleBar();
     updateWingTR();
@@ -1644,6 +1812,7 @@ void MainWindow::on_spinBoxWingCTip_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingTC_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.t_c = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.t_c );
     _saved = false;
     updateTitleBar();
 }
@@ -1653,6 +1822,7 @@ void MainWindow::on_spinBoxWingTC_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingFuel_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.fuel = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.fuel );
     _saved = false;
     updateTitleBar();
 }
@@ -1662,6 +1832,7 @@ void MainWindow::on_spinBoxWingFuel_valueChanged( double arg1 )
 void MainWindow::on_spinBoxCtrlArea_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.ctrl_area = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.ctrl_area );
     _saved = false;
     updateTitleBar();
 }
@@ -1671,6 +1842,7 @@ void MainWindow::on_spinBoxCtrlArea_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingAR_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.ar = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.ar );
     _saved = false;
     updateTitleBar();
 }
@@ -1680,6 +1852,7 @@ void MainWindow::on_spinBoxWingAR_valueChanged( double arg1 )
 void MainWindow::on_spinBoxWingTR_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->wing.tr = arg1;
+    touchData( &_dataFile.getAircraftData()->wing.tr );
     _saved = false;
     updateTitleBar();
 }
@@ -1689,6 +1862,7 @@ void MainWindow::on_spinBoxWingTR_valueChanged( double arg1 )
 void MainWindow::on_checkBoxWingDelta_toggled( bool checked )
 {
     _dataFile.getAircraftData()->wing.delta = checked;
+    touchData( &_dataFile.getAircraftData()->wing.delta );
     _saved = false;
     updateTitleBar();
 }
@@ -1698,6 +1872,7 @@ void MainWindow::on_checkBoxWingDelta_toggled( bool checked )
 void MainWindow::on_checkBoxWingVarSweep_toggled( bool checked )
 {
     _dataFile.getAircraftData()->wing.var_sweep = checked;
+    touchData( &_dataFile.getAircraftData()->wing.var_sweep );
     _saved = false;
     updateTitleBar();
 }
@@ -1707,6 +1882,7 @@ void MainWindow::on_checkBoxWingVarSweep_toggled( bool checked )
 void MainWindow::on_spinBoxHorTailArea_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.area = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.area );
     _saved = false;
     updateTitleBar();
     updateHorTailAR();
@@ -1717,6 +1893,7 @@ void MainWindow::on_spinBoxHorTailArea_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailSpan_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.span = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.span );
     _saved = false;
     updateTitleBar();
     updateHorTailAR();
@@ -1727,6 +1904,7 @@ void MainWindow::on_spinBoxHorTailSpan_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailSweep_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.sweep = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.sweep );
     _saved = false;
     updateTitleBar();
 }
@@ -1736,6 +1914,7 @@ void MainWindow::on_spinBoxHorTailSweep_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailCRoot_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.c_root = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.c_root );
     _saved = false;
     updateTitleBar();
     updateHorTailTR();
@@ -1746,6 +1925,7 @@ void MainWindow::on_spinBoxHorTailCRoot_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailCTip_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.c_tip = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.c_tip );
     _saved = false;
     updateTitleBar();
     updateHorTailTR();
@@ -1756,6 +1936,7 @@ void MainWindow::on_spinBoxHorTailCTip_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailTC_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.t_c = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.t_c );
     _saved = false;
     updateTitleBar();
 }
@@ -1765,6 +1946,7 @@ void MainWindow::on_spinBoxHorTailTC_valueChanged( double arg1 )
 void MainWindow::on_spinBoxElevArea_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.elev_area = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.elev_area );
     _saved = false;
     updateTitleBar();
 }
@@ -1774,6 +1956,7 @@ void MainWindow::on_spinBoxElevArea_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailWF_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.w_f = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.w_f );
     _saved = false;
     updateTitleBar();
 }
@@ -1783,6 +1966,7 @@ void MainWindow::on_spinBoxHorTailWF_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailArm_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.arm = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.arm );
     _saved = false;
     updateTitleBar();
 }
@@ -1792,6 +1976,7 @@ void MainWindow::on_spinBoxHorTailArm_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailAR_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.ar = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.ar );
     _saved = false;
     updateTitleBar();
 }
@@ -1801,6 +1986,7 @@ void MainWindow::on_spinBoxHorTailAR_valueChanged( double arg1 )
 void MainWindow::on_spinBoxHorTailTR_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->hor_tail.tr = arg1;
+    touchData( &_dataFile.getAircraftData()->hor_tail.tr );
     _saved = false;
     updateTitleBar();
 }
@@ -1810,6 +1996,7 @@ void MainWindow::on_spinBoxHorTailTR_valueChanged( double arg1 )
 void MainWindow::on_checkBoxHorTailMoving_toggled( bool checked )
 {
     _dataFile.getAircraftData()->hor_tail.moving = checked;
+    touchData( &_dataFile.getAircraftData()->hor_tail.moving );
     _saved = false;
     updateTitleBar();
 }
@@ -1819,6 +2006,7 @@ void MainWindow::on_checkBoxHorTailMoving_toggled( bool checked )
 void MainWindow::on_checkBoxHorTailRolling_toggled( bool checked )
 {
     _dataFile.getAircraftData()->hor_tail.rolling = checked;
+    touchData( &_dataFile.getAircraftData()->hor_tail.rolling );
     _saved = false;
     updateTitleBar();
 }
@@ -1828,6 +2016,7 @@ void MainWindow::on_checkBoxHorTailRolling_toggled( bool checked )
 void MainWindow::on_spinBoxVerTailArea_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.area = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.area );
     _saved = false;
     updateTitleBar();
     updateVerTailAR();
@@ -1838,6 +2027,7 @@ void MainWindow::on_spinBoxVerTailArea_valueChanged( double arg1 )
 void MainWindow::on_spinBoxVerTailHeight_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.height = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.height );
     _saved = false;
     updateTitleBar();
     updateVerTailAR();
@@ -1848,6 +2038,7 @@ void MainWindow::on_spinBoxVerTailHeight_valueChanged( double arg1 )
 void MainWindow::on_spinBoxVerTailSweep_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.sweep = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.sweep );
     _saved = false;
     updateTitleBar();
 }
@@ -1857,6 +2048,7 @@ void MainWindow::on_spinBoxVerTailSweep_valueChanged( double arg1 )
 void MainWindow::on_spinBoxVerTailCRoot_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.c_root = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.c_root );
     _saved = false;
     updateTitleBar();
     updateVerTailTR();
@@ -1867,6 +2059,7 @@ void MainWindow::on_spinBoxVerTailCRoot_valueChanged( double arg1 )
 void MainWindow::on_spinBoxVerTailCTip_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.c_tip = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.c_tip );
     _saved = false;
     updateTitleBar();
     updateVerTailTR();
@@ -1877,6 +2070,7 @@ void MainWindow::on_spinBoxVerTailCTip_valueChanged( double arg1 )
 void MainWindow::on_spinBoxVerTailTC_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.t_c = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.t_c );
     _saved = false;
     updateTitleBar();
 }
@@ -1886,6 +2080,7 @@ void MainWindow::on_spinBoxVerTailTC_valueChanged( double arg1 )
 void MainWindow::on_spinBoxVerTailArm_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.arm = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.arm );
     _saved = false;
     updateTitleBar();
 }
@@ -1895,6 +2090,7 @@ void MainWindow::on_spinBoxVerTailArm_valueChanged( double arg1 )
 void MainWindow::on_spinBoxRuddArea_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.rudd_area = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.rudd_area );
     _saved = false;
     updateTitleBar();
 }
@@ -1902,6 +2098,7 @@ void MainWindow::on_spinBoxRuddArea_valueChanged( double arg1 )
 void MainWindow::on_spinBoxVerTailAR_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.ar = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.ar );
     _saved = false;
     updateTitleBar();
 }
@@ -1911,6 +2108,7 @@ void MainWindow::on_spinBoxVerTailAR_valueChanged( double arg1 )
 void MainWindow::on_spinBoxVerTailTR_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->ver_tail.tr = arg1;
+    touchData( &_dataFile.getAircraftData()->ver_tail.tr );
     _saved = false;
     updateTitleBar();
 }
@@ -1920,6 +2118,7 @@ void MainWindow::on_spinBoxVerTailTR_valueChanged( double arg1 )
 void MainWindow::on_checkBoxTailT_toggled( bool checked )
 {
     _dataFile.getAircraftData()->ver_tail.t_tail = checked;
+    touchData( &_dataFile.getAircraftData()->ver_tail.t_tail );
     _saved = false;
     updateTitleBar();
 }
@@ -1929,6 +2128,7 @@ void MainWindow::on_checkBoxTailT_toggled( bool checked )
 void MainWindow::on_checkBoxVerTailRotor_toggled( bool checked )
 {
     _dataFile.getAircraftData()->ver_tail.rotor = checked;
+    touchData( &_dataFile.getAircraftData()->ver_tail.rotor );
     _saved = false;
     updateTitleBar();
 }
@@ -1939,6 +2139,7 @@ void MainWindow::on_checkBoxVerTailRotor_toggled( bool checked )
 void MainWindow::on_spinBoxMainGearLength_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->landing_gear.main_l = arg1;
+    touchData( &_dataFile.getAircraftData()->landing_gear.main_l );
     _saved = false;
     updateTitleBar();
 }
@@ -1948,6 +2149,7 @@ void MainWindow::on_spinBoxMainGearLength_valueChanged( double arg1 )
 void MainWindow::on_spinBoxNoseGearLength_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->landing_gear.nose_l = arg1;
+    touchData( &_dataFile.getAircraftData()->landing_gear.nose_l );
     _saved = false;
     updateTitleBar();
 }
@@ -1957,6 +2159,7 @@ void MainWindow::on_spinBoxNoseGearLength_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMainGearWheels_valueChanged( int arg1 )
 {
     _dataFile.getAircraftData()->landing_gear.main_wheels = arg1;
+    touchData( &_dataFile.getAircraftData()->landing_gear.main_wheels );
     _saved = false;
     updateTitleBar();
 }
@@ -1966,6 +2169,7 @@ void MainWindow::on_spinBoxMainGearWheels_valueChanged( int arg1 )
 void MainWindow::on_spinBoxMainGearStruts_valueChanged( int arg1 )
 {
     _dataFile.getAircraftData()->landing_gear.main_struts = arg1;
+    touchData( &_dataFile.getAircraftData()->landing_gear.main_struts );
     _saved = false;
     updateTitleBar();
 }
@@ -1975,6 +2179,7 @@ void MainWindow::on_spinBoxMainGearStruts_valueChanged( int arg1 )
 void MainWindow::on_spinBoxNoseGearWheels_valueChanged( int arg1 )
 {
     _dataFile.getAircraftData()->landing_gear.nose_wheels = arg1;
+    touchData( &_dataFile.getAircraftData()->landing_gear.nose_wheels );
     _saved = false;
     updateTitleBar();
 }
@@ -1984,6 +2189,7 @@ void MainWindow::on_spinBoxNoseGearWheels_valueChanged( int arg1 )
 void MainWindow::on_checkBoxGearFixed_toggled( bool checked )
 {
     _dataFile.getAircraftData()->landing_gear.fixed = checked;
+    touchData( &_dataFile.getAircraftData()->landing_gear.fixed );
     _saved = false;
     updateTitleBar();
 }
@@ -1993,6 +2199,7 @@ void MainWindow::on_checkBoxGearFixed_toggled( bool checked )
 void MainWindow::on_checkBoxGearCross_toggled( bool checked )
 {
     _dataFile.getAircraftData()->landing_gear.cross = checked;
+    touchData( &_dataFile.getAircraftData()->landing_gear.cross );
     _saved = false;
     updateTitleBar();
 }
@@ -2002,6 +2209,7 @@ void MainWindow::on_checkBoxGearCross_toggled( bool checked )
 void MainWindow::on_checkBoxGearTripod_toggled( bool checked )
 {
     _dataFile.getAircraftData()->landing_gear.tripod = checked;
+    touchData( &_dataFile.getAircraftData()->landing_gear.tripod );
     _saved = false;
     updateTitleBar();
 }
@@ -2011,6 +2219,7 @@ void MainWindow::on_checkBoxGearTripod_toggled( bool checked )
 void MainWindow::on_checkBoxGearMainKneel_toggled( bool checked )
 {
     _dataFile.getAircraftData()->landing_gear.main_kneel = checked;
+    touchData( &_dataFile.getAircraftData()->landing_gear.main_kneel );
     _saved = false;
     updateTitleBar();
 }
@@ -2020,6 +2229,7 @@ void MainWindow::on_checkBoxGearMainKneel_toggled( bool checked )
 void MainWindow::on_checkBoxGearNoseKneel_toggled( bool checked )
 {
     _dataFile.getAircraftData()->landing_gear.nose_kneel = checked;
+    touchData( &_dataFile.getAircraftData()->landing_gear.nose_kneel );
     _saved = false;
     updateTitleBar();
 }
@@ -2029,6 +2239,7 @@ void MainWindow::on_checkBoxGearNoseKneel_toggled( bool checked )
 void MainWindow::on_spinBoxEngineMass_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->engine.mass = arg1;
+    touchData( &_dataFile.getAircraftData()->engine.mass );
     _saved = false;
     updateTitleBar();
 }
@@ -2038,6 +2249,7 @@ void MainWindow::on_spinBoxEngineMass_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMainRotorDiameter_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->rotors.main_r = 0.5 * arg1;
+    touchData( &_dataFile.getAircraftData()->rotors.main_r );
     _saved = false;
     updateTitleBar();
     updateRotorTipVel();
@@ -2048,6 +2260,7 @@ void MainWindow::on_spinBoxMainRotorDiameter_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMainRotorChord_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->rotors.main_cb = arg1;
+    touchData( &_dataFile.getAircraftData()->rotors.main_cb );
     _saved = false;
     updateTitleBar();
 }
@@ -2057,6 +2270,7 @@ void MainWindow::on_spinBoxMainRotorChord_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMainRotorRPM_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->rotors.main_rpm = arg1;
+    touchData( &_dataFile.getAircraftData()->rotors.main_rpm );
     _saved = false;
     updateTitleBar();
     updateRotorTipVel();
@@ -2067,6 +2281,7 @@ void MainWindow::on_spinBoxMainRotorRPM_valueChanged( double arg1 )
 void MainWindow::on_spinBoxTailRotorDiameter_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->rotors.tail_r = 0.5 * arg1;
+    touchData( &_dataFile.getAircraftData()->rotors.tail_r );
     _saved = false;
     updateTitleBar();
 }
@@ -2076,6 +2291,7 @@ void MainWindow::on_spinBoxTailRotorDiameter_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMainRotorGear_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->rotors.main_gear_ratio = arg1;
+    touchData( &_dataFile.getAircraftData()->rotors.main_gear_ratio );
     _saved = false;
     updateTitleBar();
 }
@@ -2085,6 +2301,7 @@ void MainWindow::on_spinBoxMainRotorGear_valueChanged( double arg1 )
 void MainWindow::on_spinBoxPowerLimit_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->rotors.mcp = arg1;
+    touchData( &_dataFile.getAircraftData()->rotors.mcp );
     _saved = false;
     updateTitleBar();
 }
@@ -2094,6 +2311,7 @@ void MainWindow::on_spinBoxPowerLimit_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMainRotorTipVel_valueChanged( double arg1 )
 {
     _dataFile.getAircraftData()->rotors.main_tip_vel = arg1;
+    touchData( &_dataFile.getAircraftData()->rotors.main_tip_vel );
     _saved = false;
     updateTitleBar();
 }
@@ -2103,6 +2321,7 @@ void MainWindow::on_spinBoxMainRotorTipVel_valueChanged( double arg1 )
 void MainWindow::on_spinBoxMainRotorBlades_valueChanged( int arg1 )
 {
     _dataFile.getAircraftData()->rotors.main_blades = arg1;
+    touchData( &_dataFile.getAircraftData()->rotors.main_blades );
     _saved = false;
     updateTitleBar();
 }
@@ -31,6 +31,10 @@
 
 #include <gui/RecentFileAction.h>
 
+#include <journal/EditJournal.h>
+
+#include <service/SharedMemoryPublisher.h>
+
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace Ui
@@ -60,6 +64,13 @@ public:
     /** @brief Destructor. */
     virtual ~MainWindow();
 
+    /**
+     * @brief Starts publishing results to the shared memory segment.
+     * @param name segment name
+     * @return returns true on success and false on failure
+     */
+    bool setSharedMemory( const char *name );
+
 protected:
 
     /** */
@@ -74,6 +85,10 @@ private:
 
     DataFile _dataFile;                         ///< data file
 
+    SharedMemoryPublisher _publisher;           ///< shared memory results publisher
+
+    EditJournal _journal;                       ///< autosave edits journal
+
     bool _saved;                                ///<
 
     QString _currentFile;                       ///<
@@ -81,7 +96,21 @@ private:
     QStringList _recentFilesList;               ///<
     RecentFilesActions _recentFilesActions;     ///<
 
-    void askIfSave();
+    /**
+     * @brief Asks if unsaved changes should be saved.
+     * @return returns true if there are no unsaved changes left, i.e. they
+     * were saved or discarded, and false if saving failed or was cancelled
+     */
+    bool askIfSave();
+
+    /** Returns autosave journal file name. */
+    QString getJournalFile() const;
+
+    /** Offers recovery of unsaved changes left by the previous session. */
+    void recoverJournal();
+
+    /** Starts new autosave journal of the current state. */
+    void restartJournal();
 
     void newFile();
     void openFile();
@@ -116,6 +145,12 @@ private:
     void updateVerTailTR();
     void updateRotorTipVel();
 
+    /**
+     * @brief Marks aircraft data field as changed.
+     * @param member pointer to the field of the aircraft data
+     */
+    void touchData( const void *member );
+
     void updateRecentFiles( QString file = "" );
 
 private slots:
@@ -0,0 +1,163 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <history/TimeHistory.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+TimeHistory::TimeHistory( const Aircraft &aircraft ) :
+    _m_empty ( aircraft.getMassTotal() ),
+    _s_empty ( aircraft.getMassTotal() * aircraft.getCenterOfMass() ),
+    _i_empty ( aircraft.getInertiaMatrix().xx(),
+               aircraft.getInertiaMatrix().yy(),
+               aircraft.getInertiaMatrix().zz(),
+               aircraft.getInertiaMatrix().xy(),
+               aircraft.getInertiaMatrix().xz(),
+               aircraft.getInertiaMatrix().yz() ),
+
+    _m ( 0.0 ),
+
+    _changes ( 0 )
+{
+    recompute();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int TimeHistory::addItem( const char *name, const Vector3 &r, double mass,
+                          double l, double w, double h )
+{
+    Item item;
+
+    item.name   = name;
+    item.r      = r;
+    item.i_unit = InertiaTensor::getCuboid( 1.0, l, w, h, r );
+    item.m0     = mass;
+    item.m      = mass;
+
+    _items.push_back( item );
+
+    _m += mass;
+    _s += mass * item.r;
+    _i += item.i_unit * mass;
+
+    return static_cast< int >( _items.size() ) - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int TimeHistory::getItem( const char *name ) const
+{
+    for ( size_t i = 0; i < _items.size(); ++i )
+    {
+        if ( _items[ i ].name == name ) return static_cast< int >( i );
+    }
+
+    return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TimeHistory::setMass( int item, double mass )
+{
+    Item &it = _items[ item ];
+
+    double dm = mass - it.m;
+
+    it.m = mass;
+
+    _m += dm;
+    _s += dm * it.r;
+    _i += it.i_unit * dm;
+
+    if ( ++_changes >= _recomputeInterval )
+    {
+        recompute();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TimeHistory::reset()
+{
+    for ( Item &item : _items )
+    {
+        item.m = item.m0;
+    }
+
+    recompute();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TimeHistory::run( const Events &events, double t0, double dt, int steps, Samples *samples )
+{
+    samples->clear();
+    samples->reserve( steps + 1 );
+
+    Events::const_iterator it = events.begin();
+
+    for ( int step = 0; step <= steps; ++step )
+    {
+        // computed from step number, not accumulated, to avoid drift
+        double time = t0 + step * dt;
+
+        while ( it != events.end() && it->time <= time )
+        {
+            setMass( it->item, it->mass );
+            ++it;
+        }
+
+        Sample sample;
+
+        sample.time          = time;
+        sample.mass          = getMass();
+        sample.centerOfMass  = getCenterOfMass();
+        sample.inertiaMatrix = getInertiaMatrix();
+
+        samples->push_back( sample );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TimeHistory::recompute()
+{
+    _m = _m_empty;
+    _s = _s_empty;
+    _i = _i_empty;
+
+    for ( const Item &item : _items )
+    {
+        _m += item.m;
+        _s += item.m * item.r;
+        _i += item.i_unit * item.m;
+    }
+
+    _changes = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
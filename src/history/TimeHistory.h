@@ -0,0 +1,173 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef HISTORY_TIMEHISTORY_H_
+#define HISTORY_TIMEHISTORY_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <mcutil/math/Matrix3x3.h>
+#include <mcutil/math/Vector3.h>
+
+#include <Aircraft.h>
+
+#include <utils/InertiaTensor.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The mass characteristics time history class.
+ *
+ * Empty aircraft sums (mass, first moment of mass and inertia about the
+ * reference point) are taken once from already updated aircraft. Variable
+ * items (fuel tanks, stores, payload) are added on top of them. Inertia of
+ * an item is proportional to its mass, so it is precomputed per unit mass
+ * and changing item mass costs a few multiply-adds regardless of number of
+ * components and items. Sums are recomputed from scratch from time to time
+ * to keep rounding errors of long runs bounded.
+ *
+ * As in Aircraft inertia is given about the reference point.
+ */
+class TimeHistory
+{
+public:
+
+    /**
+     * @brief The item mass change event struct.
+     */
+    struct Event
+    {
+        double time;                ///< [s] event time
+        int item;                   ///< item index
+        double mass;                ///< [kg] item mass from the event time on
+    };
+
+    /**
+     * @brief The time history sample struct.
+     */
+    struct Sample
+    {
+        double time;                ///< [s] sample time
+        double mass;                ///< [kg] total mass
+        Vector3 centerOfMass;       ///< [m] center of mass position
+        Matrix3x3 inertiaMatrix;    ///< [kg*m^2] inertia
+    };
+
+    typedef std::vector< Event >  Events;
+    typedef std::vector< Sample > Samples;
+
+    /**
+     * @brief Constructor.
+     * @param aircraft empty aircraft (already updated)
+     */
+    explicit TimeHistory( const Aircraft &aircraft );
+
+    /**
+     * @brief Adds variable item. Item is a point mass unless dimensions
+     * are given.
+     * @param name item name
+     * @param r [m] item position
+     * @param mass [kg] initial item mass
+     * @param l [m] length (dimension x-component)
+     * @param w [m] width  (dimension y-component)
+     * @param h [m] height (dimension z-component)
+     * @return item index
+     */
+    int addItem( const char *name, const Vector3 &r, double mass,
+                 double l = 0.0, double w = 0.0, double h = 0.0 );
+
+    /**
+     * @brief Returns item index.
+     * @param name item name
+     * @return item index or -1 if there is no such item
+     */
+    int getItem( const char *name ) const;
+
+    /**
+     * @brief Sets item mass.
+     * @param item item index
+     * @param mass [kg] item mass
+     */
+    void setMass( int item, double mass );
+
+    /** @brief Restores initial masses of all items. */
+    void reset();
+
+    /**
+     * @brief Computes time history.
+     * @param events mass change events sorted by time
+     * @param t0 [s] initial time
+     * @param dt [s] time step
+     * @param steps number of steps
+     * @param samples output samples (steps + 1)
+     */
+    void run( const Events &events, double t0, double dt, int steps, Samples *samples );
+
+    inline double getMass() const { return _m; }
+
+    inline Vector3 getCenterOfMass() const
+    {
+        return ( _m > 0.0 ) ? ( _s / _m ) : Vector3();
+    }
+
+    inline Matrix3x3 getInertiaMatrix() const { return _i.getMatrix(); }
+
+    inline double getItemMass( int item ) const { return _items[ item ].m; }
+
+private:
+
+    /**
+     * @brief The variable item struct.
+     */
+    struct Item
+    {
+        std::string name;           ///< item name
+        Vector3 r;                  ///< [m] position
+        InertiaTensor i_unit;       ///< [m^2] inertia per unit mass
+        double m0;                  ///< [kg] initial mass
+        double m;                   ///< [kg] current mass
+    };
+
+    static const int _recomputeInterval = 4096;     ///< number of changes between full recomputations
+
+    double    _m_empty;             ///< [kg] empty aircraft mass
+    Vector3   _s_empty;             ///< [kg*m] empty aircraft first moment of mass
+    InertiaTensor _i_empty;         ///< [kg*m^2] empty aircraft inertia
+
+    std::vector< Item > _items;     ///< variable items
+
+    double    _m;                   ///< [kg] total mass
+    Vector3   _s;                   ///< [kg*m] total first moment of mass
+    InertiaTensor _i;               ///< [kg*m^2] total inertia
+
+    int _changes;                   ///< number of changes since last full recomputation
+
+    void recompute();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // HISTORY_TIMEHISTORY_H_
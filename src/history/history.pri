@@ -0,0 +1,5 @@
+HEADERS += \
+    $$PWD/TimeHistory.h
+
+SOURCES += \
+    $$PWD/TimeHistory.cpp
@@ -0,0 +1,278 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <import/PointMassImporter.h>
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <utils/BinaryUtils.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+static const uint32_t magic   = 0x4D50434D;     // "MCPM"
+static const uint32_t version = 1;
+
+static const uint32_t flagInertia = 0x01;
+
+static const size_t chunkSize = 4096;           ///< binary records read at once
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool endsWith( const std::string &str, const char *suffix )
+{
+    size_t length = strlen( suffix );
+
+    if ( str.size() < length ) return false;
+
+    for ( size_t i = 0; i < length; ++i )
+    {
+        char c = static_cast< char >( tolower( str[ str.size() - length + i ] ) );
+        if ( c != suffix[ i ] ) return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void addPoint( PointMasses *points, bool inertia, int64_t id, const double *v )
+{
+    Vector3 r( v[ 1 ], v[ 2 ], v[ 3 ] );
+
+    if ( inertia )
+    {
+        // tensor off-diagonal elements are negative products of inertia
+        InertiaTensor i( v[ 4 ], v[ 5 ], v[ 6 ], -v[ 7 ], -v[ 8 ], -v[ 9 ] );
+        points->add( id, v[ 0 ], r, i );
+    }
+    else
+    {
+        points->add( id, v[ 0 ], r );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool PointMassImporter::import( const char *fileName, PointMasses *points )
+{
+    std::ifstream fs( fileName, std::ios_base::in | std::ios_base::binary );
+
+    if ( !fs.is_open() ) return false;
+
+    if ( endsWith( fileName, ".mcpm" ) )
+        return readBinary( fs, points );
+
+    return readCsv( fs, points );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool PointMassImporter::readCsv( std::istream &in, PointMasses *points )
+{
+    std::string line;
+
+    int columns = 0;
+    bool header = true;
+
+    while ( std::getline( in, line ) )
+    {
+        const char *str = line.c_str();
+
+        while ( isspace( *str ) ) ++str;
+
+        if ( *str == '\0' || *str == '#' ) continue;
+
+        char *end = nullptr;
+        int64_t id = strtoll( str, &end, 10 );
+
+        if ( end == str )
+        {
+            // only the first line can be a header
+            if ( !header ) return false;
+
+            header = false;
+            continue;
+        }
+
+        header = false;
+
+        double v[ 10 ];
+        int count = 0;
+
+        str = end;
+
+        while ( count < 10 )
+        {
+            while ( isspace( *str ) || *str == ',' || *str == ';' ) ++str;
+
+            if ( *str == '\0' ) break;
+
+            v[ count ] = strtod( str, &end );
+
+            if ( end == str ) return false;
+
+            str = end;
+            count++;
+        }
+
+        while ( isspace( *str ) || *str == ',' || *str == ';' ) ++str;
+
+        if ( *str != '\0' ) return false;
+
+        if ( columns == 0 )
+        {
+            if ( count != 4 && count != 10 ) return false;
+            columns = count;
+        }
+        else if ( count != columns )
+        {
+            return false;
+        }
+
+        addPoint( points, columns == 10, id, v );
+    }
+
+    return in.eof();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool PointMassImporter::readBinary( std::istream &in, PointMasses *points )
+{
+    uint32_t magic_temp   = 0;
+    uint32_t version_temp = 0;
+    uint32_t flags        = 0;
+    uint64_t count        = 0;
+
+    bool result = true;
+
+    if ( result ) result = BinaryUtils::read( in, &magic_temp   );
+    if ( result ) result = BinaryUtils::read( in, &version_temp );
+
+    result = result && magic_temp == magic && version_temp == version;
+
+    if ( result ) result = BinaryUtils::read( in, &flags );
+    if ( result ) result = BinaryUtils::read( in, &count );
+
+    if ( !result ) return false;
+
+    const bool inertia = ( flags & flagInertia ) != 0;
+    const size_t values = inertia ? 10 : 4;
+    const size_t recordSize = sizeof( int64_t ) + values * sizeof( double );
+
+    // count comes from the file, it is checked against the remaining stream
+    // size before anything is allocated, otherwise one chunk is reserved
+    uint64_t reserved = ( count < chunkSize ) ? count : chunkSize;
+
+    std::streampos pos = in.tellg();
+
+    if ( pos != std::streampos( -1 ) )
+    {
+        in.seekg( 0, std::ios_base::end );
+        std::streampos end = in.tellg();
+        in.seekg( pos );
+
+        if ( !in.good() || end < pos ) return false;
+
+        if ( count > static_cast< uint64_t >( end - pos ) / recordSize ) return false;
+
+        reserved = count;
+    }
+
+    points->reserve( points->getCount() + static_cast< size_t >( reserved ) );
+
+    std::vector< char > buffer( chunkSize * recordSize );
+
+    while ( count > 0 )
+    {
+        size_t records = ( count < chunkSize ) ? static_cast< size_t >( count ) : chunkSize;
+
+        in.read( buffer.data(), records * recordSize );
+
+        if ( !in.good() ) return false;
+
+        for ( size_t i = 0; i < records; ++i )
+        {
+            const char *record = buffer.data() + i * recordSize;
+
+            int64_t id = 0;
+            double v[ 10 ];
+
+            memcpy( &id, record, sizeof( int64_t ) );
+            memcpy( v, record + sizeof( int64_t ), values * sizeof( double ) );
+
+            addPoint( points, inertia, id, v );
+        }
+
+        count -= records;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool PointMassImporter::writeBinary( std::ostream &out, const PointMasses &points )
+{
+    const bool inertia = points.hasInertia();
+
+    BinaryUtils::write( out, magic   );
+    BinaryUtils::write( out, version );
+    BinaryUtils::write( out, inertia ? flagInertia : 0U );
+    BinaryUtils::write( out, static_cast< uint64_t >( points.getCount() ) );
+
+    for ( size_t i = 0; i < points.getCount(); ++i )
+    {
+        Vector3 r = points.getPosition( i );
+
+        BinaryUtils::write( out, points.getId( i ) );
+        BinaryUtils::write( out, points.getMass( i ) );
+        BinaryUtils::write( out, r.x() );
+        BinaryUtils::write( out, r.y() );
+        BinaryUtils::write( out, r.z() );
+
+        if ( inertia )
+        {
+            InertiaTensor t = points.getInertia( i );
+
+            BinaryUtils::write( out,  t.xx() );
+            BinaryUtils::write( out,  t.yy() );
+            BinaryUtils::write( out,  t.zz() );
+            BinaryUtils::write( out, -t.xy() );
+            BinaryUtils::write( out, -t.xz() );
+            BinaryUtils::write( out, -t.yz() );
+        }
+    }
+
+    return out.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
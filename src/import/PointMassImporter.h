@@ -0,0 +1,92 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef IMPORT_POINTMASSIMPORTER_H_
+#define IMPORT_POINTMASSIMPORTER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+#include <components/PointMasses.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The CAD/FEM point masses importer class.
+ *
+ * Files are read in chunks straight into the point masses arrays, there is
+ * no intermediate copy of the whole file.
+ *
+ * CSV files have one point per line: id, mass [kg], x, y, z [m] and
+ * optionally ixx, iyy, izz, ixy, ixz, iyz [kg*m^2] local inertia about the
+ * point. Products of inertia are defined as positive integrals, e.g.
+ * ixy = integral of x*y dm. Values can be separated with commas, semicolons
+ * or whitespaces. Empty lines, lines starting with '#' and the header line
+ * are skipped.
+ *
+ * Binary files (*.mcpm) consist of the header: magic "MCPM", version,
+ * flags (1 if there is local inertia) as uint32 and points count as uint64
+ * followed by records: int64 id and 4 or 10 double values in the same
+ * order as in CSV files. Values are stored in the host byte order.
+ */
+class PointMassImporter
+{
+public:
+
+    /**
+     * @brief Imports point masses from file, format is chosen by extension.
+     * @param fileName file name
+     * @param points output point masses, imported points are appended
+     * @return true on success false on failure
+     */
+    static bool import( const char *fileName, PointMasses *points );
+
+    /**
+     * @brief Reads points from CSV stream.
+     * @param in input stream
+     * @param points output point masses, imported points are appended
+     * @return true on success false on failure
+     */
+    static bool readCsv( std::istream &in, PointMasses *points );
+
+    /**
+     * @brief Reads points from binary stream.
+     * @param in input stream
+     * @param points output point masses, imported points are appended
+     * @return true on success false on failure
+     */
+    static bool readBinary( std::istream &in, PointMasses *points );
+
+    /**
+     * @brief Writes points to binary stream.
+     * @param out output stream
+     * @param points point masses
+     * @return true on success false on failure
+     */
+    static bool writeBinary( std::ostream &out, const PointMasses &points );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // IMPORT_POINTMASSIMPORTER_H_
@@ -0,0 +1,548 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <import/SimModelImporter.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <QDomDocument>
+
+#include <mcutil/misc/Units.h>
+
+#include <components/ComponentFactory.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct SimUnit
+{
+    const char *name;           ///< unit name as in JSBSim "unit" attribute
+    double factor;              ///< SI value of the unit
+};
+
+static const SimUnit simUnits[] =
+{
+    { "IN"       , Units::in2m( 1.0 ) },
+    { "FT"       , Units::ft2m( 1.0 ) },
+    { "M"        , 1.0 },
+    { "FT2"      , Units::sqft2sqm( 1.0 ) },
+    { "M2"       , 1.0 },
+    { "LBS"      , Units::lb2kg( 1.0 ) },
+    { "KG"       , 1.0 },
+    { "SLUG*FT2" , 1.3558179483314004 },
+    { "KG*M2"    , 1.0 },
+    { nullptr, 0.0 }
+};
+
+struct SimGear
+{
+    Vector3 r;                  ///< [m] contact point position
+    double l;                   ///< [m] extended gear length
+    bool retractable;           ///< specifies if gear is retractable
+};
+
+struct SimSurface
+{
+    Vector3 r;                  ///< [m] root position
+    double area;                ///< [m^2] area
+    double span;                ///< [m] span (height if not mirrored)
+    double sweep;               ///< [deg] sweep
+    double c_root;              ///< [m] root chord
+    double c_tip;               ///< [m] tip chord
+    double ar;                  ///< [-] aspect ratio
+    double tr;                  ///< [-] taper ratio
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Returns SI value of the unit, default unit is used if unit is unknown. */
+static double getFactor( const QString &unit, const char *defaultUnit )
+{
+    for ( int pass = 0; pass < 2; ++pass )
+    {
+        QString name = pass == 0 ? unit : QString( defaultUnit );
+
+        for ( const SimUnit *u = simUnits; u->name != nullptr; ++u )
+        {
+            if ( name == u->name ) return u->factor;
+        }
+    }
+
+    return 1.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Returns JSBSim child element value in SI units, 0 if there is no such child. */
+static double getValue( const QDomElement &parentNode, const char *tagName, const char *defaultUnit )
+{
+    QDomElement node = parentNode.firstChildElement( tagName );
+
+    if ( node.isNull() ) return 0.0;
+
+    return node.text().toDouble() * getFactor( node.attribute( "unit", defaultUnit ), defaultUnit );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns JSBSim location in the body axes. JSBSim structural frame x-axis
+ * points aft and z-axis points up, origin is the same.
+ */
+static Vector3 getLocation( const QDomElement &node )
+{
+    const double factor = getFactor( node.attribute( "unit", "IN" ), "IN" );
+
+    return Vector3( -node.firstChildElement( "x" ).text().toDouble() * factor,
+                     node.firstChildElement( "y" ).text().toDouble() * factor,
+                    -node.firstChildElement( "z" ).text().toDouble() * factor );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Returns YASim attribute value multiplied by the factor. */
+static double getAttribute( const QDomElement &node, const char *name,
+                            double factor = 1.0, double defaultValue = 0.0 )
+{
+    if ( !node.hasAttribute( name ) ) return defaultValue;
+
+    return node.attribute( name ).toDouble() * factor;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns YASim position in the body axes. YASim y-axis points left and
+ * z-axis points up.
+ */
+static Vector3 getPosition( const QDomElement &node, const char *x = "x",
+                            const char *y = "y", const char *z = "z" )
+{
+    return Vector3(  getAttribute( node, x ),
+                    -getAttribute( node, y ),
+                    -getAttribute( node, z ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns YASim surface geometry, wing and horizontal stabilizer are mirrored,
+ * vertical stabilizer is not. Dihedral is neglected.
+ */
+static SimSurface getSurface( const QDomElement &node, bool mirrored )
+{
+    SimSurface surface;
+
+    const double length = getAttribute( node, "length" );
+    const double taper  = getAttribute( node, "taper", 1.0, 1.0 );
+
+    surface.r      = getPosition( node );
+    surface.span   = mirrored ? 2.0 * length : length;
+    surface.sweep  = getAttribute( node, "sweep" );
+    surface.c_root = getAttribute( node, "chord" );
+    surface.c_tip  = surface.c_root * taper;
+    surface.tr     = taper;
+    surface.area   = 0.5 * surface.span * ( surface.c_root + surface.c_tip );
+    surface.ar     = surface.area > 0.0 ? surface.span * surface.span / surface.area : 0.0;
+
+    return surface;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns cuboid dimension along the axis of the moment of inertia i1 giving
+ * the principal moments of inertia i1, i2 and i3.
+ */
+static double getCuboidDimension( double m, double i1, double i2, double i3 )
+{
+    return m > 0.0 ? sqrt( std::max( 0.0, 6.0 * ( i2 + i3 - i1 ) / m ) ) : 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Sets landing gear data. Gear the furthest lengthwise from the reference
+ * point is the nose (or tail) gear, all the other are main gears.
+ */
+static void setLandingGear( const std::vector< SimGear > &gears, double x_ref,
+                            AircraftData::LandingGear *landing_gear )
+{
+    if ( gears.empty() ) return;
+
+    size_t nose = gears.size();
+
+    if ( gears.size() > 1 )
+    {
+        nose = 0;
+
+        for ( size_t i = 1; i < gears.size(); ++i )
+        {
+            if ( fabs( gears[ i ].r.x() - x_ref ) > fabs( gears[ nose ].r.x() - x_ref ) ) nose = i;
+        }
+    }
+
+    landing_gear->main_l      = 0.0;
+    landing_gear->nose_l      = 0.0;
+    landing_gear->main_wheels = 0;
+    landing_gear->main_struts = 0;
+    landing_gear->nose_wheels = 0;
+    landing_gear->fixed       = true;
+
+    for ( size_t i = 0; i < gears.size(); ++i )
+    {
+        if ( i == nose )
+        {
+            landing_gear->nose_l = gears[ i ].l;
+            landing_gear->nose_wheels++;
+        }
+        else
+        {
+            landing_gear->main_l = std::max( landing_gear->main_l, gears[ i ].l );
+            landing_gear->main_wheels++;
+            landing_gear->main_struts++;
+        }
+
+        if ( gears[ i ].retractable ) landing_gear->fixed = false;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+SimModelImporter::SimModelImporter( AircraftData::Type type ) :
+    _type ( type )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool SimModelImporter::read( const QByteArray &content, Aircraft *aircraft ) const
+{
+    QDomDocument doc;
+
+    if ( !doc.setContent( content, false ) ) return false;
+
+    QDomElement rootNode = doc.documentElement();
+
+    if ( rootNode.tagName() == "fdm_config" ) return readJsbSim( rootNode, aircraft );
+    if ( rootNode.tagName() == "airplane"   ) return readYaSim( rootNode, aircraft );
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool SimModelImporter::readJsbSim( const QDomElement &rootNode, Aircraft *aircraft ) const
+{
+    QDomElement metricsNode = rootNode.firstChildElement( "metrics" );
+    QDomElement massNode    = rootNode.firstChildElement( "mass_balance" );
+
+    if ( metricsNode.isNull() || massNode.isNull() ) return false;
+
+    aircraft->reset();
+
+    AircraftData data = *aircraft->getData();
+    data.type = _type;
+
+    // geometry
+    data.wing.area = getValue( metricsNode, "wingarea", "FT2" );
+    data.wing.span = getValue( metricsNode, "wingspan", "FT"  );
+
+    if ( data.wing.area > 0.0 ) data.wing.ar = data.wing.span * data.wing.span / data.wing.area;
+
+    data.hor_tail.area = getValue( metricsNode, "htailarea", "FT2" );
+    data.hor_tail.arm  = getValue( metricsNode, "htailarm" , "FT"  );
+    data.ver_tail.area = getValue( metricsNode, "vtailarea", "FT2" );
+    data.ver_tail.arm  = getValue( metricsNode, "vtailarm" , "FT"  );
+
+    // empty mass
+    ComponentData empty;
+
+    empty.type = "all_else";
+    empty.name = "Empty Mass";
+    empty.m    = getValue( massNode, "emptywt", "LBS" );
+    empty.r    = getLocation( massNode.firstChildElement( "location" ) );
+
+    const double ixx = getValue( massNode, "ixx", "SLUG*FT2" );
+    const double iyy = getValue( massNode, "iyy", "SLUG*FT2" );
+    const double izz = getValue( massNode, "izz", "SLUG*FT2" );
+
+    empty.l = getCuboidDimension( empty.m, ixx, iyy, izz );
+    empty.w = getCuboidDimension( empty.m, iyy, izz, ixx );
+    empty.h = getCuboidDimension( empty.m, izz, ixx, iyy );
+
+    data.general.m_empty = empty.m;
+
+    std::vector< ComponentData > points;
+    double payload = 0.0;
+
+    for ( QDomElement node = massNode.firstChildElement( "pointmass" ); !node.isNull();
+          node = node.nextSiblingElement( "pointmass" ) )
+    {
+        ComponentData point;
+
+        point.type = "all_else";
+        point.name = node.attribute( "name", "Point Mass" ).toStdString();
+        point.m    = getValue( node, "weight", "LBS" );
+        point.r    = getLocation( node.firstChildElement( "location" ) );
+
+        payload += point.m;
+
+        points.push_back( point );
+    }
+
+    // fuel
+    double fuel = 0.0;
+
+    QDomElement propulsionNode = rootNode.firstChildElement( "propulsion" );
+
+    for ( QDomElement node = propulsionNode.firstChildElement( "tank" ); !node.isNull();
+          node = node.nextSiblingElement( "tank" ) )
+    {
+        const double capacity = getValue( node, "capacity", "LBS" );
+
+        fuel += capacity;
+
+        if ( fabs( getLocation( node.firstChildElement( "location" ) ).y() ) > 1.0e-3 )
+        {
+            data.wing.fuel += capacity;
+        }
+    }
+
+    data.general.mtow = data.general.m_empty + payload + fuel;
+
+    // landing gear
+    std::vector< SimGear > gears;
+
+    QDomElement groundNode = rootNode.firstChildElement( "ground_reactions" );
+
+    for ( QDomElement node = groundNode.firstChildElement( "contact" ); !node.isNull();
+          node = node.nextSiblingElement( "contact" ) )
+    {
+        if ( node.attribute( "type" ) != "BOGEY" ) continue;
+
+        SimGear gear;
+
+        gear.r = getLocation( node.firstChildElement( "location" ) );
+        gear.l = std::max( 0.0, gear.r.z() - empty.r.z() );
+        gear.retractable = node.firstChildElement( "retractable" ).text().toInt() != 0;
+
+        gears.push_back( gear );
+    }
+
+    setLandingGear( gears, empty.r.x(), &data.landing_gear );
+
+    aircraft->setData( data );
+
+    // components
+    Aircraft::Components components;
+
+    components.push_back( ComponentFactory::create( empty, aircraft->getData() ) );
+
+    for ( const ComponentData &point : points )
+    {
+        components.push_back( ComponentFactory::create( point, aircraft->getData() ) );
+    }
+
+    aircraft->addComponents( components );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool SimModelImporter::readYaSim( const QDomElement &rootNode, Aircraft *aircraft ) const
+{
+    QDomElement wingNode = rootNode.firstChildElement( "wing" );
+
+    if ( wingNode.isNull() ) return false;
+
+    aircraft->reset();
+
+    AircraftData data = *aircraft->getData();
+    data.type = _type;
+
+    // general
+    QDomElement approachNode = rootNode.firstChildElement( "approach" );
+    QDomElement cruiseNode   = rootNode.firstChildElement( "cruise"   );
+
+    data.general.m_empty  = getAttribute( rootNode, "mass", Units::lb2kg( 1.0 ) );
+    data.general.v_stall  = getAttribute( approachNode, "speed" ) / 1.3;
+    data.general.v_cruise = getAttribute( cruiseNode, "speed" );
+    data.general.h_cruise = getAttribute( cruiseNode, "alt" );
+
+    // fuselage, the longest one if there are more
+    Vector3 axis;
+
+    for ( QDomElement node = rootNode.firstChildElement( "fuselage" ); !node.isNull();
+          node = node.nextSiblingElement( "fuselage" ) )
+    {
+        Vector3 a = getPosition( node, "ax", "ay", "az" );
+        Vector3 b = getPosition( node, "bx", "by", "bz" );
+
+        double l = ( b - a ).getLength();
+
+        if ( l > data.fuselage.l )
+        {
+            data.fuselage.l = l;
+            data.fuselage.w = getAttribute( node, "width" );
+            data.fuselage.h = data.fuselage.w;
+
+            axis = ( a + b ) * 0.5;
+        }
+    }
+
+    // surfaces
+    SimSurface wing = getSurface( wingNode, true );
+
+    data.wing.area   = wing.area;
+    data.wing.span   = wing.span;
+    data.wing.sweep  = wing.sweep;
+    data.wing.c_root = wing.c_root;
+    data.wing.c_tip  = wing.c_tip;
+    data.wing.ar     = wing.ar;
+    data.wing.tr     = wing.tr;
+
+    if ( data.fuselage.l <= 0.0 ) axis = wing.r;
+
+    QDomElement hstabNode = rootNode.firstChildElement( "hstab" );
+
+    if ( !hstabNode.isNull() )
+    {
+        SimSurface hstab = getSurface( hstabNode, true );
+
+        data.hor_tail.area   = hstab.area;
+        data.hor_tail.span   = hstab.span;
+        data.hor_tail.sweep  = hstab.sweep;
+        data.hor_tail.c_root = hstab.c_root;
+        data.hor_tail.c_tip  = hstab.c_tip;
+        data.hor_tail.ar     = hstab.ar;
+        data.hor_tail.tr     = hstab.tr;
+        data.hor_tail.arm    = wing.r.x() - hstab.r.x();
+        data.hor_tail.w_f    = data.fuselage.w;
+    }
+
+    QDomElement vstabNode = rootNode.firstChildElement( "vstab" );
+
+    if ( !vstabNode.isNull() )
+    {
+        SimSurface vstab = getSurface( vstabNode, false );
+
+        data.ver_tail.area   = vstab.area;
+        data.ver_tail.height = vstab.span;
+        data.ver_tail.sweep  = vstab.sweep;
+        data.ver_tail.c_root = vstab.c_root;
+        data.ver_tail.c_tip  = vstab.c_tip;
+        data.ver_tail.ar     = vstab.ar;
+        data.ver_tail.tr     = vstab.tr;
+        data.ver_tail.arm    = wing.r.x() - vstab.r.x();
+    }
+
+    // fuel
+    double fuel = 0.0;
+
+    for ( QDomElement node = rootNode.firstChildElement( "tank" ); !node.isNull();
+          node = node.nextSiblingElement( "tank" ) )
+    {
+        const double capacity = getAttribute( node, "capacity", Units::lb2kg( 1.0 ) );
+
+        fuel += capacity;
+
+        if ( fabs( getAttribute( node, "y" ) ) > 1.0e-3 ) data.wing.fuel += capacity;
+    }
+
+    data.general.mtow = data.general.m_empty + fuel;
+
+    // landing gear
+    std::vector< SimGear > gears;
+
+    for ( QDomElement node = rootNode.firstChildElement( "gear" ); !node.isNull();
+          node = node.nextSiblingElement( "gear" ) )
+    {
+        SimGear gear;
+
+        gear.r = getPosition( node );
+        gear.l = std::max( getAttribute( node, "compression" ),
+                           gear.r.z() - axis.z() - 0.5 * data.fuselage.h );
+        gear.retractable = false;
+
+        for ( QDomElement inputNode = node.firstChildElement( "control-input" ); !inputNode.isNull();
+              inputNode = inputNode.nextSiblingElement( "control-input" ) )
+        {
+            if ( inputNode.attribute( "control" ) == "EXTEND" ) gear.retractable = true;
+        }
+
+        gears.push_back( gear );
+    }
+
+    setLandingGear( gears, wing.r.x(), &data.landing_gear );
+
+    aircraft->setData( data );
+
+    // components, ballasts are part of the empty mass
+    Aircraft::Components components;
+
+    ComponentData empty;
+
+    empty.type = "all_else";
+    empty.name = "Empty Mass";
+    empty.m    = data.general.m_empty;
+    empty.r    = Vector3( wing.r.x(), 0.0, axis.z() );
+    empty.l    = data.fuselage.l;
+    empty.w    = data.fuselage.w;
+    empty.h    = data.fuselage.h;
+
+    int ballastCount = 0;
+    char name[ 32 ];
+
+    for ( QDomElement node = rootNode.firstChildElement( "ballast" ); !node.isNull();
+          node = node.nextSiblingElement( "ballast" ) )
+    {
+        ComponentData ballast;
+
+        snprintf( name, sizeof( name ), "Ballast %d", ++ballastCount );
+
+        ballast.type = "all_else";
+        ballast.name = name;
+        ballast.m    = getAttribute( node, "mass", Units::lb2kg( 1.0 ) );
+        ballast.r    = getPosition( node );
+
+        empty.m -= ballast.m;
+
+        components.push_back( ComponentFactory::create( ballast, aircraft->getData() ) );
+    }
+
+    empty.m = std::max( 0.0, empty.m );
+
+    components.insert( components.begin(), ComponentFactory::create( empty, aircraft->getData() ) );
+
+    aircraft->addComponents( components );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,88 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef IMPORT_SIMMODELIMPORTER_H_
+#define IMPORT_SIMMODELIMPORTER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QByteArray>
+#include <QDomElement>
+
+#include <Aircraft.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The JSBSim and YASim aircraft definitions importer class.
+ *
+ * Format is recognized by the root element: "fdm_config" for JSBSim and
+ * "airplane" for YASim. Wing, tails and landing gear geometry are mapped
+ * into aircraft data. Empty mass, JSBSim pointmasses and YASim ballasts are
+ * mapped into all-else components.
+ *
+ * JSBSim empty mass becomes a cuboid placed at the empty CG of dimensions
+ * giving the same principal moments of inertia. YASim does not give empty
+ * mass distribution, so it is placed at the wing root mid-chord on the
+ * fuselage axis with the fuselage dimensions.
+ *
+ * Simulation models do not give all the data estimation formulas need,
+ * so some values are only approximated:
+ * - maximum take-off mass is empty mass, pointmasses and full fuel tanks,
+ * - wing fuel is capacity of tanks placed off the plane of symmetry,
+ * - gear the furthest lengthwise from the CG (JSBSim) or the wing (YASim)
+ *   is the nose (or tail) gear, all the other are main gears,
+ * - gear length is distance from the empty CG (JSBSim) or the fuselage
+ *   bottom (YASim) to the contact point,
+ * - stall speed is YASim approach speed divided by 1.3.
+ */
+class SimModelImporter
+{
+public:
+
+    /**
+     * @brief Constructor.
+     * @param type type of imported aircraft, simulation models do not specify it
+     */
+    explicit SimModelImporter( AircraftData::Type type = AircraftData::GeneralAviation );
+
+    /**
+     * @brief Reads aircraft from JSBSim or YASim aircraft definition.
+     * Can be called concurrently for different aircraft.
+     * @param content file content
+     * @param aircraft output aircraft
+     * @return true on success false if content is not a JSBSim or YASim aircraft
+     */
+    bool read( const QByteArray &content, Aircraft *aircraft ) const;
+
+private:
+
+    const AircraftData::Type _type;     ///< type of imported aircraft
+
+    bool readJsbSim( const QDomElement &rootNode, Aircraft *aircraft ) const;
+    bool readYaSim( const QDomElement &rootNode, Aircraft *aircraft ) const;
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // IMPORT_SIMMODELIMPORTER_H_
@@ -0,0 +1,7 @@
+HEADERS += \
+    $$PWD/PointMassImporter.h \
+    $$PWD/SimModelImporter.h
+
+SOURCES += \
+    $$PWD/PointMassImporter.cpp \
+    $$PWD/SimModelImporter.cpp
@@ -0,0 +1,746 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <journal/EditJournal.h>
+
+#include <cstdio>
+#include <sstream>
+
+#include <defs.h>
+
+#include <AircraftDataFields.h>
+
+#include <components/ComponentFactory.h>
+
+#include <utils/BinaryUtils.h>
+#include <utils/HashUtils.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+static const uint32_t magic   = 0x4A52434D;   // "MCRJ"
+static const uint32_t version = 2;
+
+static const uint32_t maxRecordSize = 1 << 24;
+
+/** Record types. */
+enum RecordType
+{
+    RecordFile = 1,         ///< aircraft file name
+    RecordData,             ///< all aircraft data fields values
+    RecordField,            ///< aircraft data field value
+    RecordAdd,              ///< component added
+    RecordSet,              ///< component parameters changed
+    RecordRemove,           ///< component removed
+    RecordPointMasses,      ///< point masses file name
+    RecordEnd,              ///< end of snapshot
+    RecordAssembly          ///< assembly, snapshot only
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void writeComponent( std::ostream &out, const ComponentData &data )
+{
+    BinaryUtils::write( out, data.type );
+    BinaryUtils::write( out, data.name );
+    BinaryUtils::write( out, data.r );
+    BinaryUtils::write( out, data.m );
+    BinaryUtils::write( out, data.l );
+    BinaryUtils::write( out, data.w );
+    BinaryUtils::write( out, data.h );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool readComponent( std::istream &in, ComponentData *data )
+{
+    return BinaryUtils::read( in, &data->type )
+        && BinaryUtils::read( in, &data->name )
+        && BinaryUtils::read( in, &data->r )
+        && BinaryUtils::read( in, &data->m )
+        && BinaryUtils::read( in, &data->l )
+        && BinaryUtils::read( in, &data->w )
+        && BinaryUtils::read( in, &data->h );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void writeAssembly( std::ostream &out, const AircraftSnapshot::AssemblyState &state )
+{
+    BinaryUtils::write( out, state.name );
+    BinaryUtils::write( out, state.origin );
+    BinaryUtils::write( out, static_cast< int64_t >( state.parent ) );
+    BinaryUtils::write( out, static_cast< uint32_t >( state.components.size() ) );
+
+    for ( uint32_t index : state.components )
+    {
+        BinaryUtils::write( out, index );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool readAssembly( std::istream &in, AircraftSnapshot::AssemblyState *state )
+{
+    int64_t parent = 0;
+    uint32_t count = 0;
+
+    if ( !BinaryUtils::read( in, &state->name   )
+      || !BinaryUtils::read( in, &state->origin )
+      || !BinaryUtils::read( in, &parent )
+      || !BinaryUtils::read( in, &count ) )
+    {
+        return false;
+    }
+
+    // count is checked against the record size before anything is allocated
+    if ( count > maxRecordSize / sizeof( uint32_t ) ) return false;
+
+    state->parent = static_cast< int >( parent );
+    state->components.resize( count );
+
+    for ( uint32_t i = 0; i < count; ++i )
+    {
+        if ( !BinaryUtils::read( in, &state->components[ i ] ) ) return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Writes record, which is size, checksum and sequence number, type and body. */
+static uint64_t writeRecord( std::ostream &out, uint64_t sequence, uint32_t type,
+                             const std::string &body )
+{
+    std::ostringstream ss;
+
+    BinaryUtils::write( ss, sequence );
+    BinaryUtils::write( ss, type );
+    ss.write( body.data(), body.size() );
+
+    const std::string payload = ss.str();
+
+    BinaryUtils::write( out, static_cast< uint32_t >( payload.size() ) );
+    BinaryUtils::write( out, HashUtils::hash( payload.data(), payload.size() ) );
+    out.write( payload.data(), payload.size() );
+
+    return sizeof( uint32_t ) + sizeof( uint64_t ) + payload.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Reads record, returns false at the end of file or on incomplete or corrupted record. */
+static bool readRecord( std::istream &in, uint64_t *sequence, uint32_t *type,
+                        std::string *body )
+{
+    uint32_t size = 0;
+    uint64_t hash = 0;
+
+    if ( !BinaryUtils::read( in, &size ) || !BinaryUtils::read( in, &hash ) ) return false;
+
+    if ( size < sizeof( uint64_t ) + sizeof( uint32_t ) || size > maxRecordSize ) return false;
+
+    std::string payload( size, '\0' );
+    in.read( &payload[ 0 ], size );
+
+    if ( !in.good() || HashUtils::hash( payload.data(), payload.size() ) != hash ) return false;
+
+    std::istringstream ss( payload );
+
+    BinaryUtils::read( ss, sequence );
+    BinaryUtils::read( ss, type );
+
+    *body = payload.substr( sizeof( uint64_t ) + sizeof( uint32_t ) );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void writeHeader( std::ostream &out )
+{
+    BinaryUtils::write( out, magic );
+    BinaryUtils::write( out, version );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool readHeader( std::istream &in )
+{
+    uint32_t magic_temp   = 0;
+    uint32_t version_temp = 0;
+
+    return BinaryUtils::read( in, &magic_temp   )
+        && BinaryUtils::read( in, &version_temp )
+        && magic_temp == magic && version_temp == version;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool setField( Aircraft *aircraft, uint32_t index, double value )
+{
+    if ( index >= static_cast< uint32_t >( AircraftDataFields::getCount() ) ) return false;
+
+    AircraftData data = *aircraft->getData();
+
+    if ( !AircraftDataFields::setValue( data, index, value ) ) return false;
+
+    aircraft->setData( data );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Writes snapshot to the temporary file, then replaces snapshot file with it. */
+static bool writeSnapshot( const std::string &fileName, const AircraftSnapshot &snapshot,
+                           const std::string &aircraftFile )
+{
+    const std::string fileSnapshot = fileName + ".snapshot";
+    const std::string fileTemp = fileSnapshot + ".tmp";
+
+    std::ofstream fs( fileTemp.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+
+    if ( !fs.is_open() )
+    {
+        return false;
+    }
+
+    const uint64_t sequence = snapshot.getVersion();
+
+    writeHeader( fs );
+
+    std::ostringstream ss;
+
+    BinaryUtils::write( ss, aircraftFile );
+    writeRecord( fs, sequence, RecordFile, ss.str() );
+
+    ss.str( "" );
+    BinaryUtils::write( ss, static_cast< uint32_t >( AircraftDataFields::getCount() ) );
+    for ( int i = 0; i < AircraftDataFields::getCount(); ++i )
+    {
+        BinaryUtils::write( ss, AircraftDataFields::getValue( snapshot.getData(), i ) );
+    }
+    writeRecord( fs, sequence, RecordData, ss.str() );
+
+    ss.str( "" );
+    BinaryUtils::write( ss, snapshot.getPointMassesFile() );
+    writeRecord( fs, sequence, RecordPointMasses, ss.str() );
+
+    for ( size_t i = 0; i < snapshot.getComponentsCount(); ++i )
+    {
+        ss.str( "" );
+        writeComponent( ss, snapshot.getComponent( i ).data );
+        writeRecord( fs, sequence, RecordAdd, ss.str() );
+    }
+
+    for ( const AircraftSnapshot::AssemblyState &state : snapshot.getAssemblies() )
+    {
+        ss.str( "" );
+        writeAssembly( ss, state );
+        writeRecord( fs, sequence, RecordAssembly, ss.str() );
+    }
+
+    writeRecord( fs, sequence, RecordEnd, std::string() );
+
+    fs.flush();
+
+    bool result = fs.good();
+
+    fs.close();
+
+    if ( result )
+    {
+        // replace snapshot file only when it has been completely written
+        std::remove( fileSnapshot.c_str() );
+        result = ( 0 == std::rename( fileTemp.c_str(), fileSnapshot.c_str() ) );
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Reads snapshot, returns false unless it is complete. */
+static bool readSnapshot( const std::string &fileName, Aircraft *aircraft,
+                          uint64_t *sequence, std::string *aircraftFile )
+{
+    std::ifstream fs( fileName.c_str(), std::ios_base::in | std::ios_base::binary );
+
+    if ( !fs.is_open() || !readHeader( fs ) ) return false;
+
+    aircraft->reset();
+
+    Aircraft::Components components;
+    AircraftSnapshot::Assemblies assemblies;
+
+    bool result = false;
+
+    uint64_t recordSequence = 0;
+    uint32_t type = 0;
+    std::string body;
+
+    while ( !result && readRecord( fs, &recordSequence, &type, &body ) )
+    {
+        std::istringstream ss( body );
+
+        bool valid = true;
+
+        if ( type == RecordFile )
+        {
+            valid = BinaryUtils::read( ss, aircraftFile );
+        }
+        else if ( type == RecordData )
+        {
+            uint32_t count = 0;
+            valid = BinaryUtils::read( ss, &count );
+
+            AircraftData data;
+
+            for ( uint32_t i = 0; valid && i < count; ++i )
+            {
+                double value = 0.0;
+                valid = BinaryUtils::read( ss, &value )
+                     && ( i >= static_cast< uint32_t >( AircraftDataFields::getCount() )
+                       || AircraftDataFields::setValue( data, i, value ) );
+            }
+
+            if ( valid ) aircraft->setData( data );
+        }
+        else if ( type == RecordPointMasses )
+        {
+            std::string pointMassesFile;
+            valid = BinaryUtils::read( ss, &pointMassesFile );
+
+            if ( valid && !pointMassesFile.empty() )
+            {
+                aircraft->importPointMasses( pointMassesFile.c_str() );
+            }
+        }
+        else if ( type == RecordAdd )
+        {
+            ComponentData componentData;
+            valid = readComponent( ss, &componentData );
+
+            Component *component = valid ? ComponentFactory::create( componentData, aircraft->getData() )
+                                         : nullptr;
+
+            // assemblies refer to components by index, so none can be skipped
+            valid = component != nullptr;
+
+            if ( component ) components.push_back( component );
+        }
+        else if ( type == RecordAssembly )
+        {
+            AircraftSnapshot::AssemblyState state;
+            valid = readAssembly( ss, &state );
+
+            if ( valid ) assemblies.push_back( state );
+        }
+        else if ( type == RecordEnd )
+        {
+            result = true;
+        }
+
+        if ( !valid ) break;
+
+        *sequence = recordSequence;
+    }
+
+    if ( result )
+    {
+        aircraft->addComponents( components );
+        result = AircraftSnapshot::setAssemblies( assemblies, aircraft );
+    }
+    else
+    {
+        for ( Component *component : components ) DELPTR( component );
+    }
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Applies journal record, returns false if record does not match the aircraft. */
+static bool applyRecord( uint32_t type, const std::string &body, Aircraft *aircraft )
+{
+    std::istringstream ss( body );
+
+    uint32_t index = 0;
+
+    if ( type == RecordField )
+    {
+        double value = 0.0;
+
+        return BinaryUtils::read( ss, &index )
+            && BinaryUtils::read( ss, &value )
+            && setField( aircraft, index, value );
+    }
+    else if ( type == RecordAdd )
+    {
+        ComponentData componentData;
+
+        if ( !readComponent( ss, &componentData ) ) return false;
+
+        Component *component = ComponentFactory::create( componentData, aircraft->getData() );
+
+        if ( !component ) return false;
+
+        aircraft->addComponent( component );
+
+        return true;
+    }
+    else if ( type == RecordSet )
+    {
+        ComponentData componentData;
+
+        if ( !BinaryUtils::read( ss, &index ) || !readComponent( ss, &componentData ) ) return false;
+
+        if ( index >= aircraft->getComponents().size() ) return false;
+
+        Component *component = aircraft->getComponent( index );
+
+        if ( componentData.type != component->getXmlTagName() ) return false;
+
+        component->setComponentData( componentData );
+
+        return true;
+    }
+    else if ( type == RecordRemove )
+    {
+        if ( !BinaryUtils::read( ss, &index ) ) return false;
+
+        if ( index >= aircraft->getComponents().size() ) return false;
+
+        aircraft->delComponent( index );
+
+        return true;
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool EditJournal::exists( const char *fileName )
+{
+    const std::string fileSnapshot = std::string( fileName ) + ".snapshot";
+
+    return std::ifstream( fileSnapshot.c_str() ).is_open()
+        || std::ifstream( ( fileSnapshot + ".tmp" ).c_str() ).is_open();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool EditJournal::isOrphaned( const char *fileName )
+{
+    if ( !exists( fileName ) ) return false;
+
+    // lock of the instance which is no longer running is stale and can be taken,
+    // stale lock time is disabled as lock of the running instance never expires
+    QLockFile lock( QString::fromLocal8Bit( fileName ) + ".lock" );
+    lock.setStaleLockTime( 0 );
+
+    return lock.tryLock( 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool EditJournal::recover( const char *fileName, Aircraft *aircraft,
+                           std::string *aircraftFile )
+{
+    const std::string fileJournal  = fileName;
+    const std::string fileSnapshot = fileJournal + ".snapshot";
+
+    std::string aircraftFileTemp;
+    uint64_t sequence = 0;
+
+    // crash might have happened after removing snapshot and before renaming the new one
+    if ( !readSnapshot( fileSnapshot, aircraft, &sequence, &aircraftFileTemp )
+      && !readSnapshot( fileSnapshot + ".tmp", aircraft, &sequence, &aircraftFileTemp ) )
+    {
+        return false;
+    }
+
+    if ( aircraftFile ) *aircraftFile = aircraftFileTemp;
+
+    // records must follow one another, replaying stops at the first gap
+    uint64_t expected = sequence + 1;
+    bool valid = true;
+
+    const std::string files[] = { fileJournal + ".old", fileJournal };
+
+    for ( const std::string &file : files )
+    {
+        std::ifstream fs( file.c_str(), std::ios_base::in | std::ios_base::binary );
+
+        if ( !fs.is_open() || !readHeader( fs ) ) continue;
+
+        uint64_t recordSequence = 0;
+        uint32_t type = 0;
+        std::string body;
+
+        while ( valid && readRecord( fs, &recordSequence, &type, &body ) )
+        {
+            if ( recordSequence < expected ) continue;
+
+            valid = recordSequence == expected && applyRecord( type, body, aircraft );
+
+            if ( valid ) ++expected;
+        }
+    }
+
+    aircraft->update();
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::remove( const char *fileName )
+{
+    const std::string fileJournal = fileName;
+
+    std::remove( fileJournal.c_str() );
+    std::remove( ( fileJournal + ".old"          ).c_str() );
+    std::remove( ( fileJournal + ".snapshot"     ).c_str() );
+    std::remove( ( fileJournal + ".snapshot.tmp" ).c_str() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+EditJournal::EditJournal() :
+    _lock ( nullptr ),
+    _size ( 0 ),
+    _compactionSize ( 1 << 20 ),
+    _sequence ( 0 ),
+    _done ( true ),
+    _compacted ( true )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+EditJournal::~EditJournal()
+{
+    close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool EditJournal::open( const char *fileName, const Aircraft &aircraft,
+                        const char *aircraftFile )
+{
+    close();
+
+    _lock = new QLockFile( QString::fromLocal8Bit( fileName ) + ".lock" );
+    _lock->setStaleLockTime( 0 );
+
+    if ( !_lock->tryLock( 0 ) )
+    {
+        DELPTR( _lock );
+        return false;
+    }
+
+    remove( fileName );
+
+    _fileName = fileName;
+    _aircraftFile = aircraftFile;
+
+    _sequence = 0;
+    _snapshot.reset();
+
+    _values.resize( AircraftDataFields::getCount() );
+
+    for ( int i = 0; i < AircraftDataFields::getCount(); ++i )
+    {
+        _values[ i ] = AircraftDataFields::getValue( *aircraft.getData(), i );
+    }
+
+    if ( !openJournal() ) return false;
+
+    compact( aircraft );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::close()
+{
+    wait();
+
+    if ( _fs.is_open() ) _fs.close();
+
+    DELPTR( _lock );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::dataChanged( const Aircraft &aircraft, int index )
+{
+    if ( index < 0 || index >= static_cast< int >( _values.size() ) ) return;
+
+    const double value = AircraftDataFields::getValue( *aircraft.getData(), index );
+
+    if ( value == _values[ index ] ) return;
+
+    _values[ index ] = value;
+
+    std::ostringstream ss;
+
+    BinaryUtils::write( ss, static_cast< uint32_t >( index ) );
+    BinaryUtils::write( ss, value );
+
+    append( RecordField, ss.str(), aircraft );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::componentAdded( const Aircraft &aircraft )
+{
+    if ( aircraft.getComponents().empty() ) return;
+
+    std::ostringstream ss;
+
+    writeComponent( ss, aircraft.getComponents().back()->getComponentData() );
+
+    append( RecordAdd, ss.str(), aircraft );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::componentChanged( const Aircraft &aircraft, int index )
+{
+    if ( index < 0 || index >= static_cast< int >( aircraft.getComponents().size() ) ) return;
+
+    std::ostringstream ss;
+
+    BinaryUtils::write( ss, static_cast< uint32_t >( index ) );
+    writeComponent( ss, aircraft.getComponents()[ index ]->getComponentData() );
+
+    append( RecordSet, ss.str(), aircraft );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::componentRemoved( const Aircraft &aircraft, int index )
+{
+    std::ostringstream ss;
+
+    BinaryUtils::write( ss, static_cast< uint32_t >( index ) );
+
+    append( RecordRemove, ss.str(), aircraft );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool EditJournal::wait()
+{
+    if ( _thread.joinable() ) _thread.join();
+
+    return _compacted;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool EditJournal::openJournal()
+{
+    _fs.open( _fileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+
+    if ( !_fs.is_open() ) return false;
+
+    writeHeader( _fs );
+    _fs.flush();
+
+    _size = 2 * sizeof( uint32_t );
+
+    return _fs.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::append( uint32_t type, const std::string &body, const Aircraft &aircraft )
+{
+    if ( !_fs.is_open() ) return;
+
+    finishCompaction();
+
+    // flushed at once, so record survives application crash
+    _size += writeRecord( _fs, ++_sequence, type, body );
+    _fs.flush();
+
+    if ( _size >= _compactionSize && !_thread.joinable() ) compact( aircraft );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::compact( const Aircraft &aircraft )
+{
+    const std::string fileOld = _fileName + ".old";
+
+    // journal is moved aside unless previous compaction failed, in which case
+    // moved journal is still needed and records are kept in the current one
+    if ( !std::ifstream( fileOld.c_str() ).is_open() )
+    {
+        _fs.close();
+
+        if ( 0 == std::rename( _fileName.c_str(), fileOld.c_str() ) )
+        {
+            openJournal();
+        }
+        else
+        {
+            _fs.open( _fileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::app );
+        }
+    }
+
+    _snapshot = AircraftSnapshot::create( aircraft, _sequence, _snapshot.get() );
+
+    AircraftSnapshot::Pointer snapshot = _snapshot;
+    std::string fileName = _fileName;
+    std::string aircraftFile = _aircraftFile;
+
+    _done = false;
+
+    _thread = std::thread( [ this, snapshot, fileName, fileOld, aircraftFile ]()
+    {
+        _compacted = writeSnapshot( fileName, *snapshot, aircraftFile );
+
+        if ( _compacted ) std::remove( fileOld.c_str() );
+
+        _done = true;
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EditJournal::finishCompaction()
+{
+    if ( _thread.joinable() && _done ) _thread.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,195 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef JOURNAL_EDITJOURNAL_H_
+#define JOURNAL_EDITJOURNAL_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <QLockFile>
+
+#include <Aircraft.h>
+
+#include <snapshot/AircraftSnapshot.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The append-only aircraft edits journal class.
+ *
+ * Every edit of aircraft data or components is appended to the journal
+ * file as a small checksummed record and flushed at once, so a crash loses
+ * no more than the edit being made. When the journal grows over compaction
+ * size it is moved aside and snapshot of the whole aircraft state is written
+ * on a background thread, after which the moved journal is removed, so the
+ * editing thread never writes the whole aircraft.
+ *
+ * Records are numbered. Snapshot holds number of the last record it
+ * includes, so state is recovered from the snapshot and records of the
+ * moved and current journal following it, up to the first incomplete or
+ * corrupted one. Snapshot keeps assemblies, components added after it
+ * belong to the root assembly.
+ *
+ * Open journal is locked, so every application instance has to use its own
+ * journal file and journal left by an instance which is still running is
+ * not taken for the one left by a crash.
+ *
+ * Files used are: journal file, journal file with ".old" suffix, journal
+ * file with ".snapshot" suffix and journal file with ".lock" suffix.
+ */
+class EditJournal
+{
+public:
+
+    /**
+     * @brief Checks if there is journal left by the previous session.
+     * @param fileName journal file name
+     * @return true if there is journal snapshot
+     */
+    static bool exists( const char *fileName );
+
+    /**
+     * @brief Checks if there is journal left by the instance which is no
+     * longer running, i.e. journal which can be recovered.
+     * @param fileName journal file name
+     * @return true if there is journal snapshot and journal is not locked
+     */
+    static bool isOrphaned( const char *fileName );
+
+    /**
+     * @brief Recovers aircraft state from the journal snapshot and records.
+     * @param fileName journal file name
+     * @param aircraft output aircraft
+     * @param aircraftFile output aircraft file name, may be null
+     * @return returns true on success and false if there is no valid snapshot
+     */
+    static bool recover( const char *fileName, Aircraft *aircraft,
+                         std::string *aircraftFile = nullptr );
+
+    /**
+     * @brief Removes journal files.
+     * @param fileName journal file name
+     */
+    static void remove( const char *fileName );
+
+    /** @brief Constructor. */
+    EditJournal();
+
+    /** @brief Destructor. Waits for compaction and closes journal. */
+    virtual ~EditJournal();
+
+    /**
+     * @brief Starts new journal of the aircraft, replaces previous journal
+     * files. Snapshot of the current state is written in the background.
+     * @param fileName journal file name
+     * @param aircraft aircraft
+     * @param aircraftFile aircraft file name, empty if not saved yet
+     * @return returns true on success and false on failure, e.g. if journal
+     * is locked by another instance
+     */
+    bool open( const char *fileName, const Aircraft &aircraft,
+               const char *aircraftFile );
+
+    /** @brief Waits for compaction and closes journal, files are kept and unlocked. */
+    void close();
+
+    inline bool isOpen() const { return _fs.is_open(); }
+
+    /**
+     * @brief Records aircraft data field change. Nothing is recorded if value
+     * is the same as the last recorded one.
+     * @param aircraft edited aircraft
+     * @param index field index, see AircraftDataFields
+     */
+    void dataChanged( const Aircraft &aircraft, int index );
+
+    /**
+     * @brief Records addition of the last aircraft component.
+     * @param aircraft edited aircraft
+     */
+    void componentAdded( const Aircraft &aircraft );
+
+    /**
+     * @brief Records component parameters change.
+     * @param aircraft edited aircraft
+     * @param index component index
+     */
+    void componentChanged( const Aircraft &aircraft, int index );
+
+    /**
+     * @brief Records component removal.
+     * @param aircraft edited aircraft
+     * @param index index of the removed component
+     */
+    void componentRemoved( const Aircraft &aircraft, int index );
+
+    /**
+     * @brief Sets journal size after which it is compacted.
+     * @param size [bytes] compaction size
+     */
+    inline void setCompactionSize( uint64_t size ) { _compactionSize = size; }
+
+    /**
+     * @brief Waits for running compaction.
+     * @return returns false if compaction failed
+     */
+    bool wait();
+
+private:
+
+    std::string _fileName;              ///< journal file name
+    std::string _aircraftFile;          ///< aircraft file name
+
+    QLockFile *_lock;                   ///< journal lock, held while journal is open
+
+    std::ofstream _fs;                  ///< journal file stream
+    uint64_t _size;                     ///< [bytes] journal file size
+    uint64_t _compactionSize;           ///< [bytes] journal size after which it is compacted
+
+    uint64_t _sequence;                 ///< number of the last record
+
+    std::vector< double > _values;      ///< last recorded aircraft data fields values
+
+    AircraftSnapshot::Pointer _snapshot;    ///< last snapshot, unchanged parts are shared with the next one
+
+    std::thread _thread;                ///< compaction thread
+    std::atomic< bool > _done;          ///< specifies if compaction thread has finished
+    bool _compacted;                    ///< specifies if last compaction succeeded
+
+    bool openJournal();
+    void append( uint32_t type, const std::string &body, const Aircraft &aircraft );
+
+    void compact( const Aircraft &aircraft );
+    void finishCompaction();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // JOURNAL_EDITJOURNAL_H_
@@ -0,0 +1,5 @@
+HEADERS += \
+    $$PWD/EditJournal.h
+
+SOURCES += \
+    $$PWD/EditJournal.cpp
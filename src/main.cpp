@@ -21,6 +21,7 @@
 
 #include <defs.h>
 
+#include <cli/CommandLine.h>
 #include <gui/MainWindow.h>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +30,11 @@ int main(int argc, char *argv[])
 {
     setlocale( LC_ALL, "C" );
 
+    if ( mc::CommandLine::isBatchMode( argc, argv ) )
+    {
+        return mc::CommandLine::run( argc, argv );
+    }
+
     QLocale::setDefault( QLocale::system() );
 
     QApplication *app = new QApplication( argc, argv );
@@ -40,6 +46,13 @@ int main(int argc, char *argv[])
 
     mc::MainWindow *win = new mc::MainWindow();
     win->show();
+
+    const char *shm = mc::CommandLine::getOption( argc, argv, "--shm" );
+
+    if ( shm )
+    {
+        win->setSharedMemory( shm );
+    }
     
     int result = app->exec();
 
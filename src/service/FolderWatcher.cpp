@@ -0,0 +1,453 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <service/FolderWatcher.h>
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSaveFile>
+
+#include <DataFile.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+FolderWatcher::FolderWatcher( QObject *parent ) :
+    QObject ( parent ),
+
+    _watcher ( Q_NULLPTR ),
+    _timer   ( Q_NULLPTR ),
+    _server  ( Q_NULLPTR ),
+
+    _database ( Q_NULLPTR ),
+    _cache    ( Q_NULLPTR )
+{
+    _watcher = new QFileSystemWatcher( this );
+    _timer   = new QTimer( this );
+
+    _timer->setSingleShot( true );
+    _timer->setInterval( 200 );
+
+    connect( _watcher, SIGNAL(fileChanged(QString))      , this, SLOT(watcher_fileChanged(QString))      );
+    connect( _watcher, SIGNAL(directoryChanged(QString)) , this, SLOT(watcher_directoryChanged(QString)) );
+
+    connect( _timer, SIGNAL(timeout()), this, SLOT(timer_timeout()) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+FolderWatcher::~FolderWatcher() {}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FolderWatcher::addDirectory( const QString &path )
+{
+    QFileInfo fileInfo( path );
+
+    if ( !fileInfo.isDir() ) return false;
+
+    scanDirectory( fileInfo.absoluteFilePath() );
+
+    QDirIterator it( fileInfo.absoluteFilePath(), QDir::Dirs | QDir::NoDotAndDotDot,
+                     QDirIterator::Subdirectories );
+
+    while ( it.hasNext() )
+    {
+        scanDirectory( it.next() );
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::evaluateAll()
+{
+    for ( Files::iterator it = _files.begin(); it != _files.end(); ++it )
+    {
+        _pending.insert( it.key() );
+    }
+
+    _timer->stop();
+    timer_timeout();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::setOutputFile( const QString &fileName )
+{
+    _outputFile = fileName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FolderWatcher::setOutputSocket( const QString &name )
+{
+    if ( _server == Q_NULLPTR )
+    {
+        _server = new QLocalServer( this );
+
+        connect( _server, SIGNAL(newConnection()), this, SLOT(server_newConnection()) );
+    }
+
+    QLocalServer::removeServer( name );
+
+    return _server->listen( name );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::setDatabase( FleetDatabase *database )
+{
+    _database = database;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::setCache( ResultCache *cache )
+{
+    _cache = cache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::setDelay( int delay )
+{
+    _timer->setInterval( delay );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+QJsonObject FolderWatcher::toJson( const ResultCache::Result &result )
+{
+    // the same layout as Aircraft::toJson()
+    QJsonObject json;
+
+    json[ "type"       ] = result.type;
+    json[ "mass_empty" ] = result.massTotal;
+
+    QJsonArray cm;
+    cm.append( result.centerOfMass.x() );
+    cm.append( result.centerOfMass.y() );
+    cm.append( result.centerOfMass.z() );
+    json[ "center_of_mass" ] = cm;
+
+    QJsonArray inertia;
+    inertia.append( result.inertiaMatrix.xx() );
+    inertia.append( result.inertiaMatrix.xy() );
+    inertia.append( result.inertiaMatrix.xz() );
+    inertia.append( result.inertiaMatrix.yx() );
+    inertia.append( result.inertiaMatrix.yy() );
+    inertia.append( result.inertiaMatrix.yz() );
+    inertia.append( result.inertiaMatrix.zx() );
+    inertia.append( result.inertiaMatrix.zy() );
+    inertia.append( result.inertiaMatrix.zz() );
+    json[ "inertia" ] = inertia;
+
+    QJsonArray components;
+
+    for ( const ResultCache::ComponentResult &component : result.components )
+    {
+        QJsonObject item;
+
+        item[ "type"     ] = component.type.c_str();
+        item[ "name"     ] = component.name.c_str();
+        item[ "mass"     ] = component.mass;
+        item[ "mass_est" ] = component.massEst;
+
+        components.append( item );
+    }
+
+    json[ "components" ] = components;
+
+    return json;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::scanDirectory( const QString &path )
+{
+    if ( !_watcher->directories().contains( path ) )
+    {
+        _watcher->addPath( path );
+    }
+
+    QDir dir( path );
+
+    QStringList names = dir.entryList( QStringList() << "*.xml", QDir::Files );
+
+    for ( QStringList::iterator it = names.begin(); it != names.end(); ++it )
+    {
+        QString fileName = dir.absoluteFilePath( *it );
+
+        if ( !_files.contains( fileName ) )
+        {
+            _files.insert( fileName, FileState() );
+            _watcher->addPath( fileName );
+            schedule( fileName );
+        }
+    }
+
+    // files removed from the directory
+    for ( Files::iterator it = _files.begin(); it != _files.end(); ++it )
+    {
+        if ( QFileInfo( it.key() ).absolutePath() == path && !QFileInfo::exists( it.key() ) )
+        {
+            schedule( it.key() );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::schedule( const QString &fileName )
+{
+    _pending.insert( fileName );
+    _timer->start();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FolderWatcher::evaluate( const QString &fileName, QJsonObject *result )
+{
+    QFileInfo fileInfo( fileName );
+
+    if ( !fileInfo.exists() )
+    {
+        _files.remove( fileName );
+        _results.remove( fileName );
+
+        if ( _database ) _database->remove( fileName.toLocal8Bit().data() );
+
+        (*result)[ "file"    ] = fileName;
+        (*result)[ "removed" ] = true;
+
+        return true;
+    }
+
+    FileState &state = _files[ fileName ];
+
+    // editors often emit several notifications for a single save
+    if ( state.modified == fileInfo.lastModified() && state.size == fileInfo.size()
+      && _results.contains( fileName ) )
+    {
+        return false;
+    }
+
+    state.modified = fileInfo.lastModified();
+    state.size     = fileInfo.size();
+
+    // files replaced on save (written to temporary file and renamed) are
+    // dropped by the watcher
+    if ( !_watcher->files().contains( fileName ) )
+    {
+        _watcher->addPath( fileName );
+    }
+
+    ResultCache::Result cached;
+
+    DataFile dataFile;
+
+    if ( _cache )
+    {
+        if ( _cache->readFile( fileName.toLocal8Bit().data(), &cached ) )
+        {
+            *result = toJson( cached );
+
+            // database parses the file only if it has been modified since ingested
+            if ( _database ) _database->ingestFile( fileName.toLocal8Bit().data() );
+        }
+        else
+        {
+            (*result)[ "error" ] = QString( "Cannot read file." );
+        }
+    }
+    else if ( dataFile.readFile( fileName.toLocal8Bit().data() ) )
+    {
+        *result = dataFile.getAircraft()->toJson();
+
+        if ( _database ) _database->insert( fileName.toLocal8Bit().data(), *dataFile.getAircraft() );
+    }
+    else
+    {
+        (*result)[ "error" ] = QString( "Cannot read file." );
+    }
+
+    (*result)[ "file" ] = fileName;
+
+    _results[ fileName ] = *result;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::publish( const QList< QJsonObject > &results )
+{
+    // nothing has changed, e.g. repeated notifications of already evaluated
+    // save, output file is still written once, even for an empty directory
+    if ( results.isEmpty() && QFileInfo::exists( _outputFile ) )
+    {
+        return;
+    }
+
+    if ( _outputFile.length() > 0 )
+    {
+        saveOutputFile();
+    }
+
+    for ( QList< QJsonObject >::const_iterator it = results.begin(); it != results.end(); ++it )
+    {
+        QByteArray line = QJsonDocument( *it ).toJson( QJsonDocument::Compact ) + "\n";
+
+        for ( Clients::iterator ic = _clients.begin(); ic != _clients.end(); ++ic )
+        {
+            (*ic)->write( line );
+        }
+    }
+
+    if ( _database && results.size() > 0 )
+    {
+        _database->save();
+    }
+
+    if ( _cache && results.size() > 0 )
+    {
+        _cache->save();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::saveOutputFile()
+{
+    QJsonArray aircraft;
+
+    for ( Results::iterator it = _results.begin(); it != _results.end(); ++it )
+    {
+        aircraft.append( it.value() );
+    }
+
+    QJsonObject root;
+    root[ "aircraft" ] = aircraft;
+
+    // readers never see partially written file
+    QSaveFile file( _outputFile );
+
+    if ( file.open( QIODevice::WriteOnly ) )
+    {
+        file.write( QJsonDocument( root ).toJson() );
+        file.commit();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::watcher_fileChanged( const QString &path )
+{
+    schedule( path );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::watcher_directoryChanged( const QString &path )
+{
+    if ( QFileInfo( path ).isDir() )
+    {
+        addDirectory( path );
+    }
+    else
+    {
+        _watcher->removePath( path );
+
+        for ( Files::iterator it = _files.begin(); it != _files.end(); ++it )
+        {
+            if ( it.key().startsWith( path + "/" ) )
+            {
+                schedule( it.key() );
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::timer_timeout()
+{
+    QList< QJsonObject > results;
+
+    QSet< QString > pending = _pending;
+    _pending.clear();
+
+    for ( QSet< QString >::iterator it = pending.begin(); it != pending.end(); ++it )
+    {
+        QJsonObject result;
+
+        if ( evaluate( *it, &result ) )
+        {
+            results.push_back( result );
+        }
+    }
+
+    publish( results );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::server_newConnection()
+{
+    while ( _server->hasPendingConnections() )
+    {
+        QLocalSocket *client = _server->nextPendingConnection();
+
+        connect( client, SIGNAL(disconnected()), this, SLOT(client_disconnected()) );
+
+        _clients.push_back( client );
+
+        // new client receives current state first
+        for ( Results::iterator it = _results.begin(); it != _results.end(); ++it )
+        {
+            client->write( QJsonDocument( it.value() ).toJson( QJsonDocument::Compact ) + "\n" );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void FolderWatcher::client_disconnected()
+{
+    QLocalSocket *client = qobject_cast< QLocalSocket* >( sender() );
+
+    if ( client )
+    {
+        _clients.removeAll( client );
+        client->deleteLater();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
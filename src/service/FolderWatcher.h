@@ -0,0 +1,164 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef SERVICE_FOLDERWATCHER_H_
+#define SERVICE_FOLDERWATCHER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QDateTime>
+#include <QFileSystemWatcher>
+#include <QJsonObject>
+#include <QList>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QMap>
+#include <QSet>
+#include <QTimer>
+
+#include <cache/ResultCache.h>
+#include <fleet/FleetDatabase.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The folder watcher class.
+ *
+ * Watches directories of aircraft files and recomputes mass characteristics
+ * of the changed files only. Notifications are collected for a short delay,
+ * so a file saved in several steps is evaluated once. Results are published
+ * to the output file (the whole current state, replaced atomically) and/or
+ * to clients of the local socket (one JSON line per changed file).
+ * Optionally fleet database is kept up to date.
+ */
+class FolderWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /** @brief Constructor. */
+    explicit FolderWatcher( QObject *parent = Q_NULLPTR );
+
+    /** @brief Destructor. */
+    virtual ~FolderWatcher();
+
+    /**
+     * @brief Adds directory and its subdirectories to the watched ones.
+     * @param path directory path
+     * @return returns true on success and false on failure
+     */
+    bool addDirectory( const QString &path );
+
+    /**
+     * @brief Evaluates all watched aircraft files and publishes results.
+     */
+    void evaluateAll();
+
+    /**
+     * @brief Sets output file.
+     * @param fileName output file name
+     */
+    void setOutputFile( const QString &fileName );
+
+    /**
+     * @brief Starts local socket server results are published to.
+     * @param name local socket name
+     * @return returns true on success and false on failure
+     */
+    bool setOutputSocket( const QString &name );
+
+    /**
+     * @brief Sets fleet database to be kept up to date.
+     * @param database fleet database (not owned)
+     */
+    void setDatabase( FleetDatabase *database );
+
+    /**
+     * @brief Sets result cache used to skip evaluation of unchanged files.
+     * @param cache result cache (not owned)
+     */
+    void setCache( ResultCache *cache );
+
+    /**
+     * @brief Sets notifications collecting delay.
+     * @param delay [ms] delay
+     */
+    void setDelay( int delay );
+
+private:
+
+    /**
+     * @brief The aircraft file state struct.
+     */
+    struct FileState
+    {
+        QDateTime modified;     ///< last evaluated file modification time
+        qint64 size = -1;       ///< last evaluated file size
+    };
+
+    typedef QMap< QString, FileState >   Files;
+    typedef QMap< QString, QJsonObject > Results;
+    typedef QList< QLocalSocket* >       Clients;
+
+    QFileSystemWatcher *_watcher;   ///< file system watcher
+    QTimer *_timer;                 ///< notifications collecting timer
+    QLocalServer *_server;          ///< local socket server
+
+    Clients _clients;               ///< local socket clients
+
+    QString _outputFile;            ///< output file name
+
+    FleetDatabase *_database;       ///< fleet database
+    ResultCache   *_cache;          ///< result cache
+
+    Files _files;                   ///< watched aircraft files
+    Results _results;               ///< current results
+    QSet< QString > _pending;       ///< files waiting for evaluation
+
+    static QJsonObject toJson( const ResultCache::Result &result );
+
+    void scanDirectory( const QString &path );
+
+    void schedule( const QString &fileName );
+
+    bool evaluate( const QString &fileName, QJsonObject *result );
+
+    void publish( const QList< QJsonObject > &results );
+
+    void saveOutputFile();
+
+private slots:
+
+    void watcher_fileChanged( const QString &path );
+    void watcher_directoryChanged( const QString &path );
+
+    void timer_timeout();
+
+    void server_newConnection();
+    void client_disconnected();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // SERVICE_FOLDERWATCHER_H_
@@ -0,0 +1,434 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <service/MassService.h>
+
+#include <QJsonDocument>
+
+#include <defs.h>
+
+#include <AircraftDataFields.h>
+#include <DataFile.h>
+
+#include <components/ComponentFactory.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+MassService::MassService( QObject *parent ) :
+    QObject ( parent ),
+
+    _server ( Q_NULLPTR )
+{
+    _server = new QLocalServer( this );
+
+    connect( _server, SIGNAL(newConnection()), this, SLOT(server_newConnection()) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+MassService::~MassService()
+{
+    QStringList models;
+
+    for ( Models::iterator it = _models.begin(); it != _models.end(); ++it )
+    {
+        models.push_back( it.key() );
+    }
+
+    for ( QStringList::iterator it = models.begin(); it != models.end(); ++it )
+    {
+        unload( *it );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool MassService::listen( const QString &name )
+{
+    QLocalServer::removeServer( name );
+
+    return _server->listen( name );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassService::setSharedMemoryPrefix( const QString &prefix )
+{
+    _shmPrefix = prefix;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool MassService::load( const QString &model, const QString &fileName )
+{
+    // data file is kept as read, so assemblies and point masses are kept too
+    DataFile *dataFile = new DataFile();
+
+    if ( !dataFile->readFile( fileName.toLocal8Bit().data() ) )
+    {
+        DELPTR( dataFile );
+        return false;
+    }
+
+    unload( model );
+
+    _models[ model ] = dataFile;
+
+    if ( _shmPrefix.length() > 0 )
+    {
+        SharedMemoryPublisher *publisher = new SharedMemoryPublisher();
+
+        if ( publisher->open( ( _shmPrefix + "." + model ).toLocal8Bit().data() ) )
+        {
+            _publishers[ model ] = publisher;
+        }
+        else
+        {
+            DELPTR( publisher );
+        }
+    }
+
+    publish( model );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+QJsonObject MassService::handle( const QJsonObject &request )
+{
+    QJsonObject response;
+
+    QString cmd = request[ "cmd" ].toString();
+    QString error;
+
+    bool result = false;
+
+    Aircraft *aircraft = Q_NULLPTR;
+
+    if ( cmd == "load" )
+    {
+        result = request[ "model" ].toString().length() > 0
+              && load( request[ "model" ].toString(), request[ "file" ].toString() );
+
+        if ( result )
+            aircraft = _models[ request[ "model" ].toString() ]->getAircraft();
+        else
+            error = "Cannot read file.";
+    }
+    else if ( cmd == "unload" )
+    {
+        aircraft = getModel( request, &error );
+
+        if ( aircraft )
+        {
+            unload( request[ "model" ].toString() );
+            aircraft = Q_NULLPTR;
+            result = true;
+        }
+    }
+    else if ( cmd == "list" )
+    {
+        QJsonArray models;
+
+        for ( Models::iterator it = _models.begin(); it != _models.end(); ++it )
+        {
+            models.append( it.key() );
+        }
+
+        response[ "models" ] = models;
+        result = true;
+    }
+    else if ( cmd == "get" )
+    {
+        aircraft = getModel( request, &error );
+        result = aircraft != Q_NULLPTR;
+    }
+    else if ( cmd == "set" )
+    {
+        aircraft = getModel( request, &error );
+        result = aircraft && setFields( aircraft, request[ "fields" ].toObject(), &error );
+    }
+    else if ( cmd == "set_component" || cmd == "del_component" )
+    {
+        aircraft = getModel( request, &error );
+
+        int index = request[ "index" ].toInt( -1 );
+
+        if ( aircraft && ( index < 0 || index >= static_cast< int >( aircraft->getComponents().size() ) ) )
+        {
+            error = "Invalid component index.";
+        }
+        else if ( aircraft && cmd == "del_component" )
+        {
+            aircraft->delComponent( index );
+            result = true;
+        }
+        else if ( aircraft )
+        {
+            Component *component = aircraft->getComponent( index );
+            ComponentData data = component->getComponentData();
+
+            if ( setComponentData( request, &data, &error ) )
+            {
+                component->setComponentData( data );
+                aircraft->refresh();
+                result = true;
+            }
+        }
+    }
+    else if ( cmd == "add_component" )
+    {
+        aircraft = getModel( request, &error );
+
+        ComponentData data;
+        data.type = request[ "type" ].toString().toStdString();
+
+        if ( aircraft && setComponentData( request, &data, &error ) )
+        {
+            Component *component = ComponentFactory::create( data, aircraft->getData() );
+
+            if ( component )
+            {
+                aircraft->addComponent( component );
+                result = true;
+            }
+            else
+            {
+                error = "Unknown component type.";
+            }
+        }
+    }
+    else
+    {
+        error = "Unknown command.";
+    }
+
+    if ( result && aircraft )
+    {
+        response = aircraft->toJson();
+
+        // loaded model is already published
+        if ( cmd != "get" && cmd != "load" )
+        {
+            publish( request[ "model" ].toString() );
+        }
+    }
+
+    if ( request.contains( "id" ) )
+    {
+        response[ "id" ] = request[ "id" ];
+    }
+
+    response[ "ok" ] = result;
+
+    if ( !result )
+    {
+        response[ "error" ] = error;
+    }
+
+    return response;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassService::publish( const QString &model )
+{
+    Publishers::iterator it = _publishers.find( model );
+
+    if ( it != _publishers.end() )
+    {
+        it.value()->publish( *_models[ model ]->getAircraft() );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassService::unload( const QString &model )
+{
+    if ( _publishers.contains( model ) )
+    {
+        DELPTR( _publishers[ model ] );
+        _publishers.remove( model );
+    }
+
+    if ( _models.contains( model ) )
+    {
+        DELPTR( _models[ model ] );
+        _models.remove( model );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+Aircraft* MassService::getModel( const QJsonObject &request, QString *error )
+{
+    Models::iterator it = _models.find( request[ "model" ].toString() );
+
+    if ( it != _models.end() )
+    {
+        return it.value()->getAircraft();
+    }
+
+    *error = "Unknown model.";
+
+    return Q_NULLPTR;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool MassService::setFields( Aircraft *aircraft, const QJsonObject &fields, QString *error )
+{
+    // all fields are validated before any is changed
+    AircraftData data = *aircraft->getData();
+
+    for ( QJsonObject::const_iterator it = fields.begin(); it != fields.end(); ++it )
+    {
+        int index = AircraftDataFields::getIndex( it.key().toStdString().c_str() );
+
+        // toDouble() would silently turn strings, arrays and nulls into 0
+        bool valid = it.value().isDouble() || it.value().isBool();
+
+        double value = it.value().isBool() ? ( it.value().toBool() ? 1.0 : 0.0 )
+                                           : it.value().toDouble();
+
+        if ( index < 0 || !valid || !AircraftDataFields::setValue( data, index, value ) )
+        {
+            *error = "Invalid field: " + it.key();
+            return false;
+        }
+    }
+
+    aircraft->setData( data );
+    aircraft->update();
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool MassService::setComponentData( const QJsonObject &request, ComponentData *data, QString *error )
+{
+    const char *names[] = { "m", "l", "w", "h" };
+    double *values[] = { &data->m, &data->l, &data->w, &data->h };
+
+    // all members are validated before any is changed
+    for ( int i = 0; i < 4; ++i )
+    {
+        if ( request.contains( names[ i ] ) && !request[ names[ i ] ].isDouble() )
+        {
+            *error = QString( "Invalid field: " ) + names[ i ];
+            return false;
+        }
+    }
+
+    Vector3 r = data->r;
+
+    if ( request.contains( "r" ) )
+    {
+        QJsonArray array = request[ "r" ].toArray();
+
+        if ( array.size() != 3 || !array[ 0 ].isDouble()
+                               || !array[ 1 ].isDouble()
+                               || !array[ 2 ].isDouble() )
+        {
+            *error = "Invalid component position.";
+            return false;
+        }
+
+        r = Vector3( array[ 0 ].toDouble(), array[ 1 ].toDouble(), array[ 2 ].toDouble() );
+    }
+
+    if ( request.contains( "name" ) ) data->name = request[ "name" ].toString().toStdString();
+
+    data->r = r;
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        if ( request.contains( names[ i ] ) ) *values[ i ] = request[ names[ i ] ].toDouble();
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassService::server_newConnection()
+{
+    while ( _server->hasPendingConnections() )
+    {
+        QLocalSocket *client = _server->nextPendingConnection();
+
+        connect( client, SIGNAL(readyRead())    , this, SLOT(client_readyRead())    );
+        connect( client, SIGNAL(disconnected()) , this, SLOT(client_disconnected()) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassService::client_readyRead()
+{
+    QLocalSocket *client = qobject_cast< QLocalSocket* >( sender() );
+
+    if ( !client ) return;
+
+    // pipelined requests are answered in order
+    while ( client->canReadLine() )
+    {
+        QByteArray line = client->readLine();
+
+        QJsonParseError parseError;
+        QJsonDocument doc = QJsonDocument::fromJson( line, &parseError );
+
+        QJsonObject response;
+
+        if ( doc.isObject() )
+        {
+            response = handle( doc.object() );
+        }
+        else
+        {
+            response[ "ok"    ] = false;
+            response[ "error" ] = QString( "Invalid request." );
+        }
+
+        client->write( QJsonDocument( response ).toJson( QJsonDocument::Compact ) + "\n" );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassService::client_disconnected()
+{
+    QLocalSocket *client = qobject_cast< QLocalSocket* >( sender() );
+
+    if ( client )
+    {
+        client->deleteLater();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,140 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef SERVICE_MASSSERVICE_H_
+#define SERVICE_MASSSERVICE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QMap>
+
+#include <Aircraft.h>
+#include <DataFile.h>
+
+#include <service/SharedMemoryPublisher.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The mass properties service class.
+ *
+ * Keeps aircraft models in memory and answers requests of local socket
+ * (Unix domain socket on Linux) clients. Each request and each response is
+ * a single line JSON object. Request "cmd" member selects command, optional
+ * "id" member is copied to the response. Response "ok" member tells if the
+ * request succeeded, otherwise "error" member holds the reason.
+ *
+ * Commands:
+ * - load   {"model","file"}     loads model from the aircraft file
+ * - unload {"model"}            removes model
+ * - list   {}                   returns names of loaded models
+ * - get    {"model"}            returns mass, cg, inertia and components masses
+ * - set    {"model","fields"}   sets aircraft data fields, e.g. {"wing.area":16.2}
+ * - set_component {"model","index",...}  modifies component
+ * - add_component {"model","type",...}   adds component
+ * - del_component {"model","index"}      removes component
+ *
+ * Component members are "name", "r" [x,y,z], "m", "l", "w" and "h".
+ * Commands modifying model respond with results, just as "get" does.
+ *
+ * Optionally results of every model are published to the shared memory
+ * segment named after the model, e.g. "/mc-mass.c172".
+ */
+class MassService : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /** @brief Constructor. */
+    explicit MassService( QObject *parent = Q_NULLPTR );
+
+    /** @brief Destructor. */
+    virtual ~MassService();
+
+    /**
+     * @brief Starts listening.
+     * @param name local socket name or path
+     * @return returns true on success and false on failure
+     */
+    bool listen( const QString &name );
+
+    /**
+     * @brief Sets shared memory segments name prefix, results are published
+     * to shared memory if prefix is not empty.
+     * @param prefix segments name prefix, e.g. "/mc-mass"
+     */
+    void setSharedMemoryPrefix( const QString &prefix );
+
+    /**
+     * @brief Loads model from the aircraft file.
+     * @param model model name
+     * @param fileName aircraft file name
+     * @return returns true on success and false on failure
+     */
+    bool load( const QString &model, const QString &fileName );
+
+    /**
+     * @brief Handles single request.
+     * @param request request
+     * @return response
+     */
+    QJsonObject handle( const QJsonObject &request );
+
+private:
+
+    typedef QMap< QString, DataFile* > Models;
+    typedef QMap< QString, SharedMemoryPublisher* > Publishers;
+
+    QLocalServer *_server;      ///< local socket server
+
+    Models _models;             ///< loaded models data files
+    Publishers _publishers;     ///< models shared memory publishers
+
+    QString _shmPrefix;         ///< shared memory segments name prefix
+
+    void publish( const QString &model );
+
+    void unload( const QString &model );
+
+    Aircraft* getModel( const QJsonObject &request, QString *error );
+
+    bool setFields( Aircraft *aircraft, const QJsonObject &fields, QString *error );
+
+    bool setComponentData( const QJsonObject &request, ComponentData *data, QString *error );
+
+private slots:
+
+    void server_newConnection();
+
+    void client_readyRead();
+    void client_disconnected();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // SERVICE_MASSSERVICE_H_
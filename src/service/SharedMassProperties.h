@@ -0,0 +1,127 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef SERVICE_SHAREDMASSPROPERTIES_H_
+#define SERVICE_SHAREDMASSPROPERTIES_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The shared memory mass properties layout struct.
+ *
+ * Segment is written by a single publisher and read by any number of
+ * processes. Consistency is ensured with a sequence lock: sequence is odd
+ * while data is being written, readers retry if sequence was odd or has
+ * changed while reading. Readers never block the publisher.
+ * This header is self-contained, so it can be used by external readers.
+ * All values are in SI units, inertia is given about the reference point.
+ */
+struct SharedMassProperties
+{
+    static constexpr uint32_t _magic   = 0x534D434D;    ///< "MCMS"
+    static constexpr uint32_t _version = 2;             ///< layout version
+
+    static constexpr int _maxComponents = 64;           ///< maximum number of components
+    static constexpr int _nameLength    = 32;           ///< component name buffer length
+
+    /**
+     * @brief The component data struct.
+     */
+    struct Component
+    {
+        char type[ _nameLength ];   ///< component XML tag name
+        char name[ _nameLength ];   ///< component name (truncated)
+        double r[ 3 ];              ///< [m] position
+        double mass;                ///< [kg] mass
+        double massEst;             ///< [kg] estimated mass
+    };
+
+    /**
+     * @brief The published data struct.
+     */
+    struct Data
+    {
+        uint64_t updates;           ///< number of updates published so far
+
+        double massTotal;           ///< [kg] total mass
+        double centerOfMass[ 3 ];   ///< [m] center of mass position
+        double inertia[ 9 ];        ///< [kg*m^2] inertia (row-major)
+
+        uint32_t componentsCount;   ///< number of valid components
+        uint32_t componentsTotal;   ///< number of aircraft components, greater than componentsCount if truncated
+
+        Component components[ _maxComponents ];     ///< components
+    };
+
+    uint32_t magic;                     ///< has to be equal to _magic
+    uint32_t version;                   ///< has to be equal to _version
+
+    std::atomic< uint32_t > sequence;   ///< sequence lock counter
+
+    uint32_t padding;                   ///< unused
+
+    Data data;                          ///< published data
+
+    /**
+     * @brief Reads consistent snapshot.
+     * @param shm shared memory segment
+     * @param data output data
+     * @param attempts maximum number of attempts
+     * @return returns true on success and false if no consistent snapshot
+     * could be read
+     */
+    static bool read( const SharedMassProperties *shm, Data *data, int attempts = 1000 )
+    {
+        if ( shm->magic != _magic || shm->version != _version ) return false;
+
+        for ( int i = 0; i < attempts; ++i )
+        {
+            uint32_t seq0 = shm->sequence.load( std::memory_order_acquire );
+
+            if ( seq0 & 1 ) continue;
+
+            memcpy( data, &shm->data, sizeof(Data) );
+
+            std::atomic_thread_fence( std::memory_order_acquire );
+
+            uint32_t seq1 = shm->sequence.load( std::memory_order_relaxed );
+
+            if ( seq0 == seq1 ) return true;
+        }
+
+        return false;
+    }
+};
+
+static_assert( std::atomic< uint32_t >::is_always_lock_free,
+               "Lock-free atomics are required for inter-process sequence lock." );
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // SERVICE_SHAREDMASSPROPERTIES_H_
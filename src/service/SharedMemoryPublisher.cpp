@@ -0,0 +1,185 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <service/SharedMemoryPublisher.h>
+
+#ifdef _LINUX_
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+#include <new>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr uint32_t SharedMassProperties::_magic;
+constexpr uint32_t SharedMassProperties::_version;
+constexpr int SharedMassProperties::_maxComponents;
+constexpr int SharedMassProperties::_nameLength;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void copyName( char *dest, const char *src )
+{
+    strncpy( dest, src, SharedMassProperties::_nameLength - 1 );
+    dest[ SharedMassProperties::_nameLength - 1 ] = '\0';
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+SharedMemoryPublisher::SharedMemoryPublisher() :
+    _shm ( nullptr )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+SharedMemoryPublisher::~SharedMemoryPublisher()
+{
+    close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool SharedMemoryPublisher::open( const char *name )
+{
+    close();
+
+#   ifdef _LINUX_
+    int fd = shm_open( name, O_CREAT | O_RDWR, 0644 );
+
+    if ( fd < 0 )
+    {
+        return false;
+    }
+
+    if ( ftruncate( fd, sizeof(SharedMassProperties) ) != 0 )
+    {
+        ::close( fd );
+        shm_unlink( name );
+        return false;
+    }
+
+    void *ptr = mmap( nullptr, sizeof(SharedMassProperties), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0 );
+
+    // mapping stays valid after the descriptor is closed
+    ::close( fd );
+
+    if ( ptr == MAP_FAILED )
+    {
+        shm_unlink( name );
+        return false;
+    }
+
+    memset( ptr, 0, sizeof(SharedMassProperties) );
+
+    _shm = new ( ptr ) SharedMassProperties();
+    _shm->sequence.store( 0, std::memory_order_relaxed );
+
+    _shm->magic   = SharedMassProperties::_magic;
+    _shm->version = SharedMassProperties::_version;
+
+    _name = name;
+
+    return true;
+#   else
+    (void)name;
+    return false;
+#   endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void SharedMemoryPublisher::close()
+{
+#   ifdef _LINUX_
+    if ( _shm )
+    {
+        munmap( _shm, sizeof(SharedMassProperties) );
+        shm_unlink( _name.c_str() );
+    }
+#   endif
+
+    _shm = nullptr;
+    _name.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void SharedMemoryPublisher::publish( const Aircraft &aircraft )
+{
+    if ( !_shm ) return;
+
+    // single writer, sequence is odd while data is being written
+    uint32_t seq = _shm->sequence.load( std::memory_order_relaxed );
+    _shm->sequence.store( seq + 1, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_release );
+
+    SharedMassProperties::Data &data = _shm->data;
+
+    data.updates++;
+
+    data.massTotal = aircraft.getMassTotal();
+
+    data.centerOfMass[ 0 ] = aircraft.getCenterOfMass().x();
+    data.centerOfMass[ 1 ] = aircraft.getCenterOfMass().y();
+    data.centerOfMass[ 2 ] = aircraft.getCenterOfMass().z();
+
+    const Matrix3x3 &i = aircraft.getInertiaMatrix();
+
+    data.inertia[ 0 ] = i.xx(); data.inertia[ 1 ] = i.xy(); data.inertia[ 2 ] = i.xz();
+    data.inertia[ 3 ] = i.yx(); data.inertia[ 4 ] = i.yy(); data.inertia[ 5 ] = i.yz();
+    data.inertia[ 6 ] = i.zx(); data.inertia[ 7 ] = i.zy(); data.inertia[ 8 ] = i.zz();
+
+    uint32_t count = 0;
+
+    for ( const Component *component : aircraft.getComponents() )
+    {
+        if ( count >= SharedMassProperties::_maxComponents ) break;
+
+        SharedMassProperties::Component &item = data.components[ count ];
+
+        copyName( item.type, component->getXmlTagName() );
+        copyName( item.name, component->getName() );
+
+        item.r[ 0 ] = component->getPosition().x();
+        item.r[ 1 ] = component->getPosition().y();
+        item.r[ 2 ] = component->getPosition().z();
+
+        item.mass    = component->getMass();
+        item.massEst = component->getEstimatedMass();
+
+        count++;
+    }
+
+    data.componentsCount = count;
+    data.componentsTotal = static_cast< uint32_t >( aircraft.getComponents().size() );
+
+    _shm->sequence.store( seq + 2, std::memory_order_release );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
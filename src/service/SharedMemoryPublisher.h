@@ -0,0 +1,79 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef SERVICE_SHAREDMEMORYPUBLISHER_H_
+#define SERVICE_SHAREDMEMORYPUBLISHER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+
+#include <Aircraft.h>
+
+#include <service/SharedMassProperties.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The shared memory mass properties publisher class.
+ *
+ * Publishes aircraft results into POSIX shared memory segment, see
+ * SharedMassProperties. Available on Linux only.
+ */
+class SharedMemoryPublisher
+{
+public:
+
+    /** @brief Constructor. */
+    SharedMemoryPublisher();
+
+    /** @brief Destructor. Removes shared memory segment. */
+    virtual ~SharedMemoryPublisher();
+
+    /**
+     * @brief Creates and maps shared memory segment.
+     * @param name segment name, e.g. "/mc-mass"
+     * @return returns true on success and false on failure
+     */
+    bool open( const char *name );
+
+    /** @brief Unmaps and removes shared memory segment. */
+    void close();
+
+    /**
+     * @brief Publishes aircraft results.
+     * @param aircraft already updated aircraft
+     */
+    void publish( const Aircraft &aircraft );
+
+    inline bool isOpen() const { return _shm != nullptr; }
+
+private:
+
+    std::string _name;              ///< segment name
+    SharedMassProperties *_shm;     ///< mapped segment
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // SERVICE_SHAREDMEMORYPUBLISHER_H_
@@ -0,0 +1,10 @@
+HEADERS += \
+    $$PWD/FolderWatcher.h \
+    $$PWD/MassService.h \
+    $$PWD/SharedMassProperties.h \
+    $$PWD/SharedMemoryPublisher.h
+
+SOURCES += \
+    $$PWD/FolderWatcher.cpp \
+    $$PWD/MassService.cpp \
+    $$PWD/SharedMemoryPublisher.cpp
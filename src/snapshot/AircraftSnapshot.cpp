@@ -0,0 +1,248 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <snapshot/AircraftSnapshot.h>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include <components/Assembly.h>
+#include <components/ComponentFactory.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Checks if component state is up to date, without copying component. */
+static bool isSame( const AircraftSnapshot::ComponentState &state,
+                    const Component *component, double estimatedMass )
+{
+    const ComponentData &data = state.data;
+
+    return state.estimatedMass == estimatedMass
+        && data.m == component->getMass()
+        && data.l == component->getLength()
+        && data.w == component->getWidth()
+        && data.h == component->getHeight()
+        && data.r.x() == component->getPosition().x()
+        && data.r.y() == component->getPosition().y()
+        && data.r.z() == component->getPosition().z()
+        && data.type == component->getXmlTagName()
+        && data.name == component->getName();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Appends child assemblies of the assembly, each followed by its own children. */
+static void addAssemblies( const Assembly *assembly, int parent,
+                           const std::unordered_map< const Component*, uint32_t > &indices,
+                           AircraftSnapshot::Assemblies *assemblies )
+{
+    for ( const Assembly *child : assembly->getAssemblies() )
+    {
+        AircraftSnapshot::AssemblyState state;
+
+        state.name   = child->getName();
+        state.origin = child->getOrigin();
+        state.parent = parent;
+
+        state.components.reserve( child->getComponents().size() );
+
+        for ( const Component *component : child->getComponents() )
+        {
+            state.components.push_back( indices.at( component ) );
+        }
+
+        assemblies->push_back( state );
+
+        addAssemblies( child, static_cast< int >( assemblies->size() ) - 1, indices, assemblies );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+AircraftSnapshot::Pointer AircraftSnapshot::create( const Aircraft &aircraft, uint64_t version,
+                                                    const AircraftSnapshot *previous )
+{
+    std::shared_ptr< AircraftSnapshot > snapshot( new AircraftSnapshot() );
+
+    snapshot->_version = version;
+
+    // data
+    const AircraftData *data = aircraft.getData();
+
+    if ( previous && std::equal( data->versions, data->versions + AircraftData::FieldsCount,
+                                 previous->_data->versions ) )
+    {
+        snapshot->_data = previous->_data;
+    }
+    else
+    {
+        snapshot->_data = std::make_shared< const AircraftData >( *data );
+    }
+
+    // components, matched with the previous snapshot ones by identity
+    std::unordered_map< const Component*, size_t > previousIndices;
+
+    if ( previous )
+    {
+        previousIndices.reserve( previous->_sources.size() );
+
+        for ( size_t i = 0; i < previous->_sources.size(); ++i )
+        {
+            previousIndices[ previous->_sources[ i ] ] = i;
+        }
+    }
+
+    const Aircraft::Components &components = aircraft.getComponents();
+
+    snapshot->_components.reserve( components.size() );
+    snapshot->_sources.reserve( components.size() );
+
+    for ( const Component *component : components )
+    {
+        const double estimatedMass = component->getEstimatedMass();
+
+        ComponentPointer state;
+
+        std::unordered_map< const Component*, size_t >::const_iterator it = previousIndices.find( component );
+
+        if ( it != previousIndices.end()
+          && isSame( *previous->_components[ it->second ], component, estimatedMass ) )
+        {
+            state = previous->_components[ it->second ];
+        }
+        else
+        {
+            std::shared_ptr< ComponentState > newState = std::make_shared< ComponentState >();
+
+            newState->data = component->getComponentData();
+            newState->estimatedMass = estimatedMass;
+
+            state = newState;
+        }
+
+        snapshot->_components.push_back( state );
+        snapshot->_sources.push_back( component );
+    }
+
+    // assemblies, components are referred by index
+    if ( !aircraft.getAssembly()->getAssemblies().empty() )
+    {
+        std::unordered_map< const Component*, uint32_t > indices;
+        indices.reserve( components.size() );
+
+        for ( size_t i = 0; i < components.size(); ++i )
+        {
+            indices[ components[ i ] ] = static_cast< uint32_t >( i );
+        }
+
+        addAssemblies( aircraft.getAssembly(), -1, indices, &snapshot->_assemblies );
+    }
+
+    // point masses
+    snapshot->_pointMassesVersion = aircraft.getPointMassesVersion();
+    snapshot->_pointMassesFile = aircraft.getPointMassesFile();
+
+    if ( previous && previous->_pointMassesVersion == snapshot->_pointMassesVersion )
+    {
+        snapshot->_pointMasses = previous->_pointMasses;
+    }
+    else
+    {
+        snapshot->_pointMasses = std::make_shared< const PointMasses >( aircraft.getPointMasses() );
+    }
+
+    // results
+    snapshot->_centerOfMass  = aircraft.getCenterOfMass();
+    snapshot->_inertiaMatrix = aircraft.getInertiaMatrix();
+    snapshot->_massTotal     = aircraft.getMassTotal();
+
+    return snapshot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+AircraftSnapshot::AircraftSnapshot() :
+    _version ( 0 ),
+    _pointMassesVersion ( 0 ),
+    _massTotal ( 0.0 )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool AircraftSnapshot::setAssemblies( const Assemblies &assemblies, Aircraft *aircraft )
+{
+    if ( assemblies.empty() ) return true;
+
+    std::vector< Assembly* > created;
+    created.reserve( assemblies.size() );
+
+    for ( const AssemblyState &state : assemblies )
+    {
+        if ( state.parent >= static_cast< int >( created.size() ) ) return false;
+
+        Assembly *parent = state.parent < 0 ? aircraft->getAssembly() : created[ state.parent ];
+        Assembly *assembly = parent->addAssembly( state.name.c_str(), state.origin );
+
+        for ( uint32_t index : state.components )
+        {
+            if ( index >= aircraft->getComponents().size() ) return false;
+
+            assembly->addComponent( aircraft->getComponent( index ) );
+        }
+
+        created.push_back( assembly );
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void AircraftSnapshot::copyTo( Aircraft *aircraft ) const
+{
+    aircraft->reset();
+    aircraft->setData( *_data );
+
+    if ( _pointMasses->getCount() > 0 )
+    {
+        aircraft->setPointMasses( *_pointMasses, _pointMassesFile.c_str() );
+    }
+
+    Aircraft::Components components;
+    components.reserve( _components.size() );
+
+    for ( const ComponentPointer &state : _components )
+    {
+        components.push_back( ComponentFactory::create( state->data, aircraft->getData() ) );
+    }
+
+    aircraft->addComponents( components );
+
+    setAssemblies( _assemblies, aircraft );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
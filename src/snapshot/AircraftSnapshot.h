@@ -0,0 +1,164 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef SNAPSHOT_AIRCRAFTSNAPSHOT_H_
+#define SNAPSHOT_AIRCRAFTSNAPSHOT_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mcutil/math/Matrix3x3.h>
+#include <mcutil/math/Vector3.h>
+
+#include <Aircraft.h>
+
+#include <components/ComponentData.h>
+#include <components/PointMasses.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The immutable aircraft snapshot class.
+ *
+ * Snapshot holds plain copies of aircraft data, components parameters and
+ * estimated masses, point masses and results taken at once, so everything
+ * read or computed from a snapshot is consistent, and it can be read by any
+ * number of threads while the aircraft itself is being edited.
+ *
+ * Parts which did not change since the previous snapshot are shared with it
+ * instead of being copied (copy-on-write), so publishing a snapshot after
+ * a single edit costs little even for aircraft of many components and
+ * point masses. Aircraft data is shared as long as its fields versions are
+ * the same, so it relies on touching changed fields as estimated masses
+ * caching does.
+ *
+ * Assemblies tree is kept as a flat list, in which parents precede their
+ * children, so it can be written and read back without recursion.
+ */
+class AircraftSnapshot
+{
+public:
+
+    typedef std::shared_ptr< const AircraftSnapshot > Pointer;
+
+    /**
+     * @brief The component state struct.
+     */
+    struct ComponentState
+    {
+        ComponentData data;             ///< component parameters
+        double estimatedMass = 0.0;     ///< [kg] component estimated mass
+    };
+
+    /**
+     * @brief The assembly state struct.
+     */
+    struct AssemblyState
+    {
+        std::string name;                       ///< assembly name
+        Vector3 origin;                         ///< [m] assembly origin
+        int parent = -1;                        ///< parent assembly index, -1 for the root assembly
+        std::vector< uint32_t > components;     ///< indices of the assembly components
+    };
+
+    typedef std::vector< AssemblyState > Assemblies;
+
+    /**
+     * @brief Creates snapshot of the aircraft. Must be called on the thread
+     * editing the aircraft.
+     * @param aircraft aircraft
+     * @param version snapshot version
+     * @param previous previous snapshot of the same aircraft, unchanged parts are shared with it
+     * @return snapshot
+     */
+    static Pointer create( const Aircraft &aircraft, uint64_t version,
+                           const AircraftSnapshot *previous = nullptr );
+
+    /**
+     * @brief Rebuilds assemblies of the aircraft, its components must already
+     * be added to the root assembly.
+     * @param assemblies assemblies list, parents must precede their children
+     * @param aircraft aircraft
+     * @return returns false if assemblies do not match the aircraft components
+     */
+    static bool setAssemblies( const Assemblies &assemblies, Aircraft *aircraft );
+
+    /**
+     * @brief Copies snapshot into the aircraft, e.g. for saving or exporting
+     * with the Aircraft interface.
+     * @param aircraft output aircraft
+     */
+    void copyTo( Aircraft *aircraft ) const;
+
+    inline uint64_t getVersion() const { return _version; }
+
+    inline const AircraftData& getData() const { return *_data; }
+
+    inline size_t getComponentsCount() const { return _components.size(); }
+
+    inline const ComponentState& getComponent( size_t index ) const
+    {
+        return *_components[ index ];
+    }
+
+    inline const Assemblies& getAssemblies() const { return _assemblies; }
+
+    inline const PointMasses& getPointMasses() const { return *_pointMasses; }
+
+    inline const std::string& getPointMassesFile() const { return _pointMassesFile; }
+
+    inline Vector3   getCenterOfMass  () const { return _centerOfMass;  }
+    inline Matrix3x3 getInertiaMatrix () const { return _inertiaMatrix; }
+    inline double    getMassTotal     () const { return _massTotal;     }
+
+private:
+
+    typedef std::shared_ptr< const ComponentState > ComponentPointer;
+
+    uint64_t _version;                                  ///< snapshot version
+
+    std::shared_ptr< const AircraftData > _data;        ///< aircraft data
+
+    std::vector< ComponentPointer > _components;        ///< components states
+    std::vector< const Component* > _sources;           ///< components of the aircraft, only compared, never dereferenced
+
+    Assemblies _assemblies;                             ///< assemblies other than the root one
+
+    std::shared_ptr< const PointMasses > _pointMasses;  ///< CAD/FEM point masses
+    std::string _pointMassesFile;                       ///< CAD/FEM point masses file name
+    uint64_t _pointMassesVersion;                       ///< CAD/FEM point masses version
+
+    Vector3   _centerOfMass;                            ///< [m] center of mass position
+    Matrix3x3 _inertiaMatrix;                           ///< [kg*m^2] inertia
+    double    _massTotal;                               ///< [kg] total mass
+
+    AircraftSnapshot();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // SNAPSHOT_AIRCRAFTSNAPSHOT_H_
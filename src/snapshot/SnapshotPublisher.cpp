@@ -0,0 +1,58 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <snapshot/SnapshotPublisher.h>
+
+#include <atomic>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+SnapshotPublisher::SnapshotPublisher() :
+    _version ( 0 )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+AircraftSnapshot::Pointer SnapshotPublisher::acquire() const
+{
+    return std::atomic_load( &_snapshot );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+AircraftSnapshot::Pointer SnapshotPublisher::publish( const Aircraft &aircraft )
+{
+    std::lock_guard< std::mutex > lock( _publishMutex );
+
+    AircraftSnapshot::Pointer previous = std::atomic_load( &_snapshot );
+    AircraftSnapshot::Pointer snapshot = AircraftSnapshot::create( aircraft, ++_version, previous.get() );
+
+    std::atomic_store( &_snapshot, snapshot );
+
+    return snapshot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,79 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef SNAPSHOT_SNAPSHOTPUBLISHER_H_
+#define SNAPSHOT_SNAPSHOTPUBLISHER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <mutex>
+
+#include <Aircraft.h>
+
+#include <snapshot/AircraftSnapshot.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The aircraft snapshots publisher class.
+ *
+ * Read-copy-update: writer edits its aircraft and publishes a new snapshot
+ * after each edit, readers on any thread take the current snapshot and keep
+ * using it as long as they need. Readers never wait for a snapshot being
+ * created, only for the pointer exchange, and old snapshots are released
+ * when the last reader drops them.
+ */
+class SnapshotPublisher
+{
+public:
+
+    /** @brief Constructor. */
+    SnapshotPublisher();
+
+    /**
+     * @brief Acquires the current snapshot. Can be called on any thread,
+     * acquired snapshot stays valid as long as the reader keeps it.
+     * @return current snapshot, null if nothing has been published yet
+     */
+    AircraftSnapshot::Pointer acquire() const;
+
+    /**
+     * @brief Publishes snapshot of the aircraft. Must be called on the
+     * thread editing the aircraft, publishing is serialized.
+     * @param aircraft aircraft
+     * @return published snapshot
+     */
+    AircraftSnapshot::Pointer publish( const Aircraft &aircraft );
+
+private:
+
+    AircraftSnapshot::Pointer _snapshot;    ///< current snapshot, accessed atomically
+
+    std::mutex _publishMutex;               ///< publishing mutex
+
+    uint64_t _version;                      ///< last published snapshot version
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // SNAPSHOT_SNAPSHOTPUBLISHER_H_
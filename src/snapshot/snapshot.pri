@@ -0,0 +1,7 @@
+HEADERS += \
+    $$PWD/AircraftSnapshot.h \
+    $$PWD/SnapshotPublisher.h
+
+SOURCES += \
+    $$PWD/AircraftSnapshot.cpp \
+    $$PWD/SnapshotPublisher.cpp
@@ -0,0 +1,191 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <utils/BinaryUtils.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+template < typename T >
+static void writeRaw( std::ostream &out, const T &value )
+{
+    out.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template < typename T >
+static bool readRaw( std::istream &in, T *value )
+{
+    in.read( reinterpret_cast< char* >( value ), sizeof( T ) );
+    return in.good();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BinaryUtils::write( std::ostream &out, uint32_t value )
+{
+    writeRaw( out, value );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BinaryUtils::write( std::ostream &out, int64_t value )
+{
+    writeRaw( out, value );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BinaryUtils::write( std::ostream &out, uint64_t value )
+{
+    writeRaw( out, value );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BinaryUtils::write( std::ostream &out, double value )
+{
+    writeRaw( out, value );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BinaryUtils::write( std::ostream &out, const std::string &value )
+{
+    write( out, static_cast< uint32_t >( value.size() ) );
+    out.write( value.data(), value.size() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BinaryUtils::write( std::ostream &out, const Vector3 &value )
+{
+    write( out, value.x() );
+    write( out, value.y() );
+    write( out, value.z() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void BinaryUtils::write( std::ostream &out, const Matrix3x3 &value )
+{
+    write( out, value.xx() );
+    write( out, value.xy() );
+    write( out, value.xz() );
+
+    write( out, value.yx() );
+    write( out, value.yy() );
+    write( out, value.yz() );
+
+    write( out, value.zx() );
+    write( out, value.zy() );
+    write( out, value.zz() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool BinaryUtils::read( std::istream &in, uint32_t *value )
+{
+    return readRaw( in, value );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool BinaryUtils::read( std::istream &in, int64_t *value )
+{
+    return readRaw( in, value );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool BinaryUtils::read( std::istream &in, uint64_t *value )
+{
+    return readRaw( in, value );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool BinaryUtils::read( std::istream &in, double *value )
+{
+    return readRaw( in, value );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool BinaryUtils::read( std::istream &in, std::string *value )
+{
+    uint32_t size = 0;
+
+    if ( read( in, &size ) )
+    {
+        value->resize( size );
+
+        if ( size > 0 )
+        {
+            in.read( &(*value)[ 0 ], size );
+        }
+
+        return in.good();
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool BinaryUtils::read( std::istream &in, Vector3 *value )
+{
+    bool result = true;
+
+    if ( result ) result = read( in, &value->x() );
+    if ( result ) result = read( in, &value->y() );
+    if ( result ) result = read( in, &value->z() );
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool BinaryUtils::read( std::istream &in, Matrix3x3 *value )
+{
+    bool result = true;
+
+    if ( result ) result = read( in, &value->xx() );
+    if ( result ) result = read( in, &value->xy() );
+    if ( result ) result = read( in, &value->xz() );
+
+    if ( result ) result = read( in, &value->yx() );
+    if ( result ) result = read( in, &value->yy() );
+    if ( result ) result = read( in, &value->yz() );
+
+    if ( result ) result = read( in, &value->zx() );
+    if ( result ) result = read( in, &value->zy() );
+    if ( result ) result = read( in, &value->zz() );
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
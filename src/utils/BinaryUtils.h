@@ -0,0 +1,69 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_BINARYUTILS_H_
+#define UTILS_BINARYUTILS_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include <mcutil/math/Matrix3x3.h>
+#include <mcutil/math/Vector3.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The BinaryUtils class.
+ *
+ * Values are written in the host byte order, binary files are not meant
+ * to be exchanged between machines of different endianness.
+ */
+class BinaryUtils
+{
+public:
+
+    static void write( std::ostream &out, uint32_t value );
+    static void write( std::ostream &out, int64_t  value );
+    static void write( std::ostream &out, uint64_t value );
+    static void write( std::ostream &out, double   value );
+
+    static void write( std::ostream &out, const std::string &value );
+    static void write( std::ostream &out, const Vector3     &value );
+    static void write( std::ostream &out, const Matrix3x3   &value );
+
+    static bool read( std::istream &in, uint32_t *value );
+    static bool read( std::istream &in, int64_t  *value );
+    static bool read( std::istream &in, uint64_t *value );
+    static bool read( std::istream &in, double   *value );
+
+    static bool read( std::istream &in, std::string *value );
+    static bool read( std::istream &in, Vector3     *value );
+    static bool read( std::istream &in, Matrix3x3   *value );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_BINARYUTILS_H_
@@ -0,0 +1,125 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_BOUNDEDQUEUE_H_
+#define UTILS_BOUNDEDQUEUE_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The bounded blocking queue class template.
+ *
+ * Producer is blocked while the queue is full, consumer is blocked while
+ * the queue is empty. Closing the queue wakes up everyone: pushing fails
+ * and popping fails once remaining items have been taken.
+ */
+template < typename T >
+class BoundedQueue
+{
+public:
+
+    /**
+     * @brief Constructor.
+     * @param capacity maximum number of queued items
+     */
+    explicit BoundedQueue( size_t capacity ) :
+        _capacity ( capacity > 0 ? capacity : 1 ),
+        _closed ( false )
+    {}
+
+    /**
+     * @brief Pushes item, waits while the queue is full.
+     * @param item item to be pushed
+     * @return returns false if the queue has been closed
+     */
+    bool push( T item )
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+
+        _notFull.wait( lock, [ this ]() { return _closed || _items.size() < _capacity; } );
+
+        if ( _closed ) return false;
+
+        _items.push_back( std::move( item ) );
+        _notEmpty.notify_one();
+
+        return true;
+    }
+
+    /**
+     * @brief Pops item, waits while the queue is empty.
+     * @param item output item
+     * @return returns false if the queue has been closed and is empty
+     */
+    bool pop( T *item )
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+
+        _notEmpty.wait( lock, [ this ]() { return _closed || !_items.empty(); } );
+
+        if ( _items.empty() ) return false;
+
+        *item = std::move( _items.front() );
+        _items.pop_front();
+        _notFull.notify_one();
+
+        return true;
+    }
+
+    /**
+     * @brief Closes the queue.
+     */
+    void close()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        _closed = true;
+
+        _notFull.notify_all();
+        _notEmpty.notify_all();
+    }
+
+private:
+
+    const size_t _capacity;             ///< maximum number of queued items
+
+    std::deque< T > _items;             ///< queued items
+
+    std::mutex _mutex;                  ///< items mutex
+    std::condition_variable _notFull;   ///< signaled when item has been popped
+    std::condition_variable _notEmpty;  ///< signaled when item has been pushed
+
+    bool _closed;                       ///< specifies if the queue has been closed
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_BOUNDEDQUEUE_H_
@@ -0,0 +1,123 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_CONSTEXPRMATH_H_
+#define UTILS_CONSTEXPRMATH_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The compile-time math functions class.
+ *
+ * Functions are meant for computing constants, they are accurate to a few
+ * units in the last place for arguments of reasonable magnitude only.
+ */
+class ConstexprMath
+{
+public:
+
+    static constexpr double ln2    = 0.693147180559945309417232121458176568;   ///< ln(2)
+    static constexpr double ln2_hi = 6.93147180369123816490e-01;               ///< ln(2) high part, exact multiples
+    static constexpr double ln2_lo = 1.90821492927058770002e-10;               ///< ln(2) low part
+
+    /**
+     * @brief Returns exponential function.
+     * @param x argument
+     * @return e^x
+     */
+    static constexpr double exp( double x )
+    {
+        // x = k*ln(2) + r, where |r| <= ln(2)/2
+        int k = static_cast< int >( x / ln2 + ( x < 0.0 ? -0.5 : 0.5 ) );
+        double r = ( x - k * ln2_hi ) - k * ln2_lo;
+
+        double term = 1.0;
+        double sum  = 1.0;
+
+        for ( int n = 1; n < 30; ++n )
+        {
+            term *= r / n;
+            sum  += term;
+        }
+
+        for ( ; k > 0; --k ) sum *= 2.0;
+        for ( ; k < 0; ++k ) sum /= 2.0;
+
+        return sum;
+    }
+
+    /**
+     * @brief Returns natural logarithm.
+     * @param x argument, has to be positive
+     * @return ln(x)
+     */
+    static constexpr double log( double x )
+    {
+        // x = m*2^k, where 0.75 <= m < 1.5
+        int k = 0;
+
+        while ( x >= 1.5  ) { x /= 2.0; ++k; }
+        while ( x <  0.75 ) { x *= 2.0; --k; }
+
+        // ln(m) = 2*atanh(s), where s = (m-1)/(m+1)
+        double s  = ( x - 1.0 ) / ( x + 1.0 );
+        double s2 = s * s;
+
+        double term = s;
+        double sum  = 0.0;
+
+        for ( int n = 1; n < 60; n += 2 )
+        {
+            sum  += term / n;
+            term *= s2;
+        }
+
+        return k * ln2_hi + ( 2.0 * sum + k * ln2_lo );
+    }
+
+    /**
+     * @brief Returns power function, integer exponents are computed exactly
+     * as repeated multiplication.
+     * @param x base, has to be positive unless exponent is integer
+     * @param y exponent
+     * @return x^y
+     */
+    static constexpr double pow( double x, double y )
+    {
+        if ( y == static_cast< int >( y ) && y > -64.0 && y < 64.0 )
+        {
+            int n = static_cast< int >( y < 0.0 ? -y : y );
+            double result = 1.0;
+
+            for ( int i = 0; i < n; ++i ) result *= x;
+
+            return y < 0.0 ? 1.0 / result : result;
+        }
+
+        return exp( y * log( x ) );
+    }
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_CONSTEXPRMATH_H_
@@ -0,0 +1,48 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <utils/FileUtils.h>
+
+#ifdef WIN32
+#   include <windows.h>
+#else
+#   include <cstdio>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool FileUtils::replace( const char *fileFrom, const char *fileTo )
+{
+#   ifdef WIN32
+    // rename() fails on Windows if the destination file exists
+    return 0 != MoveFileExA( fileFrom, fileTo, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH );
+#   else
+    // rename() atomically replaces the destination file on POSIX systems
+    return 0 == std::rename( fileFrom, fileTo );
+#   endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,49 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_FILEUTILS_H_
+#define UTILS_FILEUTILS_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The FileUtils class.
+ */
+class FileUtils
+{
+public:
+
+    /**
+     * @brief Replaces file with the other one, e.g. completely written
+     * temporary file, in a single step. Readers see either the old or the new
+     * file, never a missing or partially written one.
+     * @param fileFrom name of the file replacing the other one
+     * @param fileTo name of the file to be replaced, it does not have to exist
+     * @return returns true on success and false on failure
+     */
+    static bool replace( const char *fileFrom, const char *fileTo );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_FILEUTILS_H_
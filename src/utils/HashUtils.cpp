@@ -0,0 +1,75 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <utils/HashUtils.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr uint64_t HashUtils::_basis;
+constexpr uint64_t HashUtils::_prime;
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t HashUtils::hash( const void *data, size_t size, uint64_t hash )
+{
+    const unsigned char *bytes = static_cast< const unsigned char* >( data );
+
+    for ( size_t i = 0; i < size; ++i )
+    {
+        hash ^= bytes[ i ];
+        hash *= _prime;
+    }
+
+    return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t HashUtils::hash( uint32_t value, uint64_t hash )
+{
+    return HashUtils::hash( &value, sizeof(value), hash );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t HashUtils::hash( double value, uint64_t hash )
+{
+    // -0.0 and 0.0 are the same value
+    if ( value == 0.0 ) value = 0.0;
+
+    return HashUtils::hash( &value, sizeof(value), hash );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t HashUtils::hash( const std::string &value, uint64_t hash )
+{
+    hash = HashUtils::hash( static_cast< uint32_t >( value.size() ), hash );
+
+    return HashUtils::hash( value.data(), value.size(), hash );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
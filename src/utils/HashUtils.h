@@ -0,0 +1,58 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_HASHUTILS_H_
+#define UTILS_HASHUTILS_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The HashUtils class.
+ *
+ * 64-bit FNV-1a hash. Hashes can be chained by passing previous result
+ * as the initial value.
+ */
+class HashUtils
+{
+public:
+
+    static constexpr uint64_t _basis = 0xcbf29ce484222325ULL;   ///< FNV offset basis
+    static constexpr uint64_t _prime = 0x00000100000001b3ULL;   ///< FNV prime
+
+    static uint64_t hash( const void *data, size_t size, uint64_t hash = _basis );
+
+    static uint64_t hash( uint32_t value, uint64_t hash = _basis );
+    static uint64_t hash( double   value, uint64_t hash = _basis );
+
+    static uint64_t hash( const std::string &value, uint64_t hash = _basis );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_HASHUTILS_H_
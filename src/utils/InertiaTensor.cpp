@@ -0,0 +1,73 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <utils/InertiaTensor.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+InertiaTensor::InertiaTensor() :
+    _xx ( 0.0 ),
+    _yy ( 0.0 ),
+    _zz ( 0.0 ),
+    _xy ( 0.0 ),
+    _xz ( 0.0 ),
+    _yz ( 0.0 )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+InertiaTensor::InertiaTensor( double xx, double yy, double zz,
+                              double xy, double xz, double yz ) :
+    _xx ( xx ),
+    _yy ( yy ),
+    _zz ( zz ),
+    _xy ( xy ),
+    _xz ( xz ),
+    _yz ( yz )
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+
+Matrix3x3 InertiaTensor::getMatrix() const
+{
+    Matrix3x3 result;
+
+    result.xx() = _xx;
+    result.xy() = _xy;
+    result.xz() = _xz;
+
+    result.yx() = _xy;
+    result.yy() = _yy;
+    result.yz() = _yz;
+
+    result.zx() = _xz;
+    result.zy() = _yz;
+    result.zz() = _zz;
+
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
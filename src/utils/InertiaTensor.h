@@ -0,0 +1,138 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_INERTIATENSOR_H_
+#define UTILS_INERTIATENSOR_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <mcutil/math/Matrix3x3.h>
+#include <mcutil/math/Vector3.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The symmetric inertia tensor class.
+ *
+ * Stores only 6 independent elements. Products of inertia are stored as
+ * tensor elements, i.e. xy = -sum( m*x*y ), the same as in full matrix
+ * given by Physics::parallelAxisInertia().
+ */
+class InertiaTensor
+{
+public:
+
+    /**
+     * @brief Returns inertia of cuboid about the reference point, which is
+     * cuboid inertia and parallel axis term computed at once.
+     * @param m [kg] mass
+     * @param l [m] length (dimension x-component)
+     * @param w [m] width  (dimension y-component)
+     * @param h [m] height (dimension z-component)
+     * @param r [m] cuboid center position
+     * @return inertia tensor [kg*m^2]
+     */
+    static inline InertiaTensor getCuboid( double m, double l, double w, double h,
+                                           const Vector3 &r )
+    {
+        InertiaTensor result;
+        result.addCuboid( m, l, w, h, r );
+        return result;
+    }
+
+    /** @brief Constructor. */
+    InertiaTensor();
+
+    /** @brief Constructor. */
+    InertiaTensor( double xx, double yy, double zz,
+                   double xy, double xz, double yz );
+
+    /**
+     * @brief Adds inertia of cuboid about the reference point.
+     * @param m [kg] mass
+     * @param l [m] length (dimension x-component)
+     * @param w [m] width  (dimension y-component)
+     * @param h [m] height (dimension z-component)
+     * @param r [m] cuboid center position
+     */
+    inline void addCuboid( double m, double l, double w, double h, const Vector3 &r )
+    {
+        const double k = m / 12.0;
+
+        const double l2 = l * l;
+        const double w2 = w * w;
+        const double h2 = h * h;
+
+        const double mx = m * r.x();
+        const double my = m * r.y();
+        const double mz = m * r.z();
+
+        const double mxx = mx * r.x();
+        const double myy = my * r.y();
+        const double mzz = mz * r.z();
+
+        _xx += k * ( w2 + h2 ) + myy + mzz;
+        _yy += k * ( l2 + h2 ) + mxx + mzz;
+        _zz += k * ( l2 + w2 ) + mxx + myy;
+
+        _xy -= mx * r.y();
+        _xz -= mx * r.z();
+        _yz -= my * r.z();
+    }
+
+    /** @brief Returns full inertia matrix. */
+    Matrix3x3 getMatrix() const;
+
+    inline double xx() const { return _xx; }
+    inline double yy() const { return _yy; }
+    inline double zz() const { return _zz; }
+    inline double xy() const { return _xy; }
+    inline double xz() const { return _xz; }
+    inline double yz() const { return _yz; }
+
+    inline InertiaTensor& operator+= ( const InertiaTensor &tensor )
+    {
+        _xx += tensor._xx; _yy += tensor._yy; _zz += tensor._zz;
+        _xy += tensor._xy; _xz += tensor._xz; _yz += tensor._yz;
+        return *this;
+    }
+
+    inline InertiaTensor operator* ( double value ) const
+    {
+        return InertiaTensor( _xx * value, _yy * value, _zz * value,
+                              _xy * value, _xz * value, _yz * value );
+    }
+
+private:
+
+    double _xx;     ///< xx element
+    double _yy;     ///< yy element
+    double _zz;     ///< zz element
+    double _xy;     ///< xy (and yx) element
+    double _xz;     ///< xz (and zx) element
+    double _yz;     ///< yz (and zy) element
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_INERTIATENSOR_H_
@@ -0,0 +1,379 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <utils/MassKernels.h>
+
+#include <atomic>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#   define MC_MASS_AVX2_GCC
+#   define MC_MASS_TARGET_AVX2 __attribute__(( target( "avx2" ) ))
+#   include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#   define MC_MASS_AVX2_MSVC
+#   define MC_MASS_TARGET_AVX2
+#   include <immintrin.h>
+#   include <intrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr int MassKernels::lanes;
+
+typedef NeumaierSum LaneSums[ MassSums::Count ][ MassKernels::lanes ];
+
+////////////////////////////////////////////////////////////////////////////////
+
+static std::atomic< bool >& getAvx2Enabled()
+{
+    static std::atomic< bool > enabled( MassKernels::isAvx2Supported() );
+    return enabled;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes values added to the sums, operations are the same as in
+ * InertiaTensor::addCuboid() and MassSums::add() and in the same order
+ * as in the AVX2 kernel.
+ */
+template< bool CUBOIDS, bool INERTIA >
+static inline void getValues( const MassKernels::Arrays &a, size_t i, double v[] )
+{
+    const double m = a.m[ i ];
+    const double x = a.x[ i ];
+    const double y = a.y[ i ];
+    const double z = a.z[ i ];
+
+    const double mx = m * x;
+    const double my = m * y;
+    const double mz = m * z;
+
+    const double mxx = mx * x;
+    const double myy = my * y;
+    const double mzz = mz * z;
+
+    v[ MassSums::Mass ] = m;
+
+    v[ MassSums::FirstMomentX ] = mx;
+    v[ MassSums::FirstMomentY ] = my;
+    v[ MassSums::FirstMomentZ ] = mz;
+
+    if ( CUBOIDS )
+    {
+        const double k = m / 12.0;
+
+        const double l2 = a.l[ i ] * a.l[ i ];
+        const double w2 = a.w[ i ] * a.w[ i ];
+        const double h2 = a.h[ i ] * a.h[ i ];
+
+        v[ MassSums::InertiaXX ] = k * ( w2 + h2 ) + myy + mzz;
+        v[ MassSums::InertiaYY ] = k * ( l2 + h2 ) + mxx + mzz;
+        v[ MassSums::InertiaZZ ] = k * ( l2 + w2 ) + mxx + myy;
+    }
+    else
+    {
+        v[ MassSums::InertiaXX ] = myy + mzz;
+        v[ MassSums::InertiaYY ] = mxx + mzz;
+        v[ MassSums::InertiaZZ ] = mxx + myy;
+    }
+
+    v[ MassSums::InertiaXY ] = 0.0 - mx * y;
+    v[ MassSums::InertiaXZ ] = 0.0 - mx * z;
+    v[ MassSums::InertiaYZ ] = 0.0 - my * z;
+
+    if ( INERTIA )
+    {
+        v[ MassSums::InertiaXX ] += a.i_xx[ i ];
+        v[ MassSums::InertiaYY ] += a.i_yy[ i ];
+        v[ MassSums::InertiaZZ ] += a.i_zz[ i ];
+        v[ MassSums::InertiaXY ] += a.i_xy[ i ];
+        v[ MassSums::InertiaXZ ] += a.i_xz[ i ];
+        v[ MassSums::InertiaYZ ] += a.i_yz[ i ];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template< bool CUBOIDS, bool INERTIA >
+static void sumScalar( const MassKernels::Arrays &a, size_t first, size_t begin, size_t last,
+                       LaneSums &sums )
+{
+    double v[ MassSums::Count ];
+
+    for ( size_t i = begin; i < last; ++i )
+    {
+        getValues< CUBOIDS, INERTIA >( a, i, v );
+
+        const size_t lane = ( i - first ) % MassKernels::lanes;
+
+        for ( int j = 0; j < MassSums::Count; ++j ) sums[ j ][ lane ].add( v[ j ] );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(MC_MASS_AVX2_GCC) || defined(MC_MASS_AVX2_MSVC)
+
+/** Neumaier summation step of 4 lanes, the same as NeumaierSum::add(). */
+MC_MASS_TARGET_AVX2
+static inline void addAvx2( __m256d &sum, __m256d &c, __m256d value )
+{
+    const __m256d sign = _mm256_set1_pd( -0.0 );
+
+    const __m256d t = _mm256_add_pd( sum, value );
+
+    const __m256d sumGreater = _mm256_cmp_pd( _mm256_andnot_pd( sign, sum ),
+                                              _mm256_andnot_pd( sign, value ), _CMP_GE_OQ );
+
+    const __m256d c_sum   = _mm256_add_pd( _mm256_sub_pd( sum, t ), value );
+    const __m256d c_value = _mm256_add_pd( _mm256_sub_pd( value, t ), sum );
+
+    c   = _mm256_add_pd( c, _mm256_blendv_pd( c_value, c_sum, sumGreater ) );
+    sum = t;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Sums complete groups of 4 masses, returns index of the first mass left. */
+template< bool CUBOIDS, bool INERTIA >
+MC_MASS_TARGET_AVX2
+static size_t sumAvx2( const MassKernels::Arrays &a, size_t first, size_t last, LaneSums &sums )
+{
+    __m256d s[ MassSums::Count ];
+    __m256d c[ MassSums::Count ];
+
+    for ( int j = 0; j < MassSums::Count; ++j )
+    {
+        s[ j ] = _mm256_setzero_pd();
+        c[ j ] = _mm256_setzero_pd();
+    }
+
+    const __m256d zero   = _mm256_setzero_pd();
+    const __m256d twelve = _mm256_set1_pd( 12.0 );
+
+    size_t i = first;
+
+    for ( ; i + MassKernels::lanes <= last; i += MassKernels::lanes )
+    {
+        const __m256d m = _mm256_loadu_pd( a.m + i );
+        const __m256d x = _mm256_loadu_pd( a.x + i );
+        const __m256d y = _mm256_loadu_pd( a.y + i );
+        const __m256d z = _mm256_loadu_pd( a.z + i );
+
+        const __m256d mx = _mm256_mul_pd( m, x );
+        const __m256d my = _mm256_mul_pd( m, y );
+        const __m256d mz = _mm256_mul_pd( m, z );
+
+        const __m256d mxx = _mm256_mul_pd( mx, x );
+        const __m256d myy = _mm256_mul_pd( my, y );
+        const __m256d mzz = _mm256_mul_pd( mz, z );
+
+        __m256d i_xx = _mm256_add_pd( myy, mzz );
+        __m256d i_yy = _mm256_add_pd( mxx, mzz );
+        __m256d i_zz = _mm256_add_pd( mxx, myy );
+
+        if ( CUBOIDS )
+        {
+            const __m256d k = _mm256_div_pd( m, twelve );
+
+            const __m256d l = _mm256_loadu_pd( a.l + i );
+            const __m256d w = _mm256_loadu_pd( a.w + i );
+            const __m256d h = _mm256_loadu_pd( a.h + i );
+
+            const __m256d l2 = _mm256_mul_pd( l, l );
+            const __m256d w2 = _mm256_mul_pd( w, w );
+            const __m256d h2 = _mm256_mul_pd( h, h );
+
+            i_xx = _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( k, _mm256_add_pd( w2, h2 ) ), myy ), mzz );
+            i_yy = _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( k, _mm256_add_pd( l2, h2 ) ), mxx ), mzz );
+            i_zz = _mm256_add_pd( _mm256_add_pd( _mm256_mul_pd( k, _mm256_add_pd( l2, w2 ) ), mxx ), myy );
+        }
+
+        __m256d i_xy = _mm256_sub_pd( zero, _mm256_mul_pd( mx, y ) );
+        __m256d i_xz = _mm256_sub_pd( zero, _mm256_mul_pd( mx, z ) );
+        __m256d i_yz = _mm256_sub_pd( zero, _mm256_mul_pd( my, z ) );
+
+        if ( INERTIA )
+        {
+            i_xx = _mm256_add_pd( i_xx, _mm256_loadu_pd( a.i_xx + i ) );
+            i_yy = _mm256_add_pd( i_yy, _mm256_loadu_pd( a.i_yy + i ) );
+            i_zz = _mm256_add_pd( i_zz, _mm256_loadu_pd( a.i_zz + i ) );
+            i_xy = _mm256_add_pd( i_xy, _mm256_loadu_pd( a.i_xy + i ) );
+            i_xz = _mm256_add_pd( i_xz, _mm256_loadu_pd( a.i_xz + i ) );
+            i_yz = _mm256_add_pd( i_yz, _mm256_loadu_pd( a.i_yz + i ) );
+        }
+
+        addAvx2( s[ MassSums::Mass         ], c[ MassSums::Mass         ], m    );
+        addAvx2( s[ MassSums::FirstMomentX ], c[ MassSums::FirstMomentX ], mx   );
+        addAvx2( s[ MassSums::FirstMomentY ], c[ MassSums::FirstMomentY ], my   );
+        addAvx2( s[ MassSums::FirstMomentZ ], c[ MassSums::FirstMomentZ ], mz   );
+        addAvx2( s[ MassSums::InertiaXX    ], c[ MassSums::InertiaXX    ], i_xx );
+        addAvx2( s[ MassSums::InertiaYY    ], c[ MassSums::InertiaYY    ], i_yy );
+        addAvx2( s[ MassSums::InertiaZZ    ], c[ MassSums::InertiaZZ    ], i_zz );
+        addAvx2( s[ MassSums::InertiaXY    ], c[ MassSums::InertiaXY    ], i_xy );
+        addAvx2( s[ MassSums::InertiaXZ    ], c[ MassSums::InertiaXZ    ], i_xz );
+        addAvx2( s[ MassSums::InertiaYZ    ], c[ MassSums::InertiaYZ    ], i_yz );
+    }
+
+    double s_lanes[ MassKernels::lanes ];
+    double c_lanes[ MassKernels::lanes ];
+
+    for ( int j = 0; j < MassSums::Count; ++j )
+    {
+        _mm256_storeu_pd( s_lanes, s[ j ] );
+        _mm256_storeu_pd( c_lanes, c[ j ] );
+
+        for ( int lane = 0; lane < MassKernels::lanes; ++lane )
+        {
+            sums[ j ][ lane ] = NeumaierSum( s_lanes[ lane ], c_lanes[ lane ] );
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+template< bool CUBOIDS, bool INERTIA >
+static void sumLanes( const MassKernels::Arrays &a, size_t first, size_t last, LaneSums &sums )
+{
+    size_t begin = first;
+
+#   if defined(MC_MASS_AVX2_GCC) || defined(MC_MASS_AVX2_MSVC)
+    if ( getAvx2Enabled() ) begin = sumAvx2< CUBOIDS, INERTIA >( a, first, last, sums );
+#   endif
+
+    sumScalar< CUBOIDS, INERTIA >( a, first, begin, last, sums );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassKernels::Cuboids::clear()
+{
+    _m.clear();
+    _x.clear();
+    _y.clear();
+    _z.clear();
+    _l.clear();
+    _w.clear();
+    _h.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+MassKernels::Arrays MassKernels::Cuboids::getArrays() const
+{
+    Arrays arrays;
+
+    arrays.m = _m.data();
+    arrays.x = _x.data();
+    arrays.y = _y.data();
+    arrays.z = _z.data();
+    arrays.l = _l.data();
+    arrays.w = _w.data();
+    arrays.h = _h.data();
+
+    return arrays;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassKernels::sum( const Arrays &arrays, size_t first, size_t last, MassSums *sums )
+{
+    if ( first >= last ) return;
+
+    LaneSums laneSums;
+
+    const bool cuboids = arrays.l != nullptr;
+    const bool inertia = arrays.i_xx != nullptr;
+
+    if ( cuboids )
+    {
+        if ( inertia )
+            sumLanes< true, true >( arrays, first, last, laneSums );
+        else
+            sumLanes< true, false >( arrays, first, last, laneSums );
+    }
+    else
+    {
+        if ( inertia )
+            sumLanes< false, true >( arrays, first, last, laneSums );
+        else
+            sumLanes< false, false >( arrays, first, last, laneSums );
+    }
+
+    for ( int j = 0; j < MassSums::Count; ++j )
+    {
+        for ( int lane = 0; lane < lanes; ++lane )
+        {
+            sums->add( static_cast< MassSums::Index >( j ), laneSums[ j ][ lane ] );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool MassKernels::isAvx2Enabled()
+{
+    return getAvx2Enabled();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void MassKernels::setAvx2Enabled( bool enabled )
+{
+    getAvx2Enabled() = enabled && isAvx2Supported();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool MassKernels::isAvx2Supported()
+{
+#   if defined(MC_MASS_AVX2_GCC)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports( "avx2" );
+#   elif defined(MC_MASS_AVX2_MSVC)
+    int info[ 4 ];
+
+    __cpuid( info, 0 );
+    if ( info[ 0 ] < 7 ) return false;
+
+    // AVX and OS support of YMM registers state
+    __cpuid( info, 1 );
+    if ( ( info[ 2 ] & ( 1 << 27 ) ) == 0 || ( info[ 2 ] & ( 1 << 28 ) ) == 0 ) return false;
+    if ( ( _xgetbv( 0 ) & 0x6 ) != 0x6 ) return false;
+
+    __cpuidex( info, 7, 0 );
+    return ( info[ 1 ] & ( 1 << 5 ) ) != 0;
+#   else
+    return false;
+#   endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,145 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_MASSKERNELS_H_
+#define UTILS_MASSKERNELS_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <vector>
+
+#include <mcutil/math/Vector3.h>
+
+#include <utils/MassSums.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The mass characteristics summation kernels class.
+ *
+ * Sums masses given as structure of arrays instead of one Vector3 and
+ * InertiaTensor temporary per mass. Element i is accumulated into the
+ * compensated lane (i - first) % 4 and lanes are added to the output sums
+ * in order, so AVX2 kernel, used if supported by the CPU, and the scalar
+ * kernel give bitwise identical results.
+ */
+class MassKernels
+{
+public:
+
+    static constexpr int lanes = 4;     ///< number of partial sums
+
+    /**
+     * @brief The masses arrays struct. Optional arrays are null if not used.
+     */
+    struct Arrays
+    {
+        const double *m = nullptr;      ///< [kg] masses
+        const double *x = nullptr;      ///< [m] positions x-coordinates
+        const double *y = nullptr;      ///< [m] positions y-coordinates
+        const double *z = nullptr;      ///< [m] positions z-coordinates
+
+        const double *l = nullptr;      ///< [m] cuboids lengths, optional with widths and heights
+        const double *w = nullptr;      ///< [m] cuboids widths
+        const double *h = nullptr;      ///< [m] cuboids heights
+
+        const double *i_xx = nullptr;   ///< [kg*m^2] local inertia xx elements, optional with other elements
+        const double *i_yy = nullptr;   ///< [kg*m^2] local inertia yy elements
+        const double *i_zz = nullptr;   ///< [kg*m^2] local inertia zz elements
+        const double *i_xy = nullptr;   ///< [kg*m^2] local inertia xy elements
+        const double *i_xz = nullptr;   ///< [kg*m^2] local inertia xz elements
+        const double *i_yz = nullptr;   ///< [kg*m^2] local inertia yz elements
+    };
+
+    /**
+     * @brief The cuboids arrays class, gathers cuboids for the kernels.
+     */
+    class Cuboids
+    {
+    public:
+
+        /** @brief Removes all cuboids, keeps allocated memory. */
+        void clear();
+
+        /**
+         * @brief Adds cuboid.
+         * @param m [kg] mass
+         * @param l [m] length (dimension x-component)
+         * @param w [m] width  (dimension y-component)
+         * @param h [m] height (dimension z-component)
+         * @param r [m] cuboid center position
+         */
+        inline void add( double m, double l, double w, double h, const Vector3 &r )
+        {
+            _m.push_back( m );
+            _x.push_back( r.x() );
+            _y.push_back( r.y() );
+            _z.push_back( r.z() );
+            _l.push_back( l );
+            _w.push_back( w );
+            _h.push_back( h );
+        }
+
+        /** @brief Returns cuboids arrays. */
+        Arrays getArrays() const;
+
+        inline size_t getCount() const { return _m.size(); }
+
+    private:
+
+        std::vector< double > _m;       ///< [kg] masses
+        std::vector< double > _x;       ///< [m] positions x-coordinates
+        std::vector< double > _y;       ///< [m] positions y-coordinates
+        std::vector< double > _z;       ///< [m] positions z-coordinates
+        std::vector< double > _l;       ///< [m] lengths
+        std::vector< double > _w;       ///< [m] widths
+        std::vector< double > _h;       ///< [m] heights
+    };
+
+    /**
+     * @brief Adds masses of the given range to the sums.
+     * @param arrays masses arrays
+     * @param first index of the first mass
+     * @param last index past the last mass
+     * @param sums output sums
+     */
+    static void sum( const Arrays &arrays, size_t first, size_t last, MassSums *sums );
+
+    /** @brief Returns true if AVX2 kernel is used. */
+    static bool isAvx2Enabled();
+
+    /**
+     * @brief Enables or disables AVX2 kernel, for tests and benchmarks.
+     * AVX2 kernel cannot be enabled if it is not supported by the CPU.
+     * @param enabled specifies if AVX2 kernel should be used
+     */
+    static void setAvx2Enabled( bool enabled );
+
+    /** @brief Returns true if AVX2 kernel is supported by the CPU and build. */
+    static bool isAvx2Supported();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_MASSKERNELS_H_
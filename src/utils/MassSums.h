@@ -0,0 +1,145 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_MASSSUMS_H_
+#define UTILS_MASSSUMS_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <mcutil/math/Vector3.h>
+
+#include <utils/InertiaTensor.h>
+#include <utils/NeumaierSum.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The compensated mass characteristics sums class.
+ *
+ * Accumulates mass, first moment of mass and inertia tensor about the
+ * reference point of cuboids and point masses.
+ */
+class MassSums
+{
+public:
+
+    /** @brief The sums indices. */
+    enum Index
+    {
+        Mass = 0,           ///< [kg] mass
+        FirstMomentX,       ///< [kg*m] first moment of mass x-component
+        FirstMomentY,       ///< [kg*m] first moment of mass y-component
+        FirstMomentZ,       ///< [kg*m] first moment of mass z-component
+        InertiaXX,          ///< [kg*m^2] inertia xx element
+        InertiaYY,          ///< [kg*m^2] inertia yy element
+        InertiaZZ,          ///< [kg*m^2] inertia zz element
+        InertiaXY,          ///< [kg*m^2] inertia xy element
+        InertiaXZ,          ///< [kg*m^2] inertia xz element
+        InertiaYZ,          ///< [kg*m^2] inertia yz element
+        Count               ///< number of sums
+    };
+
+    /**
+     * @brief Adds cuboid.
+     * @param m [kg] mass
+     * @param l [m] length (dimension x-component)
+     * @param w [m] width  (dimension y-component)
+     * @param h [m] height (dimension z-component)
+     * @param r [m] cuboid center position
+     */
+    inline void add( double m, double l, double w, double h, const Vector3 &r )
+    {
+        add( m, r, InertiaTensor::getCuboid( m, l, w, h, r ) );
+    }
+
+    /**
+     * @brief Adds mass of known inertia.
+     * @param m [kg] mass
+     * @param r [m] center of mass position
+     * @param i [kg*m^2] inertia tensor about the reference point
+     */
+    inline void add( double m, const Vector3 &r, const InertiaTensor &i )
+    {
+        _sums[ Mass ].add( m );
+
+        _sums[ FirstMomentX ].add( m * r.x() );
+        _sums[ FirstMomentY ].add( m * r.y() );
+        _sums[ FirstMomentZ ].add( m * r.z() );
+
+        _sums[ InertiaXX ].add( i.xx() );
+        _sums[ InertiaYY ].add( i.yy() );
+        _sums[ InertiaZZ ].add( i.zz() );
+        _sums[ InertiaXY ].add( i.xy() );
+        _sums[ InertiaXZ ].add( i.xz() );
+        _sums[ InertiaYZ ].add( i.yz() );
+    }
+
+    /**
+     * @brief Adds other sums.
+     * @param sums sums to be added
+     */
+    inline void add( const MassSums &sums )
+    {
+        for ( int i = 0; i < Count; ++i ) _sums[ i ].add( sums._sums[ i ] );
+    }
+
+    /**
+     * @brief Adds partial compensated sum of single quantity.
+     * @param index sum index
+     * @param sum partial sum to be added
+     */
+    inline void add( Index index, const NeumaierSum &sum )
+    {
+        _sums[ index ].add( sum );
+    }
+
+    /** @brief Returns [kg] total mass. */
+    inline double getMass() const { return _sums[ Mass ].getValue(); }
+
+    /** @brief Returns [kg*m] first moment of mass. */
+    inline Vector3 getFirstMoment() const
+    {
+        return Vector3( _sums[ FirstMomentX ].getValue(),
+                        _sums[ FirstMomentY ].getValue(),
+                        _sums[ FirstMomentZ ].getValue() );
+    }
+
+    /** @brief Returns [kg*m^2] inertia tensor about the reference point. */
+    inline InertiaTensor getInertia() const
+    {
+        return InertiaTensor( _sums[ InertiaXX ].getValue(),
+                              _sums[ InertiaYY ].getValue(),
+                              _sums[ InertiaZZ ].getValue(),
+                              _sums[ InertiaXY ].getValue(),
+                              _sums[ InertiaXZ ].getValue(),
+                              _sums[ InertiaYZ ].getValue() );
+    }
+
+private:
+
+    NeumaierSum _sums[ Count ];     ///< compensated sums
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_MASSSUMS_H_
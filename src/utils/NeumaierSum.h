@@ -0,0 +1,102 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_NEUMAIERSUM_H_
+#define UTILS_NEUMAIERSUM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The compensated (Neumaier) summation class.
+ *
+ * Rounding error of each addition is accumulated separately, so the result
+ * is as accurate as if computed with twice the working precision, unless
+ * the sum is badly conditioned. Result depends on the order of additions.
+ *
+ * <h3>Refernces:</h3>
+ * <ul>
+ *   <li>Neumaier A.: Rundungsfehleranalyse einiger Verfahren zur Summation endlicher Summen, 1974</li>
+ * </ul>
+ */
+class NeumaierSum
+{
+public:
+
+    /** @brief Constructor. */
+    NeumaierSum() :
+        _sum ( 0.0 ),
+        _c   ( 0.0 )
+    {}
+
+    /**
+     * @brief Constructor.
+     * @param sum running sum
+     * @param c running compensation
+     */
+    NeumaierSum( double sum, double c ) :
+        _sum ( sum ),
+        _c   ( c )
+    {}
+
+    /**
+     * @brief Adds value.
+     * @param value value to be added
+     */
+    inline void add( double value )
+    {
+        double t = _sum + value;
+
+        if ( fabs( _sum ) >= fabs( value ) )
+            _c += ( _sum - t ) + value;
+        else
+            _c += ( value - t ) + _sum;
+
+        _sum = t;
+    }
+
+    /**
+     * @brief Adds other compensated sum.
+     * @param sum sum to be added
+     */
+    inline void add( const NeumaierSum &sum )
+    {
+        add( sum._sum );
+        _c += sum._c;
+    }
+
+    /** @brief Returns compensated sum. */
+    inline double getValue() const { return _sum + _c; }
+
+private:
+
+    double _sum;    ///< running sum
+    double _c;      ///< running compensation
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_NEUMAIERSUM_H_
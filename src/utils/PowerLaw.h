@@ -0,0 +1,108 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_POWERLAW_H_
+#define UTILS_POWERLAW_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <utility>
+
+#include <utils/ConstexprMath.h>
+#include <utils/Quantity.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief Power law regression formula class.
+ *
+ * Represents empirical formulas of the form y = c * x1^e1 * x2^e2 * ...
+ * where the coefficient c is given for the result and inputs expressed in
+ * particular units (usually pounds, feet, knots, etc.). Unit conversion
+ * factors are folded into the coefficient at compile time, so evaluation
+ * takes quantities stored in SI units without any conversion.
+ *
+ * @tparam RESULT result unit, e.g. Unit::Pound
+ * @tparam INPUTS inputs units, e.g. Unit::Foot, Unit::One
+ */
+template < typename RESULT, typename... INPUTS >
+class PowerLaw
+{
+public:
+
+    static constexpr int inputsCount = sizeof...( INPUTS );
+
+    typedef typename RESULT::Type Result;
+
+    /**
+     * @brief Constructor.
+     * @param coef formula coefficient for RESULT and INPUTS units
+     * @param exponents inputs exponents
+     */
+    constexpr PowerLaw( double coef, const double (&exponents)[ inputsCount ] ) :
+        _coef ( coef * RESULT::factor ),
+        _exps {}
+    {
+        constexpr double factors[] = { INPUTS::factor... };
+
+        for ( int i = 0; i < inputsCount; ++i )
+        {
+            _exps[ i ] = exponents[ i ];
+            _coef *= ConstexprMath::pow( factors[ i ], -exponents[ i ] );
+        }
+    }
+
+    /**
+     * @brief Evaluates formula.
+     * @param inputs formula inputs
+     * @return formula result
+     */
+    Result operator()( const typename INPUTS::Type&... inputs ) const
+    {
+        return evaluate( std::make_index_sequence< inputsCount >(), inputs... );
+    }
+
+    /** @return coefficient for result and inputs in SI units */
+    constexpr double getCoef() const { return _coef; }
+
+private:
+
+    double _coef;                   ///< [SI] coefficient
+    double _exps[ inputsCount ];    ///< [-] inputs exponents
+
+    static constexpr double toSI( double v ) { return v; }
+
+    template < int M, int L, int T >
+    static constexpr double toSI( const Quantity< M, L, T > &q ) { return q.getSI(); }
+
+    template < size_t... I >
+    Result evaluate( std::index_sequence< I... >, const typename INPUTS::Type&... inputs ) const
+    {
+        return Result( ( _coef * ... * std::pow( toSI( inputs ), _exps[ I ] ) ) );
+    }
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_POWERLAW_H_
@@ -0,0 +1,169 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_QUANTITY_H_
+#define UTILS_QUANTITY_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+template < int M, int L, int T > class Quantity;
+
+/**
+ * @brief Physical quantity type of given dimension, dimensionless quantities
+ * collapse to plain double.
+ */
+template < int M, int L, int T >
+using QuantityType = typename std::conditional< M == 0 && L == 0 && T == 0,
+                                                double, Quantity< M, L, T > >::type;
+
+/**
+ * @brief Strongly typed physical quantity class.
+ *
+ * Value is always stored in SI units, dimension is a part of the type so
+ * adding mass to length or passing area where velocity is expected does not
+ * compile.
+ *
+ * @tparam M mass dimension exponent
+ * @tparam L length dimension exponent
+ * @tparam T time dimension exponent
+ */
+template < int M, int L, int T >
+class Quantity
+{
+public:
+
+    /** @brief Constructor. */
+    constexpr Quantity() : _si ( 0.0 ) {}
+
+    /**
+     * @brief Constructor.
+     * @param si value expressed in SI units
+     */
+    explicit constexpr Quantity( double si ) : _si ( si ) {}
+
+    /** @return value expressed in SI units */
+    constexpr double getSI() const { return _si; }
+
+    constexpr Quantity operator+ ( const Quantity &q ) const { return Quantity( _si + q._si ); }
+    constexpr Quantity operator- ( const Quantity &q ) const { return Quantity( _si - q._si ); }
+    constexpr Quantity operator- () const { return Quantity( -_si ); }
+
+    constexpr Quantity operator* ( double v ) const { return Quantity( _si * v ); }
+    constexpr Quantity operator/ ( double v ) const { return Quantity( _si / v ); }
+
+    template < int M2, int L2, int T2 >
+    constexpr QuantityType< M + M2, L + L2, T + T2 > operator* ( const Quantity< M2, L2, T2 > &q ) const
+    {
+        return QuantityType< M + M2, L + L2, T + T2 >( _si * q.getSI() );
+    }
+
+    template < int M2, int L2, int T2 >
+    constexpr QuantityType< M - M2, L - L2, T - T2 > operator/ ( const Quantity< M2, L2, T2 > &q ) const
+    {
+        return QuantityType< M - M2, L - L2, T - T2 >( _si / q.getSI() );
+    }
+
+    constexpr bool operator< ( const Quantity &q ) const { return _si < q._si; }
+    constexpr bool operator> ( const Quantity &q ) const { return _si > q._si; }
+
+private:
+
+    double _si;     ///< [SI] value
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+template < int M, int L, int T >
+constexpr Quantity< M, L, T > operator* ( double v, const Quantity< M, L, T > &q )
+{
+    return q * v;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef Quantity< 1,  0,  0 > Mass;             ///< [kg]
+typedef Quantity< 0,  1,  0 > Length;           ///< [m]
+typedef Quantity< 0,  2,  0 > Area;             ///< [m^2]
+typedef Quantity< 0,  3,  0 > Volume;           ///< [m^3]
+typedef Quantity< 0,  1, -1 > Velocity;         ///< [m/s]
+typedef Quantity< 0,  0, -1 > AngularVelocity;  ///< [rad/s]
+typedef Quantity< 1, -3,  0 > Density;          ///< [kg/m^3]
+typedef Quantity< 1, -1, -2 > Pressure;         ///< [Pa]
+typedef Quantity< 1,  2, -2 > Energy;           ///< [J]
+typedef Quantity< 1,  2, -3 > Power;            ///< [W]
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Units of measure class.
+ *
+ * Each unit defines its quantity type and SI value of one unit, so the
+ * conversion factors are known at compile time.
+ */
+class Unit
+{
+public:
+
+    struct One              { typedef double          Type; static constexpr double factor = 1.0; };
+
+    struct Kilogram         { typedef Mass            Type; static constexpr double factor = 1.0; };
+    struct Pound            { typedef Mass            Type; static constexpr double factor = 0.45359237; };
+
+    struct Meter            { typedef Length          Type; static constexpr double factor = 1.0; };
+    struct Foot             { typedef Length          Type; static constexpr double factor = 0.3048; };
+    struct Inch             { typedef Length          Type; static constexpr double factor = 0.0254; };
+
+    struct SquareFoot       { typedef Area            Type; static constexpr double factor = 0.3048 * 0.3048; };
+    struct CubicFoot        { typedef Volume          Type; static constexpr double factor = 0.3048 * 0.3048 * 0.3048; };
+
+    struct FootPerSecond    { typedef Velocity        Type; static constexpr double factor = 0.3048; };
+    struct Knot             { typedef Velocity        Type; static constexpr double factor = 1852.0 / 3600.0; };
+
+    struct Rpm              { typedef AngularVelocity Type; static constexpr double factor = 2.0 * 3.14159265358979323846 / 60.0; };
+
+    struct PoundPerSquareFoot { typedef Pressure      Type; static constexpr double factor = 0.45359237 * 9.80665 / ( 0.3048 * 0.3048 ); };
+
+    struct Horsepower       { typedef Power           Type; static constexpr double factor = 745.69987158227022; };
+    struct HorsepowerSecond { typedef Energy          Type; static constexpr double factor = 745.69987158227022; };
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Makes quantity from value expressed in the given unit.
+ * @param value value expressed in UNIT
+ * @return quantity
+ */
+template < typename UNIT >
+constexpr typename UNIT::Type makeQuantity( double value )
+{
+    return typename UNIT::Type( value * UNIT::factor );
+}
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_QUANTITY_H_
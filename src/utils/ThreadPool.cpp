@@ -0,0 +1,158 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <utils/ThreadPool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** @brief Pool whose tasks the current thread is running, if any. */
+static thread_local const ThreadPool *tl_current = nullptr;
+
+////////////////////////////////////////////////////////////////////////////////
+
+ThreadPool* ThreadPool::getInstance()
+{
+    static ThreadPool instance( static_cast< int >( std::thread::hardware_concurrency() ) );
+    return &instance;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ThreadPool::ThreadPool( int threads ) :
+    _task ( nullptr ),
+    _next ( 0 ),
+    _count ( 0 ),
+    _busy ( 0 ),
+    _generation ( 0 ),
+    _stop ( false )
+{
+    for ( int i = 1; i < threads; ++i )
+    {
+        _threads.push_back( std::thread( &ThreadPool::worker, this ) );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stop = true;
+    }
+
+    _start.notify_all();
+
+    for ( std::thread &thread : _threads )
+    {
+        thread.join();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ThreadPool::run( int count, const Task &task )
+{
+    if ( count <= 0 ) return;
+
+    // nested run() from within a task of this pool is executed inline,
+    // since all the other threads may be blocked waiting for the outer run
+    if ( _threads.empty() || count == 1 || tl_current == this )
+    {
+        for ( int i = 0; i < count; ++i ) task( i );
+        return;
+    }
+
+    std::lock_guard< std::mutex > runLock( _runMutex );
+
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        _task  = &task;
+        _count = count;
+        _next  = 0;
+        _busy  = static_cast< int >( _threads.size() );
+
+        _generation++;
+    }
+
+    _start.notify_all();
+
+    tl_current = this;
+    work();
+    tl_current = nullptr;
+
+    std::unique_lock< std::mutex > lock( _mutex );
+    _done.wait( lock, [ this ]() { return _busy == 0; } );
+
+    _task = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ThreadPool::work()
+{
+    int index = _next++;
+
+    while ( index < _count )
+    {
+        (*_task)( index );
+        index = _next++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ThreadPool::worker()
+{
+    uint64_t generation = 0;
+
+    tl_current = this;
+
+    while ( true )
+    {
+        {
+            std::unique_lock< std::mutex > lock( _mutex );
+
+            _start.wait( lock, [ this, generation ]() { return _stop || _generation != generation; } );
+
+            if ( _stop ) return;
+
+            generation = _generation;
+        }
+
+        work();
+
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _busy--;
+        }
+
+        _done.notify_all();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
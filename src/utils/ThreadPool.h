@@ -0,0 +1,102 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef UTILS_THREADPOOL_H_
+#define UTILS_THREADPOOL_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The thread pool class.
+ *
+ * Runs indexed tasks on worker threads and the calling thread. Which thread
+ * runs which task is not specified, so tasks should write their results to
+ * separate, index-addressed locations.
+ */
+class ThreadPool
+{
+public:
+
+    typedef std::function< void( int ) > Task;
+
+    /**
+     * @brief Returns shared thread pool (one thread per hardware thread).
+     * @return shared thread pool
+     */
+    static ThreadPool* getInstance();
+
+    /**
+     * @brief Constructor.
+     * @param threads total number of threads including calling thread
+     */
+    explicit ThreadPool( int threads );
+
+    /** @brief Destructor. */
+    virtual ~ThreadPool();
+
+    /**
+     * @brief Runs task for every index from 0 to count-1 and waits until
+     * all are done. When called from within a task of this pool the tasks
+     * are run inline on the calling thread.
+     * @param count number of task indices
+     * @param task task
+     */
+    void run( int count, const Task &task );
+
+    inline int getThreadsCount() const { return static_cast< int >( _threads.size() ) + 1; }
+
+private:
+
+    std::vector< std::thread > _threads;    ///< worker threads
+
+    std::mutex _runMutex;                   ///< serializes run() calls
+    std::mutex _mutex;                      ///< state mutex
+
+    std::condition_variable _start;         ///< signaled when new run starts
+    std::condition_variable _done;          ///< signaled when worker finishes run
+
+    const Task *_task;                      ///< current task
+    std::atomic< int > _next;               ///< next task index
+    int _count;                             ///< number of task indices
+    int _busy;                              ///< number of busy workers
+    uint64_t _generation;                   ///< run counter
+    bool _stop;                             ///< specifies if workers should exit
+
+    void work();
+
+    void worker();
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // UTILS_THREADPOOL_H_
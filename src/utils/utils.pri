@@ -1,9 +1,27 @@
 HEADERS += \
     $$PWD/Atmosphere.h \
+    $$PWD/BinaryUtils.h \
+    $$PWD/BoundedQueue.h \
+    $$PWD/ConstexprMath.h \
     $$PWD/Cuboid.h \
+    $$PWD/FileUtils.h \
+    $$PWD/HashUtils.h \
+    $$PWD/InertiaTensor.h \
+    $$PWD/MassKernels.h \
+    $$PWD/MassSums.h \
+    $$PWD/NeumaierSum.h \
+    $$PWD/PowerLaw.h \
+    $$PWD/Quantity.h \
+    $$PWD/ThreadPool.h \
     $$PWD/XmlUtils.h
 
 SOURCES += \
     $$PWD/Atmosphere.cpp \
+    $$PWD/BinaryUtils.cpp \
     $$PWD/Cuboid.cpp \
+    $$PWD/FileUtils.cpp \
+    $$PWD/HashUtils.cpp \
+    $$PWD/InertiaTensor.cpp \
+    $$PWD/MassKernels.cpp \
+    $$PWD/ThreadPool.cpp \
     $$PWD/XmlUtils.cpp
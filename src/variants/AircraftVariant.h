@@ -0,0 +1,59 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef VARIANTS_AIRCRAFTVARIANT_H_
+#define VARIANTS_AIRCRAFTVARIANT_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <components/ComponentData.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The aircraft variant struct.
+ *
+ * Holds only differences against the base aircraft. Base components are
+ * referred by their indices in the base aircraft components list. Variant
+ * components are base components which are not removed, in the base order,
+ * followed by added components.
+ */
+struct AircraftVariant
+{
+    std::string name;                               ///< variant name
+
+    std::map< int, double > fields;                 ///< aircraft data fields values by field index
+    std::map< int, ComponentData > components;      ///< replaced base components parameters by component index
+    std::set< int > removed;                        ///< removed base components indices
+
+    std::vector< ComponentData > added;             ///< added components
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // VARIANTS_AIRCRAFTVARIANT_H_
@@ -0,0 +1,579 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+
+#include <variants/VariantSet.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+
+#include <AircraftDataFields.h>
+
+#include <components/ComponentFactory.h>
+
+#include <utils/MassKernels.h>
+#include <utils/MassSums.h>
+#include <utils/ThreadPool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** Component type estimation data, estimated mass depends only on type and aircraft data. */
+struct TypeInfo
+{
+    std::string type;                       ///< component XML tag name
+    Component::Dependencies dependencies;   ///< aircraft data fields the estimated mass depends on
+    double estimatedMass = 0.0;             ///< [kg] estimated mass for the base aircraft data
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+void VariantSet::add( const AircraftVariant &variant )
+{
+    _variants.push_back( variant );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void VariantSet::clear()
+{
+    _variants.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool VariantSet::read( const QByteArray &content )
+{
+    clear();
+
+    QDomDocument doc;
+
+    doc.setContent( content, false );
+
+    QDomElement rootNode = doc.documentElement();
+
+    if ( rootNode.tagName() != "mscsim_mass_variants" ) return false;
+
+    QDomElement nodeVariant = rootNode.firstChildElement( "variant" );
+
+    while ( !nodeVariant.isNull() )
+    {
+        AircraftVariant variant;
+
+        if ( !readVariant( &nodeVariant, &variant ) )
+        {
+            clear();
+            return false;
+        }
+
+        _variants.push_back( variant );
+
+        nodeVariant = nodeVariant.nextSiblingElement( "variant" );
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool VariantSet::readFile( const char *fileName )
+{
+    bool status = false;
+
+    clear();
+
+    QFile devFile( fileName );
+
+    if ( devFile.open( QFile::ReadOnly | QFile::Text ) )
+    {
+        status = read( devFile.readAll() );
+
+        devFile.close();
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool VariantSet::saveFile( const char *fileName ) const
+{
+    QString fileTemp = fileName;
+
+    if ( QFileInfo( fileTemp ).suffix() != QString( "xml" ) )
+    {
+        fileTemp += ".xml";
+    }
+
+    QFile devFile( fileTemp );
+
+    if ( devFile.open( QFile::WriteOnly | QFile::Truncate | QFile::Text ) )
+    {
+        QTextStream out;
+        out.setDevice( &devFile );
+        out.setCodec("UTF-8");
+        out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+
+        QDomDocument doc( "mscsim_mass_variants" );
+
+        QDomElement rootNode = doc.createElement( "mscsim_mass_variants" );
+        doc.appendChild( rootNode );
+
+        for ( const AircraftVariant &variant : _variants )
+        {
+            saveVariant( &doc, &rootNode, variant );
+        }
+
+        out << doc.toString();
+
+        devFile.close();
+
+        return true;
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+VariantSet::Results VariantSet::evaluate( const Aircraft &base ) const
+{
+    const Aircraft::Components &components = base.getComponents();
+
+    // base sums, computed once for all variants
+    MassSums baseSums;
+
+    MassKernels::Cuboids cuboids;
+
+    for ( const Component *c : components )
+    {
+        cuboids.add( c->getMass(), c->getLength(), c->getWidth(), c->getHeight(),
+                     c->getPosition() );
+    }
+
+    MassKernels::sum( cuboids.getArrays(), 0, cuboids.getCount(), &baseSums );
+
+    base.getPointMasses().addTo( &baseSums, 0, base.getPointMasses().getCount() );
+
+    // component types of all base and added components and their base
+    // estimated masses, gathered on the calling thread as those are cached
+    std::vector< TypeInfo > types;
+    std::map< std::string, int > typesIndices;
+
+    std::vector< int > componentsTypes;
+    componentsTypes.reserve( components.size() );
+
+    auto addType = [ &base, &types, &typesIndices ]( const std::string &type,
+                                                     const Component *component )
+    {
+        std::map< std::string, int >::const_iterator it = typesIndices.find( type );
+
+        if ( it != typesIndices.end() ) return it->second;
+
+        std::unique_ptr< Component > temp;
+
+        if ( !component )
+        {
+            temp.reset( ComponentFactory::create( type.c_str(), base.getData() ) );
+            component = temp.get();
+        }
+
+        TypeInfo info;
+        info.type = type;
+
+        if ( component )
+        {
+            info.dependencies  = component->getEstimationDependencies();
+            info.estimatedMass = component->getEstimatedMass();
+        }
+
+        types.push_back( info );
+        typesIndices[ type ] = static_cast< int >( types.size() ) - 1;
+
+        return static_cast< int >( types.size() ) - 1;
+    };
+
+    for ( const Component *c : components )
+    {
+        componentsTypes.push_back( addType( c->getXmlTagName(), c ) );
+    }
+
+    std::vector< std::vector< int > > addedTypes( _variants.size() );
+
+    for ( size_t i = 0; i < _variants.size(); ++i )
+    {
+        for ( const ComponentData &componentData : _variants[ i ].added )
+        {
+            addedTypes[ i ].push_back( addType( componentData.type, nullptr ) );
+        }
+    }
+
+    Results results( _variants.size() );
+
+    auto evaluateVariant = [ this, &base, &components, &baseSums, &types,
+                             &componentsTypes, &addedTypes, &results ]( int index )
+    {
+        const AircraftVariant &variant = _variants[ index ];
+
+        Result &result = results[ index ];
+        result.name = variant.name;
+        result.valid = isValid( variant, base );
+
+        if ( !result.valid ) return;
+
+        // aircraft data
+        AircraftData data = *base.getData();
+
+        std::vector< bool > changed( AircraftData::FieldsCount, false );
+
+        for ( const std::pair< const int, double > &field : variant.fields )
+        {
+            if ( AircraftDataFields::getValue( data, field.first ) == field.second ) continue;
+
+            if ( !AircraftDataFields::setValue( data, field.first, field.second ) )
+            {
+                result.valid = false;
+                return;
+            }
+
+            changed[ field.first ] = true;
+        }
+
+        // estimated masses, recomputed once per type affected by changed fields
+        std::vector< double > estimatedMasses( types.size() );
+
+        for ( size_t i = 0; i < types.size(); ++i )
+        {
+            estimatedMasses[ i ] = types[ i ].estimatedMass;
+
+            bool affected = false;
+
+            for ( int field : types[ i ].dependencies )
+            {
+                if ( changed[ field ] ) affected = true;
+            }
+
+            if ( affected )
+            {
+                std::unique_ptr< Component > temp( ComponentFactory::create( types[ i ].type.c_str(), &data ) );
+
+                if ( temp ) estimatedMasses[ i ] = temp->computeEstimatedMass();
+            }
+        }
+
+        // mass characteristics, base sums corrected by components differences
+        MassSums sums = baseSums;
+
+        for ( int i : variant.removed )
+        {
+            const Component *c = components[ i ];
+
+            sums.add( -c->getMass(), c->getLength(), c->getWidth(), c->getHeight(),
+                      c->getPosition() );
+        }
+
+        for ( const std::pair< const int, ComponentData > &component : variant.components )
+        {
+            const Component *c = components[ component.first ];
+            const ComponentData &d = component.second;
+
+            sums.add( -c->getMass(), c->getLength(), c->getWidth(), c->getHeight(),
+                      c->getPosition() );
+            sums.add( d.m, d.l, d.w, d.h, d.r );
+        }
+
+        for ( const ComponentData &d : variant.added )
+        {
+            sums.add( d.m, d.l, d.w, d.h, d.r );
+        }
+
+        const double m = sums.getMass();
+
+        result.massTotal     = m;
+        result.centerOfMass  = ( m > 0.0 ) ? ( sums.getFirstMoment() / m ) : Vector3();
+        result.inertiaMatrix = sums.getInertia().getMatrix();
+
+        // components estimated masses
+        result.estimatedMasses.reserve( components.size() - variant.removed.size() + variant.added.size() );
+
+        std::set< int >::const_iterator removed = variant.removed.begin();
+
+        for ( int i = 0; i < static_cast< int >( components.size() ); ++i )
+        {
+            if ( removed != variant.removed.end() && *removed == i )
+            {
+                ++removed;
+                continue;
+            }
+
+            result.estimatedMasses.push_back( estimatedMasses[ componentsTypes[ i ] ] );
+        }
+
+        for ( int type : addedTypes[ index ] )
+        {
+            result.estimatedMasses.push_back( estimatedMasses[ type ] );
+        }
+    };
+
+    ThreadPool::getInstance()->run( static_cast< int >( _variants.size() ), evaluateVariant );
+
+    return results;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool VariantSet::apply( int index, Aircraft *aircraft ) const
+{
+    if ( index < 0 || index >= static_cast< int >( _variants.size() ) ) return false;
+
+    const AircraftVariant &variant = _variants[ index ];
+
+    if ( !isValid( variant, *aircraft ) ) return false;
+
+    AircraftData data = *aircraft->getData();
+
+    for ( const std::pair< const int, double > &field : variant.fields )
+    {
+        if ( !AircraftDataFields::setValue( data, field.first, field.second ) ) return false;
+    }
+
+    aircraft->setData( data );
+
+    for ( const std::pair< const int, ComponentData > &component : variant.components )
+    {
+        aircraft->getComponent( component.first )->setComponentData( component.second );
+    }
+
+    Aircraft::Components added;
+
+    for ( const ComponentData &componentData : variant.added )
+    {
+        added.push_back( ComponentFactory::create( componentData, aircraft->getData() ) );
+    }
+
+    // aircraft is updated once after removing and once after adding
+    aircraft->delComponents( variant.removed );
+    aircraft->addComponents( added );
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool VariantSet::readVariant( QDomElement *variantNode, AircraftVariant *variant )
+{
+    variant->name = variantNode->attributeNode( "name" ).value().toStdString();
+
+    QDomElement nodeField = variantNode->firstChildElement( "field" );
+
+    while ( !nodeField.isNull() )
+    {
+        std::string name = nodeField.attributeNode( "name" ).value().toStdString();
+
+        int index = AircraftDataFields::getIndex( name.c_str() );
+
+        if ( index < 0 ) return false;
+
+        variant->fields[ index ] = nodeField.text().toDouble();
+
+        nodeField = nodeField.nextSiblingElement( "field" );
+    }
+
+    QDomElement nodeComponent = variantNode->firstChildElement( "component" );
+
+    while ( !nodeComponent.isNull() )
+    {
+        bool ok = false;
+        int index = nodeComponent.attributeNode( "index" ).value().toInt( &ok );
+
+        QDomElement nodeData = nodeComponent.firstChildElement();
+
+        if ( !ok || index < 0 || !readComponent( &nodeData, &variant->components[ index ] ) )
+        {
+            return false;
+        }
+
+        nodeComponent = nodeComponent.nextSiblingElement( "component" );
+    }
+
+    QDomElement nodeRemove = variantNode->firstChildElement( "remove" );
+
+    while ( !nodeRemove.isNull() )
+    {
+        bool ok = false;
+        int index = nodeRemove.attributeNode( "index" ).value().toInt( &ok );
+
+        if ( !ok || index < 0 ) return false;
+
+        variant->removed.insert( index );
+
+        nodeRemove = nodeRemove.nextSiblingElement( "remove" );
+    }
+
+    QDomElement nodeAdd = variantNode->firstChildElement( "add" );
+
+    while ( !nodeAdd.isNull() )
+    {
+        QDomElement nodeData = nodeAdd.firstChildElement();
+
+        while ( !nodeData.isNull() )
+        {
+            ComponentData componentData;
+
+            if ( !readComponent( &nodeData, &componentData ) ) return false;
+
+            variant->added.push_back( componentData );
+
+            nodeData = nodeData.nextSiblingElement();
+        }
+
+        nodeAdd = nodeAdd.nextSiblingElement( "add" );
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool VariantSet::readComponent( QDomElement *componentNode, ComponentData *componentData )
+{
+    if ( componentNode->isNull() ) return false;
+
+    AircraftData data;
+
+    std::unique_ptr< Component > temp( ComponentFactory::create( componentNode->tagName().toStdString().c_str(),
+                                                                 &data ) );
+
+    if ( !temp ) return false;
+
+    temp->read( componentNode );
+
+    *componentData = temp->getComponentData();
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void VariantSet::saveVariant( QDomDocument *doc, QDomElement *parentNode,
+                              const AircraftVariant &variant )
+{
+    QDomElement nodeVariant = doc->createElement( "variant" );
+    parentNode->appendChild( nodeVariant );
+
+    nodeVariant.setAttribute( "name", variant.name.c_str() );
+
+    for ( const std::pair< const int, double > &field : variant.fields )
+    {
+        QDomElement nodeField = doc->createElement( "field" );
+        nodeVariant.appendChild( nodeField );
+
+        nodeField.setAttribute( "name", AircraftDataFields::getField( field.first ).name );
+
+        // full precision, so values read back are exactly the same
+        nodeField.appendChild( doc->createTextNode( QString::number( field.second, 'g', 17 ) ) );
+    }
+
+    for ( const std::pair< const int, ComponentData > &component : variant.components )
+    {
+        QDomElement nodeComponent = doc->createElement( "component" );
+        nodeVariant.appendChild( nodeComponent );
+
+        nodeComponent.setAttribute( "index", component.first );
+
+        saveComponent( doc, &nodeComponent, component.second );
+    }
+
+    for ( int index : variant.removed )
+    {
+        QDomElement nodeRemove = doc->createElement( "remove" );
+        nodeVariant.appendChild( nodeRemove );
+
+        nodeRemove.setAttribute( "index", index );
+    }
+
+    if ( !variant.added.empty() )
+    {
+        QDomElement nodeAdd = doc->createElement( "add" );
+        nodeVariant.appendChild( nodeAdd );
+
+        for ( const ComponentData &componentData : variant.added )
+        {
+            saveComponent( doc, &nodeAdd, componentData );
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void VariantSet::saveComponent( QDomDocument *doc, QDomElement *parentNode,
+                                const ComponentData &componentData )
+{
+    AircraftData data;
+
+    std::unique_ptr< Component > temp( ComponentFactory::create( componentData, &data ) );
+
+    if ( temp ) temp->save( doc, parentNode );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool VariantSet::isValid( const AircraftVariant &variant, const Aircraft &base )
+{
+    const Aircraft::Components &components = base.getComponents();
+
+    const int count = static_cast< int >( components.size() );
+
+    for ( const std::pair< const int, ComponentData > &component : variant.components )
+    {
+        if ( component.first >= count ) return false;
+        if ( variant.removed.find( component.first ) != variant.removed.end() ) return false;
+        if ( component.second.type != components[ component.first ]->getXmlTagName() ) return false;
+    }
+
+    if ( !variant.removed.empty() && *variant.removed.rbegin() >= count ) return false;
+
+    for ( const ComponentData &componentData : variant.added )
+    {
+        AircraftData data;
+
+        std::unique_ptr< Component > temp( ComponentFactory::create( componentData.type.c_str(), &data ) );
+
+        if ( !temp ) return false;
+    }
+
+    for ( const std::pair< const int, double > &field : variant.fields )
+    {
+        if ( field.first < 0 || field.first >= AircraftDataFields::getCount() ) return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace mc
@@ -0,0 +1,160 @@
+/****************************************************************************//*
+ * Copyright (C) 2022 Marek M. Cel
+ *
+ * This file is part of MC-Mass.
+ *
+ * MC-Mass is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MC-Mass is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ ******************************************************************************/
+#ifndef VARIANTS_VARIANTSET_H_
+#define VARIANTS_VARIANTSET_H_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <QByteArray>
+#include <QDomDocument>
+#include <QDomElement>
+
+#include <mcutil/math/Matrix3x3.h>
+#include <mcutil/math/Vector3.h>
+
+#include <Aircraft.h>
+
+#include <variants/AircraftVariant.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace mc
+{
+
+/**
+ * @brief The aircraft variants set class.
+ *
+ * Stores product line variants as differences against a single base
+ * aircraft and evaluates all of them at once. Mass characteristics of
+ * a variant are the base sums with removed and replaced components
+ * subtracted and replacing and added components added, so evaluation cost
+ * depends on the size of the differences, not on the size of the aircraft.
+ * Estimated mass of a component depends only on its type and on the
+ * aircraft data, so it is recomputed only for types depending on any of
+ * the fields changed by the variant, once per type.
+ *
+ * Variants file root element is "mscsim_mass_variants", e.g.
+ * @code
+ * <mscsim_mass_variants>
+ *   <variant name="long range">
+ *     <field name="wing.area">17.5</field>
+ *     <component index="3"><wing name="Wing">...</wing></component>
+ *     <remove index="7"/>
+ *     <add><all_else name="Extra Tank">...</all_else></add>
+ *   </variant>
+ * </mscsim_mass_variants>
+ * @endcode
+ */
+class VariantSet
+{
+public:
+
+    typedef std::vector< AircraftVariant > Variants;
+
+    /**
+     * @brief The variant evaluation result struct.
+     */
+    struct Result
+    {
+        std::string name;                       ///< variant name
+
+        bool valid = false;                     ///< false if variant does not match the base aircraft
+
+        double    massTotal = 0.0;              ///< [kg] total mass
+        Vector3   centerOfMass;                 ///< [m] center of mass position
+        Matrix3x3 inertiaMatrix;                ///< [kg*m^2] inertia
+
+        std::vector< double > estimatedMasses;  ///< [kg] variant components estimated masses
+    };
+
+    typedef std::vector< Result > Results;
+
+    /**
+     * @brief Adds variant.
+     * @param variant variant
+     */
+    void add( const AircraftVariant &variant );
+
+    /** @brief Removes all variants. */
+    void clear();
+
+    inline const Variants& getVariants() const { return _variants; }
+
+    /**
+     * @brief Reads variants, replaces previous ones.
+     * @param content variants file content
+     * @return returns true on success and false on failure
+     */
+    bool read( const QByteArray &content );
+
+    /**
+     * @brief Reads variants file, replaces previous variants.
+     * @param fileName variants file name
+     * @return returns true on success and false on failure
+     */
+    bool readFile( const char *fileName );
+
+    /**
+     * @brief Saves variants file.
+     * @param fileName variants file name
+     * @return returns true on success and false on failure
+     */
+    bool saveFile( const char *fileName ) const;
+
+    /**
+     * @brief Evaluates all variants of the base aircraft concurrently.
+     * Base aircraft is only read, but it must not be edited meanwhile.
+     * @param base base aircraft
+     * @return results in the order of variants
+     */
+    Results evaluate( const Aircraft &base ) const;
+
+    /**
+     * @brief Applies variant to the aircraft, which should be a copy of the
+     * base one, e.g. read from the same file. Assemblies of kept components
+     * are preserved, added components belong to the root assembly.
+     * @param index variant index
+     * @param aircraft base aircraft copy
+     * @return returns true on success and false if variant does not match the aircraft
+     */
+    bool apply( int index, Aircraft *aircraft ) const;
+
+private:
+
+    Variants _variants;     ///< variants
+
+    static bool readVariant( QDomElement *variantNode, AircraftVariant *variant );
+    static bool readComponent( QDomElement *componentNode, ComponentData *componentData );
+
+    static void saveVariant( QDomDocument *doc, QDomElement *parentNode,
+                             const AircraftVariant &variant );
+    static void saveComponent( QDomDocument *doc, QDomElement *parentNode,
+                               const ComponentData &componentData );
+
+    static bool isValid( const AircraftVariant &variant, const Aircraft &base );
+};
+
+} // namespace mc
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // VARIANTS_VARIANTSET_H_
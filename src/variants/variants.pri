@@ -0,0 +1,6 @@
+HEADERS += \
+    $$PWD/AircraftVariant.h \
+    $$PWD/VariantSet.h
+
+SOURCES += \
+    $$PWD/VariantSet.cpp
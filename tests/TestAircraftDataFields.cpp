@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <limits>
+#include <string>
+
+#include <AircraftData.h>
+#include <AircraftDataFields.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestAircraftDataFields : public ::testing::Test
+{
+protected:
+    TestAircraftDataFields() {}
+    virtual ~TestAircraftDataFields() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDataFields, CanGetIndices)
+{
+    std::vector< int > indices = mc::AircraftDataFields::getIndices( { "general.mtow", "wing.*" } );
+
+    ASSERT_GT( indices.size(), 2u );
+    EXPECT_EQ( indices[ 0 ], mc::AircraftDataFields::getIndex( "general.mtow" ) );
+
+    for ( size_t i = 1; i < indices.size(); ++i )
+    {
+        EXPECT_EQ( std::string( mc::AircraftDataFields::getField( indices[ i ] ).name ).substr( 0, 5 ), "wing." );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDataFields, CanNotGetIndicesOfUnknownFields)
+{
+    EXPECT_DEATH( mc::AircraftDataFields::getIndices( { "general.mtow", "wing.unknown" } ), "wing.unknown" );
+    EXPECT_DEATH( mc::AircraftDataFields::getIndices( { "unknown.*" } ), "unknown" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDataFields, CanSetValueAndTouchOnlyChangedField)
+{
+    mc::AircraftData data = mc::AircraftData();
+
+    const int mtow = mc::AircraftDataFields::getIndex( "general.mtow" );
+    const int area = mc::AircraftDataFields::getIndex( "wing.area" );
+
+    EXPECT_TRUE( mc::AircraftDataFields::setValue( data, mtow, 1000.0 ) );
+    EXPECT_EQ( data.general.mtow, 1000.0 );
+    EXPECT_EQ( data.versions[ mtow ], 1u );
+    EXPECT_EQ( data.versions[ area ], 0u );
+
+    // same value
+    EXPECT_TRUE( mc::AircraftDataFields::setValue( data, mtow, 1000.0 ) );
+    EXPECT_EQ( data.versions[ mtow ], 1u );
+
+    // invalid values
+    EXPECT_FALSE( mc::AircraftDataFields::setValue( data, mc::AircraftDataFields::getIndex( "rotors.main_blades" ), 2.5 ) );
+    EXPECT_FALSE( mc::AircraftDataFields::setValue( data, mtow, std::numeric_limits< double >::infinity() ) );
+    EXPECT_FALSE( mc::AircraftDataFields::setValue( data, -1, 1.0 ) );
+    EXPECT_EQ( data.general.mtow, 1000.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDataFields, CanRejectIntegerOutOfRange)
+{
+    mc::AircraftData data = mc::AircraftData();
+
+    const int blades = mc::AircraftDataFields::getIndex( "rotors.main_blades" );
+    const int wheels = mc::AircraftDataFields::getIndex( "landing_gear.main_wheels" );
+
+    EXPECT_TRUE( mc::AircraftDataFields::setValue( data, blades, 4.0 ) );
+    EXPECT_EQ( data.rotors.main_blades, 4 );
+
+    EXPECT_TRUE( mc::AircraftDataFields::setValue( data, wheels, INT_MAX ) );
+    EXPECT_EQ( data.landing_gear.main_wheels, INT_MAX );
+
+    // not representable as int
+    EXPECT_FALSE( mc::AircraftDataFields::setValue( data, blades, 1.0e300 ) );
+    EXPECT_FALSE( mc::AircraftDataFields::setValue( data, blades, static_cast< double >( INT_MAX ) + 1.0 ) );
+    EXPECT_FALSE( mc::AircraftDataFields::setValue( data, blades, -1.0e300 ) );
+
+    // negative counts
+    EXPECT_FALSE( mc::AircraftDataFields::setValue( data, blades, -1.0 ) );
+    EXPECT_FALSE( mc::AircraftDataFields::setValue( data, wheels, -2.0 ) );
+
+    EXPECT_EQ( data.rotors.main_blades, 4 );
+    EXPECT_EQ( data.landing_gear.main_wheels, INT_MAX );
+    EXPECT_EQ( data.versions[ blades ], 1u );
+}
@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <DataFile.h>
+
+#include <cache/ResultCache.h>
+
+#include <components/AllElse.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestResultCache : public ::testing::Test
+{
+protected:
+    TestResultCache() {}
+    virtual ~TestResultCache() {}
+    void SetUp() override {}
+
+    void TearDown() override
+    {
+        for ( const std::string &fileName : _fileNames ) std::remove( fileName.c_str() );
+    }
+
+    std::vector< std::string > _fileNames;
+
+    std::string getFileName( const char *name )
+    {
+        std::string fileName = ::testing::TempDir() + "test_result_cache_" + name;
+        _fileNames.push_back( fileName );
+        return fileName;
+    }
+
+    static void writeFile( const std::string &fileName, const std::string &content )
+    {
+        std::ofstream fs( fileName.c_str(), std::ios_base::out | std::ios_base::trunc );
+        fs << content;
+    }
+
+    static std::string readFile( const std::string &fileName )
+    {
+        std::ifstream fs( fileName.c_str(), std::ios_base::in | std::ios_base::binary );
+        return std::string( std::istreambuf_iterator< char >( fs ), std::istreambuf_iterator< char >() );
+    }
+
+    /** Saves aircraft of two components, the second one of the given mass. */
+    static void saveAircraft( const std::string &fileName, double mass )
+    {
+        mc::DataFile dataFile;
+        mc::Aircraft *aircraft = dataFile.getAircraft();
+
+        mc::Component *c1 = new mc::AllElse( aircraft->getData() );
+        c1->setName( "c1" );
+        c1->setMass( 100.0 );
+        c1->setPosition( mc::Vector3( 1.0, 0.0, 0.0 ) );
+        aircraft->addComponent( c1 );
+
+        mc::Component *c2 = new mc::AllElse( aircraft->getData() );
+        c2->setName( "c2" );
+        c2->setMass( mass );
+        c2->setPosition( mc::Vector3( -1.0, 0.0, 0.0 ) );
+        aircraft->addComponent( c2 );
+
+        ASSERT_TRUE( dataFile.saveFile( fileName.c_str() ) );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestResultCache, CanSaveAndReopen)
+{
+    const std::string fileXml   = getFileName( "aircraft.xml" );
+    const std::string fileOther = getFileName( "other.xml" );
+    const std::string fileCache = getFileName( "cache.bin" );
+
+    saveAircraft( fileXml, 50.0 );
+    saveAircraft( fileOther, 25.0 );
+
+    mc::ResultCache::Result result;
+
+    {
+        mc::ResultCache cache;
+        ASSERT_TRUE( cache.open( fileCache.c_str() ) );
+        EXPECT_EQ( cache.getCount(), 0 );
+
+        ASSERT_TRUE( cache.readFile( fileXml.c_str(), &result ) );
+        ASSERT_TRUE( cache.save() );
+    }
+
+    // saved through the temporary file, which is not left behind
+    EXPECT_FALSE( std::ifstream( ( fileCache + ".tmp" ).c_str() ).is_open() );
+
+    // saved again over the existing file
+    {
+        mc::ResultCache cache;
+        ASSERT_TRUE( cache.open( fileCache.c_str() ) );
+        ASSERT_TRUE( cache.readFile( fileOther.c_str(), &result ) );
+        ASSERT_TRUE( cache.save() );
+    }
+
+    mc::ResultCache cache;
+    ASSERT_TRUE( cache.open( fileCache.c_str() ) );
+    EXPECT_EQ( cache.getCount(), 2 );
+
+    // known file content is a hit without parsing
+    mc::ResultCache::Result reopened;
+    ASSERT_TRUE( cache.readFile( fileXml.c_str(), &reopened ) );
+    EXPECT_EQ( cache.getHits(), 1 );
+    EXPECT_EQ( cache.getMisses(), 0 );
+
+    EXPECT_DOUBLE_EQ( reopened.massTotal, 150.0 );
+    EXPECT_DOUBLE_EQ( reopened.centerOfMass.x(), 50.0 / 150.0 );
+    ASSERT_EQ( reopened.components.size(), 2u );
+    EXPECT_EQ( reopened.components[ 1 ].name, "c2" );
+    EXPECT_DOUBLE_EQ( reopened.components[ 1 ].mass, 50.0 );
+
+    // damaged cache file is discarded
+    writeFile( fileCache, readFile( fileCache ).substr( 0, 20 ) );
+    ASSERT_TRUE( cache.open( fileCache.c_str() ) );
+    EXPECT_EQ( cache.getCount(), 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestResultCache, CanCountHitsAndMisses)
+{
+    const std::string fileXml = getFileName( "aircraft.xml" );
+
+    saveAircraft( fileXml, 50.0 );
+
+    mc::DataFile dataFile;
+    ASSERT_TRUE( dataFile.readFile( fileXml.c_str() ) );
+
+    mc::ResultCache cache;
+    mc::ResultCache::Result result;
+
+    EXPECT_FALSE( cache.evaluate( dataFile.getAircraft(), &result ) );
+    EXPECT_EQ( cache.getHits(), 0 );
+    EXPECT_EQ( cache.getMisses(), 1 );
+
+    EXPECT_TRUE( cache.evaluate( dataFile.getAircraft(), &result ) );
+    EXPECT_TRUE( cache.evaluate( dataFile.getAircraft(), &result ) );
+    EXPECT_EQ( cache.getHits(), 2 );
+    EXPECT_EQ( cache.getMisses(), 1 );
+    EXPECT_EQ( cache.getCount(), 1 );
+    EXPECT_DOUBLE_EQ( result.massTotal, 150.0 );
+
+    cache.clear();
+    EXPECT_EQ( cache.getHits(), 0 );
+    EXPECT_EQ( cache.getMisses(), 0 );
+    EXPECT_EQ( cache.getCount(), 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestResultCache, CanShareResultOfSameConfiguration)
+{
+    const std::string file1 = getFileName( "aircraft_1.xml" );
+    const std::string file2 = getFileName( "aircraft_2.xml" );
+
+    saveAircraft( file1, 50.0 );
+
+    // different content of the same configuration
+    writeFile( file2, readFile( file1 ) + "\n\n" );
+
+    mc::ResultCache cache;
+    mc::ResultCache::Result result1;
+    mc::ResultCache::Result result2;
+
+    ASSERT_TRUE( cache.readFile( file1.c_str(), &result1 ) );
+    ASSERT_TRUE( cache.readFile( file2.c_str(), &result2 ) );
+
+    EXPECT_EQ( cache.getCount(), 1 );
+    EXPECT_EQ( cache.getMisses(), 1 );
+    EXPECT_EQ( cache.getHits(), 1 );
+    EXPECT_DOUBLE_EQ( result2.massTotal, result1.massTotal );
+    EXPECT_DOUBLE_EQ( result2.inertiaMatrix.yy(), result1.inertiaMatrix.yy() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestResultCache, CanInvalidateChangedComponent)
+{
+    const std::string fileXml = getFileName( "aircraft.xml" );
+
+    saveAircraft( fileXml, 50.0 );
+
+    mc::ResultCache cache;
+    mc::ResultCache::Result result;
+
+    ASSERT_TRUE( cache.readFile( fileXml.c_str(), &result ) );
+    EXPECT_DOUBLE_EQ( result.massTotal, 150.0 );
+
+    saveAircraft( fileXml, 80.0 );
+
+    ASSERT_TRUE( cache.readFile( fileXml.c_str(), &result ) );
+    EXPECT_DOUBLE_EQ( result.massTotal, 180.0 );
+    EXPECT_DOUBLE_EQ( result.components[ 1 ].mass, 80.0 );
+
+    EXPECT_EQ( cache.getCount(), 2 );
+    EXPECT_EQ( cache.getMisses(), 2 );
+    EXPECT_EQ( cache.getHits(), 0 );
+
+    // and back to the first configuration
+    saveAircraft( fileXml, 50.0 );
+
+    ASSERT_TRUE( cache.readFile( fileXml.c_str(), &result ) );
+    EXPECT_DOUBLE_EQ( result.massTotal, 150.0 );
+    EXPECT_EQ( cache.getHits(), 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestResultCache, CanReadFileOfChangedPointMasses)
+{
+    const std::string fileCsv = getFileName( "points.csv" );
+    const std::string fileXml = getFileName( "aircraft.xml" );
+
+    writeFile( fileCsv, "1,10.0,1.0,0.0,0.0\n" );
+
+    mc::DataFile dataFile;
+
+    mc::Component *component = new mc::AllElse( dataFile.getAircraft()->getData() );
+    component->setMass( 100.0 );
+    dataFile.getAircraft()->addComponent( component );
+
+    ASSERT_TRUE( dataFile.getAircraft()->importPointMasses( fileCsv.c_str() ) );
+    ASSERT_TRUE( dataFile.saveFile( fileXml.c_str() ) );
+
+    mc::ResultCache cache;
+    mc::ResultCache::Result result;
+
+    ASSERT_TRUE( cache.readFile( fileXml.c_str(), &result ) );
+    EXPECT_DOUBLE_EQ( result.massTotal, 110.0 );
+
+    // aircraft file is the same, point masses file is not
+    writeFile( fileCsv, "1,10.0,1.0,0.0,0.0\n2,20.0,0.0,0.0,0.0\n" );
+
+    ASSERT_TRUE( cache.readFile( fileXml.c_str(), &result ) );
+    EXPECT_DOUBLE_EQ( result.massTotal, 130.0 );
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <components/AllElse.h>
+#include <components/Assembly.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestAssembly : public ::testing::Test
+{
+protected:
+    TestAssembly() {}
+    virtual ~TestAssembly() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    mc::AircraftData _data;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAssembly, CanAggregateAboutOrigin)
+{
+    mc::AllElse c1( &_data );
+    mc::AllElse c2( &_data );
+
+    c1.setMass( 10.0 );
+    c1.setPosition( mc::Vector3( 1.0, 2.0, 3.0 ) );
+    c1.setLength( 1.0 );
+
+    c2.setMass( 20.0 );
+    c2.setPosition( mc::Vector3( -1.0, 0.5, 0.0 ) );
+    c2.setWidth( 2.0 );
+
+    mc::Assembly root;
+    mc::Assembly *group = root.addAssembly( "group", mc::Vector3( 3.0, -1.0, 2.0 ) );
+    mc::Assembly *part  = group->addAssembly( "part", mc::Vector3( -2.0, 4.0, 1.0 ) );
+
+    group->addComponent( &c1 );
+    part->addComponent( &c2 );
+
+    root.update();
+
+    mc::InertiaTensor expected = c1.getInertiaTensor();
+    expected += c2.getInertiaTensor();
+
+    EXPECT_NEAR( root.getMass(), 30.0, 1.0e-12 );
+    EXPECT_NEAR( root.getFirstMoment().x(), -10.0, 1.0e-12 );
+    EXPECT_NEAR( root.getInertia().xx(), expected.xx(), 1.0e-9 );
+    EXPECT_NEAR( root.getInertia().yy(), expected.yy(), 1.0e-9 );
+    EXPECT_NEAR( root.getInertia().zz(), expected.zz(), 1.0e-9 );
+    EXPECT_NEAR( root.getInertia().xy(), expected.xy(), 1.0e-9 );
+    EXPECT_NEAR( root.getInertia().xz(), expected.xz(), 1.0e-9 );
+    EXPECT_NEAR( root.getInertia().yz(), expected.yz(), 1.0e-9 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAssembly, CanInvalidateAncestorsOnly)
+{
+    mc::AllElse c1( &_data );
+    mc::AllElse c2( &_data );
+
+    mc::Assembly root;
+    mc::Assembly *left  = root.addAssembly( "left"  );
+    mc::Assembly *right = root.addAssembly( "right" );
+
+    left->addComponent( &c1 );
+    right->addComponent( &c2 );
+
+    root.update();
+
+    EXPECT_TRUE( root.isValid() );
+
+    c1.setMass( 5.0 );
+
+    EXPECT_FALSE( left->isValid() );
+    EXPECT_FALSE( root.isValid() );
+    EXPECT_TRUE( right->isValid() );
+
+    root.update();
+
+    EXPECT_DOUBLE_EQ( root.getMass(), 5.0 );
+}
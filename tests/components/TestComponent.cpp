@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <Aircraft.h>
+#include <AircraftData.h>
+#include <AircraftDataFields.h>
+
+#include <components/AllElse.h>
+#include <components/Wing.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestComponent : public ::testing::Test
+{
+protected:
+    TestComponent() {}
+    virtual ~TestComponent() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    class CountingWing : public mc::Wing
+    {
+    public:
+
+        CountingWing( const mc::AircraftData *data ) : mc::Wing( data ), computed ( 0 ) {}
+
+        double computeEstimatedMass() const override
+        {
+            ++computed;
+            return mc::Wing::computeEstimatedMass();
+        }
+
+        mutable int computed;
+    };
+
+    static void setValue( mc::AircraftData *data, const char *name, double value )
+    {
+        ASSERT_TRUE( mc::AircraftDataFields::setValue( *data, mc::AircraftDataFields::getIndex( name ), value ) );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestComponent, CanCacheEstimatedMass)
+{
+    mc::AircraftData data = mc::AircraftData();
+
+    data.type = mc::AircraftData::FighterAttack;
+    setValue( &data, "general.mtow"  , 21772.0 );
+    setValue( &data, "general.nz_max",     9.0 );
+    setValue( &data, "wing.area_exp" ,    18.14 );
+    setValue( &data, "wing.sweep"    ,    30.9 );
+    setValue( &data, "wing.ar"       ,     2.997 );
+    setValue( &data, "wing.tr"       ,     0.296 );
+    setValue( &data, "wing.t_c"      ,     0.04 );
+    setValue( &data, "wing.ctrl_area",     6.24 );
+
+    CountingWing wing( &data );
+
+    double m0 = wing.getEstimatedMass();
+    EXPECT_GT( m0, 0.0 );
+    EXPECT_EQ( wing.computed, 1 );
+
+    EXPECT_EQ( wing.getEstimatedMass(), m0 );
+    EXPECT_EQ( wing.computed, 1 );
+
+    // fields the wing mass does not depend on
+    setValue( &data, "rotors.main_r", 8.0 );
+    setValue( &data, "ver_tail.area", 5.0 );
+    setValue( &data, "fuselage.l", 14.0 );
+
+    EXPECT_EQ( wing.getEstimatedMass(), m0 );
+    EXPECT_EQ( wing.computed, 1 );
+
+    // same value of the field the wing mass depends on
+    setValue( &data, "wing.area_exp", 18.14 );
+
+    EXPECT_EQ( wing.getEstimatedMass(), m0 );
+    EXPECT_EQ( wing.computed, 1 );
+
+    // fields the wing mass depends on
+    setValue( &data, "wing.area_exp", 20.0 );
+
+    double m1 = wing.getEstimatedMass();
+    EXPECT_GT( m1, m0 );
+    EXPECT_EQ( wing.computed, 2 );
+    EXPECT_EQ( m1, mc::Wing::estimateMass( data ) );
+
+    setValue( &data, "general.mtow", 25000.0 );
+
+    double m2 = wing.getEstimatedMass();
+    EXPECT_GT( m2, m1 );
+    EXPECT_EQ( wing.computed, 3 );
+
+    data.touchAll();
+
+    EXPECT_EQ( wing.getEstimatedMass(), m2 );
+    EXPECT_EQ( wing.computed, 4 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestComponent, CanGetInertiaAsAircraft)
+{
+    mc::Aircraft aircraft;
+
+    mc::Component *component = new mc::AllElse( aircraft.getData() );
+    component->setMass( 120.0 );
+    component->setPosition( mc::Vector3( 1.5, -0.5, 0.25 ) );
+    component->setLength( 2.0 );
+    component->setWidth( 1.0 );
+    component->setHeight( 0.5 );
+    aircraft.addComponent( component );
+
+    mc::Matrix3x3 i_c = component->getInertia();
+    mc::Matrix3x3 i_a = aircraft.getInertiaMatrix();
+
+    EXPECT_NEAR( i_c.xx(), i_a.xx(), 1.0e-9 );
+    EXPECT_NEAR( i_c.yy(), i_a.yy(), 1.0e-9 );
+    EXPECT_NEAR( i_c.zz(), i_a.zz(), 1.0e-9 );
+    EXPECT_NEAR( i_c.xy(), i_a.xy(), 1.0e-9 );
+    EXPECT_NEAR( i_c.xz(), i_a.xz(), 1.0e-9 );
+    EXPECT_NEAR( i_c.yz(), i_a.yz(), 1.0e-9 );
+}
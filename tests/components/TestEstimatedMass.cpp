@@ -0,0 +1,285 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <AircraftData.h>
+#include <AircraftDataFields.h>
+
+#include <components/Component.h>
+#include <components/ComponentFactory.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Estimates of the aircraft shipped in data/ directory, these values are
+// what data files were made with, any change of the estimation formulas that
+// changes them has to be deliberate
+
+namespace
+{
+
+struct Field
+{
+    const char *name;
+    double value;
+};
+
+struct Estimate
+{
+    const char *type;
+    double mass;
+};
+
+// F-16C
+const Field fieldsF16C[] =
+{
+    { "general.m_empty", 8910.0 }, { "general.mtow", 21772.0 }, { "general.m_maxLand", 21772.0 },
+    { "general.nz_max", 9.0 }, { "general.nz_maxLand", 9.0 }, { "general.mach_max", 2.1 },
+    { "fuselage.l", 14.0 }, { "fuselage.h", 1.65 }, { "fuselage.w", 2.08 }, { "fuselage.l_n", 5.0 },
+    { "fuselage.wetted_area", 72.92 },
+    { "wing.area", 27.87 }, { "wing.area_exp", 18.14 }, { "wing.span", 9.14 }, { "wing.sweep", 30.9 },
+    { "wing.c_tip", 1.15 }, { "wing.c_root", 3.89 }, { "wing.ar", 2.997 }, { "wing.tr", 0.296 },
+    { "wing.t_c", 0.04 }, { "wing.ctrl_area", 6.24 },
+    { "hor_tail.area", 5.92 }, { "hor_tail.span", 5.58 }, { "hor_tail.w_f", 2.08 }, { "hor_tail.ar", 5.26 },
+    { "hor_tail.rolling", 1.0 },
+    { "ver_tail.area", 5.09 }, { "ver_tail.height", 1.3 }, { "ver_tail.sweep", 44.2 },
+    { "ver_tail.c_tip", 1.21 }, { "ver_tail.c_root", 2.81 }, { "ver_tail.arm", 4.4 },
+    { "ver_tail.rudd_area", 1.31 }, { "ver_tail.ar", 0.332 }, { "ver_tail.tr", 0.431 },
+    { "landing_gear.main_l", 1.4 }, { "landing_gear.nose_l", 1.0 }, { "landing_gear.nose_wheels", 1.0 },
+    { "landing_gear.tripod", 1.0 },
+    { "engine.mass", 1681.0 },
+    { "rotors.main_gear_ratio", 1.0 },
+    { nullptr, 0.0 }
+};
+
+const Estimate estimatesF16C[] =
+{
+    { "fuselage"    ,    1854.109301 },
+    { "wing"        ,     960.945538 },
+    { "tail_hor"    ,     118.948241 },
+    { "tail_ver"    ,     185.807532 },
+    { "gear_main"   ,     568.249980 },
+    { "gear_nose"   ,     122.841870 },
+    { "engine"      ,    2185.300000 },
+    { "all_else"    ,    3701.240000 },
+    { "rotor_drive" ,       0.000000 },
+    { "rotor_hub"   ,       0.000000 },
+    { "rotor_main"  ,       0.000000 },
+    { "rotor_tail"  ,       0.000000 },
+    { nullptr, 0.0 }
+};
+
+// C-130
+const Field fieldsC130[] =
+{
+    { "general.m_empty", 34686.0 }, { "general.mtow", 70310.0 }, { "general.m_maxLand", 59000.0 },
+    { "general.nz_max", 4.4 }, { "general.nz_maxLand", 4.4 }, { "general.v_stall", 100.0 },
+    { "fuselage.l", 30.3 }, { "fuselage.h", 4.0 }, { "fuselage.w", 4.4 }, { "fuselage.l_n", 4.3 },
+    { "fuselage.wetted_area", 299.0 }, { "fuselage.landing_gear", 1.0 },
+    { "fuselage.wetted_area_override", 1.0 },
+    { "wing.area", 162.12 }, { "wing.area_exp", 140.8 }, { "wing.span", 40.41 },
+    { "wing.c_tip", 2.58 }, { "wing.c_root", 4.93 }, { "wing.ar", 10.073 }, { "wing.tr", 0.523 },
+    { "wing.t_c", 0.18 }, { "wing.ctrl_area", 46.12 },
+    { "hor_tail.area", 35.4 }, { "hor_tail.span", 15.86 }, { "hor_tail.sweep", 8.6 },
+    { "hor_tail.elev_area", 29.9 }, { "hor_tail.w_f", 2.92 }, { "hor_tail.arm", 13.04 },
+    { "hor_tail.ar", 7.106 },
+    { "ver_tail.area", 20.9 }, { "ver_tail.height", 6.9 }, { "ver_tail.sweep", 19.5 },
+    { "ver_tail.t_c", 0.16 }, { "ver_tail.arm", 12.62 }, { "ver_tail.ar", 2.278 },
+    { "landing_gear.main_l", 1.5 }, { "landing_gear.nose_l", 1.5 }, { "landing_gear.main_wheels", 4.0 },
+    { "landing_gear.main_struts", 4.0 }, { "landing_gear.nose_wheels", 2.0 },
+    { "engine.mass", 828.0 },
+    { "rotors.main_gear_ratio", 1.0 },
+    { nullptr, 0.0 }
+};
+
+const Estimate estimatesC130[] =
+{
+    { "fuselage"    ,    7384.507099 },
+    { "wing"        ,    6551.612354 },
+    { "tail_hor"    ,     848.689332 },
+    { "tail_ver"    ,     547.860987 },
+    { "gear_main"   ,    2132.063233 },
+    { "gear_nose"   ,     450.390588 },
+    { "engine"      ,    1076.400000 },
+    { "all_else"    ,   11952.700000 },
+    { "rotor_drive" ,       0.000000 },
+    { "rotor_hub"   ,       0.000000 },
+    { "rotor_main"  ,       0.000000 },
+    { "rotor_tail"  ,       0.000000 },
+    { nullptr, 0.0 }
+};
+
+// Cessna 172
+const Field fieldsC172[] =
+{
+    { "general.m_empty", 754.0 }, { "general.mtow", 1157.0 }, { "general.m_maxLand", 1157.0 },
+    { "general.nz_max", 4.4 }, { "general.nz_maxLand", 4.4 }, { "general.h_cruise", 3000.0 },
+    { "general.v_cruise", 124.0 },
+    { "fuselage.l", 7.22 }, { "fuselage.h", 1.4 }, { "fuselage.w", 1.1 }, { "fuselage.l_n", 2.0 },
+    { "fuselage.wetted_area", 26.43 },
+    { "wing.area", 16.17 }, { "wing.area_exp", 15.9 }, { "wing.span", 11.0 },
+    { "wing.c_tip", 1.13 }, { "wing.c_root", 1.7 }, { "wing.ar", 7.483 }, { "wing.tr", 0.665 },
+    { "wing.t_c", 0.12 }, { "wing.fuel", 165.0 }, { "wing.ctrl_area", 16.17 },
+    { "hor_tail.area", 2.0 }, { "hor_tail.c_tip", 0.82 }, { "hor_tail.c_root", 1.3 },
+    { "hor_tail.t_c", 0.12 }, { "hor_tail.arm", 4.79 }, { "hor_tail.tr", 0.631 },
+    { "ver_tail.area", 1.04 }, { "ver_tail.height", 1.77 }, { "ver_tail.sweep", 33.6 },
+    { "ver_tail.c_tip", 0.7 }, { "ver_tail.c_root", 1.42 }, { "ver_tail.t_c", 0.09 },
+    { "ver_tail.ar", 3.012 }, { "ver_tail.tr", 0.493 },
+    { "landing_gear.main_l", 0.7 }, { "landing_gear.nose_l", 0.6 }, { "landing_gear.fixed", 1.0 },
+    { "engine.mass", 126.0 },
+    { "rotors.main_gear_ratio", 1.0 },
+    { nullptr, 0.0 }
+};
+
+const Estimate estimatesC172[] =
+{
+    { "fuselage"    ,     152.852632 },
+    { "wing"        ,     174.361256 },
+    { "tail_hor"    ,      21.208529 },
+    { "tail_ver"    ,       9.419646 },
+    { "gear_main"   ,      76.847621 },
+    { "gear_nose"   ,      11.268054 },
+    { "engine"      ,     176.400000 },
+    { "all_else"    ,     115.700000 },
+    { "rotor_drive" ,       0.000000 },
+    { "rotor_hub"   ,       0.000000 },
+    { "rotor_main"  ,       0.000000 },
+    { "rotor_tail"  ,       0.000000 },
+    { nullptr, 0.0 }
+};
+
+// UH-60
+const Field fieldsUH60[] =
+{
+    { "general.m_empty", 5118.0 }, { "general.mtow", 11113.0 },
+    { "general.nz_max", 4.4 }, { "general.nz_maxLand", 4.4 },
+    { "fuselage.l", 15.26 }, { "fuselage.h", 2.38 }, { "fuselage.w", 2.36 }, { "fuselage.l_n", 2.0 },
+    { "fuselage.wetted_area", 114.91 },
+    { "hor_tail.area", 4.18 }, { "hor_tail.span", 4.36 }, { "hor_tail.ar", 4.548 },
+    { "ver_tail.area", 3.0 }, { "ver_tail.height", 2.17 }, { "ver_tail.ar", 1.57 }, { "ver_tail.rotor", 1.0 },
+    { "engine.mass", 207.0 },
+    { "rotors.main_r", 8.18 }, { "rotors.main_cb", 0.53 }, { "rotors.main_rpm", 258.0 },
+    { "rotors.main_gear_ratio", 80.0 }, { "rotors.tail_r", 1.675 }, { "rotors.mcp", 2215.0 },
+    { "rotors.main_tip_vel", 221.0 }, { "rotors.main_blades", 4.0 },
+    { nullptr, 0.0 }
+};
+
+const Estimate estimatesUH60[] =
+{
+    { "fuselage"    ,    1098.648324 },
+    { "wing"        ,       0.000000 },
+    { "tail_hor"    ,      48.459373 },
+    { "tail_ver"    ,      26.173683 },
+    { "gear_main"   ,     390.694236 },
+    { "gear_nose"   ,       0.000000 },
+    { "engine"      ,     269.100000 },
+    { "all_else"    ,    2778.250000 },
+    { "rotor_drive" ,     540.895796 },
+    { "rotor_hub"   ,     163.505981 },
+    { "rotor_main"  ,     339.206441 },
+    { "rotor_tail"  ,      37.602255 },
+    { nullptr, 0.0 }
+};
+
+// AW101
+const Field fieldsAW101[] =
+{
+    { "general.m_empty", 10500.0 }, { "general.mtow", 14600.0 },
+    { "general.nz_max", 4.4 }, { "general.nz_maxLand", 4.4 },
+    { "fuselage.l", 19.3 }, { "fuselage.h", 3.84 }, { "fuselage.w", 4.34 }, { "fuselage.l_n", 3.25 },
+    { "fuselage.wetted_area", 245.79 }, { "fuselage.cargo_ramp", 1.0 },
+    { "hor_tail.area", 2.73 }, { "hor_tail.span", 2.66 }, { "hor_tail.ar", 2.592 },
+    { "ver_tail.area", 4.24 }, { "ver_tail.height", 2.57 }, { "ver_tail.ar", 1.558 }, { "ver_tail.rotor", 1.0 },
+    { "engine.mass", 220.0 },
+    { "rotors.main_r", 9.3 }, { "rotors.main_cb", 0.47 }, { "rotors.main_rpm", 210.0 },
+    { "rotors.main_gear_ratio", 97.0 }, { "rotors.tail_r", 2.0 }, { "rotors.mcp", 6000.0 },
+    { "rotors.main_tip_vel", 204.52 }, { "rotors.main_blades", 5.0 },
+    { nullptr, 0.0 }
+};
+
+const Estimate estimatesAW101[] =
+{
+    { "fuselage"    ,    2451.810415 },
+    { "wing"        ,       0.000000 },
+    { "tail_hor"    ,      24.438978 },
+    { "tail_ver"    ,      36.135497 },
+    { "gear_main"   ,     489.250621 },
+    { "gear_nose"   ,       0.000000 },
+    { "engine"      ,     286.000000 },
+    { "all_else"    ,    3650.000000 },
+    { "rotor_drive" ,    1389.442254 },
+    { "rotor_hub"   ,     222.430998 },
+    { "rotor_main"  ,     393.015728 },
+    { "rotor_tail"  ,     112.075540 },
+    { nullptr, 0.0 }
+};
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestEstimatedMass : public ::testing::Test
+{
+protected:
+    TestEstimatedMass() {}
+    virtual ~TestEstimatedMass() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    void expectEstimates( mc::AircraftData::Type type,
+                          const Field fields[], const Estimate estimates[] )
+    {
+        mc::AircraftData data = mc::AircraftData();
+        data.type = type;
+
+        for ( int i = 0; fields[ i ].name != nullptr; ++i )
+        {
+            int index = mc::AircraftDataFields::getIndex( fields[ i ].name );
+            ASSERT_GE( index, 0 ) << fields[ i ].name;
+            ASSERT_TRUE( mc::AircraftDataFields::setValue( data, index, fields[ i ].value ) );
+        }
+
+        for ( int i = 0; estimates[ i ].type != nullptr; ++i )
+        {
+            std::unique_ptr< mc::Component > component( mc::ComponentFactory::create( estimates[ i ].type, &data ) );
+            ASSERT_NE( component.get(), nullptr ) << estimates[ i ].type;
+
+            EXPECT_NEAR( component->getEstimatedMass(), estimates[ i ].mass,
+                         1.0e-6 * estimates[ i ].mass + 1.0e-6 ) << estimates[ i ].type;
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimatedMass, CanEstimateF16C)
+{
+    expectEstimates( mc::AircraftData::FighterAttack, fieldsF16C, estimatesF16C );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimatedMass, CanEstimateC130)
+{
+    expectEstimates( mc::AircraftData::CargoTransport, fieldsC130, estimatesC130 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimatedMass, CanEstimateC172)
+{
+    expectEstimates( mc::AircraftData::GeneralAviation, fieldsC172, estimatesC172 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimatedMass, CanEstimateUH60)
+{
+    expectEstimates( mc::AircraftData::Helicopter, fieldsUH60, estimatesUH60 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimatedMass, CanEstimateAW101)
+{
+    expectEstimates( mc::AircraftData::Helicopter, fieldsAW101, estimatesAW101 );
+}
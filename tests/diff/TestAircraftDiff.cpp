@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include <Aircraft.h>
+#include <AircraftDataFields.h>
+
+#include <components/AllElse.h>
+#include <components/Fuselage.h>
+
+#include <diff/AircraftDiff.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestAircraftDiff : public ::testing::Test
+{
+protected:
+    TestAircraftDiff() {}
+    virtual ~TestAircraftDiff() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static void addComponent( mc::Aircraft *aircraft, const char *name, double mass, double x )
+    {
+        mc::Component *component = new mc::AllElse( aircraft->getData() );
+        component->setName( name );
+        component->setMass( mass );
+        component->setPosition( mc::Vector3( x, 0.0, 0.0 ) );
+        component->setLength( 1.0 );
+        component->setWidth( 1.0 );
+        component->setHeight( 1.0 );
+        aircraft->addComponent( component );
+    }
+
+    static void setField( mc::Aircraft *aircraft, const char *name, double value )
+    {
+        mc::AircraftData data = *aircraft->getData();
+        mc::AircraftDataFields::setValue( data, mc::AircraftDataFields::getIndex( name ), value );
+        aircraft->setData( data );
+    }
+
+    static const mc::AircraftDiff::ComponentDelta* find( const mc::AircraftDiff &diff,
+                                                         mc::AircraftDiff::Change change )
+    {
+        for ( const mc::AircraftDiff::ComponentDelta &delta : diff.getComponents() )
+        {
+            if ( delta.change == change ) return &delta;
+        }
+
+        return nullptr;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDiff, CanCompareSame)
+{
+    mc::Aircraft a1;
+    mc::Aircraft a2;
+
+    addComponent( &a1, "a", 10.0, 1.0 );
+    addComponent( &a2, "a", 10.0, 1.0 );
+
+    mc::AircraftDiff diff;
+    diff.compare( a1, a2 );
+
+    EXPECT_TRUE( diff.isEmpty() );
+    EXPECT_TRUE( diff.getFields().empty() );
+    EXPECT_TRUE( diff.getComponents().empty() );
+    EXPECT_FALSE( diff.isPointMassesChanged() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDiff, CanCompareFields)
+{
+    mc::Aircraft a1;
+    mc::Aircraft a2;
+
+    setField( &a1, "general.mtow", 1000.0 );
+    setField( &a2, "general.mtow", 1200.0 );
+
+    mc::AircraftDiff diff;
+    diff.compare( a1, a2 );
+
+    EXPECT_FALSE( diff.isEmpty() );
+    ASSERT_EQ( diff.getFields().size(), 1u );
+    EXPECT_EQ( diff.getFields()[ 0 ].index, mc::AircraftDataFields::getIndex( "general.mtow" ) );
+    EXPECT_DOUBLE_EQ( diff.getFields()[ 0 ].oldValue, 1000.0 );
+    EXPECT_DOUBLE_EQ( diff.getFields()[ 0 ].newValue, 1200.0 );
+    EXPECT_TRUE( diff.getComponents().empty() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDiff, CanCompareComponents)
+{
+    mc::Aircraft a1;
+    mc::Aircraft a2;
+
+    addComponent( &a1, "a", 10.0, 1.0 );
+    addComponent( &a1, "b", 20.0, 2.0 );
+    addComponent( &a1, "c", 30.0, 3.0 );
+
+    addComponent( &a2, "a", 15.0, 1.0 );
+    addComponent( &a2, "c", 30.0, 3.0 );
+    addComponent( &a2, "d", 40.0, 4.0 );
+
+    mc::AircraftDiff diff;
+    diff.compare( a1, a2 );
+
+    EXPECT_FALSE( diff.isEmpty() );
+    EXPECT_TRUE( diff.getFields().empty() );
+    ASSERT_EQ( diff.getComponents().size(), 3u );
+
+    const mc::AircraftDiff::ComponentDelta *modified = find( diff, mc::AircraftDiff::Modified );
+    ASSERT_NE( modified, nullptr );
+    EXPECT_EQ( modified->oldIndex, 0 );
+    EXPECT_EQ( modified->newIndex, 0 );
+    EXPECT_EQ( modified->oldData.name, "a" );
+    EXPECT_DOUBLE_EQ( modified->oldData.m, 10.0 );
+    EXPECT_DOUBLE_EQ( modified->newData.m, 15.0 );
+    EXPECT_DOUBLE_EQ( modified->mass, 5.0 );
+    EXPECT_DOUBLE_EQ( modified->firstMoment.x(), 5.0 );
+
+    const mc::AircraftDiff::ComponentDelta *removed = find( diff, mc::AircraftDiff::Removed );
+    ASSERT_NE( removed, nullptr );
+    EXPECT_EQ( removed->oldIndex, 1 );
+    EXPECT_EQ( removed->newIndex, -1 );
+    EXPECT_EQ( removed->oldData.name, "b" );
+    EXPECT_DOUBLE_EQ( removed->mass, -20.0 );
+    EXPECT_DOUBLE_EQ( removed->firstMoment.x(), -40.0 );
+
+    const mc::AircraftDiff::ComponentDelta *added = find( diff, mc::AircraftDiff::Added );
+    ASSERT_NE( added, nullptr );
+    EXPECT_EQ( added->oldIndex, -1 );
+    EXPECT_EQ( added->newIndex, 2 );
+    EXPECT_EQ( added->newData.name, "d" );
+    EXPECT_DOUBLE_EQ( added->mass, 40.0 );
+
+    // deltas add up to the total difference
+    double mass = 0.0;
+    double ixx  = 0.0;
+
+    for ( const mc::AircraftDiff::ComponentDelta &delta : diff.getComponents() )
+    {
+        mass += delta.mass;
+        ixx  += delta.inertia.getMatrix().xx();
+    }
+
+    EXPECT_DOUBLE_EQ( diff.getNewMassTotal() - diff.getOldMassTotal(), mass );
+    EXPECT_NEAR( diff.getNewInertiaMatrix().xx() - diff.getOldInertiaMatrix().xx(), ixx, 1.0e-9 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDiff, CanMatchComponentsByTypeAndName)
+{
+    mc::Aircraft a1;
+    mc::Aircraft a2;
+
+    addComponent( &a1, "x", 10.0, 1.0 );
+    addComponent( &a1, "x", 20.0, 2.0 );
+
+    // changing type is removal and addition
+    mc::Component *fuselage = new mc::Fuselage( a2.getData() );
+    fuselage->setName( "x" );
+    fuselage->setMass( 10.0 );
+    fuselage->setPosition( mc::Vector3( 1.0, 0.0, 0.0 ) );
+    a2.addComponent( fuselage );
+
+    addComponent( &a2, "x", 20.0, 2.0 );
+
+    std::vector< int > matches = mc::AircraftDiff::match( a1.getComponents(), a2.getComponents() );
+
+    ASSERT_EQ( matches.size(), 2u );
+    EXPECT_EQ( matches[ 0 ], -1 );
+    EXPECT_EQ( matches[ 1 ], 1 );
+
+    mc::AircraftDiff diff;
+    diff.compare( a1, a2 );
+
+    ASSERT_EQ( diff.getComponents().size(), 2u );
+    EXPECT_EQ( diff.getComponents()[ 0 ].change, mc::AircraftDiff::Removed );
+    EXPECT_EQ( diff.getComponents()[ 1 ].change, mc::AircraftDiff::Added );
+    EXPECT_EQ( diff.getComponents()[ 1 ].newData.type, mc::Fuselage::xmlTagName );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftDiff, CanMatchComponentsInOrderOfOccurrence)
+{
+    mc::Aircraft a1;
+    mc::Aircraft a2;
+
+    addComponent( &a1, "a", 10.0, 1.0 );
+    addComponent( &a1, "x", 20.0, 2.0 );
+    addComponent( &a1, "x", 30.0, 3.0 );
+    addComponent( &a1, "b", 40.0, 4.0 );
+
+    addComponent( &a2, "c", 50.0, 5.0 );
+    addComponent( &a2, "x", 21.0, 2.0 );
+    addComponent( &a2, "x", 31.0, 3.0 );
+    addComponent( &a2, "d", 60.0, 6.0 );
+
+    std::vector< int > matches = mc::AircraftDiff::match( a1.getComponents(), a2.getComponents() );
+
+    ASSERT_EQ( matches.size(), 4u );
+    EXPECT_EQ( matches[ 0 ], -1 );
+    EXPECT_EQ( matches[ 1 ], 1 );
+    EXPECT_EQ( matches[ 2 ], 2 );
+    EXPECT_EQ( matches[ 3 ], -1 );
+}
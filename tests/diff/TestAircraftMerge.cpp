@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include <Aircraft.h>
+#include <AircraftDataFields.h>
+
+#include <components/AllElse.h>
+
+#include <diff/AircraftMerge.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestAircraftMerge : public ::testing::Test
+{
+protected:
+    TestAircraftMerge() {}
+    virtual ~TestAircraftMerge() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static void addComponent( mc::Aircraft *aircraft, const char *name, double mass )
+    {
+        mc::Component *component = new mc::AllElse( aircraft->getData() );
+        component->setName( name );
+        component->setMass( mass );
+        component->setPosition( mc::Vector3( mass / 10.0, 0.0, 0.0 ) );
+        aircraft->addComponent( component );
+    }
+
+    static void setMass( mc::Aircraft *aircraft, const char *name, double mass )
+    {
+        aircraft->getComponent( find( *aircraft, name ) )->setMass( mass );
+        aircraft->update();
+    }
+
+    static void delComponent( mc::Aircraft *aircraft, const char *name )
+    {
+        aircraft->delComponent( find( *aircraft, name ) );
+    }
+
+    static int find( const mc::Aircraft &aircraft, const char *name )
+    {
+        for ( size_t i = 0; i < aircraft.getComponents().size(); ++i )
+        {
+            if ( strcmp( aircraft.getComponents()[ i ]->getName(), name ) == 0 ) return static_cast< int >( i );
+        }
+
+        return -1;
+    }
+
+    static double getMass( const mc::Aircraft &aircraft, const char *name )
+    {
+        int index = find( aircraft, name );
+        return index < 0 ? -1.0 : aircraft.getComponents()[ index ]->getMass();
+    }
+
+    static void setField( mc::Aircraft *aircraft, const char *name, double value )
+    {
+        mc::AircraftData data = *aircraft->getData();
+        mc::AircraftDataFields::setValue( data, mc::AircraftDataFields::getIndex( name ), value );
+        aircraft->setData( data );
+    }
+
+    static double getField( const mc::Aircraft &aircraft, const char *name )
+    {
+        return mc::AircraftDataFields::getValue( *aircraft.getData(), mc::AircraftDataFields::getIndex( name ) );
+    }
+
+    /** Creates aircraft of components "a", "b", "c" and "d". */
+    static void createBase( mc::Aircraft *aircraft )
+    {
+        setField( aircraft, "general.mtow", 1000.0 );
+        setField( aircraft, "wing.area", 20.0 );
+
+        addComponent( aircraft, "a", 10.0 );
+        addComponent( aircraft, "b", 20.0 );
+        addComponent( aircraft, "c", 30.0 );
+        addComponent( aircraft, "d", 40.0 );
+    }
+
+    static bool hasConflict( const mc::AircraftMerge::Conflicts &conflicts, const std::string &text )
+    {
+        return std::any_of( conflicts.begin(), conflicts.end(), [ &text ]( const std::string &conflict )
+        {
+            return conflict.find( text ) != std::string::npos;
+        });
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftMerge, CanMergeWithoutConflicts)
+{
+    mc::Aircraft base;
+    mc::Aircraft ours;
+    mc::Aircraft theirs;
+
+    createBase( &base );
+    createBase( &ours );
+    createBase( &theirs );
+
+    setField( &ours, "general.mtow", 1100.0 );
+    setMass( &ours, "a", 11.0 );
+    addComponent( &ours, "e", 50.0 );
+
+    setField( &theirs, "wing.area", 22.0 );
+    setMass( &theirs, "b", 22.0 );
+    delComponent( &theirs, "c" );
+    addComponent( &theirs, "f", 60.0 );
+
+    // the same change on both sides is not a conflict
+    setMass( &ours, "d", 44.0 );
+    setMass( &theirs, "d", 44.0 );
+
+    mc::AircraftMerge::Conflicts conflicts;
+    EXPECT_TRUE( mc::AircraftMerge::merge( base, theirs, &ours, &conflicts ) );
+    EXPECT_TRUE( conflicts.empty() );
+
+    EXPECT_DOUBLE_EQ( getField( ours, "general.mtow" ), 1100.0 );
+    EXPECT_DOUBLE_EQ( getField( ours, "wing.area" ), 22.0 );
+
+    EXPECT_EQ( ours.getComponents().size(), 5u );
+    EXPECT_DOUBLE_EQ( getMass( ours, "a" ), 11.0 );
+    EXPECT_DOUBLE_EQ( getMass( ours, "b" ), 22.0 );
+    EXPECT_EQ( find( ours, "c" ), -1 );
+    EXPECT_DOUBLE_EQ( getMass( ours, "d" ), 44.0 );
+    EXPECT_DOUBLE_EQ( getMass( ours, "e" ), 50.0 );
+    EXPECT_DOUBLE_EQ( getMass( ours, "f" ), 60.0 );
+
+    EXPECT_DOUBLE_EQ( ours.getMassTotal(), 11.0 + 22.0 + 44.0 + 50.0 + 60.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftMerge, CanResolveConflictsInFavourOfOurs)
+{
+    mc::Aircraft base;
+    mc::Aircraft ours;
+    mc::Aircraft theirs;
+
+    createBase( &base );
+    createBase( &ours );
+    createBase( &theirs );
+
+    setField( &ours   , "general.mtow", 1100.0 );
+    setField( &theirs , "general.mtow", 1200.0 );
+
+    setMass( &ours   , "a", 11.0 );
+    setMass( &theirs , "a", 12.0 );
+
+    delComponent( &ours, "b" );
+    setMass( &theirs, "b", 22.0 );
+
+    setMass( &ours, "c", 33.0 );
+    delComponent( &theirs, "c" );
+
+    addComponent( &ours   , "e", 50.0 );
+    addComponent( &theirs , "e", 55.0 );
+
+    mc::AircraftMerge::Conflicts conflicts;
+    EXPECT_FALSE( mc::AircraftMerge::merge( base, theirs, &ours, &conflicts ) );
+
+    EXPECT_EQ( conflicts.size(), 5u );
+    EXPECT_TRUE( hasConflict( conflicts, "field general.mtow modified on both sides" ) );
+    EXPECT_TRUE( hasConflict( conflicts, "\"a\" modified on both sides" ) );
+    EXPECT_TRUE( hasConflict( conflicts, "\"b\" modified by theirs and removed by ours" ) );
+    EXPECT_TRUE( hasConflict( conflicts, "\"c\" removed by theirs and modified by ours" ) );
+    EXPECT_TRUE( hasConflict( conflicts, "\"e\" added on both sides" ) );
+
+    EXPECT_DOUBLE_EQ( getField( ours, "general.mtow" ), 1100.0 );
+
+    EXPECT_EQ( ours.getComponents().size(), 4u );
+    EXPECT_DOUBLE_EQ( getMass( ours, "a" ), 11.0 );
+    EXPECT_EQ( find( ours, "b" ), -1 );
+    EXPECT_DOUBLE_EQ( getMass( ours, "c" ), 33.0 );
+    EXPECT_DOUBLE_EQ( getMass( ours, "d" ), 40.0 );
+    EXPECT_DOUBLE_EQ( getMass( ours, "e" ), 50.0 );
+
+    EXPECT_DOUBLE_EQ( ours.getMassTotal(), 11.0 + 33.0 + 40.0 + 50.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftMerge, CanMergePointMasses)
+{
+    mc::Aircraft base;
+    mc::Aircraft ours;
+    mc::Aircraft theirs;
+
+    mc::PointMasses points;
+    points.add( 1, 5.0, mc::Vector3( 1.0, 0.0, 0.0 ) );
+    theirs.setPointMasses( points, "points.csv" );
+
+    EXPECT_TRUE( mc::AircraftMerge::merge( base, theirs, &ours ) );
+    EXPECT_EQ( ours.getPointMasses().getCount(), 1u );
+    EXPECT_EQ( ours.getPointMassesFile(), "points.csv" );
+    EXPECT_DOUBLE_EQ( ours.getMassTotal(), 5.0 );
+
+    // modified on both sides
+    mc::Aircraft other;
+    mc::PointMasses otherPoints;
+    otherPoints.add( 2, 7.0, mc::Vector3( 0.0, 1.0, 0.0 ) );
+    other.setPointMasses( otherPoints, "other.csv" );
+
+    mc::AircraftMerge::Conflicts conflicts;
+    EXPECT_FALSE( mc::AircraftMerge::merge( base, other, &ours, &conflicts ) );
+    ASSERT_EQ( conflicts.size(), 1u );
+    EXPECT_EQ( conflicts[ 0 ], "point masses modified on both sides" );
+    EXPECT_EQ( ours.getPointMassesFile(), "points.csv" );
+}
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <Aircraft.h>
+
+#include <components/AllElse.h>
+
+#include <estimation/EstimationEnsemble.h>
+
+#include <fleet/FleetGenerator.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestEstimationEnsemble : public ::testing::Test
+{
+protected:
+    TestEstimationEnsemble() {}
+    virtual ~TestEstimationEnsemble() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    /** Method counting estimates, does not cover engines. */
+    class CountingMethod : public mc::EstimationMethod
+    {
+    public:
+
+        CountingMethod( std::atomic< int > *calls ) : _calls ( calls ) {}
+
+        const char* getName() const override { return "counting"; }
+
+        bool estimateMass( const char *xmlTagName, const mc::AircraftData &data,
+                           double *mass ) const override
+        {
+            ( *_calls )++;
+
+            if ( std::string( xmlTagName ) == "engine" ) return false;
+
+            *mass = 0.01 * data.general.mtow + std::string( xmlTagName ).size();
+
+            return true;
+        }
+
+    private:
+
+        std::atomic< int > *_calls;
+    };
+
+    /** Returns CSV line columns, quoted text may contain separators. */
+    static std::vector< std::string > split( const std::string &line )
+    {
+        std::vector< std::string > columns( 1 );
+        bool quoted = false;
+
+        for ( char c : line )
+        {
+            if ( c == '"' ) quoted = !quoted;
+
+            if ( c == ',' && !quoted )
+                columns.push_back( std::string() );
+            else
+                columns.back() += c;
+        }
+
+        return columns;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimationEnsemble, CanEstimateOncePerType)
+{
+    const int count = 40;
+
+    std::atomic< int > calls( 0 );
+
+    mc::EstimationEnsemble ensemble;
+    ensemble.addMethod( new CountingMethod( &calls ) );
+
+    const int methodsCount = static_cast< int >( ensemble.getMethods().size() );
+
+    mc::FleetGenerator generator( 5 );
+    generator.setComponentsCount( 20 );
+
+    std::vector< std::unique_ptr< mc::Aircraft > > aircraft;
+    std::vector< const mc::Aircraft* > fleet;
+
+    int typesCount = 0;
+
+    for ( int i = 0; i < count; ++i )
+    {
+        aircraft.emplace_back( new mc::Aircraft() );
+        generator.generate( i, aircraft.back().get() );
+
+        // there are always components of the same type
+        for ( int j = 0; j < 3; ++j )
+        {
+            aircraft.back()->addComponent( new mc::AllElse( aircraft.back()->getData() ) );
+        }
+
+        std::set< std::string > types;
+
+        for ( const mc::Component *component : aircraft.back()->getComponents() )
+        {
+            types.insert( component->getXmlTagName() );
+        }
+
+        typesCount += static_cast< int >( types.size() );
+
+        fleet.push_back( aircraft.back().get() );
+    }
+
+    std::vector< mc::EstimationEnsemble::Results > results;
+    ensemble.evaluate( fleet, &results );
+
+    EXPECT_EQ( calls.load(), typesCount );
+
+    ASSERT_EQ( results.size(), fleet.size() );
+
+    for ( int i = 0; i < count; ++i )
+    {
+        const mc::Aircraft::Components &components = fleet[ i ]->getComponents();
+
+        ASSERT_EQ( results[ i ].size(), components.size() );
+
+        for ( size_t j = 0; j < components.size(); ++j )
+        {
+            const mc::EstimationEnsemble::Result &result = results[ i ][ j ];
+
+            EXPECT_EQ( result.name, components[ j ]->getName() );
+            EXPECT_EQ( result.type, components[ j ]->getXmlTagName() );
+
+            ASSERT_EQ( result.masses.size(), static_cast< size_t >( methodsCount ) );
+
+            for ( int k = 0; k < methodsCount; ++k )
+            {
+                double mass = 0.0;
+
+                if ( ensemble.getMethods()[ k ]->estimateMass( result.type.c_str(), *fleet[ i ]->getData(), &mass ) )
+                    EXPECT_EQ( result.masses[ k ], mass ) << i << " " << result.type;
+                else
+                    EXPECT_TRUE( std::isnan( result.masses[ k ] ) ) << i << " " << result.type;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimationEnsemble, CanComputeStatistics)
+{
+    std::atomic< int > calls( 0 );
+
+    mc::EstimationEnsemble ensemble;
+    ensemble.addMethod( new CountingMethod( &calls ) );
+
+    mc::FleetGenerator generator( 7 );
+
+    for ( int i = 0; i < 8; ++i )
+    {
+        mc::Aircraft aircraft;
+        generator.generate( i, &aircraft );
+
+        mc::EstimationEnsemble::Results results;
+        ensemble.evaluate( aircraft, &results );
+
+        ASSERT_EQ( results.size(), aircraft.getComponents().size() );
+
+        for ( const mc::EstimationEnsemble::Result &result : results )
+        {
+            std::vector< double > masses;
+
+            for ( const mc::EstimationMethod *method : ensemble.getMethods() )
+            {
+                double mass = 0.0;
+                if ( method->estimateMass( result.type.c_str(), *aircraft.getData(), &mass ) ) masses.push_back( mass );
+            }
+
+            ASSERT_EQ( result.count, static_cast< int >( masses.size() ) ) << result.type;
+            ASSERT_FALSE( masses.empty() );
+
+            double mean = 0.0;
+            double min  = masses[ 0 ];
+            double max  = masses[ 0 ];
+
+            for ( double mass : masses )
+            {
+                mean += mass / masses.size();
+                min = std::min( min, mass );
+                max = std::max( max, mass );
+            }
+
+            // population standard deviation
+            double var = 0.0;
+            for ( double mass : masses ) var += ( mass - mean ) * ( mass - mean ) / masses.size();
+
+            const double tol = 1.0e-12 * std::max( 1.0, max );
+
+            EXPECT_NEAR( result.mean   , mean, tol ) << result.type;
+            EXPECT_NEAR( result.stdDev , sqrt( var ), 1.0e-6 * std::max( 1.0, max ) ) << result.type;
+            EXPECT_DOUBLE_EQ( result.min, min ) << result.type;
+            EXPECT_DOUBLE_EQ( result.max, max ) << result.type;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimationEnsemble, CanWriteCsv)
+{
+    std::atomic< int > calls( 0 );
+
+    mc::EstimationEnsemble ensemble;
+    ensemble.addMethod( new CountingMethod( &calls ) );
+
+    std::ostringstream header;
+    ensemble.writeCsvHeader( &header );
+
+    EXPECT_EQ( header.str(), "file,component,type,raymer,torenbeek,usaf,counting,count,mean,min,max,std_dev\n" );
+
+    const size_t columnsCount = split( header.str().substr( 0, header.str().size() - 1 ) ).size();
+
+    // methods not covering component are left empty, text is quoted
+    mc::EstimationEnsemble::Result result;
+
+    result.name   = "wing \"main\", left";
+    result.type   = "wing";
+    result.masses = { 1.5, std::numeric_limits< double >::quiet_NaN(), 2.5, 2.0 };
+    result.count  = 3;
+    result.mean   = 2.0;
+    result.min    = 1.5;
+    result.max    = 2.5;
+    result.stdDev = 0.25;
+
+    std::ostringstream row;
+    mc::EstimationEnsemble::writeCsv( "dir/c172.xml", mc::EstimationEnsemble::Results( 1, result ), &row );
+
+    EXPECT_EQ( row.str(), "\"dir/c172.xml\",\"wing \"\"main\"\", left\",wing,1.5,,2.5,2,3,2,1.5,2.5,0.25\n" );
+    EXPECT_EQ( split( row.str().substr( 0, row.str().size() - 1 ) ).size(), columnsCount );
+
+    // results of real aircraft, as many columns as in the header
+    mc::FleetGenerator generator( 9 );
+
+    mc::Aircraft aircraft;
+    generator.generate( 0, &aircraft );
+
+    mc::EstimationEnsemble::Results results;
+    ensemble.evaluate( aircraft, &results );
+
+    std::ostringstream rows;
+    mc::EstimationEnsemble::writeCsv( "c172.xml", results, &rows );
+
+    std::istringstream in( rows.str() );
+    std::string line;
+    size_t linesCount = 0;
+
+    while ( std::getline( in, line ) )
+    {
+        std::vector< std::string > columns = split( line );
+
+        ASSERT_EQ( columns.size(), columnsCount ) << line;
+        EXPECT_EQ( columns[ 2 ], results[ linesCount ].type );
+
+        // full precision
+        EXPECT_EQ( std::stod( columns[ columnsCount - 4 ] ), results[ linesCount ].mean );
+
+        linesCount++;
+    }
+
+    EXPECT_EQ( linesCount, results.size() );
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <Aircraft.h>
+
+#include <components/Component.h>
+#include <components/ComponentFactory.h>
+
+#include <estimation/EstimationKernel.h>
+
+#include <fleet/FleetGenerator.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestEstimationKernel : public ::testing::Test
+{
+protected:
+    TestEstimationKernel() {}
+    virtual ~TestEstimationKernel() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimationKernel, CanGetGroup)
+{
+    for ( int i = 0; i < mc::EstimationKernel::GroupsCount; ++i )
+    {
+        mc::EstimationKernel::Group group = static_cast< mc::EstimationKernel::Group >( i );
+        EXPECT_EQ( mc::EstimationKernel::getGroup( mc::EstimationKernel::getXmlTagName( group ) ), group );
+    }
+
+    EXPECT_EQ( mc::EstimationKernel::getGroup( "unknown" ), mc::EstimationKernel::GroupsCount );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEstimationKernel, CanEstimateAsComponents)
+{
+    const int count = 40;
+
+    mc::FleetGenerator generator( 3 );
+
+    std::vector< std::unique_ptr< mc::Aircraft > > fleet;
+    std::vector< const mc::AircraftData* > fleetData;
+
+    for ( int i = 0; i < count; ++i )
+    {
+        fleet.emplace_back( new mc::Aircraft() );
+        generator.generate( i, fleet.back().get() );
+        fleetData.push_back( fleet.back()->getData() );
+    }
+
+    std::vector< mc::EstimationKernel::Masses > fleetMasses;
+    mc::EstimationKernel::estimate( fleetData, &fleetMasses );
+
+    ASSERT_EQ( fleetMasses.size(), static_cast< size_t >( count ) );
+
+    for ( int i = 0; i < count; ++i )
+    {
+        mc::EstimationKernel::Masses masses;
+        mc::EstimationKernel::estimate( *fleetData[ i ], &masses );
+
+        for ( int j = 0; j < mc::EstimationKernel::GroupsCount; ++j )
+        {
+            const char *xmlTagName = mc::EstimationKernel::getXmlTagName( static_cast< mc::EstimationKernel::Group >( j ) );
+
+            std::unique_ptr< mc::Component > component( mc::ComponentFactory::create( xmlTagName, fleetData[ i ] ) );
+            ASSERT_NE( component.get(), nullptr );
+
+            EXPECT_EQ( masses[ j ], component->getEstimatedMass() ) << i << " " << xmlTagName;
+            EXPECT_EQ( fleetMasses[ i ][ j ], masses[ j ] ) << i << " " << xmlTagName;
+        }
+    }
+}
@@ -0,0 +1,402 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <export/ArrowWriter.h>
+#include <export/ExportSchema.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestArrowWriter : public ::testing::Test
+{
+protected:
+    TestArrowWriter() {}
+    virtual ~TestArrowWriter() {}
+
+    void SetUp() override
+    {
+        _fileName = ::testing::TempDir() + "test_arrow_writer.arrow";
+        std::remove( _fileName.c_str() );
+    }
+
+    void TearDown() override
+    {
+        std::remove( _fileName.c_str() );
+    }
+
+    std::string _fileName;
+
+    /** Encapsulated IPC message, metadata and body. */
+    struct Message
+    {
+        std::string metadata;
+        std::string body;
+    };
+
+    /** Minimal flatbuffers table reader. */
+    struct Table
+    {
+        const std::string *data = nullptr;
+        size_t pos = 0;
+
+        template< typename TYPE >
+        TYPE read( size_t offset ) const
+        {
+            TYPE value;
+            memcpy( &value, data->data() + offset, sizeof(TYPE) );
+            return value;
+        }
+
+        /** Returns field position, 0 if field is absent. */
+        size_t getField( int index ) const
+        {
+            size_t vtable = pos - read< int32_t >( pos );
+            uint16_t vtableSize = read< uint16_t >( vtable );
+
+            if ( 4 + 2 * index >= vtableSize ) return 0;
+
+            uint16_t offset = read< uint16_t >( vtable + 4 + 2 * index );
+            return offset > 0 ? pos + offset : 0;
+        }
+
+        template< typename TYPE >
+        TYPE getScalar( int index, TYPE def = 0 ) const
+        {
+            size_t field = getField( index );
+            return field > 0 ? read< TYPE >( field ) : def;
+        }
+
+        /** Returns position of the referenced object (table, vector or string). */
+        size_t getOffset( int index ) const
+        {
+            size_t field = getField( index );
+            return field + read< uint32_t >( field );
+        }
+
+        Table getTable( int index ) const
+        {
+            Table table;
+            table.data = data;
+            table.pos = getOffset( index );
+            return table;
+        }
+
+        uint32_t getVectorSize( int index ) const
+        {
+            return read< uint32_t >( getOffset( index ) );
+        }
+
+        Table getVectorTable( int index, uint32_t item ) const
+        {
+            size_t element = getOffset( index ) + 4 + 4 * item;
+
+            Table table;
+            table.data = data;
+            table.pos = element + read< uint32_t >( element );
+            return table;
+        }
+
+        /** Returns int64 pair of vector of structs (FieldNode and Buffer). */
+        void getVectorStruct( int index, uint32_t item, int64_t *first, int64_t *second ) const
+        {
+            size_t element = getOffset( index ) + 4 + 16 * item;
+            *first  = read< int64_t >( element );
+            *second = read< int64_t >( element + 8 );
+        }
+
+        std::string getString( int index ) const
+        {
+            size_t str = getOffset( index );
+            return data->substr( str + 4, read< uint32_t >( str ) );
+        }
+    };
+
+    static Table getRoot( const Message &message )
+    {
+        Table table;
+        table.data = &message.metadata;
+        table.pos = table.read< uint32_t >( 0 );
+        return table;
+    }
+
+    std::string readFile() const
+    {
+        std::ifstream fs( _fileName.c_str(), std::ios_base::in | std::ios_base::binary );
+        return std::string( ( std::istreambuf_iterator< char >( fs ) ), std::istreambuf_iterator< char >() );
+    }
+
+    /** Splits stream into messages, checks markers, alignment and end-of-stream. */
+    static std::vector< Message > readMessages( const std::string &stream )
+    {
+        std::vector< Message > messages;
+
+        size_t pos = 0;
+
+        while ( pos + 8 <= stream.size() )
+        {
+            uint32_t marker = 0;
+            int32_t length = 0;
+            memcpy( &marker, stream.data() + pos, 4 );
+            memcpy( &length, stream.data() + pos + 4, 4 );
+
+            EXPECT_EQ( marker, 0xFFFFFFFF );
+            EXPECT_EQ( length % 8, 0 );
+
+            pos += 8;
+
+            if ( length == 0 )
+            {
+                // end-of-stream is the last thing in the stream
+                EXPECT_EQ( pos, stream.size() );
+                return messages;
+            }
+
+            Message message;
+            message.metadata = stream.substr( pos, length );
+            pos += length;
+
+            int64_t bodyLength = getRoot( message ).getScalar< int64_t >( 3 );
+            EXPECT_EQ( bodyLength % 8, 0 );
+
+            message.body = stream.substr( pos, bodyLength );
+            pos += bodyLength;
+
+            messages.push_back( message );
+        }
+
+        ADD_FAILURE() << "Missing end-of-stream marker";
+        return messages;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestArrowWriter, CanWriteStream)
+{
+    mc::ExportSchema schema( mc::ExportSchema::AircraftRows );
+
+    const mc::ExportSchema::Columns &columns = schema.getColumns();
+
+    const int rowsCount = 11;
+    const int batchSize = 10;
+
+    mc::ArrowWriter writer( &schema, batchSize );
+    ASSERT_TRUE( writer.open( _fileName.c_str() ) );
+
+    for ( int r = 0; r < rowsCount; ++r )
+    {
+        mc::ExportSchema::Row row( columns.size() );
+
+        for ( size_t i = 0; i < columns.size(); ++i )
+        {
+            if ( columns[ i ].type == mc::ExportSchema::Utf8 )
+                row[ i ].text = std::string( r, 'a' + r );
+            else if ( columns[ i ].type == mc::ExportSchema::Boolean )
+                row[ i ].number = ( r % 3 == 0 ) ? 1.0 : 0.0;
+            else
+                row[ i ].number = r;
+        }
+
+        EXPECT_TRUE( writer.write( row ) );
+    }
+
+    EXPECT_TRUE( writer.close() );
+
+    std::vector< Message > messages = readMessages( readFile() );
+
+    // schema followed by full batch and the remaining rows
+    ASSERT_EQ( messages.size(), 3 );
+
+    // schema
+    {
+        Table message = getRoot( messages[ 0 ] );
+
+        EXPECT_EQ( message.getScalar< int16_t >( 0 ), 4 );     // V5
+        EXPECT_EQ( message.getScalar< uint8_t >( 1 ), 1 );     // Schema
+        EXPECT_TRUE( messages[ 0 ].body.empty() );
+
+        Table schemaTable = message.getTable( 2 );
+        ASSERT_EQ( schemaTable.getVectorSize( 1 ), columns.size() );
+
+        for ( size_t i = 0; i < columns.size(); ++i )
+        {
+            Table field = schemaTable.getVectorTable( 1, i );
+
+            EXPECT_EQ( field.getString( 0 ), columns[ i ].name );
+            EXPECT_EQ( field.getScalar< uint8_t >( 1 ), 0 );   // not nullable
+
+            uint8_t typeType = 0;
+
+            switch ( columns[ i ].type )
+            {
+                case mc::ExportSchema::Float64: typeType = 3; break;
+                case mc::ExportSchema::Int32:   typeType = 2; break;
+                case mc::ExportSchema::Boolean: typeType = 6; break;
+                case mc::ExportSchema::Utf8:    typeType = 5; break;
+            }
+
+            EXPECT_EQ( field.getScalar< uint8_t >( 2 ), typeType ) << columns[ i ].name;
+        }
+    }
+
+    // record batches
+    for ( int b = 0; b < 2; ++b )
+    {
+        const Message &batch = messages[ 1 + b ];
+
+        const int64_t length = b == 0 ? batchSize : rowsCount - batchSize;
+        const int first = b * batchSize;
+
+        Table message = getRoot( batch );
+
+        EXPECT_EQ( message.getScalar< int16_t >( 0 ), 4 );     // V5
+        EXPECT_EQ( message.getScalar< uint8_t >( 1 ), 3 );     // RecordBatch
+
+        Table recordBatch = message.getTable( 2 );
+
+        EXPECT_EQ( recordBatch.getScalar< int64_t >( 0 ), length );
+        ASSERT_EQ( recordBatch.getVectorSize( 1 ), columns.size() );
+
+        uint32_t buffer = 0;
+
+        for ( size_t i = 0; i < columns.size(); ++i )
+        {
+            int64_t nodeLength = 0;
+            int64_t nullCount = 0;
+            recordBatch.getVectorStruct( 1, i, &nodeLength, &nullCount );
+
+            EXPECT_EQ( nodeLength, length );
+            EXPECT_EQ( nullCount, 0 );
+
+            int64_t offset = 0;
+            int64_t size = 0;
+
+            // validity bitmap omitted, all values are valid
+            recordBatch.getVectorStruct( 2, buffer++, &offset, &size );
+            EXPECT_EQ( size, 0 );
+
+            if ( columns[ i ].type == mc::ExportSchema::Utf8 )
+            {
+                recordBatch.getVectorStruct( 2, buffer++, &offset, &size );
+                ASSERT_EQ( size, ( length + 1 ) * 4 );
+                EXPECT_EQ( offset % 8, 0 );
+
+                std::vector< int32_t > offsets( length + 1 );
+                memcpy( offsets.data(), batch.body.data() + offset, size );
+
+                recordBatch.getVectorStruct( 2, buffer++, &offset, &size );
+                EXPECT_EQ( offset % 8, 0 );
+                ASSERT_LE( offset + size, static_cast< int64_t >( batch.body.size() ) );
+                EXPECT_EQ( size, offsets.back() );
+
+                for ( int r = 0; r < length; ++r )
+                {
+                    std::string text = batch.body.substr( offset + offsets[ r ], offsets[ r + 1 ] - offsets[ r ] );
+                    EXPECT_EQ( text, std::string( first + r, 'a' + first + r ) );
+                }
+            }
+            else
+            {
+                recordBatch.getVectorStruct( 2, buffer++, &offset, &size );
+                EXPECT_EQ( offset % 8, 0 );
+                ASSERT_LE( offset + size, static_cast< int64_t >( batch.body.size() ) );
+
+                const char *values = batch.body.data() + offset;
+
+                switch ( columns[ i ].type )
+                {
+                    case mc::ExportSchema::Float64:
+                    {
+                        ASSERT_EQ( size, length * 8 );
+                        for ( int r = 0; r < length; ++r )
+                        {
+                            double value = 0.0;
+                            memcpy( &value, values + 8 * r, 8 );
+                            EXPECT_DOUBLE_EQ( value, first + r );
+                        }
+                        break;
+                    }
+
+                    case mc::ExportSchema::Int32:
+                    {
+                        ASSERT_EQ( size, length * 4 );
+                        for ( int r = 0; r < length; ++r )
+                        {
+                            int32_t value = 0;
+                            memcpy( &value, values + 4 * r, 4 );
+                            EXPECT_EQ( value, first + r );
+                        }
+                        break;
+                    }
+
+                    case mc::ExportSchema::Boolean:
+                    {
+                        // bit-packed, least significant bit first
+                        ASSERT_EQ( size, ( length + 7 ) / 8 );
+                        for ( int r = 0; r < length; ++r )
+                        {
+                            bool value = ( values[ r / 8 ] >> ( r % 8 ) ) & 1;
+                            EXPECT_EQ( value, ( first + r ) % 3 == 0 );
+                        }
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+            }
+        }
+
+        EXPECT_EQ( recordBatch.getVectorSize( 2 ), buffer );
+    }
+
+    // first batch bools of rows 0, 3, 6 and 9
+    {
+        Table recordBatch = getRoot( messages[ 1 ] ).getTable( 2 );
+
+        uint32_t buffer = 0;
+
+        for ( size_t i = 0; i < columns.size(); ++i )
+        {
+            buffer += columns[ i ].type == mc::ExportSchema::Utf8 ? 3 : 2;
+
+            if ( columns[ i ].type == mc::ExportSchema::Boolean )
+            {
+                int64_t offset = 0;
+                int64_t size = 0;
+                recordBatch.getVectorStruct( 2, buffer - 1, &offset, &size );
+
+                ASSERT_EQ( size, 2 );
+                EXPECT_EQ( static_cast< uint8_t >( messages[ 1 ].body[ offset     ] ), 0x49 );
+                EXPECT_EQ( static_cast< uint8_t >( messages[ 1 ].body[ offset + 1 ] ), 0x02 );
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestArrowWriter, CanWriteEmptyStream)
+{
+    mc::ExportSchema schema( mc::ExportSchema::ComponentRows );
+
+    mc::ArrowWriter writer( &schema );
+    ASSERT_TRUE( writer.open( _fileName.c_str() ) );
+    EXPECT_TRUE( writer.close() );
+
+    const std::string stream = readFile();
+
+    // schema only, no empty record batch
+    std::vector< Message > messages = readMessages( stream );
+    ASSERT_EQ( messages.size(), 1 );
+    EXPECT_EQ( getRoot( messages[ 0 ] ).getScalar< uint8_t >( 1 ), 1 );
+
+    ASSERT_GE( stream.size(), 8 );
+    EXPECT_EQ( stream.substr( stream.size() - 8 ), std::string( "\xFF\xFF\xFF\xFF\0\0\0\0", 8 ) );
+}
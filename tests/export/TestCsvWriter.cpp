@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include <export/ExportSchema.h>
+#include <export/ExportWriter.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestCsvWriter : public ::testing::Test
+{
+protected:
+    TestCsvWriter() {}
+    virtual ~TestCsvWriter() {}
+
+    void SetUp() override
+    {
+        _fileName = ::testing::TempDir() + "test_csv_writer.csv";
+        std::remove( _fileName.c_str() );
+    }
+
+    void TearDown() override
+    {
+        std::remove( _fileName.c_str() );
+    }
+
+    std::string _fileName;
+
+    std::string readFile() const
+    {
+        std::ifstream fs( _fileName.c_str(), std::ios_base::in | std::ios_base::binary );
+        return std::string( ( std::istreambuf_iterator< char >( fs ) ), std::istreambuf_iterator< char >() );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestCsvWriter, CanWriteComponentRows)
+{
+    mc::ExportSchema schema( mc::ExportSchema::ComponentRows );
+
+    mc::FleetRecord record;
+    record.fileName = "aircraft.xml";
+
+    mc::ComponentData data;
+    data.type = "all_else";
+    data.name = "Equipment";
+    data.r = mc::Vector3( 1.0, -2.0, 0.5 );
+    data.m = 10.5;
+    record.components.push_back( data );
+    record.estimatedMasses.push_back( 12.25 );
+
+    std::unique_ptr< mc::ExportWriter > writer( mc::ExportWriter::create( mc::ExportWriter::CSV, &schema ) );
+    ASSERT_TRUE( writer->open( _fileName.c_str() ) );
+
+    mc::ExportSchema::Row row;
+    schema.getRow( record, 0, &row );
+
+    EXPECT_TRUE( writer->write( row ) );
+    EXPECT_TRUE( writer->close() );
+
+    EXPECT_EQ( readFile(),
+               "file,type,name,x,y,z,mass,length,width,height,mass_est\n"
+               "aircraft.xml,all_else,Equipment,1,-2,0.5,10.5,0,0,0,12.25\n" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestCsvWriter, CanQuoteText)
+{
+    mc::ExportSchema schema( mc::ExportSchema::ComponentRows );
+
+    mc::FleetRecord record;
+    record.fileName = "fleet,a.xml";
+
+    mc::ComponentData data;
+    data.type = "all_else";
+    data.name = "Tank \"main\"\nleft";
+    record.components.push_back( data );
+
+    data.name = "carriage\rreturn";
+    record.components.push_back( data );
+
+    record.estimatedMasses.push_back( 0.0 );
+    record.estimatedMasses.push_back( 0.0 );
+
+    std::unique_ptr< mc::ExportWriter > writer( mc::ExportWriter::create( mc::ExportWriter::CSV, &schema ) );
+    ASSERT_TRUE( writer->open( _fileName.c_str() ) );
+
+    mc::ExportSchema::Row row;
+
+    for ( int i = 0; i < schema.getRowsCount( record ); ++i )
+    {
+        schema.getRow( record, i, &row );
+        EXPECT_TRUE( writer->write( row ) );
+    }
+
+    EXPECT_TRUE( writer->close() );
+
+    // fields containing separators, quotes or line breaks are quoted,
+    // quotes are doubled
+    EXPECT_EQ( readFile(),
+               "file,type,name,x,y,z,mass,length,width,height,mass_est\n"
+               "\"fleet,a.xml\",all_else,\"Tank \"\"main\"\"\nleft\",0,0,0,0,0,0,0,0\n"
+               "\"fleet,a.xml\",all_else,\"carriage\rreturn\",0,0,0,0,0,0,0,0\n" );
+}
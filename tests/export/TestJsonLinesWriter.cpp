@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include <export/ExportSchema.h>
+#include <export/ExportWriter.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestJsonLinesWriter : public ::testing::Test
+{
+protected:
+    TestJsonLinesWriter() {}
+    virtual ~TestJsonLinesWriter() {}
+
+    void SetUp() override
+    {
+        _fileName = ::testing::TempDir() + "test_json_lines_writer.jsonl";
+        std::remove( _fileName.c_str() );
+    }
+
+    void TearDown() override
+    {
+        std::remove( _fileName.c_str() );
+    }
+
+    std::string _fileName;
+
+    std::string readFile() const
+    {
+        std::ifstream fs( _fileName.c_str(), std::ios_base::in | std::ios_base::binary );
+        return std::string( ( std::istreambuf_iterator< char >( fs ) ), std::istreambuf_iterator< char >() );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestJsonLinesWriter, CanWriteComponentRows)
+{
+    mc::ExportSchema schema( mc::ExportSchema::ComponentRows );
+
+    mc::FleetRecord record;
+    record.fileName = "aircraft.xml";
+
+    mc::ComponentData data;
+    data.type = "all_else";
+    data.name = "Equipment";
+    data.r = mc::Vector3( 1.0, -2.0, 0.5 );
+    data.m = 10.5;
+    record.components.push_back( data );
+
+    data.name = "Unknown";
+    data.m = 0.0;
+    record.components.push_back( data );
+
+    record.estimatedMasses.push_back( 12.25 );
+    record.estimatedMasses.push_back( std::numeric_limits< double >::quiet_NaN() );
+
+    std::unique_ptr< mc::ExportWriter > writer( mc::ExportWriter::create( mc::ExportWriter::JSONLines, &schema ) );
+    ASSERT_TRUE( writer->open( _fileName.c_str() ) );
+
+    mc::ExportSchema::Row row;
+
+    for ( int i = 0; i < schema.getRowsCount( record ); ++i )
+    {
+        schema.getRow( record, i, &row );
+        EXPECT_TRUE( writer->write( row ) );
+    }
+
+    EXPECT_TRUE( writer->close() );
+
+    // one object per line, no header, non-finite numbers as null
+    EXPECT_EQ( readFile(),
+               "{\"file\":\"aircraft.xml\",\"type\":\"all_else\",\"name\":\"Equipment\","
+               "\"x\":1,\"y\":-2,\"z\":0.5,\"mass\":10.5,\"length\":0,\"width\":0,\"height\":0,"
+               "\"mass_est\":12.25}\n"
+               "{\"file\":\"aircraft.xml\",\"type\":\"all_else\",\"name\":\"Unknown\","
+               "\"x\":1,\"y\":-2,\"z\":0.5,\"mass\":0,\"length\":0,\"width\":0,\"height\":0,"
+               "\"mass_est\":null}\n" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestJsonLinesWriter, CanEscapeText)
+{
+    mc::ExportSchema schema( mc::ExportSchema::ComponentRows );
+
+    mc::FleetRecord record;
+    record.fileName = "C:\\fleet\\a.xml";
+
+    mc::ComponentData data;
+    data.type = "all_else";
+    data.name = "Tank \"main\"\nleft\t\r\b\f\x01\x1f";
+    record.components.push_back( data );
+    record.estimatedMasses.push_back( 0.0 );
+
+    std::unique_ptr< mc::ExportWriter > writer( mc::ExportWriter::create( mc::ExportWriter::JSONLines, &schema ) );
+    ASSERT_TRUE( writer->open( _fileName.c_str() ) );
+
+    mc::ExportSchema::Row row;
+    schema.getRow( record, 0, &row );
+
+    EXPECT_TRUE( writer->write( row ) );
+    EXPECT_TRUE( writer->close() );
+
+    EXPECT_EQ( readFile(),
+               "{\"file\":\"C:\\\\fleet\\\\a.xml\",\"type\":\"all_else\","
+               "\"name\":\"Tank \\\"main\\\"\\nleft\\t\\r\\b\\f\\u0001\\u001f\","
+               "\"x\":0,\"y\":0,\"z\":0,\"mass\":0,\"length\":0,\"width\":0,\"height\":0,"
+               "\"mass_est\":0}\n" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestJsonLinesWriter, CanWriteBooleans)
+{
+    mc::ExportSchema schema( mc::ExportSchema::AircraftRows );
+
+    const mc::ExportSchema::Columns &columns = schema.getColumns();
+
+    mc::ExportSchema::Row row( columns.size() );
+
+    size_t boolIndex = 0;
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        if ( columns[ i ].type == mc::ExportSchema::Boolean )
+        {
+            row[ i ].number = boolIndex++ % 2 == 0 ? 1.0 : 0.0;
+        }
+    }
+
+    ASSERT_GE( boolIndex, 2 );
+
+    std::unique_ptr< mc::ExportWriter > writer( mc::ExportWriter::create( mc::ExportWriter::JSONLines, &schema ) );
+    ASSERT_TRUE( writer->open( _fileName.c_str() ) );
+    EXPECT_TRUE( writer->write( row ) );
+    EXPECT_TRUE( writer->close() );
+
+    const std::string content = readFile();
+
+    boolIndex = 0;
+
+    for ( size_t i = 0; i < columns.size(); ++i )
+    {
+        if ( columns[ i ].type == mc::ExportSchema::Boolean )
+        {
+            std::string item = "\"" + columns[ i ].name + "\":"
+                             + ( boolIndex++ % 2 == 0 ? "true" : "false" );
+            EXPECT_NE( content.find( item ), std::string::npos ) << item;
+        }
+    }
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Aircraft.h>
+
+#include <fleet/FleetDatabase.h>
+#include <fleet/FleetGenerator.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestFleetDatabase : public ::testing::Test
+{
+protected:
+    TestFleetDatabase() {}
+    virtual ~TestFleetDatabase() {}
+
+    void SetUp() override
+    {
+        _fileName = ::testing::TempDir() + "test_fleet_database.mcfd";
+        std::remove( _fileName.c_str() );
+    }
+
+    void TearDown() override
+    {
+        std::remove( _fileName.c_str() );
+    }
+
+    std::string _fileName;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFleetDatabase, CanSaveAndReopen)
+{
+    const int count = 10;
+
+    mc::FleetGenerator generator( 5 );
+
+    std::vector< std::unique_ptr< mc::Aircraft > > fleet;
+
+    for ( int i = 0; i < count; ++i )
+    {
+        fleet.emplace_back( new mc::Aircraft() );
+        generator.generate( i, fleet.back().get() );
+    }
+
+    mc::PointMasses points;
+    points.add( 1, 10.0, mc::Vector3( 1.0, 2.0, 3.0 ) );
+    points.add( 2, 20.0, mc::Vector3( -1.0, 0.5, 0.0 ), mc::InertiaTensor( 1.0, 2.0, 3.0, 0.1, 0.2, 0.3 ) );
+    fleet[ 3 ]->setPointMasses( points, "points.csv" );
+
+    {
+        mc::FleetDatabase db;
+        ASSERT_TRUE( db.open( _fileName.c_str() ) );
+        EXPECT_EQ( db.getCount(), 0 );
+
+        for ( int i = 0; i < count; ++i )
+        {
+            std::string name = "aircraft_" + std::to_string( i ) + ".xml";
+            EXPECT_EQ( db.insert( name.c_str(), *fleet[ i ] ), i );
+        }
+
+        ASSERT_TRUE( db.save() );
+
+        // saving over existing database
+        ASSERT_TRUE( db.save() );
+    }
+
+    mc::FleetDatabase db;
+    ASSERT_TRUE( db.open( _fileName.c_str() ) );
+    ASSERT_EQ( db.getCount(), count );
+
+    for ( int i = 0; i < count; ++i )
+    {
+        mc::Aircraft aircraft;
+        ASSERT_TRUE( db.getAircraft( i, &aircraft ) );
+
+        EXPECT_EQ( aircraft.getData()->type, fleet[ i ]->getData()->type );
+        EXPECT_EQ( aircraft.getData()->general.mtow, fleet[ i ]->getData()->general.mtow );
+        EXPECT_EQ( aircraft.getComponents().size(), fleet[ i ]->getComponents().size() );
+        EXPECT_EQ( aircraft.getPointMasses().getCount(), fleet[ i ]->getPointMasses().getCount() );
+        EXPECT_EQ( aircraft.getPointMassesFile(), fleet[ i ]->getPointMassesFile() );
+
+        EXPECT_DOUBLE_EQ( aircraft.getMassTotal(), fleet[ i ]->getMassTotal() );
+        EXPECT_DOUBLE_EQ( aircraft.getCenterOfMass().x(), fleet[ i ]->getCenterOfMass().x() );
+        EXPECT_DOUBLE_EQ( aircraft.getCenterOfMass().z(), fleet[ i ]->getCenterOfMass().z() );
+        EXPECT_DOUBLE_EQ( aircraft.getInertiaMatrix().xx(), fleet[ i ]->getInertiaMatrix().xx() );
+        EXPECT_DOUBLE_EQ( aircraft.getInertiaMatrix().xz(), fleet[ i ]->getInertiaMatrix().xz() );
+
+        EXPECT_EQ( db.getRecord( i ).massTotal, fleet[ i ]->getMassTotal() );
+    }
+
+    EXPECT_EQ( db.getRecord( 3 ).pointMasses.getCount(), 2u );
+    EXPECT_TRUE( db.getRecord( 3 ).pointMasses.hasInertia() );
+
+    // queries
+    double mtowMin = fleet[ 0 ]->getData()->general.mtow;
+    double mtowMax = fleet[ 0 ]->getData()->general.mtow;
+
+    for ( int i = 0; i < count; ++i )
+    {
+        mtowMin = std::min( mtowMin, fleet[ i ]->getData()->general.mtow );
+        mtowMax = std::max( mtowMax, fleet[ i ]->getData()->general.mtow );
+    }
+
+    mc::FleetDatabase::Indices all = db.query( mc::FleetDatabase::MTOW, mtowMin, mtowMax );
+    ASSERT_EQ( all.size(), static_cast< size_t >( count ) );
+
+    for ( size_t i = 1; i < all.size(); ++i )
+    {
+        EXPECT_LE( db.getRecord( all[ i - 1 ] ).data.general.mtow, db.getRecord( all[ i ] ).data.general.mtow );
+    }
+
+    EXPECT_TRUE( db.query( mc::FleetDatabase::MTOW, mtowMax + 1.0, mtowMax + 2.0 ).empty() );
+
+    int typesCount = 0;
+
+    for ( int t = mc::AircraftData::FighterAttack; t <= mc::AircraftData::Helicopter; ++t )
+    {
+        mc::AircraftData::Type type = static_cast< mc::AircraftData::Type >( t );
+
+        for ( int index : db.query( type ) )
+        {
+            EXPECT_EQ( db.getRecord( index ).data.type, type );
+            typesCount++;
+        }
+    }
+
+    EXPECT_EQ( typesCount, count );
+
+    // record is replaced, not added
+    EXPECT_EQ( db.insert( "aircraft_0.xml", *fleet[ 1 ] ), 0 );
+    EXPECT_EQ( db.getCount(), count );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFleetDatabase, CanSaveAsExistingFile)
+{
+    const std::string fileOther = ::testing::TempDir() + "test_fleet_database_other.mcfd";
+
+    {
+        std::ofstream fs( fileOther.c_str(), std::ios_base::out | std::ios_base::trunc );
+        fs << "previous content";
+    }
+
+    mc::FleetGenerator generator( 5 );
+
+    mc::Aircraft aircraft;
+    generator.generate( 0, &aircraft );
+
+    mc::FleetDatabase db;
+    ASSERT_TRUE( db.open( _fileName.c_str() ) );
+    EXPECT_EQ( db.insert( "aircraft_0.xml", aircraft ), 0 );
+
+    // existing file is replaced
+    ASSERT_TRUE( db.saveAs( fileOther.c_str() ) );
+
+    std::ifstream temp( ( fileOther + ".tmp" ).c_str() );
+    EXPECT_FALSE( temp.is_open() );
+
+    mc::FleetDatabase reopened;
+    ASSERT_TRUE( reopened.open( fileOther.c_str() ) );
+    ASSERT_EQ( reopened.getCount(), 1 );
+    EXPECT_EQ( reopened.getRecord( 0 ).fileName, db.getRecord( 0 ).fileName );
+
+    std::remove( fileOther.c_str() );
+}
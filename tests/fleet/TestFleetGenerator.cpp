@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <Aircraft.h>
+
+#include <fleet/FleetGenerator.h>
+
+#include <utils/ThreadPool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestFleetGenerator : public ::testing::Test
+{
+protected:
+    TestFleetGenerator() {}
+    virtual ~TestFleetGenerator() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFleetGenerator, CanGenerateInParallelAboveParallelUpdateThreshold)
+{
+    // more components than Aircraft::update() computes serially, so
+    // update() of every aircraft runs on the pool it is generated on
+    const int componentsCount = 16 * 4096 + 100;
+    const int count = 4;
+
+    mc::FleetGenerator generator( 7 );
+    generator.setComponentsCount( componentsCount );
+
+    mc::Aircraft aircraft[ count ];
+
+    mc::ThreadPool::getInstance()->run( count, [ &generator, &aircraft ]( int index )
+    {
+        generator.generate( index, &aircraft[ index ] );
+    });
+
+    for ( int i = 0; i < count; ++i )
+    {
+        mc::Aircraft serial;
+        generator.generate( i, &serial );
+
+        ASSERT_EQ( aircraft[ i ].getComponents().size(), static_cast< size_t >( componentsCount ) );
+
+        EXPECT_GT( aircraft[ i ].getMassTotal(), 0.0 );
+        EXPECT_EQ( aircraft[ i ].getMassTotal(), serial.getMassTotal() );
+        EXPECT_EQ( aircraft[ i ].getCenterOfMass().x(), serial.getCenterOfMass().x() );
+        EXPECT_EQ( aircraft[ i ].getInertiaMatrix().xx(), serial.getInertiaMatrix().xx() );
+    }
+}
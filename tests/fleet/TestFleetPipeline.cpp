@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Aircraft.h>
+
+#include <components/AllElse.h>
+
+#include <fleet/FleetPipeline.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestFleetPipeline : public ::testing::Test
+{
+protected:
+    TestFleetPipeline() {}
+    virtual ~TestFleetPipeline() {}
+    void SetUp() override {}
+
+    void TearDown() override
+    {
+        for ( const std::string &fileName : _fileNames ) std::remove( fileName.c_str() );
+    }
+
+    std::vector< std::string > _fileNames;
+
+    /** Writes file of the given content, returns its name. */
+    std::string writeFile( int index, const std::string &content )
+    {
+        std::string fileName = ::testing::TempDir() + "test_fleet_pipeline_"
+                             + std::to_string( index ) + ".txt";
+
+        std::ofstream fs( fileName.c_str() );
+        fs << content;
+
+        _fileNames.push_back( fileName );
+
+        return fileName;
+    }
+
+    /**
+     * Parses file content, which is mass of the single component. Files of
+     * the lower masses take longer, so they are done out of the input order.
+     */
+    static bool parse( const QByteArray &content, const QString&, mc::DataFile *dataFile )
+    {
+        const std::string text = content.toStdString();
+
+        if ( text.empty() || text[ 0 ] < '0' || text[ 0 ] > '9' ) return false;
+
+        const int mass = std::stoi( text );
+
+        std::this_thread::sleep_for( std::chrono::microseconds( 100 * ( 50 - mass % 50 ) ) );
+
+        mc::Component *component = new mc::AllElse( dataFile->getAircraft()->getData() );
+        component->setMass( mass );
+        dataFile->getAircraft()->addComponent( component );
+
+        return true;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFleetPipeline, CanProcessInInputOrder)
+{
+    const int count = 100;
+
+    std::vector< std::string > paths;
+
+    for ( int i = 0; i < count; ++i ) paths.push_back( writeFile( i, std::to_string( i + 1 ) ) );
+
+    // window smaller than number of files, so the reader waits for the writer
+    mc::FleetPipeline pipeline( 4, 8 );
+    pipeline.setParser( &TestFleetPipeline::parse );
+
+    std::vector< size_t > indices;
+    std::vector< double > masses;
+
+    bool result = pipeline.run( paths, [ &paths, &indices, &masses ]( mc::FleetPipeline::Item *item )
+    {
+        EXPECT_EQ( item->fileName, paths[ item->index ] );
+        EXPECT_TRUE( item->content.isEmpty() );
+
+        indices.push_back( item->index );
+        masses.push_back( item->dataFile ? item->record.massTotal : -1.0 );
+
+        return true;
+    });
+
+    EXPECT_TRUE( result );
+
+    ASSERT_EQ( indices.size(), static_cast< size_t >( count ) );
+
+    for ( int i = 0; i < count; ++i )
+    {
+        EXPECT_EQ( indices[ i ], static_cast< size_t >( i ) );
+        EXPECT_DOUBLE_EQ( masses[ i ], i + 1.0 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFleetPipeline, CanPassUnreadableFiles)
+{
+    std::vector< std::string > paths;
+
+    paths.push_back( writeFile( 0, "10" ) );
+    paths.push_back( writeFile( 1, "invalid" ) );
+    paths.push_back( ::testing::TempDir() + "test_fleet_pipeline_missing.txt" );
+    paths.push_back( writeFile( 3, "" ) );
+    paths.push_back( writeFile( 4, "40" ) );
+
+    mc::FleetPipeline pipeline( 2, 4 );
+    pipeline.setParser( &TestFleetPipeline::parse );
+
+    std::vector< bool > read;
+
+    bool result = pipeline.run( paths, [ &read ]( mc::FleetPipeline::Item *item )
+    {
+        EXPECT_EQ( item->index, read.size() );
+        read.push_back( item->dataFile != nullptr );
+        return true;
+    });
+
+    // files which cannot be read are passed to the sink, not failures
+    EXPECT_TRUE( result );
+
+    const std::vector< bool > expected = { true, false, false, false, true };
+    EXPECT_EQ( read, expected );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFleetPipeline, CanStopFromSink)
+{
+    const int count = 100;
+    const int stop = 10;
+
+    std::vector< std::string > paths;
+
+    for ( int i = 0; i < count; ++i ) paths.push_back( writeFile( i, std::to_string( i + 1 ) ) );
+
+    mc::FleetPipeline pipeline( 4, 8 );
+    pipeline.setParser( &TestFleetPipeline::parse );
+
+    int calls = 0;
+
+    bool result = pipeline.run( paths, [ &calls ]( mc::FleetPipeline::Item *item )
+    {
+        ++calls;
+        return item->index < static_cast< size_t >( stop );
+    });
+
+    // sink failure stops pipeline, no further files are passed
+    EXPECT_FALSE( result );
+    EXPECT_EQ( calls, stop + 1 );
+
+    // pipeline can be run again
+    calls = 0;
+
+    result = pipeline.run( paths, [ &calls ]( mc::FleetPipeline::Item * )
+    {
+        ++calls;
+        return true;
+    });
+
+    EXPECT_TRUE( result );
+    EXPECT_EQ( calls, count );
+}
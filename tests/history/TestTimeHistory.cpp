@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <Aircraft.h>
+
+#include <components/AllElse.h>
+
+#include <fleet/FleetGenerator.h>
+
+#include <history/TimeHistory.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestTimeHistory : public ::testing::Test
+{
+protected:
+    TestTimeHistory() {}
+    virtual ~TestTimeHistory() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static void expectNear( double actual, double expected )
+    {
+        EXPECT_NEAR( actual, expected, 1.0e-9 * std::max( 1.0, std::fabs( expected ) ) );
+    }
+
+    static void expectSample( const mc::TimeHistory::Sample &sample, const mc::Aircraft &aircraft )
+    {
+        expectNear( sample.mass, aircraft.getMassTotal() );
+
+        expectNear( sample.centerOfMass.x(), aircraft.getCenterOfMass().x() );
+        expectNear( sample.centerOfMass.y(), aircraft.getCenterOfMass().y() );
+        expectNear( sample.centerOfMass.z(), aircraft.getCenterOfMass().z() );
+
+        expectNear( sample.inertiaMatrix.xx(), aircraft.getInertiaMatrix().xx() );
+        expectNear( sample.inertiaMatrix.yy(), aircraft.getInertiaMatrix().yy() );
+        expectNear( sample.inertiaMatrix.zz(), aircraft.getInertiaMatrix().zz() );
+        expectNear( sample.inertiaMatrix.xy(), aircraft.getInertiaMatrix().xy() );
+        expectNear( sample.inertiaMatrix.xz(), aircraft.getInertiaMatrix().xz() );
+        expectNear( sample.inertiaMatrix.yz(), aircraft.getInertiaMatrix().yz() );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestTimeHistory, CanRunAsFullUpdate)
+{
+    // more mass changes than between two recomputations from scratch
+    const int eventsCount = 5000;
+    const int steps = eventsCount / 2;
+    const double dt = 0.1;
+
+    struct ItemData
+    {
+        const char *name;
+        mc::Vector3 r;
+        double mass;
+        double l;
+        double w;
+        double h;
+    };
+
+    const ItemData items[] =
+    {
+        { "tank_l", mc::Vector3(  1.0, -3.0,  0.5 ), 800.0, 2.0, 1.5, 0.4 },
+        { "tank_r", mc::Vector3(  1.0,  3.0,  0.5 ), 800.0, 2.0, 1.5, 0.4 },
+        { "cargo",  mc::Vector3( -2.0,  0.0, -0.2 ), 500.0, 0.0, 0.0, 0.0 }
+    };
+    const int itemsCount = sizeof( items ) / sizeof( items[ 0 ] );
+
+    mc::FleetGenerator generator( 11 );
+    generator.setComponentsCount( 50 );
+
+    mc::Aircraft empty;
+    generator.generate( 0, &empty );
+
+    mc::TimeHistory history( empty );
+
+    // reference aircraft, items are components updated in full
+    mc::Aircraft aircraft;
+    generator.generate( 0, &aircraft );
+
+    std::vector< mc::Component* > components;
+
+    for ( int i = 0; i < itemsCount; ++i )
+    {
+        EXPECT_EQ( history.addItem( items[ i ].name, items[ i ].r, items[ i ].mass,
+                                    items[ i ].l, items[ i ].w, items[ i ].h ), i );
+
+        mc::Component *component = new mc::AllElse( aircraft.getData() );
+        component->setName( items[ i ].name );
+        component->setPosition( items[ i ].r );
+        component->setMass( items[ i ].mass );
+        component->setLength( items[ i ].l );
+        component->setWidth( items[ i ].w );
+        component->setHeight( items[ i ].h );
+
+        aircraft.addComponent( component );
+        components.push_back( component );
+    }
+
+    EXPECT_EQ( history.getItem( "cargo" ), 2 );
+    EXPECT_EQ( history.getItem( "none" ), -1 );
+
+    // two events per step
+    mc::TimeHistory::Events events;
+
+    for ( int i = 0; i < eventsCount; ++i )
+    {
+        mc::TimeHistory::Event event;
+
+        event.time = ( i / 2 ) * dt;
+        event.item = i % itemsCount;
+        event.mass = items[ event.item ].mass * ( 0.5 + 0.5 * std::cos( 0.01 * i ) );
+
+        events.push_back( event );
+    }
+
+    mc::TimeHistory::Samples samples;
+    history.run( events, 0.0, dt, steps, &samples );
+
+    ASSERT_EQ( samples.size(), static_cast< size_t >( steps + 1 ) );
+
+    mc::TimeHistory::Events::const_iterator it = events.begin();
+
+    for ( int step = 0; step <= steps; ++step )
+    {
+        const mc::TimeHistory::Sample &sample = samples[ step ];
+
+        EXPECT_DOUBLE_EQ( sample.time, step * dt );
+
+        while ( it != events.end() && it->time <= sample.time )
+        {
+            components[ it->item ]->setMass( it->mass );
+            ++it;
+        }
+
+        aircraft.update();
+
+        expectSample( sample, aircraft );
+    }
+
+    EXPECT_TRUE( it == events.end() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestTimeHistory, CanReset)
+{
+    mc::FleetGenerator generator( 3 );
+    generator.setComponentsCount( 10 );
+
+    mc::Aircraft empty;
+    generator.generate( 0, &empty );
+
+    mc::TimeHistory history( empty );
+
+    int item = history.addItem( "fuel", mc::Vector3( 0.5, 0.0, 0.0 ), 1000.0, 1.0, 1.0, 1.0 );
+
+    double mass = history.getMass();
+    double ixx  = history.getInertiaMatrix().xx();
+
+    EXPECT_DOUBLE_EQ( mass, empty.getMassTotal() + 1000.0 );
+
+    history.setMass( item, 250.0 );
+    EXPECT_DOUBLE_EQ( history.getItemMass( item ), 250.0 );
+    EXPECT_NEAR( history.getMass(), mass - 750.0, 1.0e-9 * mass );
+
+    history.reset();
+    EXPECT_DOUBLE_EQ( history.getItemMass( item ), 1000.0 );
+    EXPECT_DOUBLE_EQ( history.getMass(), mass );
+    EXPECT_DOUBLE_EQ( history.getInertiaMatrix().xx(), ixx );
+}
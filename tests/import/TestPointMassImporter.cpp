@@ -0,0 +1,280 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include <QDir>
+
+#include <Aircraft.h>
+#include <DataFile.h>
+
+#include <import/PointMassImporter.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestPointMassImporter : public ::testing::Test
+{
+protected:
+    TestPointMassImporter() {}
+    virtual ~TestPointMassImporter() {}
+
+    void SetUp() override
+    {
+        _fileCsv = ::testing::TempDir() + "test_point_mass_importer.csv";
+        _fileBin = ::testing::TempDir() + "test_point_mass_importer.mcpm";
+    }
+
+    void TearDown() override
+    {
+        std::remove( _fileCsv.c_str() );
+        std::remove( _fileBin.c_str() );
+    }
+
+    std::string _fileCsv;
+    std::string _fileBin;
+
+    static mc::PointMasses createPoints( int count, bool inertia )
+    {
+        mc::PointMasses points;
+
+        for ( int i = 0; i < count; ++i )
+        {
+            double m = 0.1 + 0.001 * ( i % 997 );
+            mc::Vector3 r( 0.01 * ( i % 101 ) - 0.5, 0.02 * ( i % 53 ) - 0.5, 0.03 * ( i % 29 ) - 0.4 );
+
+            if ( inertia )
+            {
+                points.add( 1000 + i, m, r, mc::InertiaTensor( 0.1 * m, 0.2 * m, 0.3 * m,
+                                                               0.01 * m, -0.02 * m, 0.03 * m ) );
+            }
+            else
+            {
+                points.add( 1000 + i, m, r );
+            }
+        }
+
+        return points;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPointMassImporter, CanReadCsv)
+{
+    std::istringstream in(
+        "id,mass,x,y,z\n"
+        "# comment\n"
+        "\n"
+        "1, 10.0, 1.0, 2.0, 3.0\n"
+        "  2; 20.0; -1.0; 0.5; 0.0\n"
+        "3 5.5 0.0 0.0 -2.0\n" );
+
+    mc::PointMasses points;
+    ASSERT_TRUE( mc::PointMassImporter::readCsv( in, &points ) );
+
+    ASSERT_EQ( points.getCount(), 3u );
+    EXPECT_FALSE( points.hasInertia() );
+
+    EXPECT_EQ( points.getId( 1 ), 2 );
+    EXPECT_DOUBLE_EQ( points.getMass( 1 ), 20.0 );
+    EXPECT_DOUBLE_EQ( points.getPosition( 1 ).x(), -1.0 );
+    EXPECT_DOUBLE_EQ( points.getPosition( 1 ).y(),  0.5 );
+    EXPECT_DOUBLE_EQ( points.getPosition( 2 ).z(), -2.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPointMassImporter, CanReadCsvWithInertia)
+{
+    std::istringstream in( "7,2.0,1.0,0.0,0.0,0.1,0.2,0.3,0.01,0.02,0.03\n" );
+
+    mc::PointMasses points;
+    ASSERT_TRUE( mc::PointMassImporter::readCsv( in, &points ) );
+
+    ASSERT_EQ( points.getCount(), 1u );
+    ASSERT_TRUE( points.hasInertia() );
+
+    // products of inertia are negated tensor elements
+    mc::InertiaTensor i = points.getInertia( 0 );
+    EXPECT_DOUBLE_EQ( i.xx(),  0.1  );
+    EXPECT_DOUBLE_EQ( i.yy(),  0.2  );
+    EXPECT_DOUBLE_EQ( i.zz(),  0.3  );
+    EXPECT_DOUBLE_EQ( i.xy(), -0.01 );
+    EXPECT_DOUBLE_EQ( i.xz(), -0.02 );
+    EXPECT_DOUBLE_EQ( i.yz(), -0.03 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPointMassImporter, CanRejectInvalidCsv)
+{
+    const char *contents[] =
+    {
+        "1,1.0,0.0,0.0\n",                          // too few values
+        "1,1.0,0.0,0.0,0.0,1.0\n",                  // neither 4 nor 10 values
+        "1,1.0,0.0,0.0,0.0\n2,1.0,0.0,0.0,0.0,0.1,0.2,0.3,0.0,0.0,0.0\n",  // columns differ
+        "1,1.0,0.0,0.0,0.0\nid,mass,x,y,z\n",       // header not in the first line
+        "1,1.0,0.0,abc,0.0\n"                       // not a number
+    };
+
+    for ( const char *content : contents )
+    {
+        std::istringstream in( content );
+
+        mc::PointMasses points;
+        EXPECT_FALSE( mc::PointMassImporter::readCsv( in, &points ) ) << content;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPointMassImporter, CanWriteAndReadBinary)
+{
+    for ( bool inertia : { false, true } )
+    {
+        // more points than binary records read at once
+        mc::PointMasses points = createPoints( 10000, inertia );
+
+        std::stringstream ss;
+        ASSERT_TRUE( mc::PointMassImporter::writeBinary( ss, points ) );
+
+        mc::PointMasses result;
+        ASSERT_TRUE( mc::PointMassImporter::readBinary( ss, &result ) );
+
+        ASSERT_EQ( result.getCount(), points.getCount() );
+        EXPECT_EQ( result.hasInertia(), inertia );
+        EXPECT_EQ( result.getHash( 0 ), points.getHash( 0 ) );
+
+        // truncated
+        std::string content = ss.str();
+        std::istringstream in( content.substr( 0, content.size() - 1 ) );
+
+        mc::PointMasses truncated;
+        EXPECT_FALSE( mc::PointMassImporter::readBinary( in, &truncated ) );
+    }
+
+    std::istringstream in( "not a binary point masses file" );
+
+    mc::PointMasses points;
+    EXPECT_FALSE( mc::PointMassImporter::readBinary( in, &points ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPointMassImporter, CanRejectBinaryCountExceedingFile)
+{
+    mc::PointMasses points = createPoints( 10, false );
+
+    std::stringstream ss;
+    ASSERT_TRUE( mc::PointMassImporter::writeBinary( ss, points ) );
+
+    // count follows magic, version and flags
+    std::string content = ss.str();
+    const size_t countOffset = 3 * sizeof(uint32_t);
+
+    for ( uint64_t count : { static_cast< uint64_t >( 11 ), static_cast< uint64_t >( 1 ) << 60 } )
+    {
+        memcpy( &content[ countOffset ], &count, sizeof(count) );
+
+        std::istringstream in( content );
+
+        mc::PointMasses result;
+        EXPECT_FALSE( mc::PointMassImporter::readBinary( in, &result ) ) << count;
+        EXPECT_EQ( result.getCount(), 0 );
+    }
+
+    // also when imported from file
+    {
+        std::ofstream fs( _fileBin.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+        fs << content;
+    }
+
+    mc::PointMasses result;
+    EXPECT_FALSE( mc::PointMassImporter::import( _fileBin.c_str(), &result ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPointMassImporter, CanImportIntoAircraft)
+{
+    {
+        std::ofstream fs( _fileCsv.c_str() );
+        fs << "id,mass,x,y,z\n";
+        fs << "1,10.0,1.0,0.0,0.0\n";
+        fs << "2,30.0,-1.0,2.0,0.0\n";
+    }
+
+    mc::PointMasses points;
+    ASSERT_TRUE( mc::PointMassImporter::import( _fileCsv.c_str(), &points ) );
+
+    {
+        std::ofstream fs( _fileBin.c_str(), std::ios_base::out | std::ios_base::binary );
+        ASSERT_TRUE( mc::PointMassImporter::writeBinary( fs, points ) );
+    }
+
+    // format chosen by extension
+    for ( const std::string &fileName : { _fileCsv, _fileBin } )
+    {
+        mc::Aircraft aircraft;
+        ASSERT_TRUE( aircraft.importPointMasses( fileName.c_str() ) );
+
+        EXPECT_EQ( aircraft.getPointMassesFile(), fileName );
+        EXPECT_EQ( aircraft.getPointMasses().getCount(), 2u );
+        EXPECT_EQ( aircraft.getPointMasses().getHash( 0 ), points.getHash( 0 ) );
+
+        EXPECT_DOUBLE_EQ( aircraft.getMassTotal(), 40.0 );
+        EXPECT_DOUBLE_EQ( aircraft.getCenterOfMass().x(), ( 10.0 - 30.0 ) / 40.0 );
+        EXPECT_DOUBLE_EQ( aircraft.getCenterOfMass().y(), 60.0 / 40.0 );
+
+        // point masses about the reference point
+        EXPECT_DOUBLE_EQ( aircraft.getInertiaMatrix().zz(), 10.0 * 1.0 + 30.0 * ( 1.0 + 4.0 ) );
+        EXPECT_DOUBLE_EQ( aircraft.getInertiaMatrix().xy(), 30.0 * 1.0 * 2.0 );
+    }
+
+    mc::Aircraft aircraft;
+    EXPECT_FALSE( aircraft.importPointMasses( ( _fileCsv + ".missing" ).c_str() ) );
+    EXPECT_EQ( aircraft.getPointMasses().getCount(), 0u );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPointMassImporter, CanReadRelativeToAircraftFile)
+{
+    const std::string dirName = ::testing::TempDir() + "test_point_mass_importer";
+    const std::string fileCsv = dirName + "/points.csv";
+    const std::string fileXml = dirName + "/aircraft.xml";
+
+    ASSERT_TRUE( QDir().mkpath( dirName.c_str() ) );
+
+    {
+        std::ofstream fs( fileCsv.c_str() );
+        fs << "1,10.0,1.0,0.0,0.0\n";
+    }
+
+    mc::DataFile dataFile;
+    ASSERT_TRUE( dataFile.getAircraft()->importPointMasses( fileCsv.c_str() ) );
+    ASSERT_TRUE( dataFile.saveFile( fileXml.c_str() ) );
+
+    // saved relative to the aircraft file
+    std::ifstream fs( fileXml.c_str() );
+    std::string content( ( std::istreambuf_iterator< char >( fs ) ), std::istreambuf_iterator< char >() );
+    EXPECT_NE( content.find( "file=\"points.csv\"" ), std::string::npos ) << content;
+
+    // resolved against the aircraft file directory, not the working one
+    mc::DataFile fromFile;
+    ASSERT_TRUE( fromFile.readFile( fileXml.c_str() ) );
+    EXPECT_EQ( fromFile.getAircraft()->getPointMasses().getCount(), 1u );
+    EXPECT_DOUBLE_EQ( fromFile.getAircraft()->getMassTotal(), 10.0 );
+
+    mc::DataFile fromData;
+    ASSERT_TRUE( fromData.readData( QByteArray( content.c_str() ), dirName.c_str() ) );
+    EXPECT_EQ( fromData.getAircraft()->getPointMassesFile(), fromFile.getAircraft()->getPointMassesFile() );
+    EXPECT_DOUBLE_EQ( fromData.getAircraft()->getMassTotal(), 10.0 );
+
+    std::remove( fileCsv.c_str() );
+    std::remove( fileXml.c_str() );
+}
@@ -0,0 +1,313 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include <mcutil/misc/Units.h>
+
+#include <Aircraft.h>
+
+#include <export/MassBalanceWriter.h>
+
+#include <import/SimModelImporter.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestSimModelImporter : public ::testing::Test
+{
+protected:
+    TestSimModelImporter() {}
+    virtual ~TestSimModelImporter() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static const char *jsbSim;
+    static const char *yaSim;
+
+    static bool read( const char *content, mc::Aircraft *aircraft )
+    {
+        mc::SimModelImporter importer;
+        return importer.read( QByteArray( content ), aircraft );
+    }
+
+    /** Exports aircraft as JSBSim mass_balance and imports it back. */
+    static bool readExported( const mc::Aircraft &aircraft, bool pointMasses, mc::Aircraft *result )
+    {
+        std::ostringstream os;
+
+        mc::MassBalanceWriter writer( pointMasses );
+
+        if ( !writer.write( aircraft, &os ) ) return false;
+
+        // without XML declaration
+        std::string massBalance = os.str();
+        massBalance = massBalance.substr( massBalance.find( '\n' ) + 1 );
+
+        std::string content = "<fdm_config name=\"exported\">\n"
+                              "  <metrics>\n"
+                              "    <wingarea unit=\"FT2\"> 174.0 </wingarea>\n"
+                              "  </metrics>\n"
+                              + massBalance +
+                              "</fdm_config>\n";
+
+        return read( content.c_str(), result );
+    }
+
+    static void expectNear( double actual, double expected )
+    {
+        // exported values are rounded to 4 decimal places
+        EXPECT_NEAR( actual, expected, 1.0e-5 * std::max( 1.0, std::fabs( expected ) ) );
+    }
+
+    static void expectSameMass( const mc::Aircraft &actual, const mc::Aircraft &expected )
+    {
+        expectNear( actual.getMassTotal(), expected.getMassTotal() );
+
+        expectNear( actual.getCenterOfMass().x(), expected.getCenterOfMass().x() );
+        expectNear( actual.getCenterOfMass().y(), expected.getCenterOfMass().y() );
+        expectNear( actual.getCenterOfMass().z(), expected.getCenterOfMass().z() );
+    }
+
+    static void expectSameInertia( const mc::Aircraft &actual, const mc::Aircraft &expected )
+    {
+        expectNear( actual.getInertiaMatrix().xx(), expected.getInertiaMatrix().xx() );
+        expectNear( actual.getInertiaMatrix().yy(), expected.getInertiaMatrix().yy() );
+        expectNear( actual.getInertiaMatrix().zz(), expected.getInertiaMatrix().zz() );
+        expectNear( actual.getInertiaMatrix().xy(), expected.getInertiaMatrix().xy() );
+        expectNear( actual.getInertiaMatrix().xz(), expected.getInertiaMatrix().xz() );
+        expectNear( actual.getInertiaMatrix().yz(), expected.getInertiaMatrix().yz() );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// point masses lie in the plane of symmetry at the height of the empty CG,
+// so the products of inertia about the CG, which cannot be imported, are zero
+const char *TestSimModelImporter::jsbSim =
+    "<?xml version=\"1.0\"?>\n"
+    "<fdm_config name=\"c172\" version=\"2.0\">\n"
+    "  <metrics>\n"
+    "    <wingarea  unit=\"FT2\"> 174.0 </wingarea>\n"
+    "    <wingspan  unit=\"FT\" > 35.8  </wingspan>\n"
+    "    <htailarea unit=\"FT2\"> 21.9  </htailarea>\n"
+    "    <htailarm  unit=\"FT\" > 15.7  </htailarm>\n"
+    "    <vtailarea unit=\"FT2\"> 16.5  </vtailarea>\n"
+    "    <vtailarm  unit=\"FT\" > 15.7  </vtailarm>\n"
+    "  </metrics>\n"
+    "  <mass_balance>\n"
+    "    <ixx unit=\"SLUG*FT2\"> 948.0  </ixx>\n"
+    "    <iyy unit=\"SLUG*FT2\"> 1346.0 </iyy>\n"
+    "    <izz unit=\"SLUG*FT2\"> 1967.0 </izz>\n"
+    "    <ixy unit=\"SLUG*FT2\"> 0.0    </ixy>\n"
+    "    <ixz unit=\"SLUG*FT2\"> 0.0    </ixz>\n"
+    "    <iyz unit=\"SLUG*FT2\"> 0.0    </iyz>\n"
+    "    <emptywt unit=\"LBS\"> 1500.0 </emptywt>\n"
+    "    <location name=\"CG\" unit=\"IN\"> <x> 41.0 </x> <y> 0.0 </y> <z> 36.5 </z> </location>\n"
+    "    <pointmass name=\"Pilot\">\n"
+    "      <weight unit=\"LBS\"> 180.0 </weight>\n"
+    "      <location name=\"POINTMASS\" unit=\"IN\"> <x> 36.0 </x> <y> 0.0 </y> <z> 36.5 </z> </location>\n"
+    "    </pointmass>\n"
+    "    <pointmass name=\"Rear Seat\">\n"
+    "      <weight unit=\"LBS\"> 170.0 </weight>\n"
+    "      <location name=\"POINTMASS\" unit=\"IN\"> <x> 70.0 </x> <y> 0.0 </y> <z> 36.5 </z> </location>\n"
+    "    </pointmass>\n"
+    "    <pointmass name=\"Baggage\">\n"
+    "      <weight unit=\"LBS\"> 50.0 </weight>\n"
+    "      <location name=\"POINTMASS\" unit=\"IN\"> <x> 95.0 </x> <y> 0.0 </y> <z> 36.5 </z> </location>\n"
+    "    </pointmass>\n"
+    "  </mass_balance>\n"
+    "  <ground_reactions>\n"
+    "    <contact type=\"BOGEY\" name=\"NOSE\">\n"
+    "      <location unit=\"IN\"> <x> -6.8 </x> <y> 0.0 </y> <z> -20.0 </z> </location>\n"
+    "      <retractable> 0 </retractable>\n"
+    "    </contact>\n"
+    "    <contact type=\"BOGEY\" name=\"LEFT_MAIN\">\n"
+    "      <location unit=\"IN\"> <x> 58.2 </x> <y> -43.0 </y> <z> -17.9 </z> </location>\n"
+    "      <retractable> 0 </retractable>\n"
+    "    </contact>\n"
+    "    <contact type=\"BOGEY\" name=\"RIGHT_MAIN\">\n"
+    "      <location unit=\"IN\"> <x> 58.2 </x> <y> 43.0 </y> <z> -17.9 </z> </location>\n"
+    "      <retractable> 0 </retractable>\n"
+    "    </contact>\n"
+    "    <contact type=\"STRUCTURE\" name=\"TAIL_SKID\">\n"
+    "      <location unit=\"IN\"> <x> 188.0 </x> <y> 0.0 </y> <z> 8.0 </z> </location>\n"
+    "    </contact>\n"
+    "  </ground_reactions>\n"
+    "  <propulsion>\n"
+    "    <tank type=\"FUEL\">\n"
+    "      <location unit=\"IN\"> <x> 56.0 </x> <y> -56.0 </y> <z> 59.4 </z> </location>\n"
+    "      <capacity unit=\"LBS\"> 150.0 </capacity>\n"
+    "    </tank>\n"
+    "    <tank type=\"FUEL\">\n"
+    "      <location unit=\"IN\"> <x> 56.0 </x> <y> 56.0 </y> <z> 59.4 </z> </location>\n"
+    "      <capacity unit=\"LBS\"> 150.0 </capacity>\n"
+    "    </tank>\n"
+    "    <tank type=\"FUEL\">\n"
+    "      <location unit=\"IN\"> <x> 50.0 </x> <y> 0.0 </y> <z> 40.0 </z> </location>\n"
+    "      <capacity unit=\"LBS\"> 20.0 </capacity>\n"
+    "    </tank>\n"
+    "  </propulsion>\n"
+    "</fdm_config>\n";
+
+////////////////////////////////////////////////////////////////////////////////
+
+// ballasts lie on the fuselage axis, so the products of inertia about the CG
+// are zero as well
+const char *TestSimModelImporter::yaSim =
+    "<?xml version=\"1.0\"?>\n"
+    "<airplane mass=\"1800\">\n"
+    "  <approach speed=\"60\" aoa=\"6\"/>\n"
+    "  <cruise speed=\"110\" alt=\"8000\"/>\n"
+    "  <fuselage ax=\"2.5\" ay=\"0\" az=\"0\" bx=\"-5.5\" by=\"0\" bz=\"0\" width=\"1.1\"/>\n"
+    "  <wing x=\"0\" y=\"0.6\" z=\"0.6\" length=\"5.2\" chord=\"1.6\" taper=\"0.7\" sweep=\"0\"/>\n"
+    "  <hstab x=\"-4.8\" y=\"0.1\" z=\"0.1\" length=\"1.7\" chord=\"1.0\" taper=\"0.8\"/>\n"
+    "  <vstab x=\"-5.0\" y=\"0\" z=\"0.2\" length=\"1.4\" chord=\"1.2\" taper=\"0.6\" sweep=\"30\"/>\n"
+    "  <tank x=\"0.1\" y=\"1.5\" z=\"0.6\" capacity=\"120\"/>\n"
+    "  <tank x=\"0.1\" y=\"-1.5\" z=\"0.6\" capacity=\"120\"/>\n"
+    "  <gear x=\"1.8\" y=\"0\" z=\"-1.2\" compression=\"0.2\"/>\n"
+    "  <gear x=\"-0.3\" y=\"1.3\" z=\"-1.1\" compression=\"0.2\"/>\n"
+    "  <gear x=\"-0.3\" y=\"-1.3\" z=\"-1.1\" compression=\"0.2\"/>\n"
+    "  <ballast x=\"2.0\" y=\"0\" z=\"0\" mass=\"60\"/>\n"
+    "  <ballast x=\"-4.5\" y=\"0\" z=\"0\" mass=\"20\"/>\n"
+    "</airplane>\n";
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestSimModelImporter, CanReadJsbSim)
+{
+    mc::Aircraft aircraft;
+    ASSERT_TRUE( read( jsbSim, &aircraft ) );
+
+    const mc::AircraftData *data = aircraft.getData();
+
+    EXPECT_NEAR( data->wing.area, mc::Units::sqft2sqm( 174.0 ), 1.0e-9 );
+    EXPECT_NEAR( data->wing.span, mc::Units::ft2m( 35.8 ), 1.0e-9 );
+    EXPECT_NEAR( data->wing.fuel, mc::Units::lb2kg( 300.0 ), 1.0e-9 );
+
+    EXPECT_NEAR( data->general.m_empty, mc::Units::lb2kg( 1500.0 ), 1.0e-9 );
+    EXPECT_NEAR( data->general.mtow, mc::Units::lb2kg( 1500.0 + 400.0 + 320.0 ), 1.0e-9 );
+
+    // structure contact is not a gear
+    EXPECT_EQ( data->landing_gear.nose_wheels, 1 );
+    EXPECT_EQ( data->landing_gear.main_wheels, 2 );
+    EXPECT_TRUE( data->landing_gear.fixed );
+
+    ASSERT_EQ( aircraft.getComponents().size(), 4u );
+    EXPECT_STREQ( aircraft.getComponents()[ 0 ]->getName(), "Empty Mass" );
+    EXPECT_STREQ( aircraft.getComponents()[ 3 ]->getName(), "Baggage" );
+
+    const double m = mc::Units::lb2kg( 1900.0 );
+    const double x = ( 1500.0 * 41.0 + 180.0 * 36.0 + 170.0 * 70.0 + 50.0 * 95.0 ) / 1900.0;
+    const double z = 36.5;
+
+    EXPECT_NEAR( aircraft.getMassTotal(), m, 1.0e-9 );
+    EXPECT_NEAR( aircraft.getCenterOfMass().x(), -mc::Units::in2m( x ), 1.0e-9 );
+    EXPECT_NEAR( aircraft.getCenterOfMass().y(), 0.0, 1.0e-9 );
+    EXPECT_NEAR( aircraft.getCenterOfMass().z(), -mc::Units::in2m( z ), 1.0e-9 );
+
+    // about the reference point, all masses are at the same height
+    const double ixx = 948.0 * mc::MassBalanceWriter::slugFt2 + m * pow( mc::Units::in2m( z ), 2.0 );
+    EXPECT_NEAR( aircraft.getInertiaMatrix().xx(), ixx, 1.0e-9 * ixx );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestSimModelImporter, CanReadYaSim)
+{
+    mc::Aircraft aircraft;
+    ASSERT_TRUE( read( yaSim, &aircraft ) );
+
+    const mc::AircraftData *data = aircraft.getData();
+
+    EXPECT_NEAR( data->fuselage.l, 8.0, 1.0e-9 );
+    EXPECT_NEAR( data->wing.span, 10.4, 1.0e-9 );
+    EXPECT_NEAR( data->wing.area, 0.5 * 10.4 * ( 1.6 + 1.6 * 0.7 ), 1.0e-9 );
+    EXPECT_NEAR( data->wing.fuel, mc::Units::lb2kg( 240.0 ), 1.0e-9 );
+    EXPECT_NEAR( data->hor_tail.arm, 4.8, 1.0e-9 );
+    EXPECT_NEAR( data->ver_tail.height, 1.4, 1.0e-9 );
+
+    EXPECT_NEAR( data->general.m_empty, mc::Units::lb2kg( 1800.0 ), 1.0e-9 );
+    EXPECT_NEAR( data->general.mtow, mc::Units::lb2kg( 2040.0 ), 1.0e-9 );
+
+    EXPECT_EQ( data->landing_gear.nose_wheels, 1 );
+    EXPECT_EQ( data->landing_gear.main_wheels, 2 );
+
+    // ballasts are part of the empty mass
+    ASSERT_EQ( aircraft.getComponents().size(), 3u );
+    EXPECT_STREQ( aircraft.getComponents()[ 0 ]->getName(), "Empty Mass" );
+    EXPECT_STREQ( aircraft.getComponents()[ 2 ]->getName(), "Ballast 2" );
+    EXPECT_NEAR( aircraft.getComponents()[ 0 ]->getMass(), mc::Units::lb2kg( 1720.0 ), 1.0e-9 );
+
+    EXPECT_NEAR( aircraft.getMassTotal(), mc::Units::lb2kg( 1800.0 ), 1.0e-9 );
+    EXPECT_NEAR( aircraft.getCenterOfMass().x(), ( 60.0 * 2.0 - 20.0 * 4.5 ) / 1800.0, 1.0e-9 );
+    EXPECT_NEAR( aircraft.getCenterOfMass().z(), 0.0, 1.0e-9 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestSimModelImporter, CanReadExported)
+{
+    for ( const char *content : { jsbSim, yaSim } )
+    {
+        mc::Aircraft aircraft;
+        ASSERT_TRUE( read( content, &aircraft ) );
+
+        // whole aircraft as empty weight
+        mc::Aircraft exported;
+        ASSERT_TRUE( readExported( aircraft, false, &exported ) );
+
+        EXPECT_EQ( exported.getComponents().size(), 1u );
+
+        expectSameMass( exported, aircraft );
+        expectSameInertia( exported, aircraft );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestSimModelImporter, CanReadExportedPointMasses)
+{
+    mc::PointMasses points;
+    points.add( 1, 25.0, mc::Vector3(  1.0,  0.5, -0.2 ) );
+    points.add( 2, 15.0, mc::Vector3( -2.0, -0.5,  0.3 ) );
+
+    for ( bool cad : { false, true } )
+    {
+        mc::Aircraft aircraft;
+        ASSERT_TRUE( read( jsbSim, &aircraft ) );
+
+        if ( cad ) aircraft.setPointMasses( points, "points.csv" );
+
+        // components as pointmasses, their inertia is not imported
+        mc::Aircraft exported;
+        ASSERT_TRUE( readExported( aircraft, true, &exported ) );
+
+        ASSERT_EQ( exported.getComponents().size(), aircraft.getComponents().size() + 1 );
+
+        EXPECT_NEAR( exported.getComponents()[ 0 ]->getMass(), cad ? 40.0 : 0.0, 1.0e-4 );
+
+        for ( size_t i = 0; i < aircraft.getComponents().size(); ++i )
+        {
+            const mc::Component *c_a = exported.getComponents()[ i + 1 ];
+            const mc::Component *c_e = aircraft.getComponents()[ i ];
+
+            EXPECT_STREQ( c_a->getName(), c_e->getName() );
+            expectNear( c_a->getMass(), c_e->getMass() );
+        }
+
+        expectSameMass( exported, aircraft );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestSimModelImporter, CanRejectInvalid)
+{
+    mc::Aircraft aircraft;
+
+    EXPECT_FALSE( read( "not xml", &aircraft ) );
+    EXPECT_FALSE( read( "<fdm_config><metrics/></fdm_config>", &aircraft ) );
+    EXPECT_FALSE( read( "<airplane mass=\"1000\"/>", &aircraft ) );
+    EXPECT_FALSE( read( "<aircraft/>", &aircraft ) );
+}
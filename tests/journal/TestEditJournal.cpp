@@ -0,0 +1,328 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <Aircraft.h>
+#include <AircraftDataFields.h>
+
+#include <components/AllElse.h>
+#include <components/Assembly.h>
+
+#include <journal/EditJournal.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestEditJournal : public ::testing::Test
+{
+protected:
+    TestEditJournal() {}
+    virtual ~TestEditJournal() {}
+
+    void SetUp() override
+    {
+        _fileName = ::testing::TempDir() + "test_edit_journal.journal";
+        mc::EditJournal::remove( _fileName.c_str() );
+    }
+
+    void TearDown() override
+    {
+        mc::EditJournal::remove( _fileName.c_str() );
+    }
+
+    std::string _fileName;
+
+    /** Makes edit number i of the aircraft and records it. */
+    static void edit( int i, mc::Aircraft *aircraft, mc::EditJournal *journal )
+    {
+        const int count = static_cast< int >( aircraft->getComponents().size() );
+
+        if ( i % 4 == 0 || count < 2 )
+        {
+            mc::Component *component = new mc::AllElse( aircraft->getData() );
+            component->setName( ( "component_" + std::to_string( i ) ).c_str() );
+            component->setPosition( mc::Vector3( 0.1 * i, -0.2 * i, 0.3 ) );
+            component->setMass( 10.0 + i );
+            component->setLength( 1.0 );
+            component->setWidth( 0.5 );
+            component->setHeight( 0.25 );
+
+            aircraft->addComponent( component );
+            journal->componentAdded( *aircraft );
+        }
+        else if ( i % 4 == 1 )
+        {
+            int index = i % count;
+            aircraft->getComponent( index )->setMass( 100.0 + i );
+            aircraft->update();
+            journal->componentChanged( *aircraft, index );
+        }
+        else if ( i % 4 == 2 )
+        {
+            int index = mc::AircraftDataFields::getIndex( "general.mtow" );
+            mc::AircraftData data = *aircraft->getData();
+            mc::AircraftDataFields::setValue( data, index, 1000.0 + i );
+            aircraft->setData( data );
+            journal->dataChanged( *aircraft, index );
+        }
+        else
+        {
+            int index = i % count;
+            aircraft->delComponent( index );
+            journal->componentRemoved( *aircraft, index );
+        }
+    }
+
+    static void expectSame( const mc::Aircraft &actual, const mc::Aircraft &expected )
+    {
+        EXPECT_DOUBLE_EQ( actual.getData()->general.mtow, expected.getData()->general.mtow );
+
+        ASSERT_EQ( actual.getComponents().size(), expected.getComponents().size() );
+
+        for ( size_t i = 0; i < expected.getComponents().size(); ++i )
+        {
+            const mc::Component *c_a = actual.getComponents()[ i ];
+            const mc::Component *c_e = expected.getComponents()[ i ];
+
+            EXPECT_STREQ( c_a->getName(), c_e->getName() );
+            EXPECT_DOUBLE_EQ( c_a->getMass(), c_e->getMass() );
+            EXPECT_DOUBLE_EQ( c_a->getPosition().x(), c_e->getPosition().x() );
+            EXPECT_DOUBLE_EQ( c_a->getPosition().y(), c_e->getPosition().y() );
+        }
+
+        EXPECT_DOUBLE_EQ( actual.getMassTotal(), expected.getMassTotal() );
+        EXPECT_DOUBLE_EQ( actual.getCenterOfMass().x(), expected.getCenterOfMass().x() );
+    }
+
+    static std::string readFile( const std::string &fileName )
+    {
+        std::ifstream fs( fileName.c_str(), std::ios_base::in | std::ios_base::binary );
+        return std::string( std::istreambuf_iterator< char >( fs ), std::istreambuf_iterator< char >() );
+    }
+
+    static void writeFile( const std::string &fileName, const std::string &contents )
+    {
+        std::ofstream fs( fileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+        fs.write( contents.data(), contents.size() );
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEditJournal, CanRecover)
+{
+    mc::Aircraft aircraft;
+    mc::EditJournal journal;
+
+    ASSERT_TRUE( journal.open( _fileName.c_str(), aircraft, "aircraft.xml" ) );
+    EXPECT_TRUE( journal.wait() );
+    EXPECT_TRUE( mc::EditJournal::exists( _fileName.c_str() ) );
+
+    for ( int i = 0; i < 20; ++i ) edit( i, &aircraft, &journal );
+
+    // journal still open, as after application crash
+    mc::Aircraft recovered;
+    std::string aircraftFile;
+    ASSERT_TRUE( mc::EditJournal::recover( _fileName.c_str(), &recovered, &aircraftFile ) );
+
+    EXPECT_EQ( aircraftFile, "aircraft.xml" );
+    expectSame( recovered, aircraft );
+
+    journal.close();
+    mc::EditJournal::remove( _fileName.c_str() );
+    EXPECT_FALSE( mc::EditJournal::exists( _fileName.c_str() ) );
+    EXPECT_FALSE( mc::EditJournal::recover( _fileName.c_str(), &recovered ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEditJournal, CanRecoverTruncatedTail)
+{
+    mc::Aircraft aircraft;
+    mc::EditJournal journal;
+
+    ASSERT_TRUE( journal.open( _fileName.c_str(), aircraft, "" ) );
+    EXPECT_TRUE( journal.wait() );
+
+    for ( int i = 0; i < 10; ++i ) edit( i, &aircraft, &journal );
+
+    mc::Aircraft previous;
+    ASSERT_TRUE( mc::EditJournal::recover( _fileName.c_str(), &previous ) );
+    expectSame( previous, aircraft );
+
+    edit( 10, &aircraft, &journal );
+    journal.close();
+
+    // last record written partially
+    std::string contents = readFile( _fileName );
+    ASSERT_GT( contents.size(), 3u );
+    writeFile( _fileName, contents.substr( 0, contents.size() - 3 ) );
+
+    mc::Aircraft recovered;
+    ASSERT_TRUE( mc::EditJournal::recover( _fileName.c_str(), &recovered ) );
+    expectSame( recovered, previous );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEditJournal, CanRecoverWithBadChecksum)
+{
+    mc::Aircraft aircraft;
+    mc::EditJournal journal;
+
+    ASSERT_TRUE( journal.open( _fileName.c_str(), aircraft, "" ) );
+
+    std::vector< size_t > sizes;
+
+    for ( int i = 0; i < 10; ++i )
+    {
+        sizes.push_back( readFile( _fileName ).size() );
+
+        mc::Component *component = new mc::AllElse( aircraft.getData() );
+        component->setMass( 10.0 * ( i + 1 ) );
+        aircraft.addComponent( component );
+        journal.componentAdded( aircraft );
+    }
+
+    journal.close();
+
+    // corrupted byte in the payload of the 6th record, replaying stops there
+    // even though following records are valid
+    std::string contents = readFile( _fileName );
+    contents[ sizes[ 6 ] - 1 ] ^= 0x01;
+    writeFile( _fileName, contents );
+
+    mc::Aircraft recovered;
+    ASSERT_TRUE( mc::EditJournal::recover( _fileName.c_str(), &recovered ) );
+    ASSERT_EQ( recovered.getComponents().size(), 5u );
+    EXPECT_DOUBLE_EQ( recovered.getMassTotal(), 10.0 + 20.0 + 30.0 + 40.0 + 50.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEditJournal, CanRecoverAfterCompaction)
+{
+    mc::Aircraft aircraft;
+    mc::EditJournal journal;
+
+    // compacted every few records
+    journal.setCompactionSize( 512 );
+
+    ASSERT_TRUE( journal.open( _fileName.c_str(), aircraft, "aircraft.xml" ) );
+
+    for ( int i = 0; i < 200; ++i )
+    {
+        edit( i, &aircraft, &journal );
+
+        if ( i == 100 )
+        {
+            EXPECT_TRUE( journal.wait() );
+
+            // there are records following the compaction snapshot
+            mc::Aircraft recovered;
+            ASSERT_TRUE( mc::EditJournal::recover( _fileName.c_str(), &recovered ) );
+            expectSame( recovered, aircraft );
+        }
+    }
+
+    journal.close();
+
+    mc::Aircraft recovered;
+    std::string aircraftFile;
+    ASSERT_TRUE( mc::EditJournal::recover( _fileName.c_str(), &recovered, &aircraftFile ) );
+
+    EXPECT_EQ( aircraftFile, "aircraft.xml" );
+    expectSame( recovered, aircraft );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEditJournal, CanRecoverAssemblies)
+{
+    mc::Aircraft aircraft;
+    mc::EditJournal journal;
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        mc::Component *component = new mc::AllElse( aircraft.getData() );
+        component->setPosition( mc::Vector3( 1.0 * i, 0.5, 0.0 ) );
+        component->setMass( 10.0 * ( i + 1 ) );
+        aircraft.addComponent( component );
+    }
+
+    mc::Assembly *group = aircraft.getAssembly()->addAssembly( "group", mc::Vector3( 2.0, 0.0, 0.0 ) );
+    mc::Assembly *part  = group->addAssembly( "part", mc::Vector3( 0.0, 1.0, 0.0 ) );
+
+    group->addComponent( aircraft.getComponent( 1 ) );
+    part->addComponent( aircraft.getComponent( 2 ) );
+    part->addComponent( aircraft.getComponent( 3 ) );
+
+    aircraft.update();
+
+    ASSERT_TRUE( journal.open( _fileName.c_str(), aircraft, "aircraft.xml" ) );
+    EXPECT_TRUE( journal.wait() );
+
+    aircraft.getComponent( 2 )->setMass( 50.0 );
+    aircraft.update();
+    journal.componentChanged( aircraft, 2 );
+
+    mc::Aircraft recovered;
+    ASSERT_TRUE( mc::EditJournal::recover( _fileName.c_str(), &recovered ) );
+
+    expectSame( recovered, aircraft );
+
+    // assemblies are not flattened
+    ASSERT_EQ( recovered.getAssembly()->getAssemblies().size(), 1u );
+
+    const mc::Assembly *recoveredGroup = recovered.getAssembly()->getAssemblies()[ 0 ];
+    EXPECT_STREQ( recoveredGroup->getName(), "group" );
+    EXPECT_DOUBLE_EQ( recoveredGroup->getOrigin().x(), 2.0 );
+    ASSERT_EQ( recoveredGroup->getComponents().size(), 1u );
+    EXPECT_EQ( recoveredGroup->getComponents()[ 0 ], recovered.getComponents()[ 1 ] );
+
+    ASSERT_EQ( recoveredGroup->getAssemblies().size(), 1u );
+
+    const mc::Assembly *recoveredPart = recoveredGroup->getAssemblies()[ 0 ];
+    EXPECT_STREQ( recoveredPart->getName(), "part" );
+    EXPECT_DOUBLE_EQ( recoveredPart->getOrigin().y(), 1.0 );
+    ASSERT_EQ( recoveredPart->getComponents().size(), 2u );
+    EXPECT_EQ( recoveredPart->getComponents()[ 0 ], recovered.getComponents()[ 2 ] );
+    EXPECT_EQ( recoveredPart->getComponents()[ 1 ], recovered.getComponents()[ 3 ] );
+
+    recovered.refresh();
+
+    EXPECT_DOUBLE_EQ( recoveredPart->getMass(), 90.0 );
+    EXPECT_DOUBLE_EQ( recovered.getMassTotal(), aircraft.getMassTotal() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestEditJournal, CanLockOpenJournal)
+{
+    mc::Aircraft aircraft;
+    mc::EditJournal journal;
+
+    ASSERT_TRUE( journal.open( _fileName.c_str(), aircraft, "" ) );
+    EXPECT_TRUE( journal.wait() );
+
+    // journal of the running instance is neither recovered nor taken over
+    EXPECT_TRUE( mc::EditJournal::exists( _fileName.c_str() ) );
+    EXPECT_FALSE( mc::EditJournal::isOrphaned( _fileName.c_str() ) );
+
+    mc::EditJournal other;
+    EXPECT_FALSE( other.open( _fileName.c_str(), aircraft, "" ) );
+    EXPECT_FALSE( other.isOpen() );
+    EXPECT_TRUE( mc::EditJournal::exists( _fileName.c_str() ) );
+
+    // closed journal is kept and can be recovered
+    journal.close();
+    EXPECT_TRUE( mc::EditJournal::isOrphaned( _fileName.c_str() ) );
+    EXPECT_TRUE( other.open( _fileName.c_str(), aircraft, "" ) );
+
+    other.close();
+    mc::EditJournal::remove( _fileName.c_str() );
+    EXPECT_FALSE( mc::EditJournal::isOrphaned( _fileName.c_str() ) );
+}
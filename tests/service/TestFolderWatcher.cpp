@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <DataFile.h>
+
+#include <cache/ResultCache.h>
+
+#include <components/AllElse.h>
+
+#include <fleet/FleetDatabase.h>
+
+#include <service/FolderWatcher.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestFolderWatcher : public ::testing::Test
+{
+protected:
+    TestFolderWatcher() {}
+    virtual ~TestFolderWatcher() {}
+
+    void SetUp() override
+    {
+        // file system notifications need event loop
+        static int argc = 1;
+        static char arg0[] = "tests";
+        static char *argv[] = { arg0, nullptr };
+
+        // application is kept, it cannot be created again in the same process
+        if ( !QCoreApplication::instance() ) new QCoreApplication( argc, argv );
+
+        _dirName    = ::testing::TempDir() + "test_folder_watcher";
+        _outputFile = ::testing::TempDir() + "test_folder_watcher.json";
+
+        ASSERT_TRUE( QDir().mkpath( _dirName.c_str() ) );
+    }
+
+    void TearDown() override
+    {
+        for ( const std::string &fileName : _fileNames ) std::remove( fileName.c_str() );
+
+        std::remove( _outputFile.c_str() );
+    }
+
+    std::string _dirName;
+    std::string _outputFile;
+
+    std::vector< std::string > _fileNames;
+
+    std::string getFileName( const char *name )
+    {
+        std::string fileName = _dirName + "/" + name;
+        _fileNames.push_back( fileName );
+        return fileName;
+    }
+
+    /** Saves aircraft of two components, the second one of the given mass. */
+    static void saveAircraft( const std::string &fileName, double mass )
+    {
+        mc::DataFile dataFile;
+        mc::Aircraft *aircraft = dataFile.getAircraft();
+
+        mc::Component *c1 = new mc::AllElse( aircraft->getData() );
+        c1->setMass( 100.0 );
+        aircraft->addComponent( c1 );
+
+        mc::Component *c2 = new mc::AllElse( aircraft->getData() );
+        c2->setMass( mass );
+        aircraft->addComponent( c2 );
+
+        ASSERT_TRUE( dataFile.saveFile( fileName.c_str() ) );
+    }
+
+    /** Returns output file content, masses by file name. */
+    QJsonObject readOutput() const
+    {
+        std::ifstream fs( _outputFile.c_str(), std::ios_base::in | std::ios_base::binary );
+        std::string content( ( std::istreambuf_iterator< char >( fs ) ), std::istreambuf_iterator< char >() );
+
+        QJsonObject masses;
+
+        QJsonArray aircraft = QJsonDocument::fromJson( QByteArray( content.c_str() ) ).object()[ "aircraft" ].toArray();
+
+        for ( int i = 0; i < aircraft.size(); ++i )
+        {
+            QJsonObject item = aircraft[ i ].toObject();
+            masses[ QFileInfo( item[ "file" ].toString() ).fileName() ] = item[ "mass_empty" ];
+        }
+
+        return masses;
+    }
+
+    /** Processes events until condition is met or timeout. */
+    static bool waitFor( std::function< bool() > condition )
+    {
+        std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now()
+                                                      + std::chrono::seconds( 10 );
+
+        while ( !condition() && std::chrono::steady_clock::now() < timeout )
+        {
+            QCoreApplication::processEvents();
+            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+        }
+
+        return condition();
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFolderWatcher, CanSkipPublishingUnchanged)
+{
+    const std::string fileXml = getFileName( "aircraft.xml" );
+
+    saveAircraft( fileXml, 50.0 );
+
+    mc::FolderWatcher watcher;
+    watcher.setOutputFile( _outputFile.c_str() );
+
+    ASSERT_TRUE( watcher.addDirectory( _dirName.c_str() ) );
+    watcher.evaluateAll();
+
+    EXPECT_DOUBLE_EQ( readOutput()[ "aircraft.xml" ].toDouble(), 150.0 );
+
+    // nothing has changed, so output file is not written
+    {
+        std::ofstream fs( _outputFile.c_str(), std::ios_base::out | std::ios_base::trunc );
+        fs << "{}";
+    }
+
+    watcher.evaluateAll();
+    EXPECT_TRUE( readOutput().isEmpty() );
+
+    saveAircraft( fileXml, 125.5 );
+
+    watcher.evaluateAll();
+    EXPECT_DOUBLE_EQ( readOutput()[ "aircraft.xml" ].toDouble(), 225.5 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFolderWatcher, CanReevaluateModifiedFileOnce)
+{
+    const std::string fileXml = getFileName( "aircraft.xml" );
+
+    saveAircraft( fileXml, 50.0 );
+
+    mc::ResultCache cache;
+
+    mc::FolderWatcher watcher;
+    watcher.setOutputFile( _outputFile.c_str() );
+    watcher.setCache( &cache );
+    watcher.setDelay( 500 );
+
+    ASSERT_TRUE( watcher.addDirectory( _dirName.c_str() ) );
+    watcher.evaluateAll();
+
+    EXPECT_DOUBLE_EQ( readOutput()[ "aircraft.xml" ].toDouble(), 150.0 );
+    EXPECT_EQ( cache.getMisses(), 1 );
+
+    // several saves within the delay are evaluated once
+    saveAircraft( fileXml, 60.0 );
+    saveAircraft( fileXml, 70.0 );
+    saveAircraft( fileXml, 80.0 );
+
+    ASSERT_TRUE( waitFor( [ this ]() { return readOutput()[ "aircraft.xml" ].toDouble() == 180.0; } ) );
+
+    EXPECT_EQ( cache.getMisses(), 2 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFolderWatcher, CanDropRemovedFile)
+{
+    const std::string file1 = getFileName( "aircraft_1.xml" );
+    const std::string file2 = getFileName( "aircraft_2.xml" );
+    const std::string fileDb = ::testing::TempDir() + "test_folder_watcher.db";
+
+    saveAircraft( file1, 50.0 );
+    saveAircraft( file2, 60.0 );
+
+    mc::FleetDatabase database;
+    ASSERT_TRUE( database.open( fileDb.c_str() ) );
+
+    mc::FolderWatcher watcher;
+    watcher.setOutputFile( _outputFile.c_str() );
+    watcher.setDatabase( &database );
+    watcher.setDelay( 100 );
+
+    ASSERT_TRUE( watcher.addDirectory( _dirName.c_str() ) );
+    watcher.evaluateAll();
+
+    EXPECT_EQ( readOutput().size(), 2 );
+    EXPECT_EQ( database.getCount(), 2 );
+
+    std::remove( file2.c_str() );
+
+    ASSERT_TRUE( waitFor( [ this ]() { return readOutput().size() == 1; } ) );
+
+    EXPECT_DOUBLE_EQ( readOutput()[ "aircraft_1.xml" ].toDouble(), 150.0 );
+    EXPECT_EQ( database.getCount(), 1 );
+    EXPECT_LT( database.find( file2.c_str() ), 0 );
+
+    std::remove( fileDb.c_str() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestFolderWatcher, CanPickUpReplacedFile)
+{
+    const std::string fileXml  = getFileName( "aircraft.xml" );
+    const std::string fileTemp = ::testing::TempDir() + "test_folder_watcher_temp.xml";
+
+    saveAircraft( fileXml, 50.0 );
+
+    mc::FolderWatcher watcher;
+    watcher.setOutputFile( _outputFile.c_str() );
+    watcher.setDelay( 100 );
+
+    ASSERT_TRUE( watcher.addDirectory( _dirName.c_str() ) );
+    watcher.evaluateAll();
+
+    EXPECT_DOUBLE_EQ( readOutput()[ "aircraft.xml" ].toDouble(), 150.0 );
+
+    // saved as editors do, written to the temporary file and renamed
+    saveAircraft( fileTemp, 60.0 );
+    ASSERT_EQ( std::rename( fileTemp.c_str(), fileXml.c_str() ), 0 );
+
+    ASSERT_TRUE( waitFor( [ this ]() { return readOutput()[ "aircraft.xml" ].toDouble() == 160.0; } ) );
+
+    // replaced file is still watched
+    saveAircraft( fileTemp, 70.0 );
+    ASSERT_EQ( std::rename( fileTemp.c_str(), fileXml.c_str() ), 0 );
+
+    ASSERT_TRUE( waitFor( [ this ]() { return readOutput()[ "aircraft.xml" ].toDouble() == 170.0; } ) );
+}
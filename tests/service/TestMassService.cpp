@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <QCoreApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QLocalSocket>
+
+#ifdef _LINUX_
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+#include <DataFile.h>
+
+#include <components/AllElse.h>
+#include <components/Assembly.h>
+
+#include <service/MassService.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestMassService : public ::testing::Test
+{
+protected:
+    TestMassService() {}
+    virtual ~TestMassService() {}
+
+    void SetUp() override
+    {
+        _fileName = ::testing::TempDir() + "test_mass_service.xml";
+
+        mc::DataFile dataFile;
+        mc::Aircraft *aircraft = dataFile.getAircraft();
+
+        for ( int i = 0; i < 5; ++i )
+        {
+            mc::Component *component = new mc::AllElse( aircraft->getData() );
+            component->setName( ( "component_" + std::to_string( i ) ).c_str() );
+            component->setPosition( mc::Vector3( 1.0 - i, 0.1 * i, 0.2 ) );
+            component->setMass( 100.0 * ( i + 1 ) );
+            component->setLength( 1.0 );
+            component->setWidth( 0.5 );
+            component->setHeight( 0.5 );
+
+            aircraft->addComponent( component );
+        }
+
+        ASSERT_TRUE( dataFile.saveFile( _fileName.c_str() ) );
+    }
+
+    void TearDown() override
+    {
+        std::remove( _fileName.c_str() );
+    }
+
+    std::string _fileName;
+
+    static QJsonObject parse( const char *json )
+    {
+        return QJsonDocument::fromJson( QByteArray( json ) ).object();
+    }
+
+    QJsonObject load( mc::MassService *service, const char *model )
+    {
+        QJsonObject request;
+        request[ "cmd"   ] = "load";
+        request[ "model" ] = model;
+        request[ "file"  ] = _fileName.c_str();
+
+        return service->handle( request );
+    }
+
+    static double getMass( const QJsonObject &response )
+    {
+        return response[ "mass_empty" ].toDouble();
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestMassService, CanHandleRequests)
+{
+    mc::MassService service;
+
+    QJsonObject response = service.handle( parse( "{\"cmd\":\"load\",\"model\":\"c172\",\"file\":\"missing.xml\"}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Cannot read file." ) );
+
+    response = load( &service, "c172" );
+    ASSERT_TRUE( response[ "ok" ].toBool() );
+    EXPECT_DOUBLE_EQ( getMass( response ), 1500.0 );
+    EXPECT_EQ( response[ "components" ].toArray().size(), 5 );
+    EXPECT_EQ( response[ "inertia" ].toArray().size(), 9 );
+
+    response = service.handle( parse( "{\"cmd\":\"list\"}" ) );
+    ASSERT_EQ( response[ "models" ].toArray().size(), 1 );
+    EXPECT_EQ( response[ "models" ].toArray()[ 0 ].toString(), QString( "c172" ) );
+
+    // id is copied to the response
+    response = service.handle( parse( "{\"cmd\":\"get\",\"model\":\"c172\",\"id\":7}" ) );
+    EXPECT_TRUE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "id" ].toInt(), 7 );
+    EXPECT_DOUBLE_EQ( getMass( response ), 1500.0 );
+
+    response = service.handle( parse( "{\"cmd\":\"set\",\"model\":\"c172\",\"fields\":{\"general.mtow\":2400.0}}" ) );
+    EXPECT_TRUE( response[ "ok" ].toBool() );
+
+    // no field is changed if any is invalid
+    response = service.handle( parse( "{\"cmd\":\"set\",\"model\":\"c172\",\"fields\":{\"general.mtow\":1.0,\"none\":1.0}}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Invalid field: none" ) );
+
+    // values of other types are not taken as 0
+    response = service.handle( parse( "{\"cmd\":\"set\",\"model\":\"c172\",\"fields\":{\"general.mtow\":\"2400\"}}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Invalid field: general.mtow" ) );
+
+    response = service.handle( parse( "{\"cmd\":\"add_component\",\"model\":\"c172\",\"type\":\"all_else\","
+                                      "\"name\":\"cargo\",\"r\":[-2.0,0.0,0.0],\"m\":250.0}" ) );
+    ASSERT_TRUE( response[ "ok" ].toBool() );
+    ASSERT_EQ( response[ "components" ].toArray().size(), 6 );
+    EXPECT_EQ( response[ "components" ].toArray()[ 5 ].toObject()[ "name" ].toString(), QString( "cargo" ) );
+    EXPECT_DOUBLE_EQ( getMass( response ), 1750.0 );
+
+    response = service.handle( parse( "{\"cmd\":\"set_component\",\"model\":\"c172\",\"index\":5,\"m\":50.0}" ) );
+    EXPECT_TRUE( response[ "ok" ].toBool() );
+    EXPECT_DOUBLE_EQ( getMass( response ), 1550.0 );
+
+    response = service.handle( parse( "{\"cmd\":\"set_component\",\"model\":\"c172\",\"index\":5,\"r\":[1.0,2.0]}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Invalid component position." ) );
+
+    response = service.handle( parse( "{\"cmd\":\"set_component\",\"model\":\"c172\",\"index\":5,\"r\":[1.0,2.0,null]}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Invalid component position." ) );
+
+    response = service.handle( parse( "{\"cmd\":\"set_component\",\"model\":\"c172\",\"index\":5,\"name\":\"x\",\"m\":\"heavy\"}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Invalid field: m" ) );
+
+    // nothing is changed by the rejected request
+    response = service.handle( parse( "{\"cmd\":\"get\",\"model\":\"c172\"}" ) );
+    EXPECT_EQ( response[ "components" ].toArray()[ 5 ].toObject()[ "name" ].toString(), QString( "cargo" ) );
+    EXPECT_DOUBLE_EQ( getMass( response ), 1550.0 );
+
+    response = service.handle( parse( "{\"cmd\":\"add_component\",\"model\":\"c172\",\"type\":\"none\"}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Unknown component type." ) );
+
+    response = service.handle( parse( "{\"cmd\":\"del_component\",\"model\":\"c172\",\"index\":5}" ) );
+    EXPECT_TRUE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "components" ].toArray().size(), 5 );
+    EXPECT_DOUBLE_EQ( getMass( response ), 1500.0 );
+
+    response = service.handle( parse( "{\"cmd\":\"del_component\",\"model\":\"c172\",\"index\":5}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Invalid component index." ) );
+
+    response = service.handle( parse( "{\"cmd\":\"get\",\"model\":\"a320\"}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Unknown model." ) );
+
+    response = service.handle( parse( "{\"cmd\":\"fly\"}" ) );
+    EXPECT_FALSE( response[ "ok" ].toBool() );
+    EXPECT_EQ( response[ "error" ].toString(), QString( "Unknown command." ) );
+
+    response = service.handle( parse( "{\"cmd\":\"unload\",\"model\":\"c172\"}" ) );
+    EXPECT_TRUE( response[ "ok" ].toBool() );
+
+    response = service.handle( parse( "{\"cmd\":\"list\"}" ) );
+    EXPECT_TRUE( response[ "models" ].toArray().isEmpty() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestMassService, CanLoadAssembliesAndPointMasses)
+{
+    const std::string fileCsv = ::testing::TempDir() + "test_mass_service.csv";
+
+    {
+        std::ofstream fs( fileCsv.c_str() );
+        fs << "1,10.0,1.0,0.0,0.0\n";
+        fs << "2,20.0,2.0,0.0,0.0\n";
+    }
+
+    mc::DataFile dataFile;
+    ASSERT_TRUE( dataFile.readFile( _fileName.c_str() ) );
+
+    mc::Aircraft *aircraft = dataFile.getAircraft();
+    mc::Assembly *group = aircraft->getAssembly()->addAssembly( "group", mc::Vector3( 2.0, 0.0, 0.0 ) );
+    group->addComponent( aircraft->getComponent( 0 ) );
+    ASSERT_TRUE( aircraft->importPointMasses( fileCsv.c_str() ) );
+    aircraft->update();
+    ASSERT_TRUE( dataFile.saveFile( _fileName.c_str() ) );
+
+    mc::MassService service;
+
+    QJsonObject response = load( &service, "c172" );
+    ASSERT_TRUE( response[ "ok" ].toBool() );
+
+    // loaded model is the aircraft as read, not flattened
+    EXPECT_DOUBLE_EQ( getMass( response ), aircraft->getMassTotal() );
+    EXPECT_DOUBLE_EQ( getMass( response ), 1530.0 );
+    EXPECT_EQ( response[ "point_masses" ].toInt(), 2 );
+    EXPECT_NEAR( response[ "center_of_mass" ].toArray()[ 0 ].toDouble(),
+                 aircraft->getCenterOfMass().x(), 1.0e-9 );
+
+    std::remove( fileCsv.c_str() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef _LINUX_
+TEST_F(TestMassService, CanPublishToSharedMemory)
+{
+    const char *name = "/mc-mass-test-service.c172";
+
+    mc::MassService service;
+    service.setSharedMemoryPrefix( "/mc-mass-test-service" );
+
+    ASSERT_TRUE( load( &service, "c172" )[ "ok" ].toBool() );
+
+    int fd = shm_open( name, O_RDONLY, 0 );
+    ASSERT_GE( fd, 0 );
+
+    void *ptr = mmap( nullptr, sizeof(mc::SharedMassProperties), PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    ASSERT_NE( ptr, MAP_FAILED );
+
+    const mc::SharedMassProperties *shm = static_cast< const mc::SharedMassProperties* >( ptr );
+    mc::SharedMassProperties::Data data;
+
+    ASSERT_TRUE( mc::SharedMassProperties::read( shm, &data ) );
+    EXPECT_EQ( data.updates, 1u );
+    EXPECT_EQ( data.componentsCount, 5u );
+    EXPECT_EQ( data.componentsTotal, 5u );
+    EXPECT_DOUBLE_EQ( data.massTotal, 1500.0 );
+    EXPECT_STREQ( data.components[ 4 ].name, "component_4" );
+
+    // get does not publish, modifications do
+    service.handle( parse( "{\"cmd\":\"get\",\"model\":\"c172\"}" ) );
+    service.handle( parse( "{\"cmd\":\"set_component\",\"model\":\"c172\",\"index\":0,\"m\":200.0}" ) );
+
+    ASSERT_TRUE( mc::SharedMassProperties::read( shm, &data ) );
+    EXPECT_EQ( data.updates, 2u );
+    EXPECT_DOUBLE_EQ( data.massTotal, 1600.0 );
+    EXPECT_DOUBLE_EQ( data.components[ 0 ].mass, 200.0 );
+
+    munmap( ptr, sizeof(mc::SharedMassProperties) );
+
+    // segment is removed with the model
+    service.handle( parse( "{\"cmd\":\"unload\",\"model\":\"c172\"}" ) );
+    EXPECT_LT( shm_open( name, O_RDONLY, 0 ), 0 );
+}
+#endif // _LINUX_
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestMassService, CanAnswerOverLocalSocket)
+{
+    // local sockets need event loop
+    int argc = 1;
+    char arg0[] = "tests";
+    char *argv[] = { arg0, nullptr };
+
+    QCoreApplication *app = QCoreApplication::instance() ? nullptr : new QCoreApplication( argc, argv );
+
+    {
+        const QString name = "mc-mass-test-service";
+
+        mc::MassService service;
+        ASSERT_TRUE( service.listen( name ) );
+
+        QLocalSocket client;
+        client.connectToServer( name );
+        ASSERT_TRUE( client.waitForConnected( 1000 ) );
+
+        // pipelined requests, one of them invalid
+        std::string requests;
+        requests += "{\"cmd\":\"load\",\"model\":\"c172\",\"file\":\"" + _fileName + "\",\"id\":1}\n";
+        requests += "not json\n";
+        requests += "{\"cmd\":\"add_component\",\"model\":\"c172\",\"type\":\"all_else\",\"m\":250.0,\"id\":2}\n";
+        requests += "{\"cmd\":\"get\",\"model\":\"c172\",\"id\":3}\n";
+
+        client.write( requests.c_str() );
+        client.flush();
+
+        QList< QJsonObject > responses;
+
+        std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now()
+                                                      + std::chrono::seconds( 10 );
+
+        while ( responses.size() < 4 && std::chrono::steady_clock::now() < timeout )
+        {
+            QCoreApplication::processEvents();
+            client.waitForReadyRead( 10 );
+
+            while ( client.canReadLine() )
+            {
+                responses.append( QJsonDocument::fromJson( client.readLine() ).object() );
+            }
+        }
+
+        // answered in order
+        ASSERT_EQ( responses.size(), 4 );
+
+        EXPECT_TRUE( responses[ 0 ][ "ok" ].toBool() );
+        EXPECT_EQ( responses[ 0 ][ "id" ].toInt(), 1 );
+        EXPECT_DOUBLE_EQ( getMass( responses[ 0 ] ), 1500.0 );
+
+        EXPECT_FALSE( responses[ 1 ][ "ok" ].toBool() );
+        EXPECT_EQ( responses[ 1 ][ "error" ].toString(), QString( "Invalid request." ) );
+
+        EXPECT_TRUE( responses[ 2 ][ "ok" ].toBool() );
+        EXPECT_EQ( responses[ 2 ][ "id" ].toInt(), 2 );
+        EXPECT_DOUBLE_EQ( getMass( responses[ 2 ] ), 1750.0 );
+
+        EXPECT_TRUE( responses[ 3 ][ "ok" ].toBool() );
+        EXPECT_EQ( responses[ 3 ][ "id" ].toInt(), 3 );
+        EXPECT_DOUBLE_EQ( getMass( responses[ 3 ] ), 1750.0 );
+
+        client.disconnectFromServer();
+    }
+
+    delete app;
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#ifdef _LINUX_
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+#include <Aircraft.h>
+
+#include <components/AllElse.h>
+
+#include <service/SharedMemoryPublisher.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestSharedMemoryPublisher : public ::testing::Test
+{
+protected:
+    TestSharedMemoryPublisher() {}
+    virtual ~TestSharedMemoryPublisher() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static constexpr const char *name = "/mc-mass-test-publisher";
+
+#   ifdef _LINUX_
+    /** Maps segment read only, as reader process does. */
+    static const mc::SharedMassProperties* map()
+    {
+        int fd = shm_open( name, O_RDONLY, 0 );
+
+        if ( fd < 0 ) return nullptr;
+
+        void *ptr = mmap( nullptr, sizeof(mc::SharedMassProperties), PROT_READ, MAP_SHARED, fd, 0 );
+        close( fd );
+
+        return ptr == MAP_FAILED ? nullptr : static_cast< const mc::SharedMassProperties* >( ptr );
+    }
+
+    static void unmap( const mc::SharedMassProperties *shm )
+    {
+        munmap( const_cast< mc::SharedMassProperties* >( shm ), sizeof(mc::SharedMassProperties) );
+    }
+#   endif
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestSharedMemoryPublisher, CanRejectInconsistent)
+{
+    mc::SharedMassProperties shm;
+    mc::SharedMassProperties::Data data;
+
+    shm.magic   = 0;
+    shm.version = mc::SharedMassProperties::_version;
+    shm.sequence.store( 0 );
+
+    EXPECT_FALSE( mc::SharedMassProperties::read( &shm, &data ) );
+
+    shm.magic = mc::SharedMassProperties::_magic;
+    EXPECT_TRUE( mc::SharedMassProperties::read( &shm, &data ) );
+
+    // writer in progress
+    shm.sequence.store( 1 );
+    EXPECT_FALSE( mc::SharedMassProperties::read( &shm, &data, 10 ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef _LINUX_
+TEST_F(TestSharedMemoryPublisher, CanReadConsistentSnapshot)
+{
+    const int componentsCount = 10;
+    const int updates = 20000;
+
+    mc::Aircraft aircraft;
+
+    for ( int i = 0; i < componentsCount; ++i )
+    {
+        mc::Component *component = new mc::AllElse( aircraft.getData() );
+        component->setName( "component" );
+        component->setPosition( mc::Vector3( 0.1 * i, 0.0, 0.0 ) );
+        aircraft.addComponent( component );
+    }
+
+    mc::SharedMemoryPublisher publisher;
+    ASSERT_TRUE( publisher.open( name ) );
+
+    const mc::SharedMassProperties *shm = map();
+    ASSERT_NE( shm, nullptr );
+
+    std::atomic< bool > done( false );
+    std::atomic< int > reads( 0 );
+    std::atomic< int > inconsistent( 0 );
+
+    // every component mass is equal to the number of updates, so data of
+    // different updates cannot be mixed up unnoticed
+    std::thread reader( [ & ]()
+    {
+        mc::SharedMassProperties::Data data;
+        uint64_t last = 0;
+
+        while ( !done.load() )
+        {
+            if ( !mc::SharedMassProperties::read( shm, &data ) || data.updates == 0 ) continue;
+
+            bool valid = data.updates >= last
+                      && data.componentsCount == static_cast< uint32_t >( componentsCount )
+                      && data.massTotal == componentsCount * static_cast< double >( data.updates );
+
+            for ( uint32_t i = 0; i < data.componentsCount && i < static_cast< uint32_t >( componentsCount ); ++i )
+            {
+                valid = valid && data.components[ i ].mass == static_cast< double >( data.updates );
+            }
+
+            if ( !valid ) inconsistent++;
+
+            last = data.updates;
+            reads++;
+        }
+    });
+
+    for ( int i = 1; i <= updates; ++i )
+    {
+        for ( int j = 0; j < componentsCount; ++j ) aircraft.getComponent( j )->setMass( i );
+        aircraft.update();
+
+        publisher.publish( aircraft );
+    }
+
+    done.store( true );
+    reader.join();
+
+    EXPECT_GT( reads.load(), 0 );
+    EXPECT_EQ( inconsistent.load(), 0 );
+
+    mc::SharedMassProperties::Data data;
+    ASSERT_TRUE( mc::SharedMassProperties::read( shm, &data ) );
+    EXPECT_EQ( data.updates, static_cast< uint64_t >( updates ) );
+    EXPECT_DOUBLE_EQ( data.massTotal, componentsCount * static_cast< double >( updates ) );
+
+    unmap( shm );
+
+    // segment is removed on close
+    publisher.close();
+    EXPECT_FALSE( publisher.isOpen() );
+    EXPECT_EQ( map(), nullptr );
+}
+#endif // _LINUX_
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef _LINUX_
+TEST_F(TestSharedMemoryPublisher, CanReportTruncatedComponents)
+{
+    const int componentsCount = mc::SharedMassProperties::_maxComponents + 6;
+
+    mc::Aircraft aircraft;
+
+    for ( int i = 0; i < componentsCount; ++i )
+    {
+        mc::Component *component = new mc::AllElse( aircraft.getData() );
+        component->setMass( 1.0 );
+        aircraft.addComponent( component );
+    }
+
+    aircraft.update();
+
+    mc::SharedMemoryPublisher publisher;
+    ASSERT_TRUE( publisher.open( name ) );
+
+    const mc::SharedMassProperties *shm = map();
+    ASSERT_NE( shm, nullptr );
+
+    publisher.publish( aircraft );
+
+    // components over the limit are not published, but total mass includes them
+    mc::SharedMassProperties::Data data;
+    ASSERT_TRUE( mc::SharedMassProperties::read( shm, &data ) );
+    EXPECT_EQ( data.componentsCount, static_cast< uint32_t >( mc::SharedMassProperties::_maxComponents ) );
+    EXPECT_EQ( data.componentsTotal, static_cast< uint32_t >( componentsCount ) );
+    EXPECT_DOUBLE_EQ( data.massTotal, componentsCount );
+
+    unmap( shm );
+}
+#endif // _LINUX_
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <Aircraft.h>
+#include <AircraftDataFields.h>
+
+#include <fleet/FleetGenerator.h>
+
+#include <snapshot/AircraftSnapshot.h>
+#include <snapshot/SnapshotPublisher.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestAircraftSnapshot : public ::testing::Test
+{
+protected:
+    TestAircraftSnapshot() {}
+    virtual ~TestAircraftSnapshot() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static double getComponentsMass( const mc::AircraftSnapshot &snapshot )
+    {
+        double mass = 0.0;
+
+        for ( size_t i = 0; i < snapshot.getComponentsCount(); ++i )
+        {
+            mass += snapshot.getComponent( i ).data.m;
+        }
+
+        for ( size_t i = 0; i < snapshot.getPointMasses().getCount(); ++i )
+        {
+            mass += snapshot.getPointMasses().getMass( i );
+        }
+
+        return mass;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftSnapshot, CanShareUnchangedParts)
+{
+    mc::FleetGenerator generator( 11 );
+    generator.setComponentsCount( 100 );
+
+    mc::Aircraft aircraft;
+    generator.generate( 0, &aircraft );
+
+    mc::PointMasses points;
+    points.add( 1, 10.0, mc::Vector3( 1.0, 2.0, 3.0 ) );
+    aircraft.setPointMasses( points, "points.csv" );
+
+    mc::AircraftSnapshot::Pointer s1 = mc::AircraftSnapshot::create( aircraft, 1 );
+
+    aircraft.getComponent( 5 )->setMass( aircraft.getComponent( 5 )->getMass() + 1.0 );
+    aircraft.update();
+
+    mc::AircraftSnapshot::Pointer s2 = mc::AircraftSnapshot::create( aircraft, 2, s1.get() );
+
+    EXPECT_EQ( s2->getVersion(), 2u );
+    EXPECT_EQ( &s2->getData(), &s1->getData() );
+    EXPECT_EQ( &s2->getPointMasses(), &s1->getPointMasses() );
+    EXPECT_EQ( &s2->getComponent( 0 ), &s1->getComponent( 0 ) );
+    EXPECT_NE( &s2->getComponent( 5 ), &s1->getComponent( 5 ) );
+
+    EXPECT_EQ( s2->getComponent( 5 ).data.m, s1->getComponent( 5 ).data.m + 1.0 );
+    EXPECT_DOUBLE_EQ( s2->getMassTotal(), s1->getMassTotal() + 1.0 );
+    EXPECT_DOUBLE_EQ( s1->getMassTotal(), getComponentsMass( *s1 ) );
+
+    // changed data is copied, previous snapshots keep their own
+    mc::AircraftData data = *aircraft.getData();
+    mc::AircraftDataFields::setValue( data, mc::AircraftDataFields::getIndex( "general.mtow" ),
+                                      1.1 * data.general.mtow );
+    aircraft.setData( data );
+
+    mc::AircraftSnapshot::Pointer s3 = mc::AircraftSnapshot::create( aircraft, 3, s2.get() );
+
+    EXPECT_NE( &s3->getData(), &s2->getData() );
+    EXPECT_EQ( s3->getData().general.mtow, data.general.mtow );
+    EXPECT_EQ( s2->getData().general.mtow, s1->getData().general.mtow );
+
+    // copy back
+    mc::Aircraft copy;
+    s3->copyTo( &copy );
+
+    EXPECT_EQ( copy.getComponents().size(), aircraft.getComponents().size() );
+    EXPECT_EQ( copy.getPointMasses().getCount(), 1u );
+    EXPECT_DOUBLE_EQ( copy.getMassTotal(), aircraft.getMassTotal() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestAircraftSnapshot, CanReadWhileEditing)
+{
+    const int edits = 500;
+    const int readers = 3;
+
+    mc::FleetGenerator generator( 12 );
+    generator.setComponentsCount( 200 );
+
+    mc::Aircraft aircraft;
+    generator.generate( 1, &aircraft );
+
+    mc::SnapshotPublisher publisher;
+    EXPECT_EQ( publisher.acquire(), nullptr );
+    publisher.publish( aircraft );
+
+    std::atomic< bool > done( false );
+    std::atomic< int > errors( 0 );
+    std::atomic< int > reads( 0 );
+
+    std::vector< std::thread > threads;
+
+    for ( int i = 0; i < readers; ++i )
+    {
+        threads.push_back( std::thread( [ & ]()
+        {
+            uint64_t last = 0;
+
+            while ( !done )
+            {
+                mc::AircraftSnapshot::Pointer snapshot = publisher.acquire();
+
+                // versions never go back and every snapshot is consistent
+                if ( snapshot->getVersion() < last ) errors++;
+                last = snapshot->getVersion();
+
+                double mass = getComponentsMass( *snapshot );
+
+                if ( fabs( mass - snapshot->getMassTotal() ) > 1.0e-9 * mass ) errors++;
+
+                reads++;
+            }
+        }));
+    }
+
+    for ( int i = 1; i <= edits; ++i )
+    {
+        mc::Component *component = aircraft.getComponent( i % aircraft.getComponents().size() );
+        component->setMass( component->getMass() + 0.5 );
+        aircraft.update();
+
+        publisher.publish( aircraft );
+    }
+
+    done = true;
+
+    for ( std::thread &thread : threads ) thread.join();
+
+    EXPECT_EQ( errors.load(), 0 );
+    EXPECT_GT( reads.load(), 0 );
+    mc::AircraftSnapshot::Pointer current = publisher.acquire();
+
+    // initial snapshot is version 1
+    EXPECT_EQ( current->getVersion(), static_cast< uint64_t >( edits + 1 ) );
+    EXPECT_DOUBLE_EQ( current->getMassTotal(), aircraft.getMassTotal() );
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <utils/BoundedQueue.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestBoundedQueue : public ::testing::Test
+{
+protected:
+    TestBoundedQueue() {}
+    virtual ~TestBoundedQueue() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestBoundedQueue, CanPassItemsInOrder)
+{
+    mc::BoundedQueue< int > queue( 4 );
+
+    std::thread producer( [ &queue ]()
+    {
+        for ( int i = 0; i < 1000; ++i ) queue.push( i );
+        queue.close();
+    });
+
+    int item = 0;
+    int expected = 0;
+
+    while ( queue.pop( &item ) )
+    {
+        EXPECT_EQ( item, expected );
+        expected++;
+    }
+
+    producer.join();
+
+    EXPECT_EQ( expected, 1000 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestBoundedQueue, CannotPushWhenClosed)
+{
+    mc::BoundedQueue< int > queue( 1 );
+
+    EXPECT_TRUE( queue.push( 1 ) );
+
+    queue.close();
+
+    EXPECT_FALSE( queue.push( 2 ) );
+
+    int item = 0;
+    EXPECT_TRUE( queue.pop( &item ) );
+    EXPECT_EQ( item, 1 );
+    EXPECT_FALSE( queue.pop( &item ) );
+}
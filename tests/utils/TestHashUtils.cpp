@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <utils/HashUtils.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestHashUtils : public ::testing::Test
+{
+protected:
+    TestHashUtils() {}
+    virtual ~TestHashUtils() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestHashUtils, CanHashBytes)
+{
+    EXPECT_EQ( mc::HashUtils::hash( "", 0 ), 0xcbf29ce484222325ULL );
+    EXPECT_EQ( mc::HashUtils::hash( "a", 1 ), 0xaf63dc4c8601ec8cULL );
+    EXPECT_EQ( mc::HashUtils::hash( "foobar", 6 ), 0x85944171f73967e8ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestHashUtils, CanChainHashes)
+{
+    uint64_t h = mc::HashUtils::hash( "foo", 3 );
+    h = mc::HashUtils::hash( "bar", 3, h );
+
+    EXPECT_EQ( h, mc::HashUtils::hash( "foobar", 6 ) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestHashUtils, CanHashZeroRegardlessOfSign)
+{
+    EXPECT_EQ( mc::HashUtils::hash( 0.0 ), mc::HashUtils::hash( -0.0 ) );
+    EXPECT_NE( mc::HashUtils::hash( 1.0 ), mc::HashUtils::hash( -1.0 ) );
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <mcutil/physics/Physics.h>
+
+#include <utils/Cuboid.h>
+#include <utils/InertiaTensor.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestInertiaTensor : public ::testing::Test
+{
+protected:
+    TestInertiaTensor() {}
+    virtual ~TestInertiaTensor() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestInertiaTensor, CanInstantiate)
+{
+    mc::InertiaTensor i;
+
+    EXPECT_DOUBLE_EQ( i.xx(), 0.0 );
+    EXPECT_DOUBLE_EQ( i.yy(), 0.0 );
+    EXPECT_DOUBLE_EQ( i.zz(), 0.0 );
+    EXPECT_DOUBLE_EQ( i.xy(), 0.0 );
+    EXPECT_DOUBLE_EQ( i.xz(), 0.0 );
+    EXPECT_DOUBLE_EQ( i.yz(), 0.0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestInertiaTensor, CanGetCuboid)
+{
+    const double m = 120.0;
+    const double l = 1.5;
+    const double w = 0.8;
+    const double h = 0.4;
+
+    mc::Vector3 r( 2.0, -1.0, 0.5 );
+
+    mc::Matrix3x3 i0 = mc::Physics::parallelAxisInertia( m, mc::Cuboid::getInertia( m, l, w, h ), r );
+    mc::Matrix3x3 i1 = mc::InertiaTensor::getCuboid( m, l, w, h, r ).getMatrix();
+
+    EXPECT_NEAR( i1.xx(), i0.xx(), 1.0e-9 );
+    EXPECT_NEAR( i1.xy(), i0.xy(), 1.0e-9 );
+    EXPECT_NEAR( i1.xz(), i0.xz(), 1.0e-9 );
+
+    EXPECT_NEAR( i1.yx(), i0.yx(), 1.0e-9 );
+    EXPECT_NEAR( i1.yy(), i0.yy(), 1.0e-9 );
+    EXPECT_NEAR( i1.yz(), i0.yz(), 1.0e-9 );
+
+    EXPECT_NEAR( i1.zx(), i0.zx(), 1.0e-9 );
+    EXPECT_NEAR( i1.zy(), i0.zy(), 1.0e-9 );
+    EXPECT_NEAR( i1.zz(), i0.zz(), 1.0e-9 );
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+
+#include <utils/MassKernels.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestMassKernels : public ::testing::Test
+{
+protected:
+    TestMassKernels() {}
+    virtual ~TestMassKernels() {}
+    void SetUp() override {}
+    void TearDown() override { mc::MassKernels::setAvx2Enabled( true ); }
+
+    static void fill( mc::MassKernels::Cuboids *cuboids, int count )
+    {
+        for ( int i = 0; i < count; ++i )
+        {
+            double t = static_cast< double >( i );
+
+            cuboids->add( 1.0 + fmod( 7.3 * t, 11.0 ),
+                          fmod( 1.7 * t, 3.0 ), fmod( 2.3 * t, 5.0 ), fmod( 0.7 * t, 2.0 ),
+                          mc::Vector3( fmod( 3.1 * t, 20.0 ) - 10.0,
+                                       fmod( 1.3 * t, 8.0 ) - 4.0,
+                                       fmod( 0.9 * t, 3.0 ) - 1.5 ) );
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestMassKernels, CanSumCuboids)
+{
+    mc::MassKernels::Cuboids cuboids;
+    fill( &cuboids, 1003 );
+
+    mc::MassKernels::Arrays a = cuboids.getArrays();
+
+    mc::MassSums expected;
+
+    for ( size_t i = 0; i < cuboids.getCount(); ++i )
+    {
+        expected.add( a.m[ i ], a.l[ i ], a.w[ i ], a.h[ i ], mc::Vector3( a.x[ i ], a.y[ i ], a.z[ i ] ) );
+    }
+
+    mc::MassSums sums;
+    mc::MassKernels::sum( a, 0, cuboids.getCount(), &sums );
+
+    EXPECT_NEAR( sums.getMass(), expected.getMass(), 1.0e-12 * expected.getMass() );
+
+    EXPECT_NEAR( sums.getFirstMoment().x(), expected.getFirstMoment().x(), 1.0e-9 );
+    EXPECT_NEAR( sums.getFirstMoment().y(), expected.getFirstMoment().y(), 1.0e-9 );
+    EXPECT_NEAR( sums.getFirstMoment().z(), expected.getFirstMoment().z(), 1.0e-9 );
+
+    EXPECT_NEAR( sums.getInertia().xx(), expected.getInertia().xx(), 1.0e-8 );
+    EXPECT_NEAR( sums.getInertia().yy(), expected.getInertia().yy(), 1.0e-8 );
+    EXPECT_NEAR( sums.getInertia().zz(), expected.getInertia().zz(), 1.0e-8 );
+    EXPECT_NEAR( sums.getInertia().xy(), expected.getInertia().xy(), 1.0e-8 );
+    EXPECT_NEAR( sums.getInertia().xz(), expected.getInertia().xz(), 1.0e-8 );
+    EXPECT_NEAR( sums.getInertia().yz(), expected.getInertia().yz(), 1.0e-8 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestMassKernels, CanSumPointMassesWithInertia)
+{
+    double m[] = { 2.0, 3.0, 4.0, 5.0, 6.0 };
+    double x[] = { 1.0, -1.0, 0.0, 2.0, 0.5 };
+    double y[] = { 0.0, 2.0, -1.0, 1.0, 0.5 };
+    double z[] = { 1.0, 0.0, 3.0, -2.0, 0.5 };
+
+    double i[] = { 0.1, 0.2, 0.3, 0.4, 0.5 };
+
+    mc::MassKernels::Arrays a;
+
+    a.m = m; a.x = x; a.y = y; a.z = z;
+    a.i_xx = i; a.i_yy = i; a.i_zz = i; a.i_xy = i; a.i_xz = i; a.i_yz = i;
+
+    mc::MassSums sums;
+    mc::MassKernels::sum( a, 1, 5, &sums );
+
+    double i_xx = 0.0;
+    double i_xy = 0.0;
+
+    for ( int j = 1; j < 5; ++j )
+    {
+        i_xx += m[ j ] * ( y[ j ] * y[ j ] + z[ j ] * z[ j ] ) + i[ j ];
+        i_xy += -m[ j ] * x[ j ] * y[ j ] + i[ j ];
+    }
+
+    EXPECT_DOUBLE_EQ( sums.getMass(), 18.0 );
+    EXPECT_DOUBLE_EQ( sums.getInertia().xx(), i_xx );
+    EXPECT_DOUBLE_EQ( sums.getInertia().xy(), i_xy );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestMassKernels, CanGiveSameResultsWithAndWithoutAvx2)
+{
+    if ( !mc::MassKernels::isAvx2Supported() )
+    {
+        GTEST_SKIP() << "AVX2 is not supported";
+    }
+
+    mc::MassKernels::Cuboids cuboids;
+    fill( &cuboids, 1003 );
+
+    mc::MassSums sums1;
+    mc::MassSums sums2;
+
+    mc::MassKernels::setAvx2Enabled( true );
+    EXPECT_TRUE( mc::MassKernels::isAvx2Enabled() );
+    mc::MassKernels::sum( cuboids.getArrays(), 3, cuboids.getCount(), &sums1 );
+
+    mc::MassKernels::setAvx2Enabled( false );
+    EXPECT_FALSE( mc::MassKernels::isAvx2Enabled() );
+    mc::MassKernels::sum( cuboids.getArrays(), 3, cuboids.getCount(), &sums2 );
+
+    double i1[] = { sums1.getMass(), sums1.getInertia().xx(), sums1.getInertia().xy(), sums1.getInertia().yz() };
+    double i2[] = { sums2.getMass(), sums2.getInertia().xx(), sums2.getInertia().xy(), sums2.getInertia().yz() };
+
+    // bitwise identical
+    EXPECT_EQ( memcmp( i1, i2, sizeof( i1 ) ), 0 );
+}
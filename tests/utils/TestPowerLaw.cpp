@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <utils/PowerLaw.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestPowerLaw : public ::testing::Test
+{
+protected:
+    TestPowerLaw() {}
+    virtual ~TestPowerLaw() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPowerLaw, CanComputeConstexprPow)
+{
+    static_assert( mc::ConstexprMath::pow( 2.0, 10.0 ) == 1024.0, "" );
+    static_assert( mc::ConstexprMath::pow( 2.0, -2.0 ) == 0.25, "" );
+
+    EXPECT_NEAR( mc::ConstexprMath::pow( 0.3048, -0.622 ), std::pow( 0.3048, -0.622 ), 1.0e-15 );
+    EXPECT_NEAR( mc::ConstexprMath::pow( 1000.0, -0.4908 ), std::pow( 1000.0, -0.4908 ), 1.0e-15 );
+    EXPECT_NEAR( mc::ConstexprMath::pow( 745.69987158227022, 0.78137 ),
+                 std::pow( 745.69987158227022, 0.78137 ), 1.0e-12 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPowerLaw, CanFoldUnitConversions)
+{
+    // W[lb] = 0.499 * W_dg[lb]^0.35 * N_z^0.25 * L[ft]^0.5
+    static constexpr mc::PowerLaw< mc::Unit::Pound, mc::Unit::Pound, mc::Unit::One, mc::Unit::Foot >
+        eq( 0.499, { 0.35, 0.25, 0.5 } );
+
+    double w_dg_lb = 20000.0;
+    double n_z     = 9.0;
+    double l_ft    = 50.0;
+
+    double w_lb = 0.499 * std::pow( w_dg_lb, 0.35 ) * std::pow( n_z, 0.25 ) * std::pow( l_ft, 0.5 );
+
+    mc::Mass w = eq( mc::makeQuantity< mc::Unit::Pound >( w_dg_lb ), n_z,
+                     mc::makeQuantity< mc::Unit::Foot  >( l_ft ) );
+
+    EXPECT_NEAR( w.getSI(), w_lb * 0.45359237, 1.0e-12 * w.getSI() );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestPowerLaw, CanDeriveQuantityTypes)
+{
+    mc::Length   l( 2.0 );
+    mc::Velocity v( 4.0 );
+    mc::Density  rho( 1.225 );
+
+    mc::Area     a = l * l;
+    mc::Pressure q = 0.5 * rho * v * v;
+    double       r = l / l;
+
+    EXPECT_DOUBLE_EQ( a.getSI(), 4.0 );
+    EXPECT_DOUBLE_EQ( q.getSI(), 9.8 );
+    EXPECT_DOUBLE_EQ( r, 1.0 );
+
+    mc::Pressure psf = mc::makeQuantity< mc::Unit::PoundPerSquareFoot >( 1.0 );
+
+    EXPECT_NEAR( psf.getSI(), 47.880258980335840, 1.0e-12 );
+}
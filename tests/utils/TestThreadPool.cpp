@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include <utils/MassSums.h>
+#include <utils/ThreadPool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestThreadPool : public ::testing::Test
+{
+protected:
+    TestThreadPool() {}
+    virtual ~TestThreadPool() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestThreadPool, CanRunEveryIndexOnce)
+{
+    mc::ThreadPool pool( 4 );
+
+    std::vector< std::atomic< int > > counts( 1000 );
+    for ( std::atomic< int > &count : counts ) count = 0;
+
+    for ( int run = 0; run < 10; ++run )
+    {
+        pool.run( static_cast< int >( counts.size() ), [ &counts ]( int index )
+        {
+            counts[ index ]++;
+        });
+    }
+
+    for ( const std::atomic< int > &count : counts )
+    {
+        EXPECT_EQ( count.load(), 10 );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestThreadPool, CanReduceIndependentlyOfThreadsCount)
+{
+    const int chunkSize = 1000;
+    const int chunks = 64;
+
+    std::vector< double > masses( chunkSize * chunks );
+    std::vector< mc::Vector3 > positions( chunkSize * chunks );
+
+    for ( size_t i = 0; i < masses.size(); ++i )
+    {
+        masses[ i ] = 1.0e-3 * ( 1 + i % 97 ) + ( i % 1000 == 0 ? 1.0e6 : 0.0 );
+        positions[ i ].set( 0.1 * ( i % 13 ), -0.3 * ( i % 7 ), 0.01 * ( i % 11 ) );
+    }
+
+    auto reduce = [ & ]( int threads )
+    {
+        mc::ThreadPool pool( threads );
+        std::vector< mc::MassSums > sums( chunks );
+
+        pool.run( chunks, [ & ]( int chunk )
+        {
+            for ( int i = chunk * chunkSize; i < ( chunk + 1 ) * chunkSize; ++i )
+            {
+                sums[ chunk ].add( masses[ i ], 0.1, 0.1, 0.1, positions[ i ] );
+            }
+        });
+
+        mc::MassSums total;
+        for ( const mc::MassSums &s : sums ) total.add( s );
+        return total;
+    };
+
+    mc::MassSums s1 = reduce( 1 );
+
+    for ( int threads = 2; threads <= 8; ++threads )
+    {
+        mc::MassSums sn = reduce( threads );
+
+        EXPECT_EQ( s1.getMass(), sn.getMass() );
+        EXPECT_EQ( s1.getFirstMoment().x(), sn.getFirstMoment().x() );
+        EXPECT_EQ( s1.getInertia().xx(), sn.getInertia().xx() );
+        EXPECT_EQ( s1.getInertia().xy(), sn.getInertia().xy() );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestThreadPool, CanRunNested)
+{
+    mc::ThreadPool pool( 4 );
+
+    std::vector< std::atomic< int > > counts( 64 * 64 );
+    for ( std::atomic< int > &count : counts ) count = 0;
+
+    pool.run( 64, [ &pool, &counts ]( int outer )
+    {
+        pool.run( 64, [ &counts, outer ]( int inner )
+        {
+            counts[ outer * 64 + inner ]++;
+        });
+    });
+
+    for ( const std::atomic< int > &count : counts )
+    {
+        EXPECT_EQ( count.load(), 1 );
+    }
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <Aircraft.h>
+#include <AircraftDataFields.h>
+
+#include <components/AllElse.h>
+#include <components/Wing.h>
+
+#include <fleet/FleetGenerator.h>
+
+#include <variants/VariantSet.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TestVariantSet : public ::testing::Test
+{
+protected:
+    TestVariantSet() {}
+    virtual ~TestVariantSet() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static void expectNear( double actual, double expected )
+    {
+        EXPECT_NEAR( actual, expected, 1.0e-9 * std::max( 1.0, std::fabs( expected ) ) );
+    }
+
+    static mc::ComponentData createComponent( const char *type, const char *name,
+                                              double m, double x )
+    {
+        mc::ComponentData data;
+
+        data.type = type;
+        data.name = name;
+        data.r = mc::Vector3( x, 0.5, -0.2 );
+        data.m = m;
+        data.l = 1.5;
+        data.w = 0.5;
+        data.h = 0.3;
+
+        return data;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestVariantSet, CanEvaluateAsApplied)
+{
+    const int componentsCount = 40;
+
+    mc::FleetGenerator generator( 13 );
+    generator.setComponentsCount( componentsCount );
+
+    mc::Aircraft base;
+    generator.generate( 0, &base );
+
+    const int mtow = mc::AircraftDataFields::getIndex( "general.mtow" );
+    const int area = mc::AircraftDataFields::getIndex( "wing.area" );
+
+    mc::VariantSet variants;
+
+    // unchanged
+    mc::AircraftVariant v0;
+    v0.name = "base";
+    variants.add( v0 );
+
+    // fields only
+    mc::AircraftVariant v1;
+    v1.name = "fields";
+    v1.fields[ mtow ] = 1.2 * base.getData()->general.mtow;
+    v1.fields[ area ] = 1.1 * base.getData()->wing.area;
+    variants.add( v1 );
+
+    // components replaced, removed and added
+    mc::AircraftVariant v2;
+    v2.name = "components";
+    mc::ComponentData replaced = base.getComponents()[ 5 ]->getComponentData();
+    replaced.m *= 1.5;
+    replaced.r = replaced.r + mc::Vector3( 0.3, 0.0, 0.0 );
+    v2.components[ 5 ] = replaced;
+    v2.removed.insert( 0 );
+    v2.removed.insert( 7 );
+    v2.removed.insert( componentsCount - 1 );
+    v2.added.push_back( createComponent( mc::AllElse::xmlTagName, "Extra Tank", 120.0, 2.0 ) );
+    v2.added.push_back( createComponent( mc::Wing::xmlTagName, "Extra Wing", 300.0, -1.0 ) );
+    variants.add( v2 );
+
+    // all at once
+    mc::AircraftVariant v3 = v2;
+    v3.name = "all";
+    v3.fields = v1.fields;
+    variants.add( v3 );
+
+    // not matching base aircraft
+    mc::AircraftVariant v4;
+    v4.name = "invalid";
+    v4.removed.insert( componentsCount );
+    variants.add( v4 );
+
+    mc::VariantSet::Results results = variants.evaluate( base );
+
+    ASSERT_EQ( results.size(), variants.getVariants().size() );
+
+    for ( int i = 0; i < static_cast< int >( results.size() ); ++i )
+    {
+        const mc::VariantSet::Result &result = results[ i ];
+
+        EXPECT_EQ( result.name, variants.getVariants()[ i ].name );
+
+        mc::Aircraft aircraft;
+        generator.generate( 0, &aircraft );
+
+        bool applied = variants.apply( i, &aircraft );
+
+        EXPECT_EQ( result.valid, applied );
+
+        if ( !applied ) continue;
+
+        // full update from scratch
+        aircraft.update();
+
+        expectNear( result.massTotal, aircraft.getMassTotal() );
+
+        expectNear( result.centerOfMass.x(), aircraft.getCenterOfMass().x() );
+        expectNear( result.centerOfMass.y(), aircraft.getCenterOfMass().y() );
+        expectNear( result.centerOfMass.z(), aircraft.getCenterOfMass().z() );
+
+        expectNear( result.inertiaMatrix.xx(), aircraft.getInertiaMatrix().xx() );
+        expectNear( result.inertiaMatrix.yy(), aircraft.getInertiaMatrix().yy() );
+        expectNear( result.inertiaMatrix.zz(), aircraft.getInertiaMatrix().zz() );
+        expectNear( result.inertiaMatrix.xy(), aircraft.getInertiaMatrix().xy() );
+        expectNear( result.inertiaMatrix.xz(), aircraft.getInertiaMatrix().xz() );
+        expectNear( result.inertiaMatrix.yz(), aircraft.getInertiaMatrix().yz() );
+
+        ASSERT_EQ( result.estimatedMasses.size(), aircraft.getComponents().size() );
+
+        for ( size_t j = 0; j < aircraft.getComponents().size(); ++j )
+        {
+            expectNear( result.estimatedMasses[ j ], aircraft.getComponents()[ j ]->getEstimatedMass() );
+        }
+    }
+
+    EXPECT_FALSE( results[ 4 ].valid );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TestVariantSet, CanApply)
+{
+    mc::FleetGenerator generator( 17 );
+    generator.setComponentsCount( 10 );
+
+    mc::Aircraft aircraft;
+    generator.generate( 0, &aircraft );
+
+    std::vector< std::string > names;
+
+    for ( const mc::Component *c : aircraft.getComponents() ) names.push_back( c->getName() );
+
+    mc::AircraftVariant variant;
+    variant.removed.insert( 1 );
+    variant.removed.insert( 2 );
+    variant.removed.insert( 8 );
+    variant.added.push_back( createComponent( mc::AllElse::xmlTagName, "Added", 50.0, 1.0 ) );
+
+    mc::VariantSet variants;
+    variants.add( variant );
+
+    ASSERT_TRUE( variants.apply( 0, &aircraft ) );
+    EXPECT_FALSE( variants.apply( 1, &aircraft ) );
+
+    // kept components in the base order followed by added ones
+    const std::vector< std::string > expected =
+    {
+        names[ 0 ], names[ 3 ], names[ 4 ], names[ 5 ], names[ 6 ], names[ 7 ], names[ 9 ], "Added"
+    };
+
+    ASSERT_EQ( aircraft.getComponents().size(), expected.size() );
+
+    for ( size_t i = 0; i < expected.size(); ++i )
+    {
+        EXPECT_EQ( aircraft.getComponents()[ i ]->getName(), expected[ i ] );
+    }
+
+    EXPECT_EQ( aircraft.getAssembly()->getComponents().size(), expected.size() );
+}